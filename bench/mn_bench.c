@@ -0,0 +1,984 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "mn_bench.h"
+
+/*
+mn_bench - micro benchmarks for the MATHNEON kernels.
+
+Usage:
+    mn_bench [mode] [count] [reps]
+
+    mode   - Benchmark to run, "all" runs every mode (default "all")
+    count  - Number of elements per array (default 4M, large enough to leave the caches)
+    reps   - Runs per case, the best time is reported (default 10)
+
+Modes:
+    prefetch - Sweeps the software prefetch distance used by the NEON main
+               loops and prints the best distance per kernel for this CPU.
+               The winner can be baked in with -DMN_PREFETCH_DISTANCE=<bytes>.
+    float64  - Compares the float64 NEON kernels with the scalar C versions.
+    matrix   - Batched 4x4 matrix multiply, vec4f transform and 4x4 / 3x3 inverse, NEON vs C.
+    sgemm    - Square mn_sgemm_neon (1 thread and all CPUs) against a naive triple
+               loop and mn_sgemm_c. count is the matrix size n here (default 512).
+    fir      - Streaming float / int16 FIR (8, 32 and 128 taps, decimation 1 and 4),
+               NEON vs C, in 4096-sample chunks.
+    complex  - cmul / cconjmul / cabs on interleaved mn_complexf_t arrays, NEON vs C.
+    fft      - Batched complex and real forward FFTs of 64 to 4096 points (and a
+               mixed-radix 960), NEON vs C. GFLOP/s counts 5 n log2(n) per complex
+               transform and half that per real one.
+    explog   - exp / log / pow on float arrays for every accuracy tier, NEON vs
+               the libm C loop. The GFLOP/s column counts elements here, so
+               1.00 means 1 ns per element.
+    trig     - sin / cos / sincos / tan on angles in [-100, 100] and atan2, NEON
+               vs the libm C loop; GFLOP/s counts elements as for explog.
+    sqrt     - sqrt / rsqrt / recip on float arrays for every accuracy tier (NEON
+               vs C); GFLOP/s counts elements as for explog.
+    activation - relu / sigmoid / tanh / gelu and softmax on float logits in
+               [-8, 8], NEON vs C; GFLOP/s counts elements as for explog.
+    norm     - meanvar and layernorm over the whole array and as rows of 768,
+               NEON vs C; GFLOP/s counts elements as for explog.
+    scan     - inclusive scans of float / int32 / vec3f arrays, NEON on one
+               thread and on every CPU vs C; GFLOP/s counts elements.
+    histogram - uint8 histograms of random and of flat-region bytes, int32
+               bincount and 1000-bin float histograms, NEON on one thread and
+               on every CPU vs C; GFLOP/s counts elements.
+    compact  - compactc on float arrays keeping about 10% and 50% of the
+               values, NEON vs C; GFLOP/s counts elements.
+    sort     - float / int32 sorts and the float kv sort of random data,
+               NEON vs C vs qsort; GFLOP/s counts elements.
+*/
+
+#define MN_BENCH_BEST(reps, best, stmt) \
+    do { \
+        best = 1e30; \
+        for (int rep_ = 0; rep_ < (reps); rep_++) { \
+            double t0_ = mn_bench_now(); \
+            stmt; \
+            double t1_ = mn_bench_now() - t0_; \
+            if (t1_ < best) best = t1_; \
+        } \
+    } while (0)
+
+typedef void (*mn_bench_mode_fn)(size_t count, int reps);
+
+typedef struct
+{
+    const char * name;
+    mn_bench_mode_fn run;
+} mn_bench_mode_t;
+
+static void * mn_bench_alloc (size_t bytes)
+{
+    void * ptr = malloc(bytes);
+    if (!ptr)
+    {
+        fprintf(stderr, "mn_bench: malloc of %zu bytes failed\n", bytes);
+        exit(1);
+    }
+    memset(ptr, 0, bytes);
+    return ptr;
+}
+
+/* ===== prefetch ===== */
+
+static void mn_bench_prefetch (size_t count, int reps)
+{
+    static const size_t distances[] = { 0, 64, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048 };
+    const size_t n_dist = sizeof(distances) / sizeof(distances[0]);
+    const char * names[] = { "add_float_neon", "mulc_float_neon", "abs_vec4f_neon" };
+    size_t best_dist[3] = { 0, 0, 0 };
+    double best_time[3] = { 1e30, 1e30, 1e30 };
+    size_t saved = mn_get_prefetch_distance();
+    char label[64];
+
+    mn_float32_t * src1 = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_float32_t * src2 = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_float32_t * dst  = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    size_t count_v4 = count / 4;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        src1[i] = (mn_float32_t)i * 0.5f;
+        src2[i] = (mn_float32_t)i * -0.25f;
+    }
+
+    mn_bench_header("prefetch distance sweep");
+    for (size_t d = 0; d < n_dist; d++)
+    {
+        double t;
+        mn_set_prefetch_distance(distances[d]);
+
+        MN_BENCH_BEST(reps, t, mn_add_float_neon(dst, src1, src2, count));
+        snprintf(label, sizeof(label), "%s @%zu", names[0], distances[d]);
+        mn_bench_report(label, t, 3.0 * sizeof(mn_float32_t) * count, (double)count);
+        if (t < best_time[0]) { best_time[0] = t; best_dist[0] = distances[d]; }
+
+        MN_BENCH_BEST(reps, t, mn_mulc_float_neon(dst, src1, 3.0f, count));
+        snprintf(label, sizeof(label), "%s @%zu", names[1], distances[d]);
+        mn_bench_report(label, t, 2.0 * sizeof(mn_float32_t) * count, (double)count);
+        if (t < best_time[1]) { best_time[1] = t; best_dist[1] = distances[d]; }
+
+        MN_BENCH_BEST(reps, t, mn_abs_vec4f_neon((mn_vec4f_t *)dst, (mn_vec4f_t *)src2, count_v4));
+        snprintf(label, sizeof(label), "%s @%zu", names[2], distances[d]);
+        mn_bench_report(label, t, 2.0 * sizeof(mn_vec4f_t) * count_v4, 0.0);
+        if (t < best_time[2]) { best_time[2] = t; best_dist[2] = distances[d]; }
+    }
+
+    printf("\nBest prefetch distance on this CPU:\n");
+    for (int k = 0; k < 3; k++)
+    {
+        printf("    %-20s %5zu bytes\n", names[k], best_dist[k]);
+    }
+
+    mn_set_prefetch_distance(saved);
+    free(src1);
+    free(src2);
+    free(dst);
+}
+
+/* ===== float64 ===== */
+
+static void mn_bench_float64 (size_t count, int reps)
+{
+    mn_float64_t * src1 = (mn_float64_t *)mn_bench_alloc(sizeof(mn_float64_t) * count);
+    mn_float64_t * src2 = (mn_float64_t *)mn_bench_alloc(sizeof(mn_float64_t) * count);
+    mn_float64_t * dst  = (mn_float64_t *)mn_bench_alloc(sizeof(mn_float64_t) * count);
+    const mn_vec3d_t k3 = { 1.0, 2.0, 3.0 };
+    size_t count_v3 = count / 3;
+    double t;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        src1[i] = (mn_float64_t)i * 0.5;
+        src2[i] = (mn_float64_t)i * -0.25 - 1.0;
+    }
+
+    mn_bench_header("float64 NEON vs scalar");
+
+#define MN_BENCH_F64_PAIR(op, args, bytes, flops) \
+    MN_BENCH_BEST(reps, t, mn_##op##_c args); \
+    mn_bench_report(#op "_c", t, bytes, flops); \
+    MN_BENCH_BEST(reps, t, mn_##op##_neon args); \
+    mn_bench_report(#op "_neon", t, bytes, flops);
+
+    MN_BENCH_F64_PAIR(add_float64, (dst, src1, src2, count), 3.0 * sizeof(mn_float64_t) * count, (double)count)
+    MN_BENCH_F64_PAIR(mul_float64, (dst, src1, src2, count), 3.0 * sizeof(mn_float64_t) * count, (double)count)
+    MN_BENCH_F64_PAIR(div_float64, (dst, src1, src2, count), 3.0 * sizeof(mn_float64_t) * count, (double)count)
+    MN_BENCH_F64_PAIR(mulc_float64, (dst, src1, 3.0, count), 2.0 * sizeof(mn_float64_t) * count, (double)count)
+    MN_BENCH_F64_PAIR(abs_float64, (dst, src2, count), 2.0 * sizeof(mn_float64_t) * count, 0.0)
+    MN_BENCH_F64_PAIR(addc_vec3d, ((mn_vec3d_t *)dst, (mn_vec3d_t *)src1, &k3, count_v3),
+                      2.0 * sizeof(mn_vec3d_t) * count_v3, 3.0 * count_v3)
+
+#undef MN_BENCH_F64_PAIR
+
+    free(src1);
+    free(src2);
+    free(dst);
+}
+
+/* ===== matrix ===== */
+
+static void mn_bench_matrix (size_t count, int reps)
+{
+    size_t count_v4 = count / 4;
+    size_t count_m4 = count / 16;
+    mn_vec4f_t * vsrc = (mn_vec4f_t *)mn_bench_alloc(sizeof(mn_vec4f_t) * count_v4);
+    mn_vec4f_t * vdst = (mn_vec4f_t *)mn_bench_alloc(sizeof(mn_vec4f_t) * count_v4);
+    mn_mat4f_t * msrc = (mn_mat4f_t *)mn_bench_alloc(sizeof(mn_mat4f_t) * count_m4);
+    mn_mat4f_t * mdst = (mn_mat4f_t *)mn_bench_alloc(sizeof(mn_mat4f_t) * count_m4);
+    const mn_mat4f_t mat = { { 1, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 0, 1, 0 }, { 10, 20, 30, 1 } };
+    double t;
+
+    for (size_t i = 0; i < count_v4 * 4; i++)
+    {
+        ((mn_float32_t *)vsrc)[i] = (mn_float32_t)i * 0.25f;
+    }
+    for (size_t i = 0; i < count_m4 * 16; i++)
+    {
+        ((mn_float32_t *)msrc)[i] = (mn_float32_t)(i % 7) - 3.0f;
+    }
+
+    mn_bench_header("matrix NEON vs scalar");
+
+    MN_BENCH_BEST(reps, t, mn_transform_vec4f_c(vdst, vsrc, &mat, count_v4));
+    mn_bench_report("transform_vec4f_c", t, 2.0 * sizeof(mn_vec4f_t) * count_v4, 28.0 * count_v4);
+    MN_BENCH_BEST(reps, t, mn_transform_vec4f_neon(vdst, vsrc, &mat, count_v4));
+    mn_bench_report("transform_vec4f_neon", t, 2.0 * sizeof(mn_vec4f_t) * count_v4, 28.0 * count_v4);
+
+    MN_BENCH_BEST(reps, t, mn_mulmat_4x4f_c(mdst, msrc, msrc, count_m4));
+    mn_bench_report("mulmat_4x4f_c", t, 3.0 * sizeof(mn_mat4f_t) * count_m4, 112.0 * count_m4);
+    MN_BENCH_BEST(reps, t, mn_mulmat_4x4f_neon(mdst, msrc, msrc, count_m4));
+    mn_bench_report("mulmat_4x4f_neon", t, 3.0 * sizeof(mn_mat4f_t) * count_m4, 112.0 * count_m4);
+
+    MN_BENCH_BEST(reps, t, mn_invmat_4x4f_c(mdst, msrc, count_m4));
+    mn_bench_report("invmat_4x4f_c", t, 2.0 * sizeof(mn_mat4f_t) * count_m4, 0.0);
+    MN_BENCH_BEST(reps, t, mn_invmat_4x4f_neon(mdst, msrc, count_m4));
+    mn_bench_report("invmat_4x4f_neon", t, 2.0 * sizeof(mn_mat4f_t) * count_m4, 0.0);
+
+    MN_BENCH_BEST(reps, t, mn_invmat_3x3f_c((mn_mat3f_t *)mdst, (mn_mat3f_t *)msrc, count_m4));
+    mn_bench_report("invmat_3x3f_c", t, 2.0 * sizeof(mn_mat3f_t) * count_m4, 0.0);
+    MN_BENCH_BEST(reps, t, mn_invmat_3x3f_neon((mn_mat3f_t *)mdst, (mn_mat3f_t *)msrc, count_m4));
+    mn_bench_report("invmat_3x3f_neon", t, 2.0 * sizeof(mn_mat3f_t) * count_m4, 0.0);
+
+    free(vsrc);
+    free(vdst);
+    free(msrc);
+    free(mdst);
+}
+
+/* ===== sgemm ===== */
+
+/* Textbook i, j, k loop (dot product per element), the baseline to beat */
+static void mn_bench_sgemm_naive (size_t n, const mn_float32_t * A, const mn_float32_t * B, mn_float32_t * C)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        for (size_t j = 0; j < n; j++)
+        {
+            mn_float32_t acc = 0.0f;
+            for (size_t k = 0; k < n; k++)
+            {
+                acc += A[i + k * n] * B[k + j * n];
+            }
+            C[i + j * n] = acc;
+        }
+    }
+}
+
+static void mn_bench_sgemm (size_t count, int reps)
+{
+    /* the default count (4M elements) is far too big for n^3 work */
+    const size_t n = count >= ((size_t)1 << 20) ? 512 : count;
+    const double flops = 2.0 * n * n * n;
+    const double bytes = 3.0 * sizeof(mn_float32_t) * n * n;
+    mn_float32_t * A = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * n * n);
+    mn_float32_t * B = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * n * n);
+    mn_float32_t * C = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * n * n);
+    size_t saved = mn_get_threads();
+    char label[64];
+    double t;
+
+    for (size_t i = 0; i < n * n; i++)
+    {
+        A[i] = (mn_float32_t)(i % 17) * 0.125f - 1.0f;
+        B[i] = (mn_float32_t)(i % 13) * -0.25f + 1.5f;
+    }
+
+    mn_bench_header("sgemm");
+
+    MN_BENCH_BEST(reps, t, mn_bench_sgemm_naive(n, A, B, C));
+    snprintf(label, sizeof(label), "naive %zux%zu", n, n);
+    mn_bench_report(label, t, bytes, flops);
+
+    MN_BENCH_BEST(reps, t, mn_sgemm_c(n, n, n, A, n, B, n, C, n, 1.0f, 0.0f));
+    snprintf(label, sizeof(label), "sgemm_c %zux%zu", n, n);
+    mn_bench_report(label, t, bytes, flops);
+
+    mn_set_threads(1);
+    MN_BENCH_BEST(reps, t, mn_sgemm_neon(n, n, n, A, n, B, n, C, n, 1.0f, 0.0f));
+    snprintf(label, sizeof(label), "sgemm_neon %zux%zu", n, n);
+    mn_bench_report(label, t, bytes, flops);
+
+    mn_set_threads(0);
+    MN_BENCH_BEST(reps, t, mn_sgemm_neon(n, n, n, A, n, B, n, C, n, 1.0f, 0.0f));
+    snprintf(label, sizeof(label), "sgemm_neon %zux%zu mt", n, n);
+    mn_bench_report(label, t, bytes, flops);
+
+    mn_set_threads(saved);
+    free(A);
+    free(B);
+    free(C);
+}
+
+/* ===== fir ===== */
+
+#define MN_BENCH_FIR_CHUNK 4096
+
+static void mn_bench_fir (size_t count, int reps)
+{
+    static const size_t taps_list[] = { 8, 32, 128 };
+    static const size_t dec_list[] = { 1, 4 };
+    const size_t n = count - count % (MN_BENCH_FIR_CHUNK);
+    mn_float32_t * xf = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * (n + 1));
+    mn_float32_t * yf = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * (n + 1));
+    mn_int16_t * xi = (mn_int16_t *)mn_bench_alloc(sizeof(mn_int16_t) * (n + 1));
+    mn_int16_t * yi = (mn_int16_t *)mn_bench_alloc(sizeof(mn_int16_t) * (n + 1));
+    mn_float32_t hf[128];
+    mn_int16_t hi[128];
+    char label[64];
+    double t;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        xf[i] = (mn_float32_t)(i % 31) * 0.0625f - 1.0f;
+        xi[i] = (mn_int16_t)((i * 2654435761u) >> 16);
+    }
+    for (size_t k = 0; k < 128; k++)
+    {
+        hf[k] = 1.0f / (mn_float32_t)(k + 1);
+        hi[k] = (mn_int16_t)(16384 / (k + 1));
+    }
+
+    mn_bench_header("fir");
+
+/* one pass over the whole signal in chunks, the delay line carries over */
+#define MN_BENCH_FIR_RUN(fn, fir, y, x, dec) \
+    for (size_t pos_ = 0; pos_ < n; pos_ += MN_BENCH_FIR_CHUNK) \
+        fn(&fir, y + pos_ / (dec), x + pos_, MN_BENCH_FIR_CHUNK)
+
+    for (size_t d = 0; d < sizeof(dec_list) / sizeof(dec_list[0]); d++)
+    {
+        for (size_t k = 0; k < sizeof(taps_list) / sizeof(taps_list[0]); k++)
+        {
+            const size_t taps = taps_list[k], dec = dec_list[d];
+            const double flops = 2.0 * taps * (double)(n / dec);
+            mn_fir_float_t ff;
+            mn_fir_int16_t fi;
+
+            if (mn_fir_init_float(&ff, hf, taps, dec) != MN_SUCCESS ||
+                mn_fir_init_int16(&fi, hi, taps, dec) != MN_SUCCESS)
+            {
+                fprintf(stderr, "mn_bench: fir init failed\n");
+                exit(1);
+            }
+
+            MN_BENCH_BEST(reps, t, MN_BENCH_FIR_RUN(mn_fir_float_c, ff, yf, xf, dec));
+            snprintf(label, sizeof(label), "fir_float_c t%zu d%zu", taps, dec);
+            mn_bench_report(label, t, (double)n * sizeof(mn_float32_t), flops);
+            MN_BENCH_BEST(reps, t, MN_BENCH_FIR_RUN(mn_fir_float_neon, ff, yf, xf, dec));
+            snprintf(label, sizeof(label), "fir_float_neon t%zu d%zu", taps, dec);
+            mn_bench_report(label, t, (double)n * sizeof(mn_float32_t), flops);
+
+            MN_BENCH_BEST(reps, t, MN_BENCH_FIR_RUN(mn_fir_int16_c, fi, yi, xi, dec));
+            snprintf(label, sizeof(label), "fir_int16_c t%zu d%zu", taps, dec);
+            mn_bench_report(label, t, (double)n * sizeof(mn_int16_t), flops);
+            MN_BENCH_BEST(reps, t, MN_BENCH_FIR_RUN(mn_fir_int16_neon, fi, yi, xi, dec));
+            snprintf(label, sizeof(label), "fir_int16_neon t%zu d%zu", taps, dec);
+            mn_bench_report(label, t, (double)n * sizeof(mn_int16_t), flops);
+
+            mn_fir_free_float(&ff);
+            mn_fir_free_int16(&fi);
+        }
+    }
+#undef MN_BENCH_FIR_RUN
+
+    free(xf);
+    free(yf);
+    free(xi);
+    free(yi);
+}
+
+/* ===== complex ===== */
+
+static void mn_bench_complex (size_t count, int reps)
+{
+    mn_complexf_t * a = (mn_complexf_t *)mn_bench_alloc(sizeof(mn_complexf_t) * count);
+    mn_complexf_t * b = (mn_complexf_t *)mn_bench_alloc(sizeof(mn_complexf_t) * count);
+    mn_complexf_t * d = (mn_complexf_t *)mn_bench_alloc(sizeof(mn_complexf_t) * count);
+    mn_float32_t * f = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    const double bytes2 = 3.0 * sizeof(mn_complexf_t) * count;
+    const double bytes1 = (double)(sizeof(mn_complexf_t) + sizeof(mn_float32_t)) * count;
+    double t;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        a[i].re = (mn_float32_t)(i % 29) * 0.125f - 1.0f;
+        a[i].im = (mn_float32_t)(i % 7) * 0.5f;
+        b[i].re = (mn_float32_t)(i % 11) * -0.25f;
+        b[i].im = 1.0f;
+    }
+
+    mn_bench_header("complex");
+
+    MN_BENCH_BEST(reps, t, mn_cmul_complexf_c(d, a, b, count));
+    mn_bench_report("cmul_complexf_c", t, bytes2, 6.0 * count);
+    MN_BENCH_BEST(reps, t, mn_cmul_complexf_neon(d, a, b, count));
+    mn_bench_report("cmul_complexf_neon", t, bytes2, 6.0 * count);
+
+    MN_BENCH_BEST(reps, t, mn_cconjmul_complexf_c(d, a, b, count));
+    mn_bench_report("cconjmul_complexf_c", t, bytes2, 6.0 * count);
+    MN_BENCH_BEST(reps, t, mn_cconjmul_complexf_neon(d, a, b, count));
+    mn_bench_report("cconjmul_complexf_neon", t, bytes2, 6.0 * count);
+
+    MN_BENCH_BEST(reps, t, mn_cabs_complexf_c(f, a, count));
+    mn_bench_report("cabs_complexf_c", t, bytes1, 4.0 * count);
+    MN_BENCH_BEST(reps, t, mn_cabs_complexf_neon(f, a, count));
+    mn_bench_report("cabs_complexf_neon", t, bytes1, 4.0 * count);
+
+    free(a);
+    free(b);
+    free(d);
+    free(f);
+}
+
+/* ===== fft ===== */
+
+static void mn_bench_fft (size_t count, int reps)
+{
+    static const size_t n_list[] = { 64, 256, 960, 1024, 4096 };
+    mn_complexf_t * x = (mn_complexf_t *)mn_bench_alloc(sizeof(mn_complexf_t) * count);
+    mn_complexf_t * y = (mn_complexf_t *)mn_bench_alloc(sizeof(mn_complexf_t) * (count + count / 32 + 2));
+    mn_fft_plan_t plan;
+    char label[64];
+    double t;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        x[i].re = (mn_float32_t)(i % 29) * 0.125f - 1.0f;
+        x[i].im = (mn_float32_t)(i % 13) * -0.25f;
+    }
+
+    mn_bench_header("fft");
+
+    for (size_t ni = 0; ni < sizeof(n_list) / sizeof(n_list[0]); ni++)
+    {
+        const size_t n = n_list[ni];
+        const size_t batch = count / n;
+        const double flops = 5.0 * n * log2((double)n) * batch;
+        const double bytes = 2.0 * sizeof(mn_complexf_t) * n * batch;
+
+        if (batch == 0 || mn_fft_plan_complex(&plan, n) != MN_SUCCESS)
+        {
+            continue;
+        }
+        snprintf(label, sizeof(label), "fft_forward_c n=%zu", n);
+        MN_BENCH_BEST(reps, t, mn_fft_forward_c(&plan, y, x, batch));
+        mn_bench_report(label, t, bytes, flops);
+        snprintf(label, sizeof(label), "fft_forward_neon n=%zu", n);
+        MN_BENCH_BEST(reps, t, mn_fft_forward_neon(&plan, y, x, batch));
+        mn_bench_report(label, t, bytes, flops);
+        mn_fft_plan_free(&plan);
+
+        /* the same samples read as 2 * count reals */
+        if (mn_fft_plan_real(&plan, n) != MN_SUCCESS)
+        {
+            continue;
+        }
+        snprintf(label, sizeof(label), "rfft_forward_c n=%zu", n);
+        MN_BENCH_BEST(reps, t, mn_rfft_forward_c(&plan, y, (mn_float32_t *)x, 2 * batch));
+        mn_bench_report(label, t, bytes, flops);
+        snprintf(label, sizeof(label), "rfft_forward_neon n=%zu", n);
+        MN_BENCH_BEST(reps, t, mn_rfft_forward_neon(&plan, y, (mn_float32_t *)x, 2 * batch));
+        mn_bench_report(label, t, bytes, flops);
+        mn_fft_plan_free(&plan);
+    }
+
+    free(x);
+    free(y);
+}
+
+/* ===== explog ===== */
+
+static void mn_bench_explog (size_t count, int reps)
+{
+    static const char * tiers[] = { "precise", "fast", "ultra" };
+    mn_float32_t * x = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_float32_t * y = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_float32_t * d = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    const double bytes1 = 2.0 * sizeof(mn_float32_t) * count;
+    const double bytes2 = 3.0 * sizeof(mn_float32_t) * count;
+    char label[64];
+    double t;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        x[i] = (mn_float32_t)(i % 1000) * 0.01f + 0.001f;
+        y[i] = (mn_float32_t)(i % 37) * 0.25f - 4.0f;
+    }
+
+    mn_bench_header("explog");
+
+    MN_BENCH_BEST(reps, t, mn_exp_float_c(d, y, count, MN_ACCURACY_PRECISE));
+    mn_bench_report("exp_float_c", t, bytes1, (double)count);
+    for (int a = 0; a < 3; a++)
+    {
+        snprintf(label, sizeof(label), "exp_float_neon %s", tiers[a]);
+        MN_BENCH_BEST(reps, t, mn_exp_float_neon(d, y, count, a));
+        mn_bench_report(label, t, bytes1, (double)count);
+    }
+
+    MN_BENCH_BEST(reps, t, mn_log_float_c(d, x, count, MN_ACCURACY_PRECISE));
+    mn_bench_report("log_float_c", t, bytes1, (double)count);
+    for (int a = 0; a < 3; a++)
+    {
+        snprintf(label, sizeof(label), "log_float_neon %s", tiers[a]);
+        MN_BENCH_BEST(reps, t, mn_log_float_neon(d, x, count, a));
+        mn_bench_report(label, t, bytes1, (double)count);
+    }
+
+    MN_BENCH_BEST(reps, t, mn_pow_float_c(d, x, y, count, MN_ACCURACY_PRECISE));
+    mn_bench_report("pow_float_c", t, bytes2, (double)count);
+    for (int a = 0; a < 3; a++)
+    {
+        snprintf(label, sizeof(label), "pow_float_neon %s", tiers[a]);
+        MN_BENCH_BEST(reps, t, mn_pow_float_neon(d, x, y, count, a));
+        mn_bench_report(label, t, bytes2, (double)count);
+    }
+
+    free(x);
+    free(y);
+    free(d);
+}
+
+/* ===== trig ===== */
+
+static void mn_bench_trig (size_t count, int reps)
+{
+    mn_float32_t * x = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_float32_t * y = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_float32_t * d = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_float32_t * e = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    const double bytes1 = 2.0 * sizeof(mn_float32_t) * count;
+    const double bytes2 = 3.0 * sizeof(mn_float32_t) * count;
+    double t;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        x[i] = (mn_float32_t)(i % 2000) * 0.1f - 100.0f;
+        y[i] = (mn_float32_t)(i % 37) * 0.25f - 4.0f;
+    }
+
+    mn_bench_header("trig");
+
+    MN_BENCH_BEST(reps, t, mn_sin_float_c(d, x, count));
+    mn_bench_report("sin_float_c", t, bytes1, (double)count);
+    MN_BENCH_BEST(reps, t, mn_sin_float_neon(d, x, count));
+    mn_bench_report("sin_float_neon", t, bytes1, (double)count);
+
+    MN_BENCH_BEST(reps, t, mn_cos_float_c(d, x, count));
+    mn_bench_report("cos_float_c", t, bytes1, (double)count);
+    MN_BENCH_BEST(reps, t, mn_cos_float_neon(d, x, count));
+    mn_bench_report("cos_float_neon", t, bytes1, (double)count);
+
+    MN_BENCH_BEST(reps, t, mn_sincos_float_c(d, e, x, count));
+    mn_bench_report("sincos_float_c", t, bytes2, (double)count);
+    MN_BENCH_BEST(reps, t, mn_sincos_float_neon(d, e, x, count));
+    mn_bench_report("sincos_float_neon", t, bytes2, (double)count);
+
+    MN_BENCH_BEST(reps, t, mn_tan_float_c(d, x, count));
+    mn_bench_report("tan_float_c", t, bytes1, (double)count);
+    MN_BENCH_BEST(reps, t, mn_tan_float_neon(d, x, count));
+    mn_bench_report("tan_float_neon", t, bytes1, (double)count);
+
+    MN_BENCH_BEST(reps, t, mn_atan2_float_c(d, y, x, count));
+    mn_bench_report("atan2_float_c", t, bytes2, (double)count);
+    MN_BENCH_BEST(reps, t, mn_atan2_float_neon(d, y, x, count));
+    mn_bench_report("atan2_float_neon", t, bytes2, (double)count);
+
+    free(x);
+    free(y);
+    free(d);
+    free(e);
+}
+
+/* ===== sqrt ===== */
+
+static void mn_bench_sqrt (size_t count, int reps)
+{
+    static const char * tiers[] = { "precise", "fast", "ultra", "estimate" };
+    static const struct
+    {
+        const char * name;
+        mn_result_t (*c)(mn_float32_t *, mn_float32_t *, size_t, int);
+        mn_result_t (*neon)(mn_float32_t *, mn_float32_t *, size_t, int);
+    } ops[] = {
+        { "sqrt",  mn_sqrt_float_c,  mn_sqrt_float_neon },
+        { "rsqrt", mn_rsqrt_float_c, mn_rsqrt_float_neon },
+        { "recip", mn_recip_float_c, mn_recip_float_neon },
+    };
+    mn_float32_t * x = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_float32_t * d = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    const double bytes = 2.0 * sizeof(mn_float32_t) * count;
+    char label[64];
+    double t;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        x[i] = (mn_float32_t)(i % 1000) * 0.01f + 0.001f;
+    }
+
+    mn_bench_header("sqrt");
+
+    for (size_t k = 0; k < sizeof(ops) / sizeof(ops[0]); k++)
+    {
+        snprintf(label, sizeof(label), "%s_float_c", ops[k].name);
+        MN_BENCH_BEST(reps, t, ops[k].c(d, x, count, MN_ACCURACY_PRECISE));
+        mn_bench_report(label, t, bytes, (double)count);
+        for (int a = 0; a < 4; a++)
+        {
+            snprintf(label, sizeof(label), "%s_float_neon %s", ops[k].name, tiers[a]);
+            MN_BENCH_BEST(reps, t, ops[k].neon(d, x, count, a));
+            mn_bench_report(label, t, bytes, (double)count);
+        }
+    }
+
+    free(x);
+    free(d);
+}
+
+/* ===== activation ===== */
+
+static void mn_bench_activation (size_t count, int reps)
+{
+    static const struct
+    {
+        const char * name;
+        mn_result_t (*c)(mn_float32_t *, mn_float32_t *, size_t);
+        mn_result_t (*neon)(mn_float32_t *, mn_float32_t *, size_t);
+    } ops[] = {
+        { "relu",    mn_relu_float_c,    mn_relu_float_neon },
+        { "sigmoid", mn_sigmoid_float_c, mn_sigmoid_float_neon },
+        { "tanh",    mn_tanh_float_c,    mn_tanh_float_neon },
+        { "gelu",    mn_gelu_float_c,    mn_gelu_float_neon },
+        { "softmax", mn_softmax_float_c, mn_softmax_float_neon },
+    };
+    mn_float32_t * x = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_float32_t * d = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    const double bytes = 2.0 * sizeof(mn_float32_t) * count;
+    char label[64];
+    double t;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        x[i] = (mn_float32_t)(i % 1601) * 0.01f - 8.0f;
+    }
+
+    mn_bench_header("activation");
+
+    for (size_t k = 0; k < sizeof(ops) / sizeof(ops[0]); k++)
+    {
+        snprintf(label, sizeof(label), "%s_float_c", ops[k].name);
+        MN_BENCH_BEST(reps, t, ops[k].c(d, x, count));
+        mn_bench_report(label, t, bytes, (double)count);
+        snprintf(label, sizeof(label), "%s_float_neon", ops[k].name);
+        MN_BENCH_BEST(reps, t, ops[k].neon(d, x, count));
+        mn_bench_report(label, t, bytes, (double)count);
+    }
+
+    free(x);
+    free(d);
+}
+
+/* ===== norm ===== */
+
+static void mn_bench_norm (size_t count, int reps)
+{
+    const size_t cols = 768;
+    const size_t rows = count / cols;
+    mn_float32_t * x = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_float32_t * d = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_float32_t * gamma = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_float32_t * beta = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_float32_t * mean = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * (rows + 1));
+    mn_float32_t * var = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * (rows + 1));
+    const double bytes1 = sizeof(mn_float32_t) * (double)count;
+    const double bytes5 = 5.0 * sizeof(mn_float32_t) * count;   /* src twice, gamma, beta, dst */
+    double t;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        x[i] = (mn_float32_t)(i % 997) * 0.01f + 3.0f;
+        gamma[i] = 1.0f + (mn_float32_t)(i % 7) * 0.125f;
+        beta[i] = (mn_float32_t)(i % 5) * 0.25f;
+    }
+
+    mn_bench_header("norm");
+
+    MN_BENCH_BEST(reps, t, mn_meanvar_float_c(mean, var, x, count));
+    mn_bench_report("meanvar_float_c", t, bytes1, (double)count);
+    MN_BENCH_BEST(reps, t, mn_meanvar_float_neon(mean, var, x, count));
+    mn_bench_report("meanvar_float_neon", t, bytes1, (double)count);
+
+    MN_BENCH_BEST(reps, t, mn_layernorm_float_c(d, x, gamma, beta, 1e-5f, count));
+    mn_bench_report("layernorm_float_c", t, bytes5, (double)count);
+    MN_BENCH_BEST(reps, t, mn_layernorm_float_neon(d, x, gamma, beta, 1e-5f, count));
+    mn_bench_report("layernorm_float_neon", t, bytes5, (double)count);
+
+    if (rows > 0)
+    {
+        const double bytes_rows = 5.0 * sizeof(mn_float32_t) * (double)(rows * cols);
+        MN_BENCH_BEST(reps, t, mn_layernorm_rows_float_c(d, x, gamma, beta, 1e-5f, rows, cols));
+        mn_bench_report("layernorm_rows_float_c", t, bytes_rows, (double)(rows * cols));
+        MN_BENCH_BEST(reps, t, mn_layernorm_rows_float_neon(d, x, gamma, beta, 1e-5f, rows, cols));
+        mn_bench_report("layernorm_rows_float_neon", t, bytes_rows, (double)(rows * cols));
+    }
+
+    free(x);
+    free(d);
+    free(gamma);
+    free(beta);
+    free(mean);
+    free(var);
+}
+
+/* ===== scan ===== */
+
+static void mn_bench_scan (size_t count, int reps)
+{
+    mn_float32_t * xf = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_float32_t * df = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_int32_t * xi = (mn_int32_t *)mn_bench_alloc(sizeof(mn_int32_t) * count);
+    mn_int32_t * di = (mn_int32_t *)mn_bench_alloc(sizeof(mn_int32_t) * count);
+    const size_t n3 = count / 3;
+    const double bytes = 2.0 * sizeof(mn_float32_t) * count;
+    const double bytes3 = 2.0 * sizeof(mn_vec3f_t) * n3;
+    size_t saved = mn_get_threads();
+    double t;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        xf[i] = (mn_float32_t)(i % 17) * 0.125f - 1.0f;
+        xi[i] = (mn_int32_t)(i % 1000) - 500;
+    }
+
+    mn_bench_header("scan");
+
+    MN_BENCH_BEST(reps, t, mn_scan_inclusive_float_c(df, xf, count));
+    mn_bench_report("scan_inclusive_float_c", t, bytes, (double)count);
+    mn_set_threads(1);
+    MN_BENCH_BEST(reps, t, mn_scan_inclusive_float_neon(df, xf, count));
+    mn_bench_report("scan_inclusive_float_neon", t, bytes, (double)count);
+    mn_set_threads(0);
+    MN_BENCH_BEST(reps, t, mn_scan_inclusive_float_neon(df, xf, count));
+    mn_bench_report("scan_inclusive_float_neon mt", t, bytes, (double)count);
+
+    MN_BENCH_BEST(reps, t, mn_scan_inclusive_int32_c(di, xi, count));
+    mn_bench_report("scan_inclusive_int32_c", t, bytes, (double)count);
+    mn_set_threads(1);
+    MN_BENCH_BEST(reps, t, mn_scan_inclusive_int32_neon(di, xi, count));
+    mn_bench_report("scan_inclusive_int32_neon", t, bytes, (double)count);
+    mn_set_threads(0);
+    MN_BENCH_BEST(reps, t, mn_scan_inclusive_int32_neon(di, xi, count));
+    mn_bench_report("scan_inclusive_int32_neon mt", t, bytes, (double)count);
+
+    MN_BENCH_BEST(reps, t, mn_scan_inclusive_vec3f_c((mn_vec3f_t *)df, (mn_vec3f_t *)xf, n3));
+    mn_bench_report("scan_inclusive_vec3f_c", t, bytes3, (double)(3 * n3));
+    mn_set_threads(1);
+    MN_BENCH_BEST(reps, t, mn_scan_inclusive_vec3f_neon((mn_vec3f_t *)df, (mn_vec3f_t *)xf, n3));
+    mn_bench_report("scan_inclusive_vec3f_neon", t, bytes3, (double)(3 * n3));
+
+    mn_set_threads(saved);
+    free(xf);
+    free(df);
+    free(xi);
+    free(di);
+}
+
+/* ===== histogram ===== */
+
+static void mn_bench_histogram (size_t count, int reps)
+{
+    mn_uint8_t * xb = (mn_uint8_t *)mn_bench_alloc(count);
+    mn_uint8_t * xr = (mn_uint8_t *)mn_bench_alloc(count);
+    mn_int32_t * xi = (mn_int32_t *)mn_bench_alloc(sizeof(mn_int32_t) * count);
+    mn_float32_t * xf = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_uint32_t * hist = (mn_uint32_t *)mn_bench_alloc(sizeof(mn_uint32_t) * 1024);
+    const double bytes4 = sizeof(mn_float32_t) * (double)count;
+    size_t saved = mn_get_threads();
+    uint32_t state = 1;
+    double t;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        state = state * 1103515245u + 12345u;
+        xb[i] = (mn_uint8_t)(state >> 24);
+        xr[i] = (mn_uint8_t)(i / 4096);     /* long runs of one value, as in flat image regions */
+        xi[i] = (mn_int32_t)((state >> 8) % 1024);
+        xf[i] = (mn_float32_t)(state >> 8) * (1.0f / 16777216.0f);
+    }
+
+    mn_bench_header("histogram");
+
+    MN_BENCH_BEST(reps, t, mn_histogram_uint8_c(hist, xb, count));
+    mn_bench_report("histogram_uint8_c", t, (double)count, (double)count);
+    MN_BENCH_BEST(reps, t, mn_histogram_uint8_c(hist, xr, count));
+    mn_bench_report("histogram_uint8_c runs", t, (double)count, (double)count);
+    mn_set_threads(1);
+    MN_BENCH_BEST(reps, t, mn_histogram_uint8_neon(hist, xb, count));
+    mn_bench_report("histogram_uint8_neon", t, (double)count, (double)count);
+    MN_BENCH_BEST(reps, t, mn_histogram_uint8_neon(hist, xr, count));
+    mn_bench_report("histogram_uint8_neon runs", t, (double)count, (double)count);
+    mn_set_threads(0);
+    MN_BENCH_BEST(reps, t, mn_histogram_uint8_neon(hist, xb, count));
+    mn_bench_report("histogram_uint8_neon mt", t, (double)count, (double)count);
+
+    MN_BENCH_BEST(reps, t, mn_histogram_int32_c(hist, 1000, xi, count));
+    mn_bench_report("histogram_int32_c", t, bytes4, (double)count);
+    mn_set_threads(1);
+    MN_BENCH_BEST(reps, t, mn_histogram_int32_neon(hist, 1000, xi, count));
+    mn_bench_report("histogram_int32_neon", t, bytes4, (double)count);
+
+    MN_BENCH_BEST(reps, t, mn_histogram_float_c(hist, 1000, xf, 0.0f, 1.0f, count));
+    mn_bench_report("histogram_float_c", t, bytes4, (double)count);
+    MN_BENCH_BEST(reps, t, mn_histogram_float_neon(hist, 1000, xf, 0.0f, 1.0f, count));
+    mn_bench_report("histogram_float_neon", t, bytes4, (double)count);
+    mn_set_threads(0);
+    MN_BENCH_BEST(reps, t, mn_histogram_float_neon(hist, 1000, xf, 0.0f, 1.0f, count));
+    mn_bench_report("histogram_float_neon mt", t, bytes4, (double)count);
+
+    mn_set_threads(saved);
+    free(xb);
+    free(xr);
+    free(xi);
+    free(xf);
+    free(hist);
+}
+
+/* ===== compact ===== */
+
+static void mn_bench_compact (size_t count, int reps)
+{
+    mn_float32_t * x = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_float32_t * d = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    const mn_float32_t limits[2] = { 0.9f, 0.5f };
+    uint32_t state = 1;
+    size_t kept;
+    char label[64];
+    double t;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        state = state * 1103515245u + 12345u;
+        x[i] = (mn_float32_t)(state >> 8) * (1.0f / 16777216.0f);
+    }
+
+    mn_bench_header("compact");
+
+    for (int k = 0; k < 2; k++)
+    {
+        const int pct = (int)((1.0f - limits[k]) * 100.0f + 0.5f);
+        MN_BENCH_BEST(reps, t, mn_compactc_float_c(d, &kept, x, limits[k], count, MN_CMP_GT));
+        /* src read once, the kept values written */
+        const double bytes = sizeof(mn_float32_t) * ((double)count + (double)kept);
+        snprintf(label, sizeof(label), "compactc_float_c %d%%", pct);
+        mn_bench_report(label, t, bytes, (double)count);
+        MN_BENCH_BEST(reps, t, mn_compactc_float_neon(d, &kept, x, limits[k], count, MN_CMP_GT));
+        snprintf(label, sizeof(label), "compactc_float_neon %d%%", pct);
+        mn_bench_report(label, t, bytes, (double)count);
+    }
+
+    free(x);
+    free(d);
+}
+
+/* ===== sort ===== */
+
+static int mn_bench_cmp_float (const void * a, const void * b)
+{
+    const mn_float32_t x = *(const mn_float32_t *)a, y = *(const mn_float32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static int mn_bench_cmp_int32 (const void * a, const void * b)
+{
+    const mn_int32_t x = *(const mn_int32_t *)a, y = *(const mn_int32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void mn_bench_sort (size_t count, int reps)
+{
+    mn_float32_t * x = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_float32_t * d = (mn_float32_t *)mn_bench_alloc(sizeof(mn_float32_t) * count);
+    mn_int32_t * xi = (mn_int32_t *)mn_bench_alloc(sizeof(mn_int32_t) * count);
+    mn_int32_t * di = (mn_int32_t *)mn_bench_alloc(sizeof(mn_int32_t) * count);
+    mn_uint32_t * idx = (mn_uint32_t *)mn_bench_alloc(sizeof(mn_uint32_t) * count);
+    mn_uint32_t * dv = (mn_uint32_t *)mn_bench_alloc(sizeof(mn_uint32_t) * count);
+    /* src read once and dst written once; the merge passes move more */
+    const double bytes = 2.0 * sizeof(mn_float32_t) * count;
+    uint32_t state = 1;
+    double t;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        state = state * 1103515245u + 12345u;
+        x[i] = (mn_float32_t)(state >> 8) * (1.0f / 16777216.0f) - 0.5f;
+        xi[i] = (mn_int32_t)(state ^ (state >> 13));
+        idx[i] = (mn_uint32_t)i;
+    }
+
+    mn_bench_header("sort");
+
+    /* qsort sorts in place, so its time includes copying the input */
+    MN_BENCH_BEST(reps, t, (memcpy(d, x, sizeof(mn_float32_t) * count),
+                            qsort(d, count, sizeof(mn_float32_t), mn_bench_cmp_float)));
+    mn_bench_report("qsort float", t, bytes, (double)count);
+    MN_BENCH_BEST(reps, t, mn_sort_float_c(d, x, count));
+    mn_bench_report("sort_float_c", t, bytes, (double)count);
+    MN_BENCH_BEST(reps, t, mn_sort_float_neon(d, x, count));
+    mn_bench_report("sort_float_neon", t, bytes, (double)count);
+
+    MN_BENCH_BEST(reps, t, (memcpy(di, xi, sizeof(mn_int32_t) * count),
+                            qsort(di, count, sizeof(mn_int32_t), mn_bench_cmp_int32)));
+    mn_bench_report("qsort int32", t, bytes, (double)count);
+    MN_BENCH_BEST(reps, t, mn_sort_int32_c(di, xi, count));
+    mn_bench_report("sort_int32_c", t, bytes, (double)count);
+    MN_BENCH_BEST(reps, t, mn_sort_int32_neon(di, xi, count));
+    mn_bench_report("sort_int32_neon", t, bytes, (double)count);
+
+    MN_BENCH_BEST(reps, t, mn_sort_kv_float_c(d, dv, x, idx, count));
+    mn_bench_report("sort_kv_float_c", t, 2.0 * bytes, (double)count);
+    MN_BENCH_BEST(reps, t, mn_sort_kv_float_neon(d, dv, x, idx, count));
+    mn_bench_report("sort_kv_float_neon", t, 2.0 * bytes, (double)count);
+
+    free(x);
+    free(d);
+    free(xi);
+    free(di);
+    free(idx);
+    free(dv);
+}
+
+static const mn_bench_mode_t mn_bench_modes[] =
+{
+    { "prefetch", mn_bench_prefetch },
+    { "float64",  mn_bench_float64 },
+    { "matrix",   mn_bench_matrix },
+    { "sgemm",    mn_bench_sgemm },
+    { "fir",      mn_bench_fir },
+    { "complex",  mn_bench_complex },
+    { "fft",      mn_bench_fft },
+    { "explog",   mn_bench_explog },
+    { "trig",     mn_bench_trig },
+    { "sqrt",     mn_bench_sqrt },
+    { "activation", mn_bench_activation },
+    { "norm",     mn_bench_norm },
+    { "scan",     mn_bench_scan },
+    { "histogram", mn_bench_histogram },
+    { "compact",  mn_bench_compact },
+    { "sort",     mn_bench_sort },
+};
+
+int main (int argc, char ** argv)
+{
+    const char * mode = argc > 1 ? argv[1] : "all";
+    size_t count = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : (size_t)4 << 20;
+    int reps = argc > 3 ? atoi(argv[3]) : 10;
+    int ran = 0;
+
+    if (count == 0 || reps <= 0)
+    {
+        fprintf(stderr, "usage: %s [mode] [count] [reps]\n", argv[0]);
+        return 1;
+    }
+
+    for (size_t m = 0; m < sizeof(mn_bench_modes) / sizeof(mn_bench_modes[0]); m++)
+    {
+        if (strcmp(mode, "all") == 0 || strcmp(mode, mn_bench_modes[m].name) == 0)
+        {
+            mn_bench_modes[m].run(count, reps);
+            ran = 1;
+        }
+    }
+
+    if (!ran)
+    {
+        fprintf(stderr, "mn_bench: unknown mode \"%s\"\n", mode);
+        return 1;
+    }
+    return 0;
+}
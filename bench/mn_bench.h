@@ -0,0 +1,55 @@
+#ifndef MN_BENCH_H
+#define MN_BENCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+/**
+ * @brief Helpers shared by the mn_bench modes: a monotonic timer and a
+ * common result line so every mode prints the same columns.
+ */
+
+/** @brief Returns a monotonic time stamp in seconds. */
+static double mn_bench_now (void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double)now.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+/** @brief Prints the column header used by mn_bench_report(). */
+static void mn_bench_header (const char * mode)
+{
+    printf("\n===== mn_bench: %s =====\n", mode);
+    printf("%-28s %12s %12s %12s\n", "case", "time (ms)", "GB/s", "GFLOP/s");
+}
+
+/**
+ * @brief Prints one result line.
+ * @param name    Case name
+ * @param seconds Best time of one run
+ * @param bytes   Bytes moved by one run (0 to leave the column empty)
+ * @param flops   Floating point operations of one run (0 to leave the column empty)
+ */
+static void mn_bench_report (const char * name, double seconds, double bytes, double flops)
+{
+    printf("%-28s %12.3f", name, seconds * 1e3);
+    if (bytes > 0.0)  printf(" %12.2f", bytes / seconds * 1e-9); else printf(" %12s", "-");
+    if (flops > 0.0)  printf(" %12.2f", flops / seconds * 1e-9); else printf(" %12s", "-");
+    printf("\n");
+}
+
+#endif
@@ -4,6 +4,7 @@
 #define MN_DTYPES_H
 
 #include <assert.h>
+#include <stddef.h>
 #include <stdint.h>
 
 
@@ -12,8 +13,13 @@
 /////////////////////////////////////////////////////////
 
 typedef int      mn_result_t;
+typedef int8_t   mn_int8_t;
+typedef int16_t  mn_int16_t;
 typedef int32_t  mn_int32_t;
 typedef float    mn_float32_t;
+typedef double   mn_float64_t;
+typedef uint8_t  mn_uint8_t;
+typedef uint16_t mn_uint16_t;
 typedef uint32_t mn_uint32_t;
 
 /////////////////////////////////////////////////////////
@@ -22,6 +28,7 @@ typedef uint32_t mn_uint32_t;
 #define MN_SUCCESS 0
 #define MN_ERROR -1
 #define MN_OK MN_SUCCESS
+#define MN_OVERFLOW 1    /* _ovf routines: the (wrapped) result overflowed in at least one element */
 
 /**
  * @brief A 2-tuple of mn_int32_t values.
@@ -83,4 +90,271 @@ typedef struct
     mn_float32_t w;
 } mn_vec4f_t;
 
+/**
+ * @brief A 2x2 matrix of mn_float32_t values, stored column by column.
+ */
+typedef struct
+{
+    mn_vec2f_t c1;
+    mn_vec2f_t c2;
+} mn_mat2f_t;
+
+/**
+ * @brief A 3x3 matrix of mn_float32_t values, stored column by column.
+ */
+typedef struct
+{
+    mn_vec3f_t c1;
+    mn_vec3f_t c2;
+    mn_vec3f_t c3;
+} mn_mat3f_t;
+
+/**
+ * @brief A 4x4 matrix of mn_float32_t values, stored column by column.
+ *
+ * c1.y is row 2 of column 1. One column fits a float32x4_t.
+ */
+typedef struct
+{
+    mn_vec4f_t c1;
+    mn_vec4f_t c2;
+    mn_vec4f_t c3;
+    mn_vec4f_t c4;
+} mn_mat4f_t;
+
+/**
+ * @brief A single precision complex number, real part first.
+ *
+ * Same layout as mn_vec2f_t, so an array of them is interleaved re, im, re, im.
+ */
+typedef struct
+{
+    mn_float32_t re;
+    mn_float32_t im;
+} mn_complexf_t;
+
+/**
+ * @brief A 2-tuple of mn_float64_t values.
+ */
+typedef struct
+{
+    mn_float64_t x;
+    mn_float64_t y;
+} mn_vec2d_t;
+
+/**
+ * @brief A 3-tuple of mn_float64_t values.
+ */
+typedef struct
+{
+    mn_float64_t x;
+    mn_float64_t y;
+    mn_float64_t z;
+} mn_vec3d_t;
+
+/**
+ * @brief A 4-tuple of mn_float64_t values.
+ */
+typedef struct
+{
+    mn_float64_t x;
+    mn_float64_t y;
+    mn_float64_t z;
+    mn_float64_t w;
+} mn_vec4d_t;
+
+/**
+ * @brief IEEE 754 half precision value, stored as its 16 raw bits so the type
+ * is the same on every compiler. Convert with mn_f32_to_f16 / mn_f16_to_f32.
+ */
+typedef uint16_t mn_float16_t;
+
+/**
+ * @brief A 2-tuple of mn_float16_t values.
+ */
+typedef struct
+{
+    mn_float16_t x;
+    mn_float16_t y;
+} mn_vec2h_t;
+
+/**
+ * @brief A 3-tuple of mn_float16_t values.
+ */
+typedef struct
+{
+    mn_float16_t x;
+    mn_float16_t y;
+    mn_float16_t z;
+} mn_vec3h_t;
+
+/**
+ * @brief A 4-tuple of mn_float16_t values.
+ */
+typedef struct
+{
+    mn_float16_t x;
+    mn_float16_t y;
+    mn_float16_t z;
+    mn_float16_t w;
+} mn_vec4h_t;
+
+/**
+ * @brief bfloat16 value (the upper 16 bits of a float32), stored as raw bits.
+ * Convert with mn_f32_to_bf16 / mn_bf16_to_f32.
+ */
+typedef uint16_t mn_bfloat16_t;
+
+/////////////////////////////////////////////////////////
+// Type conversion (mn_cvt_*)
+/////////////////////////////////////////////////////////
+
+#define MN_ROUND_NEAREST 0   /* to nearest, ties to even */
+#define MN_ROUND_ZERO    1   /* toward zero (truncate) */
+#define MN_ROUND_DOWN    2   /* toward -infinity (floor) */
+#define MN_ROUND_UP      3   /* toward +infinity (ceil) */
+
+/**
+ * @brief Options for the mn_cvt_* routines: dst = convert(src * scale + offset).
+ * The scaling is one fused multiply-add in float32. round selects how float
+ * values become integers (MN_ROUND_*); integer results saturate to the range
+ * of the destination type and NaN becomes 0. A NULL config converts the
+ * values unchanged with MN_ROUND_NEAREST.
+ */
+typedef struct
+{
+    mn_float32_t scale;
+    mn_float32_t offset;
+    int          round;
+} mn_cvt_config_t;
+
+/////////////////////////////////////////////////////////
+// FIR filters (mn_fir_*)
+/////////////////////////////////////////////////////////
+
+/**
+ * @brief A streaming float FIR filter: y[n] = sum_k coeffs[k] * x[n - k].
+ * Set up with mn_fir_init_float, release with mn_fir_free_float. The delay
+ * line (the last num_taps - 1 inputs) carries over from one call to the next.
+ * With decimation D > 1 only every D-th output is produced.
+ */
+typedef struct
+{
+    const mn_float32_t * coeffs;  /* num_taps coefficients, owned by the caller */
+    size_t num_taps;
+    size_t decimation;
+    mn_float32_t * state;         /* delay line followed by num_taps - 1 scratch values */
+} mn_fir_float_t;
+
+/**
+ * @brief A streaming int16 FIR filter with Q15 coefficients, see mn_fir_float_t.
+ * The products are summed exactly and rounded once: y = sat16((sum + 2^14) >> 15).
+ */
+typedef struct
+{
+    const mn_int16_t * coeffs;
+    size_t num_taps;
+    size_t decimation;
+    mn_int16_t * state;
+} mn_fir_int16_t;
+
+/////////////////////////////////////////////////////////
+// FFT plans (mn_fft_*, mn_rfft_*)
+/////////////////////////////////////////////////////////
+
+#define MN_FFT_MAX_FACTORS 64
+
+/**
+ * @brief A precomputed FFT of one length.
+ * Set up with mn_fft_plan_complex (n complex points) or mn_fft_plan_real
+ * (n real samples, n even), release with mn_fft_plan_free. The work is done
+ * by a complex transform of nc = n (complex) or n / 2 (real) points, split
+ * into radix 4, 2, 3 and 5 stages (factors[], in execution order).
+ * The plan holds scratch memory: run one transform per plan at a time.
+ */
+typedef struct
+{
+    size_t n;                           /* transform length */
+    size_t nc;                          /* length of the complex transform */
+    int real;                           /* 1 for mn_fft_plan_real plans */
+    size_t num_factors;
+    size_t factors[MN_FFT_MAX_FACTORS];
+    mn_complexf_t * twiddles;           /* stage twiddles, nc - 1 values */
+    mn_complexf_t * itwiddles;          /* their conjugates for the inverse */
+    mn_complexf_t * rtwiddles;          /* real plans: exp(-2 pi i k / n), k < nc */
+    mn_complexf_t * buffer;             /* scratch, 2 * nc values (3 * nc for real plans) */
+} mn_fft_plan_t;
+
+/////////////////////////////////////////////////////////
+// Transcendental functions (mn_exp_*, mn_log_*, mn_pow_*, mn_sqrt_*)
+/////////////////////////////////////////////////////////
+
+#define MN_ACCURACY_PRECISE  0   /* within about 1 ULP of the correctly rounded result */
+#define MN_ACCURACY_FAST     1   /* within a few ULP, shorter polynomials */
+#define MN_ACCURACY_ULTRA    2   /* about 1e-3 relative error, the shortest polynomials */
+#define MN_ACCURACY_ESTIMATE 3   /* the hardware estimate alone, about 8 bits (mn_sqrt / mn_rsqrt / mn_recip only) */
+
+/////////////////////////////////////////////////////////
+// Comparison predicates (mn_compact_*, mn_compactc_*)
+/////////////////////////////////////////////////////////
+
+#define MN_CMP_EQ 0   /* x == y */
+#define MN_CMP_NE 1   /* x != y, true when either is NaN */
+#define MN_CMP_LT 2   /* x < y */
+#define MN_CMP_LE 3   /* x <= y */
+#define MN_CMP_GT 4   /* x > y */
+#define MN_CMP_GE 5   /* x >= y */
+
+/////////////////////////////////////////////////////////
+// Streaming over memory-mapped files and chunked input
+/////////////////////////////////////////////////////////
+
+/**
+ * @brief An elementwise op with one source, e.g. mn_abs_float_neon.
+ * Existing operators are wrapped with MN_STREAM_DEFINE_UNARY(op, type).
+ */
+typedef mn_result_t (*mn_stream_unary_fn)(void * dst, void * src, size_t count);
+
+/**
+ * @brief An elementwise op with two sources, e.g. mn_add_float_neon.
+ * Existing operators are wrapped with MN_STREAM_DEFINE_BINARY(op, type).
+ */
+typedef mn_result_t (*mn_stream_binary_fn)(void * dst, void * src1, void * src2, size_t count);
+
+/**
+ * @brief A kernel with user data, for ops that need extra arguments (constants).
+ * src2 is NULL for one-source streams.
+ */
+typedef mn_result_t (*mn_stream_kernel_fn)(void * ctx, void * dst, void * src1, void * src2, size_t count);
+
+/**
+ * @brief Fills src1 (and src2 for two-source streams) with up to max_count
+ * elements and returns how many were read, 0 at the end of the input.
+ */
+typedef size_t (*mn_stream_read_fn)(void * ctx, void * src1, void * src2, size_t max_count);
+
+/** @brief Consumes count result elements. */
+typedef mn_result_t (*mn_stream_write_fn)(void * ctx, const void * dst, size_t count);
+
+/**
+ * @brief Options for the mn_stream_* helpers. A NULL config uses the defaults.
+ */
+typedef struct
+{
+    size_t chunk_bytes;  /* bytes per chunk and per array, 0 = MN_STREAM_DEFAULT_CHUNK */
+    int    advise;       /* non-zero: sequential / will-need read-ahead hints to the kernel */
+    int    io_thread;    /* non-zero: a helper thread faults in or reads the next chunk */
+} mn_stream_config_t;
+
+/**
+ * @brief A file mapped into memory by mn_stream_map_file.
+ */
+typedef struct
+{
+    void *   data;       /* start of the mapping */
+    size_t   size;       /* mapped bytes */
+    intptr_t file;       /* file descriptor / HANDLE */
+    intptr_t mapping;    /* mapping HANDLE on Windows, unused elsewhere */
+} mn_stream_map_t;
+
 #endif // MN_DTYPES_H
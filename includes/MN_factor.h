@@ -3,7 +3,11 @@
 
 #include <assert.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <math.h>
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -13,15 +17,19 @@ extern "C" {
 // Macros for pointer overlap safety checks
 // -----------------------------------------------------------------------------
 //
-// These macros check whether two buffers (dst and src) overlap in memory.
-// This prevents undefined behavior when functions read from src and write to dst.
+// These macros check how the dst and src buffers share memory. All kernels
+// are elementwise, so they run in place: dst may be exactly the same pointer
+// as a source. A partial overlap (dst starting inside a source range, or the
+// other way around) would read already written results and is rejected.
 // They assume that `count` is the number of elements (not bytes).
 // -----------------------------------------------------------------------------
 
 /**
- * @brief Ensures that dst and src do not overlap for `count` elements.
+ * @brief Ensures that dst and src are either the same buffer or do not
+ * overlap for `count` elements.
  *
  * Expands into a runtime assertion:
+ *  - If dst == src, the call is an in-place operation and is accepted.
  *  - If dst < src, then the dst range must end before src begins.
  *  - If dst > src, then the src range must end before dst begins.
  *
@@ -40,35 +48,580 @@ extern "C" {
         } \
     } while (0)
 
-#define MN_CHECK_Dst1SRC1SRC2(arg1, arg2, arg3) \
-   if ( (void *)arg1 < (void *)arg2 ) \
-    { assert ( (void *)arg1 + count <= (void *)arg2 ); } \
-   else if ( (void *)arg1 > (void *)arg2 ) \
-    { assert ( (void *)arg2 + count <= (void *)arg1 ); } \
-   if ( (void *)arg1 < (void *)arg3 ) \
-    { assert ( (void *)arg1 + count <= (void *)arg3 ); } \
-   else if ( (void *)arg1 > (void *)arg3 ) \
-    { assert ( (void *)arg3 + count <= (void *)arg1 ); } \
-   if ( (void *)arg3 < (void *)arg2 ) \
-    { assert ( (void *)arg3 + count <= (void *)arg2 ); } \
-   else if ( (void *)arg3 > (void *)arg2 ) \
-    { assert ( (void *)arg2 + count <= (void *)arg3 ); }
+/**
+ * @brief Same rule as MN_CHECK_DstSRC for two-source kernels: dst is checked
+ * against src1 and src2. The sources are only read, so src1 and src2 may
+ * overlap each other freely.
+ */
 
+#define MN_CHECK_Dst1SRC1SRC2(arg1, arg2, arg3) \
+    do { \
+        const char* dst_bytes = (const char*)(arg1); \
+        const char* src1_bytes = (const char*)(arg2); \
+        const char* src2_bytes = (const char*)(arg3); \
+        if (dst_bytes < src1_bytes) { \
+            assert(dst_bytes + count * sizeof(*(arg1)) <= src1_bytes); \
+        } else if (dst_bytes > src1_bytes) { \
+            assert(src1_bytes + count * sizeof(*(arg2)) <= dst_bytes); \
+        } \
+        if (dst_bytes < src2_bytes) { \
+            assert(dst_bytes + count * sizeof(*(arg1)) <= src2_bytes); \
+        } else if (dst_bytes > src2_bytes) { \
+            assert(src2_bytes + count * sizeof(*(arg3)) <= dst_bytes); \
+        } \
+    } while (0)
 
 #define MN_ASSERT_DS MN_CHECK_DstSRC
 #define MN_ASSERT_DS1S2(dst, src1, src2) MN_CHECK_Dst1SRC1SRC2(dst, src1, src2)
 
+// -----------------------------------------------------------------------------
+// Loop macros for the C implementations
+// -----------------------------------------------------------------------------
+//
+// The loop body is written against the local pointers d (dst), s (src) or
+// s1/s2 (src1/src2). When dst is one of the sources the loop runs on plain
+// pointers (in-place call). Otherwise the locals are restrict-qualified so the
+// compiler knows the buffers are disjoint and can vectorize the loop.
+// -----------------------------------------------------------------------------
+
+#if defined(_MSC_VER)
+#define MN_RESTRICT __restrict
+#elif defined(__GNUC__) || defined(__clang__)
+#define MN_RESTRICT __restrict__
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
+#define MN_RESTRICT restrict
+#else
+#define MN_RESTRICT
+#endif
+
+#define MN_C_DstSrc_DO_COUNT_TIMES(type, loopCode) \
+    if ( (const void *)dst == (const void *)src ) \
+    { \
+        type * d = dst; \
+        const type * s = src; \
+        for ( size_t itr = 0; itr < count; itr++ ) { loopCode } \
+    } \
+    else \
+    { \
+        type * MN_RESTRICT d = dst; \
+        const type * MN_RESTRICT s = src; \
+        for ( size_t itr = 0; itr < count; itr++ ) { loopCode } \
+    }
+
+#define MN_C_DstSrc1Src2_DO_COUNT_TIMES(type, loopCode) \
+    if ( (const void *)dst == (const void *)src1 || (const void *)dst == (const void *)src2 ) \
+    { \
+        type * d = dst; \
+        const type * s1 = src1; \
+        const type * s2 = src2; \
+        for ( size_t itr = 0; itr < count; itr++ ) { loopCode } \
+    } \
+    else \
+    { \
+        type * MN_RESTRICT d = dst; \
+        const type * MN_RESTRICT s1 = src1; \
+        const type * MN_RESTRICT s2 = src2; \
+        for ( size_t itr = 0; itr < count; itr++ ) { loopCode } \
+    }
+
+// -----------------------------------------------------------------------------
+// Software prefetch for the NEON main loops
+// -----------------------------------------------------------------------------
+//
+// Every MAINLOOP macro below issues a streaming prefetch for its source
+// pointers, `mn_prefetch_distance` bytes ahead of the current load. In-order
+// cores (Cortex-A53/A55) have a weak hardware prefetcher and benefit from it;
+// out-of-order cores usually do not, so the distance defaults to 0 (disabled).
+//
+// A kernel reads the distance once, with MN_PREFETCH_INIT before its loop, and
+// issues one hint per 64-byte cache line rather than one per loaded register.
+//
+// The default comes from MN_PREFETCH_DISTANCE (set with -DMN_PREFETCH_DISTANCE
+// in CMake) and can be changed at runtime with mn_set_prefetch_distance().
+// Use `mn_bench prefetch` to find the best value for a given CPU.
+// -----------------------------------------------------------------------------
+
+#ifndef MN_PREFETCH_DISTANCE
+#define MN_PREFETCH_DISTANCE 0
+#endif
+
+/* Current prefetch distance in bytes, 0 disables prefetching (MN_prefetch.c) */
+extern size_t mn_prefetch_distance;
+
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_ARM64)
+#include <intrin.h>
+#define MN_PREFETCH_HINT(addr) __prefetch2((const void *)(addr), 1) /* PLDL1STRM */
+#elif defined(__GNUC__) || defined(__clang__)
+#define MN_PREFETCH_HINT(addr) __builtin_prefetch((const void *)(addr), 0, 0) /* PLDL1STRM */
+#else
+#define MN_PREFETCH_HINT(addr) ((void)0)
+#endif
+
+#define MN_PREFETCH_LINE 64
+
+/* Declares the distance used by MN_PREFETCH_SRC, once per call */
+#define MN_PREFETCH_INIT const size_t mn_pf_dist = mn_prefetch_distance
+
+/*
+    For a pointer that advances `step` bytes per iteration, the offset within
+    the line is below `step` exactly once per line, whatever the alignment; a
+    step of a line or more prefetches on every iteration. Prefetch hints never
+    fault, so running past the end of src is harmless.
+*/
+#define MN_PREFETCH_SRC_STEP(ptr, step) \
+    do { \
+        if (mn_pf_dist != 0 && ((uintptr_t)(ptr) & (MN_PREFETCH_LINE - 1)) < (uintptr_t)(step)) { \
+            MN_PREFETCH_HINT((const char *)(ptr) + mn_pf_dist); \
+        } \
+    } while (0)
+
+/* One q register (16 bytes) per iteration */
+#define MN_PREFETCH_SRC(ptr) MN_PREFETCH_SRC_STEP(ptr, 16)
+
+// -----------------------------------------------------------------------------
+// Half precision (float16) support in the NEON kernels
+// -----------------------------------------------------------------------------
+//
+// MN_FP16_NATIVE - float16x8_t arithmetic is available (ARMv8.2-A FP16), the
+//                  kernels work on 8 halves per instruction.
+// MN_FP16_CVT    - only the conversions vcvt_f32_f16 / vcvt_f16_f32 are
+//                  available, the kernels widen to float32, compute and narrow.
+// Without either, the float16 NEON entry points call the C implementations.
+// -----------------------------------------------------------------------------
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+#define MN_FP16_NATIVE 1
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64) || (defined(__ARM_NEON_FP) && (__ARM_NEON_FP & 2))
+#define MN_FP16_CVT 1
+#endif
+
+// -----------------------------------------------------------------------------
+// Float helpers shared by the NEON kernels
+// -----------------------------------------------------------------------------
+//
+// MN_NEON_FMA       - vfmaq_f32 / vfmsq_f32 are available (AArch64, or 32-bit
+//                     ARM with VFPv4). MN_FMAQ_F32 / MN_FMSQ_F32 (acc + a * b,
+//                     acc - a * b) and MN_FMAQ_N_F32 (acc + a * scalar) fuse
+//                     there and use vmlaq / vmlsq otherwise, so the last bit
+//                     can differ between the two.
+// MN_FMAQ_LANEQ_F32 - acc + a * v[l], l a constant 0 .. 3. Fused on AArch64
+//                     only, 32-bit ARM has no by-lane vfma.
+// mn_hsumq_f32/s32  - sum of the 4 lanes.
+// mn_divq_f32       - a / b, and mn_recipq_f32 1 / x: vdivq_f32 on AArch64,
+//                     the vrecpeq_f32 estimate and two vrecpsq_f32 Newton steps
+//                     on 32-bit ARM (within a couple of ulp for normal b).
+// MN_MAP_F32_NEON   - d[i] = VEC(s[i]) for n floats: four vectors per step,
+//                     then one, then the last 1 - 3 values in a vector whose
+//                     spare lanes hold pad, so the tail runs the same VEC.
+// -----------------------------------------------------------------------------
+
+#if defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_FEATURE_FMA)
+#define MN_NEON_FMA 1
+#define MN_FMAQ_F32(acc, a, b) vfmaq_f32((acc), (a), (b))
+#define MN_FMSQ_F32(acc, a, b) vfmsq_f32((acc), (a), (b))
+#else
+#define MN_FMAQ_F32(acc, a, b) vmlaq_f32((acc), (a), (b))
+#define MN_FMSQ_F32(acc, a, b) vmlsq_f32((acc), (a), (b))
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define MN_FMAQ_N_F32(acc, a, s)        vfmaq_n_f32((acc), (a), (s))
+#define MN_FMAQ_LANEQ_F32(acc, a, v, l) vfmaq_laneq_f32((acc), (a), (v), l)
+#else
+#define MN_FMAQ_N_F32(acc, a, s)        MN_FMAQ_F32((acc), (a), vdupq_n_f32(s))
+#define MN_FMAQ_LANEQ_F32(acc, a, v, l) MN_FMAQ_LANEQ_F32_##l(acc, a, v)
+#define MN_FMAQ_LANEQ_F32_0(acc, a, v)  vmlaq_lane_f32((acc), (a), vget_low_f32(v), 0)
+#define MN_FMAQ_LANEQ_F32_1(acc, a, v)  vmlaq_lane_f32((acc), (a), vget_low_f32(v), 1)
+#define MN_FMAQ_LANEQ_F32_2(acc, a, v)  vmlaq_lane_f32((acc), (a), vget_high_f32(v), 0)
+#define MN_FMAQ_LANEQ_F32_3(acc, a, v)  vmlaq_lane_f32((acc), (a), vget_high_f32(v), 1)
+#endif
+
+#define MN_MAP_F32_NEON(d, s, n, VEC, pad) \
+    do { \
+        size_t itr = 0; \
+        for ( ; itr + 16 <= (n); itr += 16 ) \
+        { \
+            const float32x4_t r0 = VEC(vld1q_f32((s) + itr)); \
+            const float32x4_t r1 = VEC(vld1q_f32((s) + itr + 4)); \
+            const float32x4_t r2 = VEC(vld1q_f32((s) + itr + 8)); \
+            const float32x4_t r3 = VEC(vld1q_f32((s) + itr + 12)); \
+            vst1q_f32((d) + itr, r0); \
+            vst1q_f32((d) + itr + 4, r1); \
+            vst1q_f32((d) + itr + 8, r2); \
+            vst1q_f32((d) + itr + 12, r3); \
+        } \
+        for ( ; itr + 4 <= (n); itr += 4 ) \
+        { \
+            vst1q_f32((d) + itr, VEC(vld1q_f32((s) + itr))); \
+        } \
+        if (itr < (n)) \
+        { \
+            float buf_[ 4 ] = { (pad), (pad), (pad), (pad) }; \
+            for ( size_t i = 0; itr + i < (n); i++ ) buf_[ i ] = (s)[ itr + i ]; \
+            vst1q_f32(buf_, VEC(vld1q_f32(buf_))); \
+            for ( size_t i = 0; itr + i < (n); i++ ) (d)[ itr + i ] = buf_[ i ]; \
+        } \
+    } while (0)
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM) || defined(_M_ARM64)
+static inline float mn_hsumq_f32 (float32x4_t v)
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+    return vaddvq_f32(v);
+#else
+    float32x2_t s = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+    return vget_lane_f32(vpadd_f32(s, s), 0);
+#endif
+}
+
+static inline int32_t mn_hsumq_s32 (int32x4_t v)
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+    return vaddvq_s32(v);
+#else
+    int32x2_t s = vadd_s32(vget_low_s32(v), vget_high_s32(v));
+    return vget_lane_s32(vpadd_s32(s, s), 0);
+#endif
+}
+
+static inline float32x4_t mn_recipq_f32 (float32x4_t x)
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+    return vdivq_f32(vdupq_n_f32(1.0f), x);
+#else
+    float32x4_t r = vrecpeq_f32(x);
+    r = vmulq_f32(r, vrecpsq_f32(x, r));
+    return vmulq_f32(r, vrecpsq_f32(x, r));
+#endif
+}
+
+static inline float32x4_t mn_divq_f32 (float32x4_t a, float32x4_t b)
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+    return vdivq_f32(a, b);
+#else
+    return vmulq_f32(a, mn_recipq_f32(b));
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// bfloat16 support in the NEON kernels
+// -----------------------------------------------------------------------------
+//
+// MN_BF16_NATIVE - the ARMv8.6-A BF16 instructions are available: narrowing
+//                  uses vcvtq_low/high_bf16_f32 and dot products use
+//                  vbfdotq_f32. Without it the kernels narrow with integer
+//                  rounding, which works on every NEON target.
+// -----------------------------------------------------------------------------
+
+#if defined(__ARM_FEATURE_BF16_VECTOR_ARITHMETIC)
+#define MN_BF16_NATIVE 1
+#endif
+
+// -----------------------------------------------------------------------------
+// Double precision (float64) support in the NEON kernels
+// -----------------------------------------------------------------------------
+//
+// MN_FP64_NEON - float64x2_t arithmetic is available (AArch64 only). On 32-bit
+//                ARM the float64 NEON entry points call the C implementations.
+// -----------------------------------------------------------------------------
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define MN_FP64_NEON 1
+#endif
+
+// -----------------------------------------------------------------------------
+// Type conversion (mn_cvt_*) kernels
+// -----------------------------------------------------------------------------
+//
+// MN_CVT_NEON - the NEON conversions need the AArch64 rounding conversions
+//               (vcvtnq / vcvtmq / vcvtpq_s32_f32) and a fused vfmaq_f32 to
+//               give the same bits as the C versions. On 32-bit ARM the
+//               mn_cvt_*_neon entry points call the C implementations.
+//
+// dst and src have different element sizes, so they may only alias when the
+// sizes match (e.g. int32 <-> float in place).
+// -----------------------------------------------------------------------------
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define MN_CVT_NEON 1
+#endif
+
+#define MN_CHECK_CVT(dst, src, count) \
+    do { \
+        const char * d_ = (const char *)(dst); \
+        const char * s_ = (const char *)(src); \
+        assert((dst) && (src)); \
+        assert((d_ == s_ && sizeof(*(dst)) == sizeof(*(src))) || \
+               d_ + (count) * sizeof(*(dst)) <= s_ || s_ + (count) * sizeof(*(src)) <= d_); \
+        (void)d_; (void)s_; \
+    } while (0)
+
+// -----------------------------------------------------------------------------
+// Complex (mn_complexf_t) kernels
+// -----------------------------------------------------------------------------
+//
+// MN_COMPLEX_FCMLA - the ARMv8.3-A complex instructions are available: the
+//                    multiplies run vcmlaq_f32 / vcmlaq_rot*_f32 on the
+//                    interleaved data. Without it the kernels deinterleave
+//                    with vld2q_f32 and use separate real / imaginary vectors.
+// -----------------------------------------------------------------------------
+
+#if defined(__ARM_FEATURE_COMPLEX)
+#define MN_COMPLEX_FCMLA 1
+#endif
+
+// -----------------------------------------------------------------------------
+// Narrow integer (int8 / uint8 / int16 / uint16) kernels
+// -----------------------------------------------------------------------------
+//
+// Every op has a wrapping form (mn_add_int16_*) and a saturating form
+// (mn_add_sat_int16_*). The generators below define the C and NEON versions of
+// add/sub/mul/addc/subc/mulc for one element type; the NEON ones handle one
+// 128-bit register (16 x 8-bit or 8 x 16-bit lanes) per step and run the
+// leftover elements through a zero padded register.
+//
+// C loop bodies see x and y (src1 / src2 or cst) widened to `wide`: uint32_t
+// for the wrapping forms, int64_t for the saturating ones.
+// -----------------------------------------------------------------------------
+
+#define MN_SAT_CLAMP(type, lo, hi, v) ((type)((v) < (lo) ? (lo) : ((v) > (hi) ? (hi) : (v))))
+
+#define MN_INTN_C_BINARY(op, tname, type, wide, expr) \
+mn_result_t mn_##op##_##tname##_c (type * dst, type * src1, type * src2, size_t count) \
+{ \
+    MN_ASSERT_DS1S2(dst, src1, src2); \
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(type, \
+        const wide x = (wide)s1[itr]; \
+        const wide y = (wide)s2[itr]; \
+        d[itr] = (type)(expr); \
+    ); \
+    return MN_SUCCESS; \
+}
+
+#define MN_INTN_C_CONST(op, tname, type, wide, expr) \
+mn_result_t mn_##op##_##tname##_c (type * dst, type * src, const type cst, size_t count) \
+{ \
+    const wide y = (wide)cst; \
+    MN_ASSERT_DS; \
+    MN_C_DstSrc_DO_COUNT_TIMES(type, \
+        const wide x = (wide)s[itr]; \
+        d[itr] = (type)(expr); \
+    ); \
+    return MN_SUCCESS; \
+}
+
+#define MN_INTN_C_UNARY(op, tname, type, wide, expr) \
+mn_result_t mn_##op##_##tname##_c (type * dst, type * src, size_t count) \
+{ \
+    MN_ASSERT_DS; \
+    MN_C_DstSrc_DO_COUNT_TIMES(type, \
+        const wide x = (wide)s[itr]; \
+        d[itr] = (type)(expr); \
+    ); \
+    return MN_SUCCESS; \
+}
+
+#define MN_INTN_C_FAMILY(tname, type, lo, hi) \
+    MN_INTN_C_BINARY(add, tname, type, uint32_t, x + y) \
+    MN_INTN_C_BINARY(sub, tname, type, uint32_t, x - y) \
+    MN_INTN_C_BINARY(mul, tname, type, uint32_t, x * y) \
+    MN_INTN_C_CONST(addc, tname, type, uint32_t, x + y) \
+    MN_INTN_C_CONST(subc, tname, type, uint32_t, x - y) \
+    MN_INTN_C_CONST(mulc, tname, type, uint32_t, x * y) \
+    MN_INTN_C_BINARY(add_sat, tname, type, int64_t, MN_SAT_CLAMP(type, lo, hi, x + y)) \
+    MN_INTN_C_BINARY(sub_sat, tname, type, int64_t, MN_SAT_CLAMP(type, lo, hi, x - y)) \
+    MN_INTN_C_BINARY(mul_sat, tname, type, int64_t, MN_SAT_CLAMP(type, lo, hi, x * y)) \
+    MN_INTN_C_CONST(addc_sat, tname, type, int64_t, MN_SAT_CLAMP(type, lo, hi, x + y)) \
+    MN_INTN_C_CONST(subc_sat, tname, type, int64_t, MN_SAT_CLAMP(type, lo, hi, x - y)) \
+    MN_INTN_C_CONST(mulc_sat, tname, type, int64_t, MN_SAT_CLAMP(type, lo, hi, x * y))
+
+/* abs only exists for the signed types: |min| wraps to min, or saturates to max */
+#define MN_INTN_C_ABS(tname, type, lo, hi) \
+    MN_INTN_C_UNARY(abs, tname, type, int64_t, (uint32_t)(x < 0 ? -x : x)) \
+    MN_INTN_C_UNARY(abs_sat, tname, type, int64_t, MN_SAT_CLAMP(type, lo, hi, x < 0 ? -x : x))
+
+#define MN_INTN_NEON_BINARY(op, tname, type, vtype, lanes, sfx, VOP) \
+mn_result_t mn_##op##_##tname##_neon (type * dst, type * src1, type * src2, size_t count) \
+{ \
+    size_t i = 0; \
+    MN_ASSERT_DS1S2(dst, src1, src2); \
+    MN_PREFETCH_INIT; \
+    for (; i + (lanes) <= count; i += (lanes)) \
+    { \
+        MN_PREFETCH_SRC(src1 + i); \
+        MN_PREFETCH_SRC(src2 + i); \
+        vst1q_##sfx(dst + i, VOP(vld1q_##sfx(src1 + i), vld1q_##sfx(src2 + i))); \
+    } \
+    if (i < count) \
+    { \
+        type ta[lanes] = { 0 }, tb[lanes] = { 0 }, td[lanes]; \
+        memcpy(ta, src1 + i, (count - i) * sizeof(type)); \
+        memcpy(tb, src2 + i, (count - i) * sizeof(type)); \
+        vst1q_##sfx(td, VOP(vld1q_##sfx(ta), vld1q_##sfx(tb))); \
+        memcpy(dst + i, td, (count - i) * sizeof(type)); \
+    } \
+    return MN_SUCCESS; \
+}
+
+#define MN_INTN_NEON_CONST(op, tname, type, vtype, lanes, sfx, VOP) \
+mn_result_t mn_##op##_##tname##_neon (type * dst, type * src, const type cst, size_t count) \
+{ \
+    const vtype n_cst = vdupq_n_##sfx(cst); \
+    size_t i = 0; \
+    MN_ASSERT_DS; \
+    MN_PREFETCH_INIT; \
+    for (; i + (lanes) <= count; i += (lanes)) \
+    { \
+        MN_PREFETCH_SRC(src + i); \
+        vst1q_##sfx(dst + i, VOP(vld1q_##sfx(src + i), n_cst)); \
+    } \
+    if (i < count) \
+    { \
+        type ta[lanes] = { 0 }, td[lanes]; \
+        memcpy(ta, src + i, (count - i) * sizeof(type)); \
+        vst1q_##sfx(td, VOP(vld1q_##sfx(ta), n_cst)); \
+        memcpy(dst + i, td, (count - i) * sizeof(type)); \
+    } \
+    return MN_SUCCESS; \
+}
+
+#define MN_INTN_NEON_UNARY(op, tname, type, vtype, lanes, sfx, VOP) \
+mn_result_t mn_##op##_##tname##_neon (type * dst, type * src, size_t count) \
+{ \
+    size_t i = 0; \
+    MN_ASSERT_DS; \
+    MN_PREFETCH_INIT; \
+    for (; i + (lanes) <= count; i += (lanes)) \
+    { \
+        MN_PREFETCH_SRC(src + i); \
+        vst1q_##sfx(dst + i, VOP(vld1q_##sfx(src + i))); \
+    } \
+    if (i < count) \
+    { \
+        type ta[lanes] = { 0 }, td[lanes]; \
+        memcpy(ta, src + i, (count - i) * sizeof(type)); \
+        vst1q_##sfx(td, VOP(vld1q_##sfx(ta))); \
+        memcpy(dst + i, td, (count - i) * sizeof(type)); \
+    } \
+    return MN_SUCCESS; \
+}
+
+/* The saturating multiply needs mn_qmulq_<sfx>, defined by the including file. */
+#define MN_INTN_NEON_FAMILY(tname, type, vtype, lanes, sfx) \
+    MN_INTN_NEON_BINARY(add, tname, type, vtype, lanes, sfx, vaddq_##sfx) \
+    MN_INTN_NEON_BINARY(sub, tname, type, vtype, lanes, sfx, vsubq_##sfx) \
+    MN_INTN_NEON_BINARY(mul, tname, type, vtype, lanes, sfx, vmulq_##sfx) \
+    MN_INTN_NEON_CONST(addc, tname, type, vtype, lanes, sfx, vaddq_##sfx) \
+    MN_INTN_NEON_CONST(subc, tname, type, vtype, lanes, sfx, vsubq_##sfx) \
+    MN_INTN_NEON_CONST(mulc, tname, type, vtype, lanes, sfx, vmulq_##sfx) \
+    MN_INTN_NEON_BINARY(add_sat, tname, type, vtype, lanes, sfx, vqaddq_##sfx) \
+    MN_INTN_NEON_BINARY(sub_sat, tname, type, vtype, lanes, sfx, vqsubq_##sfx) \
+    MN_INTN_NEON_BINARY(mul_sat, tname, type, vtype, lanes, sfx, mn_qmulq_##sfx) \
+    MN_INTN_NEON_CONST(addc_sat, tname, type, vtype, lanes, sfx, vqaddq_##sfx) \
+    MN_INTN_NEON_CONST(subc_sat, tname, type, vtype, lanes, sfx, vqsubq_##sfx) \
+    MN_INTN_NEON_CONST(mulc_sat, tname, type, vtype, lanes, sfx, mn_qmulq_##sfx)
+
+#define MN_INTN_NEON_ABS(tname, type, vtype, lanes, sfx) \
+    MN_INTN_NEON_UNARY(abs, tname, type, vtype, lanes, sfx, vabsq_##sfx) \
+    MN_INTN_NEON_UNARY(abs_sat, tname, type, vtype, lanes, sfx, vqabsq_##sfx)
+
+// -----------------------------------------------------------------------------
+// int32 saturating and overflow-checked kernels
+// -----------------------------------------------------------------------------
+//
+// The int32 _sat routines reuse the MN_INTN_* generators above. The _ovf
+// routines store the wrapping result like mn_add_int32_* and return
+// MN_OVERFLOW when any element overflowed. The NEON loop ORs a per-lane
+// overflow mask (sign bit set on overflow) and reduces it once at the end,
+// so the check adds two or three instructions per register.
+// -----------------------------------------------------------------------------
+
+/* Saturating int32 multiply: exact 64-bit products narrowed with saturation */
+#define MN_QMULQ_S32(a, b) \
+    vcombine_s32(vqmovn_s64(vmull_s32(vget_low_s32(a), vget_low_s32(b))), \
+                 vqmovn_s64(vmull_s32(vget_high_s32(a), vget_high_s32(b))))
+
+#define MN_INT32_ADD_WRAP(a, b) ((mn_int32_t)((uint32_t)(a) + (uint32_t)(b)))
+#define MN_INT32_SUB_WRAP(a, b) ((mn_int32_t)((uint32_t)(a) - (uint32_t)(b)))
+#define MN_INT32_MUL_WRAP(a, b) ((mn_int32_t)((uint32_t)(a) * (uint32_t)(b)))
+
+/* Scalar overflow masks: negative when a op b overflowed into r */
+#define MN_INT32_ADD_OVF(a, b, r) (((a) ^ (r)) & ((b) ^ (r)))
+#define MN_INT32_SUB_OVF(a, b, r) (((a) ^ (b)) & ((a) ^ (r)))
+#define MN_INT32_MUL_OVF(a, b, r) ((int64_t)(a) * (b) != (int64_t)(r) ? -1 : 0)
+
+#define MN_INT32X4_ADD_OVF(a, b, r) vandq_s32(veorq_s32((a), (r)), veorq_s32((b), (r)))
+#define MN_INT32X4_SUB_OVF(a, b, r) vandq_s32(veorq_s32((a), (b)), veorq_s32((a), (r)))
+/* mul: the high half of the exact 64-bit product must be the sign extension of r */
+#define MN_INT32X4_MUL_OVF(a, b, r) \
+    vreinterpretq_s32_u32(vmvnq_u32(vceqq_s32( \
+        vcombine_s32(vshrn_n_s64(vmull_s32(vget_low_s32(a), vget_low_s32(b)), 32), \
+                     vshrn_n_s64(vmull_s32(vget_high_s32(a), vget_high_s32(b)), 32)), \
+        vshrq_n_s32((r), 31))))
+
+#define MN_INT32_C_OVF(op, SOP, SFLAG) \
+mn_result_t mn_##op##_ovf_int32_c (mn_int32_t * dst, mn_int32_t * src1, mn_int32_t * src2, size_t count) \
+{ \
+    mn_int32_t flag = 0; \
+    MN_ASSERT_DS1S2(dst, src1, src2); \
+    for ( size_t itr = 0; itr < count; itr++ ) \
+    { \
+        const mn_int32_t a = src1[itr]; \
+        const mn_int32_t b = src2[itr]; \
+        const mn_int32_t r = SOP(a, b); \
+        flag |= SFLAG(a, b, r); \
+        dst[itr] = r; \
+    } \
+    return flag < 0 ? MN_OVERFLOW : MN_SUCCESS; \
+}
+
+#define MN_INT32_NEON_OVF(op, VOP, VFLAG, SOP, SFLAG) \
+mn_result_t mn_##op##_ovf_int32_neon (mn_int32_t * dst, mn_int32_t * src1, mn_int32_t * src2, size_t count) \
+{ \
+    int32x4_t n_flag = vdupq_n_s32(0); \
+    int32x2_t n_half; \
+    mn_int32_t flag; \
+    size_t i = 0; \
+    MN_ASSERT_DS1S2(dst, src1, src2); \
+    MN_PREFETCH_INIT; \
+    for (; i + 4 <= count; i += 4) \
+    { \
+        const int32x4_t n_a = vld1q_s32(src1 + i); \
+        const int32x4_t n_b = vld1q_s32(src2 + i); \
+        const int32x4_t n_r = VOP(n_a, n_b); \
+        MN_PREFETCH_SRC(src1 + i); \
+        MN_PREFETCH_SRC(src2 + i); \
+        n_flag = vorrq_s32(n_flag, VFLAG(n_a, n_b, n_r)); \
+        vst1q_s32(dst + i, n_r); \
+    } \
+    n_half = vorr_s32(vget_low_s32(n_flag), vget_high_s32(n_flag)); \
+    flag = vget_lane_s32(n_half, 0) | vget_lane_s32(n_half, 1); \
+    for (; i < count; i++) \
+    { \
+        const mn_int32_t a = src1[i]; \
+        const mn_int32_t b = src2[i]; \
+        const mn_int32_t r = SOP(a, b); \
+        flag |= SFLAG(a, b, r); \
+        dst[i] = r; \
+    } \
+    return flag < 0 ? MN_OVERFLOW : MN_SUCCESS; \
+}
+
 
 #define MN_ABS_DstSrc_DO_COUNT_TIMES_FLOAT_NEON(loopCode1, loopCode2) { \
     MN_ASSERT_DS; /* check dst/src pointers does not overlap*/ \
     float32x4_t n_src; \
     float32x4_t n_dst; \
-    int dif = count % 4; /* finds remaining elements if not multiple of 4 */ \
+    size_t dif = count % 4; /* finds remaining elements if not multiple of 4 */ \
+    MN_PREFETCH_INIT; \
     for (; count > dif; count -= 4) { \
         loopCode1; \
     } \
     if (dif != 0) { \
-        for (unsigned int idx = 0; idx < dif; idx++) { \
+        for (size_t idx = 0; idx < dif; idx++) { \
             loopCode2; \
         } \
     } \
@@ -78,12 +631,13 @@ extern "C" {
     MN_ASSERT_DS; /* check dst/src pointers does not overlap*/ \
     int32x4_t n_src; \
     int32x4_t n_dst; \
-    int dif = count % 4; /* finds remaining elements if not multiple of 4 */ \
+    size_t dif = count % 4; /* finds remaining elements if not multiple of 4 */ \
+    MN_PREFETCH_INIT; \
     for (; count > dif; count -= 4) { \
         loopCode1; \
     } \
     if (dif != 0) { \
-        for (unsigned int idx = 0; idx < dif; idx++) { \
+        for (size_t idx = 0; idx < dif; idx++) { \
             loopCode2; \
         } \
     } \
@@ -93,7 +647,8 @@ extern "C" {
    mn_result_t res = MN_OK; \
    float32x4_t n_src; \
    float32x4_t n_dst; \
-   int dif = count % 2; \
+   size_t dif = count % 2; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 2) { \
     loopCode1; \
    } \
@@ -107,7 +662,8 @@ extern "C" {
    mn_result_t res = MN_OK; \
    int32x4_t n_src; \
    int32x4_t n_dst; \
-   int dif = count % 2; \
+   size_t dif = count % 2; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 2) { \
     loopCode1; \
    } \
@@ -121,12 +677,13 @@ extern "C" {
   mn_result_t res = MN_OK; \
   float32x4_t n_src1, n_src2, n_src3; \
   float32x4_t n_dst1, n_dst2, n_dst3; \
-  int dif = count % 4;  \
+  size_t dif = count % 4;  \
+  MN_PREFETCH_INIT; \
   for (; count > dif; count -= 4) { \
    loopCode1; \
   } \
   if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
     } \
@@ -138,12 +695,13 @@ extern "C" {
   mn_result_t res = MN_OK; \
   int32x4_t n_src1, n_src2, n_src3; \
   int32x4_t n_dst1, n_dst2, n_dst3; \
-  int dif = count % 4;  \
+  size_t dif = count % 4;  \
+  MN_PREFETCH_INIT; \
   for (; count > dif; count -= 4) { \
    loopCode1; \
   } \
   if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
     } \
@@ -155,6 +713,7 @@ extern "C" {
    mn_result_t res = MN_OK; \
    float32x4_t n_src; \
    float32x4_t n_dst; \
+   MN_PREFETCH_INIT; \
    for (; count != 0; count --) { \
      loopCode; \
     } \
@@ -165,6 +724,7 @@ extern "C" {
    mn_result_t res = MN_OK; \
    int32x4_t n_src; \
    int32x4_t n_dst; \
+   MN_PREFETCH_INIT; \
    for (; count != 0; count --) { \
      loopCode; \
     } \
@@ -172,6 +732,7 @@ extern "C" {
 }
 
 #define MN_MAINLOOP_FLOAT_NEON_ABS { \
+    MN_PREFETCH_SRC(src); \
     n_src = vld1q_f32((float32_t*)src); /* load 4 floats */ \
     n_dst = vabsq_f32(n_src);           /* compute abs */ \
     vst1q_f32((float32_t*)dst, n_dst); /* store back */ \
@@ -180,6 +741,7 @@ extern "C" {
 }
 
 #define MN_MAINLOOP_INT32_NEON_ABS { \
+    MN_PREFETCH_SRC(src); \
     n_src = vld1q_s32((int32_t*)src); /* load 4 int 32-bit elements */ \
     n_dst = vabsq_s32(n_src);           /* compute abs */ \
     vst1q_s32((int32_t*)dst, n_dst); /* store back */ \
@@ -188,6 +750,7 @@ extern "C" {
 }
 
 #define MN_ABS_DstSrc_MAINLOOP_VEC2F_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_f32( (float32_t*)src ); /* load two vectors */ \
      src += 2; /* move to the next two vectors */ \
      loopCode; /* actual operation */ /* The main loop iterates through two 2D vectors each time */ \
@@ -196,6 +759,7 @@ extern "C" {
 }
 
 #define MN_ABS_DstSrc_MAINLOOP_VEC2I_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_s32( (int32_t*)src ); /* load two vectors */ \
      src += 2; /* move to the next two vectors */ \
      loopCode; /* actual operation */ /* The main loop iterates through two 2D vectors each time */ \
@@ -210,6 +774,7 @@ extern "C" {
 */
 
 #define MN_ABS_DstSrc_MAINLOOP_VEC3F_NEON(loopCode) {                                  \
+    MN_PREFETCH_SRC_STEP(src, 48);                                                     \
     n_src1 = vld1q_f32((float32_t*)src);                                               \
     src = (mn_float32_t*)((char*)src + 4 * sizeof(mn_float32_t));                      \
     n_src2 = vld1q_f32((float32_t*)src);                                               \
@@ -227,6 +792,7 @@ extern "C" {
 
 
 #define MN_ABS_DstSrc_MAINLOOP_VEC3I_NEON(loopCode) {                                  \
+    MN_PREFETCH_SRC_STEP(src, 48);                                                     \
     n_src1 = vld1q_s32((int32_t*)src);                                                 \
     src = (mn_int32_t*)((char*)src + 4 * sizeof(mn_int32_t));                          \
     n_src2 = vld1q_s32((int32_t*)src);                                                 \
@@ -243,6 +809,7 @@ extern "C" {
 }
 
 #define MN_ABS_DstSrc_MAINLOOP_VEC4F_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_f32( (float32_t*)src ); \
      src ++; \
      loopCode; \
@@ -251,6 +818,7 @@ extern "C" {
 }
 
 #define MN_ABS_DstSrc_MAINLOOP_VEC4I_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_s32( (int32_t*)src ); \
      src ++; \
      loopCode; \
@@ -309,12 +877,13 @@ extern "C" {
     float32x4_t n_src1, n_src2; \
     float32x4_t n_dst; \
     float32x2_t n_rest1, n_rest2, n_rest; \
-    int dif = count % 4; /* finds remaining elements if not multiple of 4 */ \
+    size_t dif = count % 4; /* finds remaining elements if not multiple of 4 */ \
+    MN_PREFETCH_INIT; \
     for (; count > dif; count -= 4) { \
         loopCode1; \
     } \
     if (dif != 0) { \
-        for (unsigned int idx = 0; idx < dif; idx++) { \
+        for (size_t idx = 0; idx < dif; idx++) { \
             loopCode2; \
         } \
     } \
@@ -327,12 +896,13 @@ extern "C" {
     int32x4_t n_src1, n_src2; \
     int32x4_t n_dst; \
     int32x2_t n_rest1, n_rest2, n_rest; \
-    int dif = count % 4; /* finds remaining elements if not multiple of 4 */ \
+    size_t dif = count % 4; /* finds remaining elements if not multiple of 4 */ \
+    MN_PREFETCH_INIT; \
     for (; count > dif; count -= 4) { \
         loopCode1; \
     } \
     if (dif != 0) { \
-        for (unsigned int idx = 0; idx < dif; idx++) { \
+        for (size_t idx = 0; idx < dif; idx++) { \
             loopCode2; \
         } \
     } \
@@ -345,7 +915,8 @@ extern "C" {
    float32x4_t n_src1, n_src2; \
    float32x4_t n_dst; \
    float32x2_t n_rest1, n_rest2, n_rest; \
-   int dif = count % 2; \
+   size_t dif = count % 2; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 2) { \
     loopCode1; \
    } \
@@ -360,7 +931,8 @@ extern "C" {
    int32x4_t n_src1, n_src2; \
    int32x4_t n_dst; \
    int32x2_t n_rest1, n_rest2, n_rest; \
-   int dif = count % 2; \
+   size_t dif = count % 2; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 2) { \
     loopCode1; \
    } \
@@ -375,12 +947,13 @@ extern "C" {
   float32x4_t n_src11, n_src12, n_src13; \
   float32x4_t n_src21, n_src22, n_src23; \
   float32x4_t n_dst1, n_dst2, n_dst3; \
-  int dif = count % 4;  \
+  size_t dif = count % 4;  \
+  MN_PREFETCH_INIT; \
   for (; count > dif; count -= 4) { \
    loopCode1; \
   } \
   if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
     } \
@@ -393,12 +966,13 @@ extern "C" {
   int32x4_t n_src11, n_src12, n_src13; \
   int32x4_t n_src21, n_src22, n_src23; \
   int32x4_t n_dst1, n_dst2, n_dst3; \
-  int dif = count % 4;  \
+  size_t dif = count % 4;  \
+  MN_PREFETCH_INIT; \
   for (; count > dif; count -= 4) { \
    loopCode1; \
   } \
   if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
     } \
@@ -410,6 +984,7 @@ extern "C" {
    mn_result_t res = MN_OK; \
    float32x4_t n_src1, n_src2; \
    float32x4_t n_dst; \
+   MN_PREFETCH_INIT; \
    for (; count != 0; count --) { \
      loopCode; \
     } \
@@ -420,6 +995,7 @@ extern "C" {
    mn_result_t res = MN_OK; \
    int32x4_t n_src1, n_src2; \
    int32x4_t n_dst; \
+   MN_PREFETCH_INIT; \
    for (; count != 0; count --) { \
      loopCode; \
     } \
@@ -428,6 +1004,8 @@ extern "C" {
 
 // MAINLOOP macros for addition (load -> add -> store -> advance pointers)
 #define MN_MAINLOOP_FLOAT_NEON_ADD { \
+    MN_PREFETCH_SRC(src1); \
+    MN_PREFETCH_SRC(src2); \
     n_src1 = vld1q_f32((float32_t*)src1); /* load 4 floats from src1 */ \
     n_src2 = vld1q_f32((float32_t*)src2); /* load 4 floats from src2 */ \
     n_dst = vaddq_f32(n_src1, n_src2);    /* compute addition */ \
@@ -438,6 +1016,8 @@ extern "C" {
 }
 
 #define MN_MAINLOOP_INT32_NEON_ADD { \
+    MN_PREFETCH_SRC(src1); \
+    MN_PREFETCH_SRC(src2); \
     n_src1 = vld1q_s32((int32_t*)src1); /* load 4 int32 from src1 */ \
     n_src2 = vld1q_s32((int32_t*)src2); /* load 4 int32 from src2 */ \
     n_dst = vaddq_s32(n_src1, n_src2);  /* compute addition */ \
@@ -448,6 +1028,8 @@ extern "C" {
 }
 
 #define MN_ADD_DstSrc1Src2_MAINLOOP_VEC2F_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src1); \
+     MN_PREFETCH_SRC(src2); \
      n_src1 = vld1q_f32( (float32_t*)src1 ); /* load two vec2f (8 floats) */ \
      n_src2 = vld1q_f32( (float32_t*)src2 ); /* load two vec2f (8 floats) */ \
      src1 += 2; /* move to the next two vectors */ \
@@ -458,6 +1040,8 @@ extern "C" {
 }
 
 #define MN_ADD_DstSrc1Src2_MAINLOOP_VEC2I_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src1); \
+     MN_PREFETCH_SRC(src2); \
      n_src1 = vld1q_s32( (int32_t*)src1 ); /* load two vec2i */ \
      n_src2 = vld1q_s32( (int32_t*)src2 ); /* load two vec2i */ \
      src1 += 2; /* move to the next two vectors */ \
@@ -468,6 +1052,8 @@ extern "C" {
 }
 
 #define MN_ADD_DstSrc1Src2_MAINLOOP_VEC3F_NEON(loopCode) {                             \
+    MN_PREFETCH_SRC_STEP(src1, 48);                                                    \
+    MN_PREFETCH_SRC_STEP(src2, 48);                                                    \
     n_src11 = vld1q_f32((float32_t*)src1);                                             \
     src1 = (mn_vec3f_t*)((char*)src1 + 4 * sizeof(mn_float32_t));                      \
     n_src12 = vld1q_f32((float32_t*)src1);                                             \
@@ -490,6 +1076,8 @@ extern "C" {
 }
 
 #define MN_ADD_DstSrc1Src2_MAINLOOP_VEC3I_NEON(loopCode) {                             \
+    MN_PREFETCH_SRC_STEP(src1, 48);                                                    \
+    MN_PREFETCH_SRC_STEP(src2, 48);                                                    \
     n_src11 = vld1q_s32((int32_t*)src1);                                               \
     src1 = (mn_vec3i_t*)((char*)src1 + 4 * sizeof(mn_int32_t));                        \
     n_src12 = vld1q_s32((int32_t*)src1);                                               \
@@ -512,6 +1100,8 @@ extern "C" {
 }
 
 #define MN_ADD_DstSrc1Src2_MAINLOOP_VEC4F_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src1); \
+     MN_PREFETCH_SRC(src2); \
      n_src1 = vld1q_f32( (float32_t*)src1 ); \
      n_src2 = vld1q_f32( (float32_t*)src2 ); \
      src1 ++; \
@@ -522,6 +1112,8 @@ extern "C" {
 }
 
 #define MN_ADD_DstSrc1Src2_MAINLOOP_VEC4I_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src1); \
+     MN_PREFETCH_SRC(src2); \
      n_src1 = vld1q_s32( (int32_t*)src1 ); \
      n_src2 = vld1q_s32( (int32_t*)src2 ); \
      src1 ++; \
@@ -556,10 +1148,10 @@ extern "C" {
 
 #define MN_ADD_DstSrc1Src2_SECONDLOOP_VEC3F_NEON(loopCode) { \
      float32x2x3_t n_rest1, n_rest2; \
-     n_rest1 = vld3_f32( (float32_t*)src1 ); \
-     n_rest2 = vld3_f32( (float32_t*)src2 ); \
+     n_rest1 = vld3_lane_f32( (float32_t*)src1, n_rest1, 0); \
+     n_rest2 = vld3_lane_f32( (float32_t*)src2, n_rest2, 0); \
      loopCode; /* exceptional cases where the count isn't a multiple of 4 */ \
-     vst3_f32( (float32_t*)dst, n_rest1); /* store result */ \
+     vst3_lane_f32( (float32_t*)dst, n_rest1, 0); /* store result */ \
      src1++; \
      src2++; \
      dst++; \
@@ -567,10 +1159,10 @@ extern "C" {
 
 #define MN_ADD_DstSrc1Src2_SECONDLOOP_VEC3I_NEON(loopCode) { \
      int32x2x3_t n_rest1, n_rest2; \
-     n_rest1 = vld3_s32( (int32_t*)src1 ); \
-     n_rest2 = vld3_s32( (int32_t*)src2 ); \
+     n_rest1 = vld3_lane_s32( (int32_t*)src1, n_rest1, 0); \
+     n_rest2 = vld3_lane_s32( (int32_t*)src2, n_rest2, 0); \
      loopCode; /* exceptional cases where the count isn't a multiple of 4 */ \
-     vst3_s32( (int32_t*)dst, n_rest1); /* store result */ \
+     vst3_lane_s32( (int32_t*)dst, n_rest1, 0); /* store result */ \
      src1++; \
      src2++; \
      dst++; \
@@ -586,12 +1178,13 @@ extern "C" {
     float32x4_t n_src1, n_src2; \
     float32x4_t n_dst; \
     float32x2_t n_rest1, n_rest2, n_rest; \
-    int dif = count % 4; /* finds remaining elements if not multiple of 4 */ \
+    size_t dif = count % 4; /* finds remaining elements if not multiple of 4 */ \
+    MN_PREFETCH_INIT; \
     for (; count > dif; count -= 4) { \
         loopCode1; \
     } \
     if (dif != 0) { \
-        for (unsigned int idx = 0; idx < dif; idx++) { \
+        for (size_t idx = 0; idx < dif; idx++) { \
             loopCode2; \
         } \
     } \
@@ -604,12 +1197,13 @@ extern "C" {
     int32x4_t n_src1, n_src2; \
     int32x4_t n_dst; \
     int32x2_t n_rest1, n_rest2, n_rest; \
-    int dif = count % 4; /* finds remaining elements if not multiple of 4 */ \
+    size_t dif = count % 4; /* finds remaining elements if not multiple of 4 */ \
+    MN_PREFETCH_INIT; \
     for (; count > dif; count -= 4) { \
         loopCode1; \
     } \
     if (dif != 0) { \
-        for (unsigned int idx = 0; idx < dif; idx++) { \
+        for (size_t idx = 0; idx < dif; idx++) { \
             loopCode2; \
         } \
     } \
@@ -622,7 +1216,8 @@ extern "C" {
    float32x4_t n_src1, n_src2; \
    float32x4_t n_dst; \
    float32x2_t n_rest1, n_rest2, n_rest; \
-   int dif = count % 2; \
+   size_t dif = count % 2; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 2) { \
     loopCode1; \
    } \
@@ -637,7 +1232,8 @@ extern "C" {
    int32x4_t n_src1, n_src2; \
    int32x4_t n_dst; \
    int32x2_t n_rest1, n_rest2, n_rest; \
-   int dif = count % 2; \
+   size_t dif = count % 2; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 2) { \
     loopCode1; \
    } \
@@ -652,12 +1248,13 @@ extern "C" {
   float32x4_t n_src11, n_src12, n_src13; \
   float32x4_t n_src21, n_src22, n_src23; \
   float32x4_t n_dst1, n_dst2, n_dst3; \
-  int dif = count % 4;  \
+  size_t dif = count % 4;  \
+  MN_PREFETCH_INIT; \
   for (; count > dif; count -= 4) { \
    loopCode1; \
   } \
   if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
     } \
@@ -670,12 +1267,13 @@ extern "C" {
   int32x4_t n_src11, n_src12, n_src13; \
   int32x4_t n_src21, n_src22, n_src23; \
   int32x4_t n_dst1, n_dst2, n_dst3; \
-  int dif = count % 4;  \
+  size_t dif = count % 4;  \
+  MN_PREFETCH_INIT; \
   for (; count > dif; count -= 4) { \
    loopCode1; \
   } \
   if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
     } \
@@ -687,6 +1285,7 @@ extern "C" {
    mn_result_t res = MN_OK; \
    float32x4_t n_src1, n_src2; \
    float32x4_t n_dst; \
+   MN_PREFETCH_INIT; \
    for (; count != 0; count --) { \
      loopCode; \
     } \
@@ -697,6 +1296,7 @@ extern "C" {
    mn_result_t res = MN_OK; \
    int32x4_t n_src1, n_src2; \
    int32x4_t n_dst; \
+   MN_PREFETCH_INIT; \
    for (; count != 0; count --) { \
      loopCode; \
     } \
@@ -705,6 +1305,8 @@ extern "C" {
 
 // MAINLOOP macros for subtraction (load -> sub -> store -> advance pointers)
 #define MN_MAINLOOP_FLOAT_NEON_SUB { \
+    MN_PREFETCH_SRC(src1); \
+    MN_PREFETCH_SRC(src2); \
     n_src1 = vld1q_f32((float32_t*)src1); /* load 4 floats from src1 */ \
     n_src2 = vld1q_f32((float32_t*)src2); /* load 4 floats from src2 */ \
     n_dst = vsubq_f32(n_src1, n_src2);    /* compute subtraction */ \
@@ -715,6 +1317,8 @@ extern "C" {
 }
 
 #define MN_MAINLOOP_INT32_NEON_SUB { \
+    MN_PREFETCH_SRC(src1); \
+    MN_PREFETCH_SRC(src2); \
     n_src1 = vld1q_s32((int32_t*)src1); /* load 4 int32 from src1 */ \
     n_src2 = vld1q_s32((int32_t*)src2); /* load 4 int32 from src2 */ \
     n_dst = vsubq_s32(n_src1, n_src2);  /* compute subtraction */ \
@@ -725,6 +1329,8 @@ extern "C" {
 }
 
 #define MN_SUB_DstSrc1Src2_MAINLOOP_VEC2F_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src1); \
+     MN_PREFETCH_SRC(src2); \
      n_src1 = vld1q_f32( (float32_t*)src1 ); /* load two vec2f (8 floats) */ \
      n_src2 = vld1q_f32( (float32_t*)src2 ); /* load two vec2f (8 floats) */ \
      src1 += 2; /* move to the next two vectors */ \
@@ -735,6 +1341,8 @@ extern "C" {
 }
 
 #define MN_SUB_DstSrc1Src2_MAINLOOP_VEC2I_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src1); \
+     MN_PREFETCH_SRC(src2); \
      n_src1 = vld1q_s32( (int32_t*)src1 ); /* load two vec2i */ \
      n_src2 = vld1q_s32( (int32_t*)src2 ); /* load two vec2i */ \
      src1 += 2; /* move to the next two vectors */ \
@@ -745,6 +1353,8 @@ extern "C" {
 }
 
 #define MN_SUB_DstSrc1Src2_MAINLOOP_VEC3F_NEON(loopCode) {                             \
+    MN_PREFETCH_SRC_STEP(src1, 48);                                                    \
+    MN_PREFETCH_SRC_STEP(src2, 48);                                                    \
     n_src11 = vld1q_f32((float32_t*)src1);                                             \
     src1 = (mn_vec3f_t*)((char*)src1 + 4 * sizeof(mn_float32_t));                      \
     n_src12 = vld1q_f32((float32_t*)src1);                                             \
@@ -767,6 +1377,8 @@ extern "C" {
 }
 
 #define MN_SUB_DstSrc1Src2_MAINLOOP_VEC3I_NEON(loopCode) {                             \
+    MN_PREFETCH_SRC_STEP(src1, 48);                                                    \
+    MN_PREFETCH_SRC_STEP(src2, 48);                                                    \
     n_src11 = vld1q_s32((int32_t*)src1);                                               \
     src1 = (mn_vec3i_t*)((char*)src1 + 4 * sizeof(mn_int32_t));                        \
     n_src12 = vld1q_s32((int32_t*)src1);                                               \
@@ -789,6 +1401,8 @@ extern "C" {
 }
 
 #define MN_SUB_DstSrc1Src2_MAINLOOP_VEC4F_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src1); \
+     MN_PREFETCH_SRC(src2); \
      n_src1 = vld1q_f32( (float32_t*)src1 ); \
      n_src2 = vld1q_f32( (float32_t*)src2 ); \
      src1 ++; \
@@ -799,6 +1413,8 @@ extern "C" {
 }
 
 #define MN_SUB_DstSrc1Src2_MAINLOOP_VEC4I_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src1); \
+     MN_PREFETCH_SRC(src2); \
      n_src1 = vld1q_s32( (int32_t*)src1 ); \
      n_src2 = vld1q_s32( (int32_t*)src2 ); \
      src1 ++; \
@@ -810,11 +1426,11 @@ extern "C" {
 
 // SECONDLOOP macros for subtraction (handles leftover elements)
 #define MN_SECONDLOOP_FLOAT_SUB { \
-    *dst++ = *src1++ + *src2++; \
+    *dst++ = *src1++ - *src2++; \
 }
 
 #define MN_SECONDLOOP_INT32_SUB { \
-    *dst++ = *src1++ + *src2++; \
+    *dst++ = *src1++ - *src2++; \
 }
 
 #define MN_SUB_DstSrc1Src2_SECONDLOOP_VEC2F_NEON(loopCode) { \
@@ -833,10 +1449,10 @@ extern "C" {
 
 #define MN_SUB_DstSrc1Src2_SECONDLOOP_VEC3F_NEON(loopCode) { \
      float32x2x3_t n_rest1, n_rest2; \
-     n_rest1 = vld3_f32( (float32_t*)src1 ); \
-     n_rest2 = vld3_f32( (float32_t*)src2 ); \
+     n_rest1 = vld3_lane_f32( (float32_t*)src1, n_rest1, 0); \
+     n_rest2 = vld3_lane_f32( (float32_t*)src2, n_rest2, 0); \
      loopCode; /* exceptional cases where the count isn't a multiple of 4 */ \
-     vst3_f32( (float32_t*)dst, n_rest1); /* store result */ \
+     vst3_lane_f32( (float32_t*)dst, n_rest1, 0); /* store result */ \
      src1++; \
      src2++; \
      dst++; \
@@ -844,16 +1460,17 @@ extern "C" {
 
 #define MN_SUB_DstSrc1Src2_SECONDLOOP_VEC3I_NEON(loopCode) { \
      int32x2x3_t n_rest1, n_rest2; \
-     n_rest1 = vld3_s32( (int32_t*)src1 ); \
-     n_rest2 = vld3_s32( (int32_t*)src2 ); \
+     n_rest1 = vld3_lane_s32( (int32_t*)src1, n_rest1, 0); \
+     n_rest2 = vld3_lane_s32( (int32_t*)src2, n_rest2, 0); \
      loopCode; /* exceptional cases where the count isn't a multiple of 4 */ \
-     vst3_s32( (int32_t*)dst, n_rest1); /* store result */ \
+     vst3_lane_s32( (int32_t*)dst, n_rest1, 0); /* store result */ \
      src1++; \
      src2++; \
      dst++; \
 }
 
 #define MN_ADDC_DstSrcCst_MAINLOOP_FLOAT_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_f32( (float32_t*)src ); \
      src += 4; \
      loopCode; \
@@ -875,13 +1492,14 @@ extern "C" {
    mn_result_t res = MN_OK; \
    float32x4_t n_src; \
    float32x4_t n_dst; \
-   unsigned int dif = 0; \
+   size_t dif = 0; \
    dif = count % 4; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 4) { \
      loopCode1; \
     } \
    if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
      } \
@@ -890,6 +1508,7 @@ extern "C" {
   }
 
 #define MN_ADDC_DstSrcCst_MAINLOOP_VEC2F_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_f32( (float32_t*)src ); \
      src += 2; \
      loopCode; \
@@ -916,7 +1535,8 @@ extern "C" {
    n_cst = vsetq_lane_f32(cst->y, n_cst, 3); \
    float32x4_t n_src; \
    float32x4_t n_dst; \
-   unsigned int dif = count % 2; \
+   size_t dif = count % 2; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 2) { \
     loopCode1; \
    } \
@@ -927,6 +1547,7 @@ extern "C" {
   }
 
 #define MN_ADDC_DstSrcCst_MAINLOOP_VEC3F_NEON(loopCode) { \
+     MN_PREFETCH_SRC_STEP(src, 48); \
      mn_vec3f_t* src_ptr = src; \
      n_src1 = vld1q_f32( (float32_t*)src_ptr ); \
      src_ptr = (mn_vec3f_t*)((char*)src_ptr + 4 * sizeof(mn_float32_t)); \
@@ -979,12 +1600,13 @@ extern "C" {
    n_cst3 = vsetq_lane_f32(cst->z, n_cst3, 3); \
    float32x4_t n_src1, n_src2, n_src3; \
    float32x4_t n_dst1, n_dst2, n_dst3; \
-   unsigned int dif = count % 4; \
+   size_t dif = count % 4; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 4) { \
     loopCode1; \
   } \
   if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
      } \
@@ -993,6 +1615,7 @@ extern "C" {
   }
 
 #define MN_ADDC_DstSrcCst_MAINLOOP_VEC4F_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_f32( (float32_t*)src ); \
      src ++; \
      loopCode; \
@@ -1009,6 +1632,7 @@ extern "C" {
    n_cst = vsetq_lane_f32(cst->w, n_cst, 3); \
    float32x4_t n_src; \
    float32x4_t n_dst; \
+   MN_PREFETCH_INIT; \
    for (; count != 0; count --) { \
      loopCode; \
     } \
@@ -1016,6 +1640,7 @@ extern "C" {
   }
 
 #define MN_ADDC_DstSrcCst_MAINLOOP_INT32_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_s32( (int32_t*)src ); \
      src += 4; \
      loopCode; \
@@ -1037,13 +1662,14 @@ extern "C" {
    mn_result_t res = MN_OK; \
    int32x4_t n_src; \
    int32x4_t n_dst; \
-   unsigned int dif = 0; \
+   size_t dif = 0; \
    dif = count % 4; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 4) { \
      loopCode1; \
     } \
    if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
      } \
@@ -1052,6 +1678,7 @@ extern "C" {
   }
 
 #define MN_ADDC_DstSrcCst_MAINLOOP_VEC2I_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_s32( (int32_t*)src ); \
      src += 2; \
      loopCode; \
@@ -1078,7 +1705,8 @@ extern "C" {
    n_cst = vsetq_lane_s32(cst->y, n_cst, 3); \
    int32x4_t n_src; \
    int32x4_t n_dst; \
-   unsigned int dif = count % 2; \
+   size_t dif = count % 2; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 2) { \
     loopCode1; \
    } \
@@ -1089,6 +1717,7 @@ extern "C" {
   }
 
 #define MN_ADDC_DstSrcCst_MAINLOOP_VEC3I_NEON(loopCode) { \
+     MN_PREFETCH_SRC_STEP(src, 48); \
      mn_vec3i_t* src_ptr = src; \
      n_src1 = vld1q_s32( (int32_t*)src_ptr ); \
      src_ptr = (mn_vec3i_t*)((char*)src_ptr + 4 * sizeof(mn_int32_t)); \
@@ -1141,12 +1770,13 @@ extern "C" {
    n_cst3 = vsetq_lane_s32(cst->z, n_cst3, 3); \
    int32x4_t n_src1, n_src2, n_src3; \
    int32x4_t n_dst1, n_dst2, n_dst3; \
-   unsigned int dif = count % 4; \
+   size_t dif = count % 4; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 4) { \
     loopCode1; \
   } \
   if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
      } \
@@ -1155,6 +1785,7 @@ extern "C" {
   }
 
 #define MN_ADDC_DstSrcCst_MAINLOOP_VEC4I_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_s32( (int32_t*)src ); \
      src ++; \
      loopCode; \
@@ -1171,6 +1802,7 @@ extern "C" {
    n_cst = vsetq_lane_s32(cst->w, n_cst, 3); \
    int32x4_t n_src; \
    int32x4_t n_dst; \
+   MN_PREFETCH_INIT; \
    for (; count != 0; count --) { \
      loopCode; \
     } \
@@ -1178,6 +1810,7 @@ extern "C" {
   }
 
 #define MN_SUBC_DstSrcCst_MAINLOOP_FLOAT_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_f32( (float32_t*)src ); \
      src += 4; \
      loopCode; \
@@ -1199,13 +1832,14 @@ extern "C" {
    mn_result_t res = MN_OK; \
    float32x4_t n_src; \
    float32x4_t n_dst; \
-   unsigned int dif = 0; \
+   size_t dif = 0; \
    dif = count % 4; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 4) { \
      loopCode1; \
     } \
    if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
      } \
@@ -1214,6 +1848,7 @@ extern "C" {
   }
 
 #define MN_SUBC_DstSrcCst_MAINLOOP_VEC2F_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_f32( (float32_t*)src ); \
      src += 2; \
      loopCode; \
@@ -1240,7 +1875,8 @@ extern "C" {
    n_cst = vsetq_lane_f32(cst->y, n_cst, 3); \
    float32x4_t n_src; \
    float32x4_t n_dst; \
-   unsigned int dif = count % 2; \
+   size_t dif = count % 2; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 2) { \
     loopCode1; \
    } \
@@ -1251,6 +1887,7 @@ extern "C" {
   }
 
 #define MN_SUBC_DstSrcCst_MAINLOOP_VEC3F_NEON(loopCode) { \
+     MN_PREFETCH_SRC_STEP(src, 48); \
      mn_vec3f_t* src_ptr = src; \
      n_src1 = vld1q_f32( (float32_t*)src_ptr ); \
      src_ptr = (mn_vec3f_t*)((char*)src_ptr + 4 * sizeof(mn_float32_t)); \
@@ -1303,12 +1940,13 @@ extern "C" {
    n_cst3 = vsetq_lane_f32(cst->z, n_cst3, 3); \
    float32x4_t n_src1, n_src2, n_src3; \
    float32x4_t n_dst1, n_dst2, n_dst3; \
-   unsigned int dif = count % 4; \
+   size_t dif = count % 4; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 4) { \
     loopCode1; \
   } \
   if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
      } \
@@ -1317,6 +1955,7 @@ extern "C" {
   }
 
 #define MN_SUBC_DstSrcCst_MAINLOOP_VEC4F_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_f32( (float32_t*)src ); \
      src ++; \
      loopCode; \
@@ -1333,6 +1972,7 @@ extern "C" {
    n_cst = vsetq_lane_f32(cst->w, n_cst, 3); \
    float32x4_t n_src; \
    float32x4_t n_dst; \
+   MN_PREFETCH_INIT; \
    for (; count != 0; count --) { \
      loopCode; \
     } \
@@ -1340,6 +1980,7 @@ extern "C" {
   }
 
 #define MN_SUBC_DstSrcCst_MAINLOOP_INT32_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_s32( (int32_t*)src ); \
      src += 4; \
      loopCode; \
@@ -1361,13 +2002,14 @@ extern "C" {
    mn_result_t res = MN_OK; \
    int32x4_t n_src; \
    int32x4_t n_dst; \
-   unsigned int dif = 0; \
+   size_t dif = 0; \
    dif = count % 4; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 4) { \
      loopCode1; \
     } \
    if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
      } \
@@ -1376,6 +2018,7 @@ extern "C" {
   }
 
 #define MN_SUBC_DstSrcCst_MAINLOOP_VEC2I_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_s32( (int32_t*)src ); \
      src += 2; \
      loopCode; \
@@ -1402,7 +2045,8 @@ extern "C" {
    n_cst = vsetq_lane_s32(cst->y, n_cst, 3); \
    int32x4_t n_src; \
    int32x4_t n_dst; \
-   unsigned int dif = count % 2; \
+   size_t dif = count % 2; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 2) { \
     loopCode1; \
    } \
@@ -1413,6 +2057,7 @@ extern "C" {
   }
 
 #define MN_SUBC_DstSrcCst_MAINLOOP_VEC3I_NEON(loopCode) { \
+     MN_PREFETCH_SRC_STEP(src, 48); \
      mn_vec3i_t* src_ptr = src; \
      n_src1 = vld1q_s32( (int32_t*)src_ptr ); \
      src_ptr = (mn_vec3i_t*)((char*)src_ptr + 4 * sizeof(mn_int32_t)); \
@@ -1465,12 +2110,13 @@ extern "C" {
    n_cst3 = vsetq_lane_s32(cst->z, n_cst3, 3); \
    int32x4_t n_src1, n_src2, n_src3; \
    int32x4_t n_dst1, n_dst2, n_dst3; \
-   unsigned int dif = count % 4; \
+   size_t dif = count % 4; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 4) { \
     loopCode1; \
   } \
   if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
      } \
@@ -1479,6 +2125,7 @@ extern "C" {
   }
 
 #define MN_SUBC_DstSrcCst_MAINLOOP_VEC4I_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_s32( (int32_t*)src ); \
      src ++; \
      loopCode; \
@@ -1495,6 +2142,7 @@ extern "C" {
    n_cst = vsetq_lane_s32(cst->w, n_cst, 3); \
    int32x4_t n_src; \
    int32x4_t n_dst; \
+   MN_PREFETCH_INIT; \
    for (; count != 0; count --) { \
      loopCode; \
     } \
@@ -1508,12 +2156,13 @@ extern "C" {
     float32x4_t n_src1, n_src2; \
     float32x4_t n_dst; \
     float32x2_t n_rest1, n_rest2, n_rest; \
-    int dif = count % 4; /* finds remaining elements if not multiple of 4 */ \
+    size_t dif = count % 4; /* finds remaining elements if not multiple of 4 */ \
+    MN_PREFETCH_INIT; \
     for (; count > dif; count -= 4) { \
         loopCode1; \
     } \
     if (dif != 0) { \
-        for (unsigned int idx = 0; idx < dif; idx++) { \
+        for (size_t idx = 0; idx < dif; idx++) { \
             loopCode2; \
         } \
     } \
@@ -1526,12 +2175,13 @@ extern "C" {
     int32x4_t n_src1, n_src2; \
     int32x4_t n_dst; \
     int32x2_t n_rest1, n_rest2, n_rest; \
-    int dif = count % 4; /* finds remaining elements if not multiple of 4 */ \
+    size_t dif = count % 4; /* finds remaining elements if not multiple of 4 */ \
+    MN_PREFETCH_INIT; \
     for (; count > dif; count -= 4) { \
         loopCode1; \
     } \
     if (dif != 0) { \
-        for (unsigned int idx = 0; idx < dif; idx++) { \
+        for (size_t idx = 0; idx < dif; idx++) { \
             loopCode2; \
         } \
     } \
@@ -1544,7 +2194,8 @@ extern "C" {
    float32x4_t n_src1, n_src2; \
    float32x4_t n_dst; \
    float32x2_t n_rest1, n_rest2, n_rest; \
-   int dif = count % 2; \
+   size_t dif = count % 2; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 2) { \
     loopCode1; \
    } \
@@ -1559,7 +2210,8 @@ extern "C" {
    int32x4_t n_src1, n_src2; \
    int32x4_t n_dst; \
    int32x2_t n_rest1, n_rest2, n_rest; \
-   int dif = count % 2; \
+   size_t dif = count % 2; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 2) { \
     loopCode1; \
    } \
@@ -1574,12 +2226,13 @@ extern "C" {
   float32x4_t n_src11, n_src12, n_src13; \
   float32x4_t n_src21, n_src22, n_src23; \
   float32x4_t n_dst1, n_dst2, n_dst3; \
-  int dif = count % 4;  \
+  size_t dif = count % 4;  \
+  MN_PREFETCH_INIT; \
   for (; count > dif; count -= 4) { \
    loopCode1; \
   } \
   if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
     } \
@@ -1592,12 +2245,13 @@ extern "C" {
   int32x4_t n_src11, n_src12, n_src13; \
   int32x4_t n_src21, n_src22, n_src23; \
   int32x4_t n_dst1, n_dst2, n_dst3; \
-  int dif = count % 4;  \
+  size_t dif = count % 4;  \
+  MN_PREFETCH_INIT; \
   for (; count > dif; count -= 4) { \
    loopCode1; \
   } \
   if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
     } \
@@ -1609,6 +2263,7 @@ extern "C" {
    mn_result_t res = MN_OK; \
    float32x4_t n_src1, n_src2; \
    float32x4_t n_dst; \
+   MN_PREFETCH_INIT; \
    for (; count != 0; count --) { \
      loopCode; \
     } \
@@ -1619,6 +2274,7 @@ extern "C" {
    mn_result_t res = MN_OK; \
    int32x4_t n_src1, n_src2; \
    int32x4_t n_dst; \
+   MN_PREFETCH_INIT; \
    for (; count != 0; count --) { \
      loopCode; \
     } \
@@ -1627,6 +2283,8 @@ extern "C" {
 
 // MAINLOOP macros for multiply (load -> mul -> store -> advance pointers)
 #define MN_MAINLOOP_FLOAT_NEON_MUL { \
+    MN_PREFETCH_SRC(src1); \
+    MN_PREFETCH_SRC(src2); \
     n_src1 = vld1q_f32((float32_t*)src1); /* load 4 floats from src1 */ \
     n_src2 = vld1q_f32((float32_t*)src2); /* load 4 floats from src2 */ \
     n_dst = vmulq_f32(n_src1, n_src2);    /* compute multiply */ \
@@ -1637,6 +2295,8 @@ extern "C" {
 }
 
 #define MN_MAINLOOP_INT32_NEON_MUL { \
+    MN_PREFETCH_SRC(src1); \
+    MN_PREFETCH_SRC(src2); \
     n_src1 = vld1q_s32((int32_t*)src1); /* load 4 int32 from src1 */ \
     n_src2 = vld1q_s32((int32_t*)src2); /* load 4 int32 from src2 */ \
     n_dst = vmulq_s32(n_src1, n_src2);  /* compute multiply */ \
@@ -1647,6 +2307,8 @@ extern "C" {
 }
 
 #define MN_MUL_DstSrc1Src2_MAINLOOP_VEC2F_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src1); \
+     MN_PREFETCH_SRC(src2); \
      n_src1 = vld1q_f32( (float32_t*)src1 ); /* load two vec2f (8 floats) */ \
      n_src2 = vld1q_f32( (float32_t*)src2 ); /* load two vec2f (8 floats) */ \
      src1 += 2; /* move to the next two vectors */ \
@@ -1657,6 +2319,8 @@ extern "C" {
 }
 
 #define MN_MUL_DstSrc1Src2_MAINLOOP_VEC2I_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src1); \
+     MN_PREFETCH_SRC(src2); \
      n_src1 = vld1q_s32( (int32_t*)src1 ); /* load two vec2i */ \
      n_src2 = vld1q_s32( (int32_t*)src2 ); /* load two vec2i */ \
      src1 += 2; /* move to the next two vectors */ \
@@ -1667,6 +2331,8 @@ extern "C" {
 }
 
 #define MN_MUL_DstSrc1Src2_MAINLOOP_VEC3F_NEON(loopCode) {                             \
+    MN_PREFETCH_SRC_STEP(src1, 48);                                                    \
+    MN_PREFETCH_SRC_STEP(src2, 48);                                                    \
     n_src11 = vld1q_f32((float32_t*)src1);                                             \
     src1 = (mn_vec3f_t*)((char*)src1 + 4 * sizeof(mn_float32_t));                      \
     n_src12 = vld1q_f32((float32_t*)src1);                                             \
@@ -1689,6 +2355,8 @@ extern "C" {
 }
 
 #define MN_MUL_DstSrc1Src2_MAINLOOP_VEC3I_NEON(loopCode) {                             \
+    MN_PREFETCH_SRC_STEP(src1, 48);                                                    \
+    MN_PREFETCH_SRC_STEP(src2, 48);                                                    \
     n_src11 = vld1q_s32((int32_t*)src1);                                               \
     src1 = (mn_vec3i_t*)((char*)src1 + 4 * sizeof(mn_int32_t));                        \
     n_src12 = vld1q_s32((int32_t*)src1);                                               \
@@ -1711,6 +2379,8 @@ extern "C" {
 }
 
 #define MN_MUL_DstSrc1Src2_MAINLOOP_VEC4F_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src1); \
+     MN_PREFETCH_SRC(src2); \
      n_src1 = vld1q_f32( (float32_t*)src1 ); \
      n_src2 = vld1q_f32( (float32_t*)src2 ); \
      src1 ++; \
@@ -1721,6 +2391,8 @@ extern "C" {
 }
 
 #define MN_MUL_DstSrc1Src2_MAINLOOP_VEC4I_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src1); \
+     MN_PREFETCH_SRC(src2); \
      n_src1 = vld1q_s32( (int32_t*)src1 ); \
      n_src2 = vld1q_s32( (int32_t*)src2 ); \
      src1 ++; \
@@ -1732,11 +2404,11 @@ extern "C" {
 
 // SECONDLOOP macros for multiply (handles leftover elements)
 #define MN_SECONDLOOP_FLOAT_MUL { \
-    *dst++ = *src1++ + *src2++; \
+    *dst++ = *src1++ * *src2++; \
 }
 
 #define MN_SECONDLOOP_INT32_MUL { \
-    *dst++ = *src1++ + *src2++; \
+    *dst++ = *src1++ * *src2++; \
 }
 
 #define MN_MUL_DstSrc1Src2_SECONDLOOP_VEC2F_NEON(loopCode) { \
@@ -1755,10 +2427,10 @@ extern "C" {
 
 #define MN_MUL_DstSrc1Src2_SECONDLOOP_VEC3F_NEON(loopCode) { \
      float32x2x3_t n_rest1, n_rest2; \
-     n_rest1 = vld3_f32( (float32_t*)src1 ); \
-     n_rest2 = vld3_f32( (float32_t*)src2 ); \
+     n_rest1 = vld3_lane_f32( (float32_t*)src1, n_rest1, 0); \
+     n_rest2 = vld3_lane_f32( (float32_t*)src2, n_rest2, 0); \
      loopCode; /* exceptional cases where the count isn't a multiple of 4 */ \
-     vst3_f32( (float32_t*)dst, n_rest1); /* store result */ \
+     vst3_lane_f32( (float32_t*)dst, n_rest1, 0); /* store result */ \
      src1++; \
      src2++; \
      dst++; \
@@ -1766,16 +2438,17 @@ extern "C" {
 
 #define MN_MUL_DstSrc1Src2_SECONDLOOP_VEC3I_NEON(loopCode) { \
      int32x2x3_t n_rest1, n_rest2; \
-     n_rest1 = vld3_s32( (int32_t*)src1 ); \
-     n_rest2 = vld3_s32( (int32_t*)src2 ); \
+     n_rest1 = vld3_lane_s32( (int32_t*)src1, n_rest1, 0); \
+     n_rest2 = vld3_lane_s32( (int32_t*)src2, n_rest2, 0); \
      loopCode; /* exceptional cases where the count isn't a multiple of 4 */ \
-     vst3_s32( (int32_t*)dst, n_rest1); /* store result */ \
+     vst3_lane_s32( (int32_t*)dst, n_rest1, 0); /* store result */ \
      src1++; \
      src2++; \
      dst++; \
 }
 
 #define MN_MULC_DstSrcCst_MAINLOOP_FLOAT_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_f32( (float32_t*)src ); \
      src += 4; \
      loopCode; \
@@ -1797,13 +2470,14 @@ extern "C" {
    mn_result_t res = MN_OK; \
    float32x4_t n_src; \
    float32x4_t n_dst; \
-   unsigned int dif = 0; \
+   size_t dif = 0; \
    dif = count % 4; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 4) { \
      loopCode1; \
     } \
    if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
      } \
@@ -1812,6 +2486,7 @@ extern "C" {
   }
 
 #define MN_MULC_DstSrcCst_MAINLOOP_VEC2F_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_f32( (float32_t*)src ); \
      src += 2; \
      loopCode; \
@@ -1838,7 +2513,8 @@ extern "C" {
    n_cst = vsetq_lane_f32(cst->y, n_cst, 3); \
    float32x4_t n_src; \
    float32x4_t n_dst; \
-   unsigned int dif = count % 2; \
+   size_t dif = count % 2; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 2) { \
     loopCode1; \
    } \
@@ -1849,6 +2525,7 @@ extern "C" {
   }
 
 #define MN_MULC_DstSrcCst_MAINLOOP_VEC3F_NEON(loopCode) { \
+     MN_PREFETCH_SRC_STEP(src, 48); \
      mn_vec3f_t* src_ptr = src; \
      n_src1 = vld1q_f32( (float32_t*)src_ptr ); \
      src_ptr = (mn_vec3f_t*)((char*)src_ptr + 4 * sizeof(mn_float32_t)); \
@@ -1901,12 +2578,13 @@ extern "C" {
    n_cst3 = vsetq_lane_f32(cst->z, n_cst3, 3); \
    float32x4_t n_src1, n_src2, n_src3; \
    float32x4_t n_dst1, n_dst2, n_dst3; \
-   unsigned int dif = count % 4; \
+   size_t dif = count % 4; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 4) { \
     loopCode1; \
   } \
   if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
      } \
@@ -1915,6 +2593,7 @@ extern "C" {
   }
 
 #define MN_MULC_DstSrcCst_MAINLOOP_VEC4F_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_f32( (float32_t*)src ); \
      src ++; \
      loopCode; \
@@ -1931,6 +2610,7 @@ extern "C" {
    n_cst = vsetq_lane_f32(cst->w, n_cst, 3); \
    float32x4_t n_src; \
    float32x4_t n_dst; \
+   MN_PREFETCH_INIT; \
    for (; count != 0; count --) { \
      loopCode; \
     } \
@@ -1938,6 +2618,7 @@ extern "C" {
   }
 
 #define MN_MULC_DstSrcCst_MAINLOOP_INT32_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_s32( (int32_t*)src ); \
      src += 4; \
      loopCode; \
@@ -1959,13 +2640,14 @@ extern "C" {
    mn_result_t res = MN_OK; \
    int32x4_t n_src; \
    int32x4_t n_dst; \
-   unsigned int dif = 0; \
+   size_t dif = 0; \
    dif = count % 4; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 4) { \
      loopCode1; \
     } \
    if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
      } \
@@ -1974,6 +2656,7 @@ extern "C" {
   }
 
 #define MN_MULC_DstSrcCst_MAINLOOP_VEC2I_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_s32( (int32_t*)src ); \
      src += 2; \
      loopCode; \
@@ -2000,7 +2683,8 @@ extern "C" {
    n_cst = vsetq_lane_s32(cst->y, n_cst, 3); \
    int32x4_t n_src; \
    int32x4_t n_dst; \
-   unsigned int dif = count % 2; \
+   size_t dif = count % 2; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 2) { \
     loopCode1; \
    } \
@@ -2011,6 +2695,7 @@ extern "C" {
   }
 
 #define MN_MULC_DstSrcCst_MAINLOOP_VEC3I_NEON(loopCode) { \
+     MN_PREFETCH_SRC_STEP(src, 48); \
      mn_vec3i_t* src_ptr = src; \
      n_src1 = vld1q_s32( (int32_t*)src_ptr ); \
      src_ptr = (mn_vec3i_t*)((char*)src_ptr + 4 * sizeof(mn_int32_t)); \
@@ -2063,12 +2748,13 @@ extern "C" {
    n_cst3 = vsetq_lane_s32(cst->z, n_cst3, 3); \
    int32x4_t n_src1, n_src2, n_src3; \
    int32x4_t n_dst1, n_dst2, n_dst3; \
-   unsigned int dif = count % 4; \
+   size_t dif = count % 4; \
+   MN_PREFETCH_INIT; \
    for (; count > dif; count -= 4) { \
     loopCode1; \
   } \
   if ( 0 != dif ) { \
-    unsigned int idx; \
+    size_t idx; \
     for ( idx = 0 ; idx < dif; idx++ ) { \
       loopCode2; \
      } \
@@ -2077,6 +2763,7 @@ extern "C" {
   }
 
 #define MN_MULC_DstSrcCst_MAINLOOP_VEC4I_NEON(loopCode) { \
+     MN_PREFETCH_SRC(src); \
      n_src = vld1q_s32( (int32_t*)src ); \
      src ++; \
      loopCode; \
@@ -2093,6 +2780,7 @@ extern "C" {
    n_cst = vsetq_lane_s32(cst->w, n_cst, 3); \
    int32x4_t n_src; \
    int32x4_t n_dst; \
+   MN_PREFETCH_INIT; \
    for (; count != 0; count --) { \
      loopCode; \
     } \
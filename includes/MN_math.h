@@ -6,6 +6,12 @@
 extern "C" {
 #endif
 
+/**
+ * All operators are elementwise and may run in place: dst can be the same
+ * pointer as src (or src1/src2). Buffers that partially overlap are not
+ * supported and trip the overlap assertion in debug builds.
+ */
+
 /**
  * ================================
  * MN ABSOLUTE OPERATOR USING C & NEON
@@ -53,18 +59,18 @@ mn_result_t mn_abs_vec4i_neon(mn_vec4i_t *dst, mn_vec4i_t *src, size_t count);
 /**
  * @brief Adds two int arrays.
  */
-mn_result_t mn_add_int32_c(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, mn_uint32_t count);
-mn_result_t mn_add_vec2i_c(mn_vec2i_t *dst, mn_vec2i_t *src1, mn_vec2i_t *src2, mn_uint32_t count);
-mn_result_t mn_add_vec3i_c(mn_vec3i_t *dst, mn_vec3i_t *src1, mn_vec3i_t *src2, mn_uint32_t count);
-mn_result_t mn_add_vec4i_c(mn_vec4i_t *dst, mn_vec4i_t *src1, mn_vec4i_t *src2, mn_uint32_t count);
+mn_result_t mn_add_int32_c(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+mn_result_t mn_add_vec2i_c(mn_vec2i_t *dst, mn_vec2i_t *src1, mn_vec2i_t *src2, size_t count);
+mn_result_t mn_add_vec3i_c(mn_vec3i_t *dst, mn_vec3i_t *src1, mn_vec3i_t *src2, size_t count);
+mn_result_t mn_add_vec4i_c(mn_vec4i_t *dst, mn_vec4i_t *src1, mn_vec4i_t *src2, size_t count);
 
 /**
  * @brief Adds two float arrays.
  */
-mn_result_t mn_add_float_c(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, mn_uint32_t count);
-mn_result_t mn_add_vec2f_c(mn_vec2f_t *dst, mn_vec2f_t *src1, mn_vec2f_t *src2, mn_uint32_t count);
-mn_result_t mn_add_vec3f_c(mn_vec3f_t *dst, mn_vec3f_t *src1, mn_vec3f_t *src2, mn_uint32_t count);
-mn_result_t mn_add_vec4f_c(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2, mn_uint32_t count);
+mn_result_t mn_add_float_c(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, size_t count);
+mn_result_t mn_add_vec2f_c(mn_vec2f_t *dst, mn_vec2f_t *src1, mn_vec2f_t *src2, size_t count);
+mn_result_t mn_add_vec3f_c(mn_vec3f_t *dst, mn_vec3f_t *src1, mn_vec3f_t *src2, size_t count);
+mn_result_t mn_add_vec4f_c(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2, size_t count);
 
 /**
  * ================================
@@ -75,18 +81,18 @@ mn_result_t mn_add_vec4f_c(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2,
 /**
  * @brief Adds two float arrays using NEON.
  */
-mn_result_t mn_add_float_neon(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, mn_uint32_t count);
-mn_result_t mn_add_vec2f_neon(mn_vec2f_t *dst, mn_vec2f_t *src1, mn_vec2f_t *src2, mn_uint32_t count);
-mn_result_t mn_add_vec3f_neon(mn_vec3f_t *dst, mn_vec3f_t *src1, mn_vec3f_t *src2, mn_uint32_t count);
-mn_result_t mn_add_vec4f_neon(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2, mn_uint32_t count);
+mn_result_t mn_add_float_neon(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, size_t count);
+mn_result_t mn_add_vec2f_neon(mn_vec2f_t *dst, mn_vec2f_t *src1, mn_vec2f_t *src2, size_t count);
+mn_result_t mn_add_vec3f_neon(mn_vec3f_t *dst, mn_vec3f_t *src1, mn_vec3f_t *src2, size_t count);
+mn_result_t mn_add_vec4f_neon(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2, size_t count);
 
 /**
  * @brief Adds two int arrays using NEON.
  */
-mn_result_t mn_add_int32_neon(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, mn_uint32_t count);
-mn_result_t mn_add_vec2i_neon(mn_vec2i_t *dst, mn_vec2i_t *src1, mn_vec2i_t *src2, mn_uint32_t count);
-mn_result_t mn_add_vec3i_neon(mn_vec3i_t *dst, mn_vec3i_t *src1, mn_vec3i_t *src2, mn_uint32_t count);
-mn_result_t mn_add_vec4i_neon(mn_vec4i_t *dst, mn_vec4i_t *src1, mn_vec4i_t *src2, mn_uint32_t count);
+mn_result_t mn_add_int32_neon(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+mn_result_t mn_add_vec2i_neon(mn_vec2i_t *dst, mn_vec2i_t *src1, mn_vec2i_t *src2, size_t count);
+mn_result_t mn_add_vec3i_neon(mn_vec3i_t *dst, mn_vec3i_t *src1, mn_vec3i_t *src2, size_t count);
+mn_result_t mn_add_vec4i_neon(mn_vec4i_t *dst, mn_vec4i_t *src1, mn_vec4i_t *src2, size_t count);
 
 /**
  * ================================
@@ -97,18 +103,18 @@ mn_result_t mn_add_vec4i_neon(mn_vec4i_t *dst, mn_vec4i_t *src1, mn_vec4i_t *src
 /**
  * @brief subs two int arrays.
  */
-mn_result_t mn_sub_int32_c(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, mn_uint32_t count);
-mn_result_t mn_sub_vec2i_c(mn_vec2i_t *dst, mn_vec2i_t *src1, mn_vec2i_t *src2, mn_uint32_t count);
-mn_result_t mn_sub_vec3i_c(mn_vec3i_t *dst, mn_vec3i_t *src1, mn_vec3i_t *src2, mn_uint32_t count);
-mn_result_t mn_sub_vec4i_c(mn_vec4i_t *dst, mn_vec4i_t *src1, mn_vec4i_t *src2, mn_uint32_t count);
+mn_result_t mn_sub_int32_c(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+mn_result_t mn_sub_vec2i_c(mn_vec2i_t *dst, mn_vec2i_t *src1, mn_vec2i_t *src2, size_t count);
+mn_result_t mn_sub_vec3i_c(mn_vec3i_t *dst, mn_vec3i_t *src1, mn_vec3i_t *src2, size_t count);
+mn_result_t mn_sub_vec4i_c(mn_vec4i_t *dst, mn_vec4i_t *src1, mn_vec4i_t *src2, size_t count);
 
 /**
  * @brief subs two float arrays.
  */
-mn_result_t mn_sub_float_c(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, mn_uint32_t count);
-mn_result_t mn_sub_vec2f_c(mn_vec2f_t *dst, mn_vec2f_t *src1, mn_vec2f_t *src2, mn_uint32_t count);
-mn_result_t mn_sub_vec3f_c(mn_vec3f_t *dst, mn_vec3f_t *src1, mn_vec3f_t *src2, mn_uint32_t count);
-mn_result_t mn_sub_vec4f_c(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2, mn_uint32_t count);
+mn_result_t mn_sub_float_c(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, size_t count);
+mn_result_t mn_sub_vec2f_c(mn_vec2f_t *dst, mn_vec2f_t *src1, mn_vec2f_t *src2, size_t count);
+mn_result_t mn_sub_vec3f_c(mn_vec3f_t *dst, mn_vec3f_t *src1, mn_vec3f_t *src2, size_t count);
+mn_result_t mn_sub_vec4f_c(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2, size_t count);
 
 /**
  * ================================
@@ -119,18 +125,18 @@ mn_result_t mn_sub_vec4f_c(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2,
 /**
  * @brief subs two float arrays using NEON.
  */
-mn_result_t mn_sub_float_neon(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, mn_uint32_t count);
-mn_result_t mn_sub_vec2f_neon(mn_vec2f_t *dst, mn_vec2f_t *src1, mn_vec2f_t *src2, mn_uint32_t count);
-mn_result_t mn_sub_vec3f_neon(mn_vec3f_t *dst, mn_vec3f_t *src1, mn_vec3f_t *src2, mn_uint32_t count);
-mn_result_t mn_sub_vec4f_neon(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2, mn_uint32_t count);
+mn_result_t mn_sub_float_neon(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, size_t count);
+mn_result_t mn_sub_vec2f_neon(mn_vec2f_t *dst, mn_vec2f_t *src1, mn_vec2f_t *src2, size_t count);
+mn_result_t mn_sub_vec3f_neon(mn_vec3f_t *dst, mn_vec3f_t *src1, mn_vec3f_t *src2, size_t count);
+mn_result_t mn_sub_vec4f_neon(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2, size_t count);
 
 /**
  * @brief subs two int arrays using NEON.
  */
-mn_result_t mn_sub_int32_neon(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, mn_uint32_t count);
-mn_result_t mn_sub_vec2i_neon(mn_vec2i_t *dst, mn_vec2i_t *src1, mn_vec2i_t *src2, mn_uint32_t count);
-mn_result_t mn_sub_vec3i_neon(mn_vec3i_t *dst, mn_vec3i_t *src1, mn_vec3i_t *src2, mn_uint32_t count);
-mn_result_t mn_sub_vec4i_neon(mn_vec4i_t *dst, mn_vec4i_t *src1, mn_vec4i_t *src2, mn_uint32_t count);
+mn_result_t mn_sub_int32_neon(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+mn_result_t mn_sub_vec2i_neon(mn_vec2i_t *dst, mn_vec2i_t *src1, mn_vec2i_t *src2, size_t count);
+mn_result_t mn_sub_vec3i_neon(mn_vec3i_t *dst, mn_vec3i_t *src1, mn_vec3i_t *src2, size_t count);
+mn_result_t mn_sub_vec4i_neon(mn_vec4i_t *dst, mn_vec4i_t *src1, mn_vec4i_t *src2, size_t count);
 
 /**
  * ================================
@@ -206,18 +212,18 @@ mn_result_t mn_subc_vec4i_neon(mn_vec4i_t *dst, mn_vec4i_t *src, const mn_vec4i_
 /**
  * @brief multiply two int arrays.
  */
-mn_result_t mn_mul_int32_c(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, mn_uint32_t count);
-mn_result_t mn_mul_vec2i_c(mn_vec2i_t *dst, mn_vec2i_t *src1, mn_vec2i_t *src2, mn_uint32_t count);
-mn_result_t mn_mul_vec3i_c(mn_vec3i_t *dst, mn_vec3i_t *src1, mn_vec3i_t *src2, mn_uint32_t count);
-mn_result_t mn_mul_vec4i_c(mn_vec4i_t *dst, mn_vec4i_t *src1, mn_vec4i_t *src2, mn_uint32_t count);
+mn_result_t mn_mul_int32_c(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+mn_result_t mn_mul_vec2i_c(mn_vec2i_t *dst, mn_vec2i_t *src1, mn_vec2i_t *src2, size_t count);
+mn_result_t mn_mul_vec3i_c(mn_vec3i_t *dst, mn_vec3i_t *src1, mn_vec3i_t *src2, size_t count);
+mn_result_t mn_mul_vec4i_c(mn_vec4i_t *dst, mn_vec4i_t *src1, mn_vec4i_t *src2, size_t count);
 
 /**
  * @brief multiply two float arrays.
  */
-mn_result_t mn_mul_float_c(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, mn_uint32_t count);
-mn_result_t mn_mul_vec2f_c(mn_vec2f_t *dst, mn_vec2f_t *src1, mn_vec2f_t *src2, mn_uint32_t count);
-mn_result_t mn_mul_vec3f_c(mn_vec3f_t *dst, mn_vec3f_t *src1, mn_vec3f_t *src2, mn_uint32_t count);
-mn_result_t mn_mul_vec4f_c(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2, mn_uint32_t count);
+mn_result_t mn_mul_float_c(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, size_t count);
+mn_result_t mn_mul_vec2f_c(mn_vec2f_t *dst, mn_vec2f_t *src1, mn_vec2f_t *src2, size_t count);
+mn_result_t mn_mul_vec3f_c(mn_vec3f_t *dst, mn_vec3f_t *src1, mn_vec3f_t *src2, size_t count);
+mn_result_t mn_mul_vec4f_c(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2, size_t count);
 
 /**
  * ================================
@@ -228,18 +234,18 @@ mn_result_t mn_mul_vec4f_c(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2,
 /**
  * @brief multiply two float arrays using NEON.
  */
-mn_result_t mn_mul_float_neon(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, mn_uint32_t count);
-mn_result_t mn_mul_vec2f_neon(mn_vec2f_t *dst, mn_vec2f_t *src1, mn_vec2f_t *src2, mn_uint32_t count);
-mn_result_t mn_mul_vec3f_neon(mn_vec3f_t *dst, mn_vec3f_t *src1, mn_vec3f_t *src2, mn_uint32_t count);
-mn_result_t mn_mul_vec4f_neon(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2, mn_uint32_t count);
+mn_result_t mn_mul_float_neon(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, size_t count);
+mn_result_t mn_mul_vec2f_neon(mn_vec2f_t *dst, mn_vec2f_t *src1, mn_vec2f_t *src2, size_t count);
+mn_result_t mn_mul_vec3f_neon(mn_vec3f_t *dst, mn_vec3f_t *src1, mn_vec3f_t *src2, size_t count);
+mn_result_t mn_mul_vec4f_neon(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2, size_t count);
 
 /**
  * @brief multiply two int arrays using NEON.
  */
-mn_result_t mn_mul_int32_neon(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, mn_uint32_t count);
-mn_result_t mn_mul_vec2i_neon(mn_vec2i_t *dst, mn_vec2i_t *src1, mn_vec2i_t *src2, mn_uint32_t count);
-mn_result_t mn_mul_vec3i_neon(mn_vec3i_t *dst, mn_vec3i_t *src1, mn_vec3i_t *src2, mn_uint32_t count);
-mn_result_t mn_mul_vec4i_neon(mn_vec4i_t *dst, mn_vec4i_t *src1, mn_vec4i_t *src2, mn_uint32_t count);
+mn_result_t mn_mul_int32_neon(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+mn_result_t mn_mul_vec2i_neon(mn_vec2i_t *dst, mn_vec2i_t *src1, mn_vec2i_t *src2, size_t count);
+mn_result_t mn_mul_vec3i_neon(mn_vec3i_t *dst, mn_vec3i_t *src1, mn_vec3i_t *src2, size_t count);
+mn_result_t mn_mul_vec4i_neon(mn_vec4i_t *dst, mn_vec4i_t *src1, mn_vec4i_t *src2, size_t count);
 
 /**
  * ===================================
@@ -283,18 +289,18 @@ mn_result_t mn_mulc_vec4i_neon(mn_vec4i_t *dst, mn_vec4i_t *src, const mn_vec4i_
 /**
  * @brief division two int arrays.
  */
-mn_result_t mn_div_int32_c(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, mn_uint32_t count);
-mn_result_t mn_div_vec2i_c(mn_vec2i_t *dst, mn_vec2i_t *src1, mn_vec2i_t *src2, mn_uint32_t count);
-mn_result_t mn_div_vec3i_c(mn_vec3i_t *dst, mn_vec3i_t *src1, mn_vec3i_t *src2, mn_uint32_t count);
-mn_result_t mn_div_vec4i_c(mn_vec4i_t *dst, mn_vec4i_t *src1, mn_vec4i_t *src2, mn_uint32_t count);
+mn_result_t mn_div_int32_c(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+mn_result_t mn_div_vec2i_c(mn_vec2i_t *dst, mn_vec2i_t *src1, mn_vec2i_t *src2, size_t count);
+mn_result_t mn_div_vec3i_c(mn_vec3i_t *dst, mn_vec3i_t *src1, mn_vec3i_t *src2, size_t count);
+mn_result_t mn_div_vec4i_c(mn_vec4i_t *dst, mn_vec4i_t *src1, mn_vec4i_t *src2, size_t count);
 
 /**
  * @brief division two float arrays.
  */
-mn_result_t mn_div_float_c(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, mn_uint32_t count);
-mn_result_t mn_div_vec2f_c(mn_vec2f_t *dst, mn_vec2f_t *src1, mn_vec2f_t *src2, mn_uint32_t count);
-mn_result_t mn_div_vec3f_c(mn_vec3f_t *dst, mn_vec3f_t *src1, mn_vec3f_t *src2, mn_uint32_t count);
-mn_result_t mn_div_vec4f_c(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2, mn_uint32_t count);
+mn_result_t mn_div_float_c(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, size_t count);
+mn_result_t mn_div_vec2f_c(mn_vec2f_t *dst, mn_vec2f_t *src1, mn_vec2f_t *src2, size_t count);
+mn_result_t mn_div_vec3f_c(mn_vec3f_t *dst, mn_vec3f_t *src1, mn_vec3f_t *src2, size_t count);
+mn_result_t mn_div_vec4f_c(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2, size_t count);
 
 /**
  * ================================
@@ -305,18 +311,1715 @@ mn_result_t mn_div_vec4f_c(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2,
 /**
  * @brief division two float arrays using NEON.
  */
-mn_result_t mn_div_float_neon(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, mn_uint32_t count);
-mn_result_t mn_div_vec2f_neon(mn_vec2f_t *dst, mn_vec2f_t *src1, mn_vec2f_t *src2, mn_uint32_t count);
-mn_result_t mn_div_vec3f_neon(mn_vec3f_t *dst, mn_vec3f_t *src1, mn_vec3f_t *src2, mn_uint32_t count);
-mn_result_t mn_div_vec4f_neon(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2, mn_uint32_t count);
+mn_result_t mn_div_float_neon(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, size_t count);
+mn_result_t mn_div_vec2f_neon(mn_vec2f_t *dst, mn_vec2f_t *src1, mn_vec2f_t *src2, size_t count);
+mn_result_t mn_div_vec3f_neon(mn_vec3f_t *dst, mn_vec3f_t *src1, mn_vec3f_t *src2, size_t count);
+mn_result_t mn_div_vec4f_neon(mn_vec4f_t *dst, mn_vec4f_t *src1, mn_vec4f_t *src2, size_t count);
 
 /**
  * @brief division two int arrays using NEON.
  */
-mn_result_t mn_div_int32_neon(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, mn_uint32_t count);
-mn_result_t mn_div_vec2i_neon(mn_vec2i_t *dst, mn_vec2i_t *src1, mn_vec2i_t *src2, mn_uint32_t count);
-mn_result_t mn_div_vec3i_neon(mn_vec3i_t *dst, mn_vec3i_t *src1, mn_vec3i_t *src2, mn_uint32_t count);
-mn_result_t mn_div_vec4i_neon(mn_vec4i_t *dst, mn_vec4i_t *src1, mn_vec4i_t *src2, mn_uint32_t count);
+mn_result_t mn_div_int32_neon(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+mn_result_t mn_div_vec2i_neon(mn_vec2i_t *dst, mn_vec2i_t *src1, mn_vec2i_t *src2, size_t count);
+mn_result_t mn_div_vec3i_neon(mn_vec3i_t *dst, mn_vec3i_t *src1, mn_vec3i_t *src2, size_t count);
+mn_result_t mn_div_vec4i_neon(mn_vec4i_t *dst, mn_vec4i_t *src1, mn_vec4i_t *src2, size_t count);
+
+/**
+ * ================================
+ * MN INT32 SATURATING AND OVERFLOW-CHECKED OPERATORS USING C & NEON
+ * ================================
+ *
+ * _sat routines clamp each result to [INT32_MIN, INT32_MAX].
+ * _ovf routines store the wrapping result (same as mn_add_int32_*) and return
+ * MN_OVERFLOW if at least one element overflowed, MN_SUCCESS otherwise.
+ */
+
+/**
+ * @brief Saturating add/sub/mul of two int32 arrays using C.
+ */
+mn_result_t mn_add_sat_int32_c(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+mn_result_t mn_sub_sat_int32_c(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+mn_result_t mn_mul_sat_int32_c(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+
+/**
+ * @brief Saturating addc/subc/mulc of an int32 array using C.
+ */
+mn_result_t mn_addc_sat_int32_c(mn_int32_t *dst, mn_int32_t *src, mn_int32_t cst, size_t count);
+mn_result_t mn_subc_sat_int32_c(mn_int32_t *dst, mn_int32_t *src, mn_int32_t cst, size_t count);
+mn_result_t mn_mulc_sat_int32_c(mn_int32_t *dst, mn_int32_t *src, mn_int32_t cst, size_t count);
+
+/**
+ * @brief Overflow-checked add/sub/mul of two int32 arrays using C.
+ */
+mn_result_t mn_add_ovf_int32_c(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+mn_result_t mn_sub_ovf_int32_c(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+mn_result_t mn_mul_ovf_int32_c(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+
+/**
+ * @brief Saturating add/sub/mul of two int32 arrays using NEON.
+ */
+mn_result_t mn_add_sat_int32_neon(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+mn_result_t mn_sub_sat_int32_neon(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+mn_result_t mn_mul_sat_int32_neon(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+
+/**
+ * @brief Saturating addc/subc/mulc of an int32 array using NEON.
+ */
+mn_result_t mn_addc_sat_int32_neon(mn_int32_t *dst, mn_int32_t *src, mn_int32_t cst, size_t count);
+mn_result_t mn_subc_sat_int32_neon(mn_int32_t *dst, mn_int32_t *src, mn_int32_t cst, size_t count);
+mn_result_t mn_mulc_sat_int32_neon(mn_int32_t *dst, mn_int32_t *src, mn_int32_t cst, size_t count);
+
+/**
+ * @brief Overflow-checked add/sub/mul of two int32 arrays using NEON.
+ */
+mn_result_t mn_add_ovf_int32_neon(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+mn_result_t mn_sub_ovf_int32_neon(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+mn_result_t mn_mul_ovf_int32_neon(mn_int32_t *dst, mn_int32_t *src1, mn_int32_t *src2, size_t count);
+
+/**
+ * ================================
+ * MN FLOAT64 OPERATORS USING C & NEON
+ * ================================
+ */
+
+/**
+ * @brief Computes absolute value of float64 arrays using C.
+ */
+mn_result_t mn_abs_float64_c(mn_float64_t *dst, mn_float64_t *src, size_t count);
+mn_result_t mn_abs_vec2d_c(mn_vec2d_t *dst, mn_vec2d_t *src, size_t count);
+mn_result_t mn_abs_vec3d_c(mn_vec3d_t *dst, mn_vec3d_t *src, size_t count);
+mn_result_t mn_abs_vec4d_c(mn_vec4d_t *dst, mn_vec4d_t *src, size_t count);
+
+/**
+ * @brief Adds two float64 arrays using C.
+ */
+mn_result_t mn_add_float64_c(mn_float64_t *dst, mn_float64_t *src1, mn_float64_t *src2, size_t count);
+mn_result_t mn_add_vec2d_c(mn_vec2d_t *dst, mn_vec2d_t *src1, mn_vec2d_t *src2, size_t count);
+mn_result_t mn_add_vec3d_c(mn_vec3d_t *dst, mn_vec3d_t *src1, mn_vec3d_t *src2, size_t count);
+mn_result_t mn_add_vec4d_c(mn_vec4d_t *dst, mn_vec4d_t *src1, mn_vec4d_t *src2, size_t count);
+
+/**
+ * @brief Subtracts two float64 arrays using C.
+ */
+mn_result_t mn_sub_float64_c(mn_float64_t *dst, mn_float64_t *src1, mn_float64_t *src2, size_t count);
+mn_result_t mn_sub_vec2d_c(mn_vec2d_t *dst, mn_vec2d_t *src1, mn_vec2d_t *src2, size_t count);
+mn_result_t mn_sub_vec3d_c(mn_vec3d_t *dst, mn_vec3d_t *src1, mn_vec3d_t *src2, size_t count);
+mn_result_t mn_sub_vec4d_c(mn_vec4d_t *dst, mn_vec4d_t *src1, mn_vec4d_t *src2, size_t count);
+
+/**
+ * @brief Multiplies two float64 arrays using C.
+ */
+mn_result_t mn_mul_float64_c(mn_float64_t *dst, mn_float64_t *src1, mn_float64_t *src2, size_t count);
+mn_result_t mn_mul_vec2d_c(mn_vec2d_t *dst, mn_vec2d_t *src1, mn_vec2d_t *src2, size_t count);
+mn_result_t mn_mul_vec3d_c(mn_vec3d_t *dst, mn_vec3d_t *src1, mn_vec3d_t *src2, size_t count);
+mn_result_t mn_mul_vec4d_c(mn_vec4d_t *dst, mn_vec4d_t *src1, mn_vec4d_t *src2, size_t count);
+
+/**
+ * @brief Divides two float64 arrays using C.
+ */
+mn_result_t mn_div_float64_c(mn_float64_t *dst, mn_float64_t *src1, mn_float64_t *src2, size_t count);
+mn_result_t mn_div_vec2d_c(mn_vec2d_t *dst, mn_vec2d_t *src1, mn_vec2d_t *src2, size_t count);
+mn_result_t mn_div_vec3d_c(mn_vec3d_t *dst, mn_vec3d_t *src1, mn_vec3d_t *src2, size_t count);
+mn_result_t mn_div_vec4d_c(mn_vec4d_t *dst, mn_vec4d_t *src1, mn_vec4d_t *src2, size_t count);
+
+/**
+ * @brief Adds a constant to a float64 array using C.
+ */
+mn_result_t mn_addc_float64_c(mn_float64_t *dst, mn_float64_t *src, mn_float64_t cst, size_t count);
+mn_result_t mn_addc_vec2d_c(mn_vec2d_t *dst, mn_vec2d_t *src, const mn_vec2d_t *cst, size_t count);
+mn_result_t mn_addc_vec3d_c(mn_vec3d_t *dst, mn_vec3d_t *src, const mn_vec3d_t *cst, size_t count);
+mn_result_t mn_addc_vec4d_c(mn_vec4d_t *dst, mn_vec4d_t *src, const mn_vec4d_t *cst, size_t count);
+
+/**
+ * @brief Subtracts a constant from a float64 array using C.
+ */
+mn_result_t mn_subc_float64_c(mn_float64_t *dst, mn_float64_t *src, mn_float64_t cst, size_t count);
+mn_result_t mn_subc_vec2d_c(mn_vec2d_t *dst, mn_vec2d_t *src, const mn_vec2d_t *cst, size_t count);
+mn_result_t mn_subc_vec3d_c(mn_vec3d_t *dst, mn_vec3d_t *src, const mn_vec3d_t *cst, size_t count);
+mn_result_t mn_subc_vec4d_c(mn_vec4d_t *dst, mn_vec4d_t *src, const mn_vec4d_t *cst, size_t count);
+
+/**
+ * @brief Multiplies a float64 array by a constant using C.
+ */
+mn_result_t mn_mulc_float64_c(mn_float64_t *dst, mn_float64_t *src, mn_float64_t cst, size_t count);
+mn_result_t mn_mulc_vec2d_c(mn_vec2d_t *dst, mn_vec2d_t *src, const mn_vec2d_t *cst, size_t count);
+mn_result_t mn_mulc_vec3d_c(mn_vec3d_t *dst, mn_vec3d_t *src, const mn_vec3d_t *cst, size_t count);
+mn_result_t mn_mulc_vec4d_c(mn_vec4d_t *dst, mn_vec4d_t *src, const mn_vec4d_t *cst, size_t count);
+
+/**
+ * @brief Computes absolute value of float64 arrays using NEON.
+ */
+mn_result_t mn_abs_float64_neon(mn_float64_t *dst, mn_float64_t *src, size_t count);
+mn_result_t mn_abs_vec2d_neon(mn_vec2d_t *dst, mn_vec2d_t *src, size_t count);
+mn_result_t mn_abs_vec3d_neon(mn_vec3d_t *dst, mn_vec3d_t *src, size_t count);
+mn_result_t mn_abs_vec4d_neon(mn_vec4d_t *dst, mn_vec4d_t *src, size_t count);
+
+/**
+ * @brief Adds two float64 arrays using NEON.
+ */
+mn_result_t mn_add_float64_neon(mn_float64_t *dst, mn_float64_t *src1, mn_float64_t *src2, size_t count);
+mn_result_t mn_add_vec2d_neon(mn_vec2d_t *dst, mn_vec2d_t *src1, mn_vec2d_t *src2, size_t count);
+mn_result_t mn_add_vec3d_neon(mn_vec3d_t *dst, mn_vec3d_t *src1, mn_vec3d_t *src2, size_t count);
+mn_result_t mn_add_vec4d_neon(mn_vec4d_t *dst, mn_vec4d_t *src1, mn_vec4d_t *src2, size_t count);
+
+/**
+ * @brief Subtracts two float64 arrays using NEON.
+ */
+mn_result_t mn_sub_float64_neon(mn_float64_t *dst, mn_float64_t *src1, mn_float64_t *src2, size_t count);
+mn_result_t mn_sub_vec2d_neon(mn_vec2d_t *dst, mn_vec2d_t *src1, mn_vec2d_t *src2, size_t count);
+mn_result_t mn_sub_vec3d_neon(mn_vec3d_t *dst, mn_vec3d_t *src1, mn_vec3d_t *src2, size_t count);
+mn_result_t mn_sub_vec4d_neon(mn_vec4d_t *dst, mn_vec4d_t *src1, mn_vec4d_t *src2, size_t count);
+
+/**
+ * @brief Multiplies two float64 arrays using NEON.
+ */
+mn_result_t mn_mul_float64_neon(mn_float64_t *dst, mn_float64_t *src1, mn_float64_t *src2, size_t count);
+mn_result_t mn_mul_vec2d_neon(mn_vec2d_t *dst, mn_vec2d_t *src1, mn_vec2d_t *src2, size_t count);
+mn_result_t mn_mul_vec3d_neon(mn_vec3d_t *dst, mn_vec3d_t *src1, mn_vec3d_t *src2, size_t count);
+mn_result_t mn_mul_vec4d_neon(mn_vec4d_t *dst, mn_vec4d_t *src1, mn_vec4d_t *src2, size_t count);
+
+/**
+ * @brief Divides two float64 arrays using NEON.
+ */
+mn_result_t mn_div_float64_neon(mn_float64_t *dst, mn_float64_t *src1, mn_float64_t *src2, size_t count);
+mn_result_t mn_div_vec2d_neon(mn_vec2d_t *dst, mn_vec2d_t *src1, mn_vec2d_t *src2, size_t count);
+mn_result_t mn_div_vec3d_neon(mn_vec3d_t *dst, mn_vec3d_t *src1, mn_vec3d_t *src2, size_t count);
+mn_result_t mn_div_vec4d_neon(mn_vec4d_t *dst, mn_vec4d_t *src1, mn_vec4d_t *src2, size_t count);
+
+/**
+ * @brief Adds a constant to a float64 array using NEON.
+ */
+mn_result_t mn_addc_float64_neon(mn_float64_t *dst, mn_float64_t *src, mn_float64_t cst, size_t count);
+mn_result_t mn_addc_vec2d_neon(mn_vec2d_t *dst, mn_vec2d_t *src, const mn_vec2d_t *cst, size_t count);
+mn_result_t mn_addc_vec3d_neon(mn_vec3d_t *dst, mn_vec3d_t *src, const mn_vec3d_t *cst, size_t count);
+mn_result_t mn_addc_vec4d_neon(mn_vec4d_t *dst, mn_vec4d_t *src, const mn_vec4d_t *cst, size_t count);
+
+/**
+ * @brief Subtracts a constant from a float64 array using NEON.
+ */
+mn_result_t mn_subc_float64_neon(mn_float64_t *dst, mn_float64_t *src, mn_float64_t cst, size_t count);
+mn_result_t mn_subc_vec2d_neon(mn_vec2d_t *dst, mn_vec2d_t *src, const mn_vec2d_t *cst, size_t count);
+mn_result_t mn_subc_vec3d_neon(mn_vec3d_t *dst, mn_vec3d_t *src, const mn_vec3d_t *cst, size_t count);
+mn_result_t mn_subc_vec4d_neon(mn_vec4d_t *dst, mn_vec4d_t *src, const mn_vec4d_t *cst, size_t count);
+
+/**
+ * @brief Multiplies a float64 array by a constant using NEON.
+ */
+mn_result_t mn_mulc_float64_neon(mn_float64_t *dst, mn_float64_t *src, mn_float64_t cst, size_t count);
+mn_result_t mn_mulc_vec2d_neon(mn_vec2d_t *dst, mn_vec2d_t *src, const mn_vec2d_t *cst, size_t count);
+mn_result_t mn_mulc_vec3d_neon(mn_vec3d_t *dst, mn_vec3d_t *src, const mn_vec3d_t *cst, size_t count);
+mn_result_t mn_mulc_vec4d_neon(mn_vec4d_t *dst, mn_vec4d_t *src, const mn_vec4d_t *cst, size_t count);
+
+/**
+ * ================================
+ * MN FLOAT16 OPERATORS USING C & NEON
+ * ================================
+ */
+
+/**
+ * @brief Converts between float32 and IEEE half precision (round to nearest even).
+ */
+mn_float16_t mn_f32_to_f16(mn_float32_t value);
+mn_float32_t mn_f16_to_f32(mn_float16_t value);
+
+/**
+ * @brief Adds two float16 arrays using C.
+ */
+mn_result_t mn_add_float16_c(mn_float16_t *dst, mn_float16_t *src1, mn_float16_t *src2, size_t count);
+mn_result_t mn_add_vec2h_c(mn_vec2h_t *dst, mn_vec2h_t *src1, mn_vec2h_t *src2, size_t count);
+mn_result_t mn_add_vec3h_c(mn_vec3h_t *dst, mn_vec3h_t *src1, mn_vec3h_t *src2, size_t count);
+mn_result_t mn_add_vec4h_c(mn_vec4h_t *dst, mn_vec4h_t *src1, mn_vec4h_t *src2, size_t count);
+
+/**
+ * @brief Subtracts two float16 arrays using C.
+ */
+mn_result_t mn_sub_float16_c(mn_float16_t *dst, mn_float16_t *src1, mn_float16_t *src2, size_t count);
+mn_result_t mn_sub_vec2h_c(mn_vec2h_t *dst, mn_vec2h_t *src1, mn_vec2h_t *src2, size_t count);
+mn_result_t mn_sub_vec3h_c(mn_vec3h_t *dst, mn_vec3h_t *src1, mn_vec3h_t *src2, size_t count);
+mn_result_t mn_sub_vec4h_c(mn_vec4h_t *dst, mn_vec4h_t *src1, mn_vec4h_t *src2, size_t count);
+
+/**
+ * @brief Multiplies two float16 arrays using C.
+ */
+mn_result_t mn_mul_float16_c(mn_float16_t *dst, mn_float16_t *src1, mn_float16_t *src2, size_t count);
+mn_result_t mn_mul_vec2h_c(mn_vec2h_t *dst, mn_vec2h_t *src1, mn_vec2h_t *src2, size_t count);
+mn_result_t mn_mul_vec3h_c(mn_vec3h_t *dst, mn_vec3h_t *src1, mn_vec3h_t *src2, size_t count);
+mn_result_t mn_mul_vec4h_c(mn_vec4h_t *dst, mn_vec4h_t *src1, mn_vec4h_t *src2, size_t count);
+
+/**
+ * @brief Adds a constant to a float16 array using C.
+ */
+mn_result_t mn_addc_float16_c(mn_float16_t *dst, mn_float16_t *src, mn_float16_t cst, size_t count);
+mn_result_t mn_addc_vec2h_c(mn_vec2h_t *dst, mn_vec2h_t *src, const mn_vec2h_t *cst, size_t count);
+mn_result_t mn_addc_vec3h_c(mn_vec3h_t *dst, mn_vec3h_t *src, const mn_vec3h_t *cst, size_t count);
+mn_result_t mn_addc_vec4h_c(mn_vec4h_t *dst, mn_vec4h_t *src, const mn_vec4h_t *cst, size_t count);
+
+/**
+ * @brief Multiplies a float16 array by a constant using C.
+ */
+mn_result_t mn_mulc_float16_c(mn_float16_t *dst, mn_float16_t *src, mn_float16_t cst, size_t count);
+mn_result_t mn_mulc_vec2h_c(mn_vec2h_t *dst, mn_vec2h_t *src, const mn_vec2h_t *cst, size_t count);
+mn_result_t mn_mulc_vec3h_c(mn_vec3h_t *dst, mn_vec3h_t *src, const mn_vec3h_t *cst, size_t count);
+mn_result_t mn_mulc_vec4h_c(mn_vec4h_t *dst, mn_vec4h_t *src, const mn_vec4h_t *cst, size_t count);
+
+/**
+ * @brief Computes absolute value of float16 array using C.
+ */
+mn_result_t mn_abs_float16_c(mn_float16_t *dst, mn_float16_t *src, size_t count);
+mn_result_t mn_abs_vec2h_c(mn_vec2h_t *dst, mn_vec2h_t *src, size_t count);
+mn_result_t mn_abs_vec3h_c(mn_vec3h_t *dst, mn_vec3h_t *src, size_t count);
+mn_result_t mn_abs_vec4h_c(mn_vec4h_t *dst, mn_vec4h_t *src, size_t count);
+
+/**
+ * @brief Fused multiply-add of float16 arrays using C: dst = src1 * src2 + src3.
+ */
+mn_result_t mn_fma_float16_c(mn_float16_t *dst, mn_float16_t *src1, mn_float16_t *src2, mn_float16_t *src3, size_t count);
+mn_result_t mn_fma_vec2h_c(mn_vec2h_t *dst, mn_vec2h_t *src1, mn_vec2h_t *src2, mn_vec2h_t *src3, size_t count);
+mn_result_t mn_fma_vec3h_c(mn_vec3h_t *dst, mn_vec3h_t *src1, mn_vec3h_t *src2, mn_vec3h_t *src3, size_t count);
+mn_result_t mn_fma_vec4h_c(mn_vec4h_t *dst, mn_vec4h_t *src1, mn_vec4h_t *src2, mn_vec4h_t *src3, size_t count);
+
+/**
+ * @brief Adds two float16 arrays using NEON.
+ */
+mn_result_t mn_add_float16_neon(mn_float16_t *dst, mn_float16_t *src1, mn_float16_t *src2, size_t count);
+mn_result_t mn_add_vec2h_neon(mn_vec2h_t *dst, mn_vec2h_t *src1, mn_vec2h_t *src2, size_t count);
+mn_result_t mn_add_vec3h_neon(mn_vec3h_t *dst, mn_vec3h_t *src1, mn_vec3h_t *src2, size_t count);
+mn_result_t mn_add_vec4h_neon(mn_vec4h_t *dst, mn_vec4h_t *src1, mn_vec4h_t *src2, size_t count);
+
+/**
+ * @brief Subtracts two float16 arrays using NEON.
+ */
+mn_result_t mn_sub_float16_neon(mn_float16_t *dst, mn_float16_t *src1, mn_float16_t *src2, size_t count);
+mn_result_t mn_sub_vec2h_neon(mn_vec2h_t *dst, mn_vec2h_t *src1, mn_vec2h_t *src2, size_t count);
+mn_result_t mn_sub_vec3h_neon(mn_vec3h_t *dst, mn_vec3h_t *src1, mn_vec3h_t *src2, size_t count);
+mn_result_t mn_sub_vec4h_neon(mn_vec4h_t *dst, mn_vec4h_t *src1, mn_vec4h_t *src2, size_t count);
+
+/**
+ * @brief Multiplies two float16 arrays using NEON.
+ */
+mn_result_t mn_mul_float16_neon(mn_float16_t *dst, mn_float16_t *src1, mn_float16_t *src2, size_t count);
+mn_result_t mn_mul_vec2h_neon(mn_vec2h_t *dst, mn_vec2h_t *src1, mn_vec2h_t *src2, size_t count);
+mn_result_t mn_mul_vec3h_neon(mn_vec3h_t *dst, mn_vec3h_t *src1, mn_vec3h_t *src2, size_t count);
+mn_result_t mn_mul_vec4h_neon(mn_vec4h_t *dst, mn_vec4h_t *src1, mn_vec4h_t *src2, size_t count);
+
+/**
+ * @brief Adds a constant to a float16 array using NEON.
+ */
+mn_result_t mn_addc_float16_neon(mn_float16_t *dst, mn_float16_t *src, mn_float16_t cst, size_t count);
+mn_result_t mn_addc_vec2h_neon(mn_vec2h_t *dst, mn_vec2h_t *src, const mn_vec2h_t *cst, size_t count);
+mn_result_t mn_addc_vec3h_neon(mn_vec3h_t *dst, mn_vec3h_t *src, const mn_vec3h_t *cst, size_t count);
+mn_result_t mn_addc_vec4h_neon(mn_vec4h_t *dst, mn_vec4h_t *src, const mn_vec4h_t *cst, size_t count);
+
+/**
+ * @brief Multiplies a float16 array by a constant using NEON.
+ */
+mn_result_t mn_mulc_float16_neon(mn_float16_t *dst, mn_float16_t *src, mn_float16_t cst, size_t count);
+mn_result_t mn_mulc_vec2h_neon(mn_vec2h_t *dst, mn_vec2h_t *src, const mn_vec2h_t *cst, size_t count);
+mn_result_t mn_mulc_vec3h_neon(mn_vec3h_t *dst, mn_vec3h_t *src, const mn_vec3h_t *cst, size_t count);
+mn_result_t mn_mulc_vec4h_neon(mn_vec4h_t *dst, mn_vec4h_t *src, const mn_vec4h_t *cst, size_t count);
+
+/**
+ * @brief Computes absolute value of float16 array using NEON.
+ */
+mn_result_t mn_abs_float16_neon(mn_float16_t *dst, mn_float16_t *src, size_t count);
+mn_result_t mn_abs_vec2h_neon(mn_vec2h_t *dst, mn_vec2h_t *src, size_t count);
+mn_result_t mn_abs_vec3h_neon(mn_vec3h_t *dst, mn_vec3h_t *src, size_t count);
+mn_result_t mn_abs_vec4h_neon(mn_vec4h_t *dst, mn_vec4h_t *src, size_t count);
+
+/**
+ * @brief Fused multiply-add of float16 arrays using NEON: dst = src1 * src2 + src3.
+ */
+mn_result_t mn_fma_float16_neon(mn_float16_t *dst, mn_float16_t *src1, mn_float16_t *src2, mn_float16_t *src3, size_t count);
+mn_result_t mn_fma_vec2h_neon(mn_vec2h_t *dst, mn_vec2h_t *src1, mn_vec2h_t *src2, mn_vec2h_t *src3, size_t count);
+mn_result_t mn_fma_vec3h_neon(mn_vec3h_t *dst, mn_vec3h_t *src1, mn_vec3h_t *src2, mn_vec3h_t *src3, size_t count);
+mn_result_t mn_fma_vec4h_neon(mn_vec4h_t *dst, mn_vec4h_t *src1, mn_vec4h_t *src2, mn_vec4h_t *src3, size_t count);
+
+/**
+ * ================================
+ * MN BFLOAT16 OPERATORS USING C & NEON
+ * ================================
+ */
+
+/**
+ * @brief Converts between float32 and bfloat16 (round to nearest even, NaN stays NaN).
+ */
+mn_bfloat16_t mn_f32_to_bf16(mn_float32_t value);
+mn_float32_t mn_bf16_to_f32(mn_bfloat16_t value);
+
+/**
+ * @brief Adds two bfloat16 arrays using C.
+ */
+mn_result_t mn_add_bfloat16_c(mn_bfloat16_t *dst, mn_bfloat16_t *src1, mn_bfloat16_t *src2, size_t count);
+
+/**
+ * @brief Subtracts two bfloat16 arrays using C.
+ */
+mn_result_t mn_sub_bfloat16_c(mn_bfloat16_t *dst, mn_bfloat16_t *src1, mn_bfloat16_t *src2, size_t count);
+
+/**
+ * @brief Multiplies two bfloat16 arrays using C.
+ */
+mn_result_t mn_mul_bfloat16_c(mn_bfloat16_t *dst, mn_bfloat16_t *src1, mn_bfloat16_t *src2, size_t count);
+
+/**
+ * @brief Adds a constant to a bfloat16 array using C.
+ */
+mn_result_t mn_addc_bfloat16_c(mn_bfloat16_t *dst, mn_bfloat16_t *src, mn_bfloat16_t cst, size_t count);
+
+/**
+ * @brief Multiplies a bfloat16 array by a constant using C.
+ */
+mn_result_t mn_mulc_bfloat16_c(mn_bfloat16_t *dst, mn_bfloat16_t *src, mn_bfloat16_t cst, size_t count);
+
+/**
+ * @brief Fused multiply-add of bfloat16 arrays using C: dst = src1 * src2 + src3.
+ */
+mn_result_t mn_fma_bfloat16_c(mn_bfloat16_t *dst, mn_bfloat16_t *src1, mn_bfloat16_t *src2, mn_bfloat16_t *src3, size_t count);
+
+/**
+ * @brief Sums a bfloat16 array into a float32 using C.
+ */
+mn_result_t mn_sum_bfloat16_c(mn_float32_t *dst, mn_bfloat16_t *src, size_t count);
+
+/**
+ * @brief Dot product of two bfloat16 arrays into a float32 using C.
+ */
+mn_result_t mn_dot_bfloat16_c(mn_float32_t *dst, mn_bfloat16_t *src1, mn_bfloat16_t *src2, size_t count);
+
+/**
+ * @brief Adds two bfloat16 arrays using NEON.
+ */
+mn_result_t mn_add_bfloat16_neon(mn_bfloat16_t *dst, mn_bfloat16_t *src1, mn_bfloat16_t *src2, size_t count);
+
+/**
+ * @brief Subtracts two bfloat16 arrays using NEON.
+ */
+mn_result_t mn_sub_bfloat16_neon(mn_bfloat16_t *dst, mn_bfloat16_t *src1, mn_bfloat16_t *src2, size_t count);
+
+/**
+ * @brief Multiplies two bfloat16 arrays using NEON.
+ */
+mn_result_t mn_mul_bfloat16_neon(mn_bfloat16_t *dst, mn_bfloat16_t *src1, mn_bfloat16_t *src2, size_t count);
+
+/**
+ * @brief Adds a constant to a bfloat16 array using NEON.
+ */
+mn_result_t mn_addc_bfloat16_neon(mn_bfloat16_t *dst, mn_bfloat16_t *src, mn_bfloat16_t cst, size_t count);
+
+/**
+ * @brief Multiplies a bfloat16 array by a constant using NEON.
+ */
+mn_result_t mn_mulc_bfloat16_neon(mn_bfloat16_t *dst, mn_bfloat16_t *src, mn_bfloat16_t cst, size_t count);
+
+/**
+ * @brief Fused multiply-add of bfloat16 arrays using NEON: dst = src1 * src2 + src3.
+ */
+mn_result_t mn_fma_bfloat16_neon(mn_bfloat16_t *dst, mn_bfloat16_t *src1, mn_bfloat16_t *src2, mn_bfloat16_t *src3, size_t count);
+
+/**
+ * @brief Sums a bfloat16 array into a float32 using NEON. Adds 8 partial sums instead of
+ *        in sequence, so the result matches mn_sum_bfloat16_c only to rounding.
+ */
+mn_result_t mn_sum_bfloat16_neon(mn_float32_t *dst, mn_bfloat16_t *src, size_t count);
+
+/**
+ * @brief Dot product of two bfloat16 arrays into a float32 using NEON (vbfdotq_f32 with MN_BF16_NATIVE).
+ *        The products are exact, but they are added into 8 partial sums instead of in
+ *        sequence, so the result matches mn_dot_bfloat16_c only to rounding.
+ */
+mn_result_t mn_dot_bfloat16_neon(mn_float32_t *dst, mn_bfloat16_t *src1, mn_bfloat16_t *src2, size_t count);
+
+/**
+ * ================================
+ * MN INT8 / INT16 OPERATORS USING C & NEON
+ * ================================
+ *
+ * The plain routines wrap around on overflow, the _sat routines saturate to
+ * the range of the element type. abs is only defined for the signed types.
+ */
+
+/**
+ * @brief Adds two arrays of int8/uint8/int16/uint16 (wrapping) using C.
+ */
+mn_result_t mn_add_int8_c(mn_int8_t *dst, mn_int8_t *src1, mn_int8_t *src2, size_t count);
+mn_result_t mn_add_uint8_c(mn_uint8_t *dst, mn_uint8_t *src1, mn_uint8_t *src2, size_t count);
+mn_result_t mn_add_int16_c(mn_int16_t *dst, mn_int16_t *src1, mn_int16_t *src2, size_t count);
+mn_result_t mn_add_uint16_c(mn_uint16_t *dst, mn_uint16_t *src1, mn_uint16_t *src2, size_t count);
+
+/**
+ * @brief Adds two arrays of int8/uint8/int16/uint16 (saturating) using C.
+ */
+mn_result_t mn_add_sat_int8_c(mn_int8_t *dst, mn_int8_t *src1, mn_int8_t *src2, size_t count);
+mn_result_t mn_add_sat_uint8_c(mn_uint8_t *dst, mn_uint8_t *src1, mn_uint8_t *src2, size_t count);
+mn_result_t mn_add_sat_int16_c(mn_int16_t *dst, mn_int16_t *src1, mn_int16_t *src2, size_t count);
+mn_result_t mn_add_sat_uint16_c(mn_uint16_t *dst, mn_uint16_t *src1, mn_uint16_t *src2, size_t count);
+
+/**
+ * @brief Subtracts two arrays of int8/uint8/int16/uint16 (wrapping) using C.
+ */
+mn_result_t mn_sub_int8_c(mn_int8_t *dst, mn_int8_t *src1, mn_int8_t *src2, size_t count);
+mn_result_t mn_sub_uint8_c(mn_uint8_t *dst, mn_uint8_t *src1, mn_uint8_t *src2, size_t count);
+mn_result_t mn_sub_int16_c(mn_int16_t *dst, mn_int16_t *src1, mn_int16_t *src2, size_t count);
+mn_result_t mn_sub_uint16_c(mn_uint16_t *dst, mn_uint16_t *src1, mn_uint16_t *src2, size_t count);
+
+/**
+ * @brief Subtracts two arrays of int8/uint8/int16/uint16 (saturating) using C.
+ */
+mn_result_t mn_sub_sat_int8_c(mn_int8_t *dst, mn_int8_t *src1, mn_int8_t *src2, size_t count);
+mn_result_t mn_sub_sat_uint8_c(mn_uint8_t *dst, mn_uint8_t *src1, mn_uint8_t *src2, size_t count);
+mn_result_t mn_sub_sat_int16_c(mn_int16_t *dst, mn_int16_t *src1, mn_int16_t *src2, size_t count);
+mn_result_t mn_sub_sat_uint16_c(mn_uint16_t *dst, mn_uint16_t *src1, mn_uint16_t *src2, size_t count);
+
+/**
+ * @brief Multiplies two arrays of int8/uint8/int16/uint16 (wrapping) using C.
+ */
+mn_result_t mn_mul_int8_c(mn_int8_t *dst, mn_int8_t *src1, mn_int8_t *src2, size_t count);
+mn_result_t mn_mul_uint8_c(mn_uint8_t *dst, mn_uint8_t *src1, mn_uint8_t *src2, size_t count);
+mn_result_t mn_mul_int16_c(mn_int16_t *dst, mn_int16_t *src1, mn_int16_t *src2, size_t count);
+mn_result_t mn_mul_uint16_c(mn_uint16_t *dst, mn_uint16_t *src1, mn_uint16_t *src2, size_t count);
+
+/**
+ * @brief Multiplies two arrays of int8/uint8/int16/uint16 (saturating) using C.
+ */
+mn_result_t mn_mul_sat_int8_c(mn_int8_t *dst, mn_int8_t *src1, mn_int8_t *src2, size_t count);
+mn_result_t mn_mul_sat_uint8_c(mn_uint8_t *dst, mn_uint8_t *src1, mn_uint8_t *src2, size_t count);
+mn_result_t mn_mul_sat_int16_c(mn_int16_t *dst, mn_int16_t *src1, mn_int16_t *src2, size_t count);
+mn_result_t mn_mul_sat_uint16_c(mn_uint16_t *dst, mn_uint16_t *src1, mn_uint16_t *src2, size_t count);
+
+/**
+ * @brief Adds a constant to an array of int8/uint8/int16/uint16 (wrapping) using C.
+ */
+mn_result_t mn_addc_int8_c(mn_int8_t *dst, mn_int8_t *src, mn_int8_t cst, size_t count);
+mn_result_t mn_addc_uint8_c(mn_uint8_t *dst, mn_uint8_t *src, mn_uint8_t cst, size_t count);
+mn_result_t mn_addc_int16_c(mn_int16_t *dst, mn_int16_t *src, mn_int16_t cst, size_t count);
+mn_result_t mn_addc_uint16_c(mn_uint16_t *dst, mn_uint16_t *src, mn_uint16_t cst, size_t count);
+
+/**
+ * @brief Adds a constant to an array of int8/uint8/int16/uint16 (saturating) using C.
+ */
+mn_result_t mn_addc_sat_int8_c(mn_int8_t *dst, mn_int8_t *src, mn_int8_t cst, size_t count);
+mn_result_t mn_addc_sat_uint8_c(mn_uint8_t *dst, mn_uint8_t *src, mn_uint8_t cst, size_t count);
+mn_result_t mn_addc_sat_int16_c(mn_int16_t *dst, mn_int16_t *src, mn_int16_t cst, size_t count);
+mn_result_t mn_addc_sat_uint16_c(mn_uint16_t *dst, mn_uint16_t *src, mn_uint16_t cst, size_t count);
+
+/**
+ * @brief Subtracts a constant from an array of int8/uint8/int16/uint16 (wrapping) using C.
+ */
+mn_result_t mn_subc_int8_c(mn_int8_t *dst, mn_int8_t *src, mn_int8_t cst, size_t count);
+mn_result_t mn_subc_uint8_c(mn_uint8_t *dst, mn_uint8_t *src, mn_uint8_t cst, size_t count);
+mn_result_t mn_subc_int16_c(mn_int16_t *dst, mn_int16_t *src, mn_int16_t cst, size_t count);
+mn_result_t mn_subc_uint16_c(mn_uint16_t *dst, mn_uint16_t *src, mn_uint16_t cst, size_t count);
+
+/**
+ * @brief Subtracts a constant from an array of int8/uint8/int16/uint16 (saturating) using C.
+ */
+mn_result_t mn_subc_sat_int8_c(mn_int8_t *dst, mn_int8_t *src, mn_int8_t cst, size_t count);
+mn_result_t mn_subc_sat_uint8_c(mn_uint8_t *dst, mn_uint8_t *src, mn_uint8_t cst, size_t count);
+mn_result_t mn_subc_sat_int16_c(mn_int16_t *dst, mn_int16_t *src, mn_int16_t cst, size_t count);
+mn_result_t mn_subc_sat_uint16_c(mn_uint16_t *dst, mn_uint16_t *src, mn_uint16_t cst, size_t count);
+
+/**
+ * @brief Multiplies an array by a constant of int8/uint8/int16/uint16 (wrapping) using C.
+ */
+mn_result_t mn_mulc_int8_c(mn_int8_t *dst, mn_int8_t *src, mn_int8_t cst, size_t count);
+mn_result_t mn_mulc_uint8_c(mn_uint8_t *dst, mn_uint8_t *src, mn_uint8_t cst, size_t count);
+mn_result_t mn_mulc_int16_c(mn_int16_t *dst, mn_int16_t *src, mn_int16_t cst, size_t count);
+mn_result_t mn_mulc_uint16_c(mn_uint16_t *dst, mn_uint16_t *src, mn_uint16_t cst, size_t count);
+
+/**
+ * @brief Multiplies an array by a constant of int8/uint8/int16/uint16 (saturating) using C.
+ */
+mn_result_t mn_mulc_sat_int8_c(mn_int8_t *dst, mn_int8_t *src, mn_int8_t cst, size_t count);
+mn_result_t mn_mulc_sat_uint8_c(mn_uint8_t *dst, mn_uint8_t *src, mn_uint8_t cst, size_t count);
+mn_result_t mn_mulc_sat_int16_c(mn_int16_t *dst, mn_int16_t *src, mn_int16_t cst, size_t count);
+mn_result_t mn_mulc_sat_uint16_c(mn_uint16_t *dst, mn_uint16_t *src, mn_uint16_t cst, size_t count);
+
+/**
+ * @brief Computes absolute value of int8/int16 arrays (wrapping) using C.
+ */
+mn_result_t mn_abs_int8_c(mn_int8_t *dst, mn_int8_t *src, size_t count);
+mn_result_t mn_abs_int16_c(mn_int16_t *dst, mn_int16_t *src, size_t count);
+
+/**
+ * @brief Computes absolute value of int8/int16 arrays (saturating) using C.
+ */
+mn_result_t mn_abs_sat_int8_c(mn_int8_t *dst, mn_int8_t *src, size_t count);
+mn_result_t mn_abs_sat_int16_c(mn_int16_t *dst, mn_int16_t *src, size_t count);
+
+/**
+ * @brief Multiplies Q15 fixed-point arrays using C: (src1 * src2) >> 15, -1 * -1 saturates.
+ */
+mn_result_t mn_mul_q15_int16_c(mn_int16_t *dst, mn_int16_t *src1, mn_int16_t *src2, size_t count);
+mn_result_t mn_mulc_q15_int16_c(mn_int16_t *dst, mn_int16_t *src, mn_int16_t cst, size_t count);
+
+/**
+ * @brief Adds two arrays of int8/uint8/int16/uint16 (wrapping) using NEON.
+ */
+mn_result_t mn_add_int8_neon(mn_int8_t *dst, mn_int8_t *src1, mn_int8_t *src2, size_t count);
+mn_result_t mn_add_uint8_neon(mn_uint8_t *dst, mn_uint8_t *src1, mn_uint8_t *src2, size_t count);
+mn_result_t mn_add_int16_neon(mn_int16_t *dst, mn_int16_t *src1, mn_int16_t *src2, size_t count);
+mn_result_t mn_add_uint16_neon(mn_uint16_t *dst, mn_uint16_t *src1, mn_uint16_t *src2, size_t count);
+
+/**
+ * @brief Adds two arrays of int8/uint8/int16/uint16 (saturating) using NEON.
+ */
+mn_result_t mn_add_sat_int8_neon(mn_int8_t *dst, mn_int8_t *src1, mn_int8_t *src2, size_t count);
+mn_result_t mn_add_sat_uint8_neon(mn_uint8_t *dst, mn_uint8_t *src1, mn_uint8_t *src2, size_t count);
+mn_result_t mn_add_sat_int16_neon(mn_int16_t *dst, mn_int16_t *src1, mn_int16_t *src2, size_t count);
+mn_result_t mn_add_sat_uint16_neon(mn_uint16_t *dst, mn_uint16_t *src1, mn_uint16_t *src2, size_t count);
+
+/**
+ * @brief Subtracts two arrays of int8/uint8/int16/uint16 (wrapping) using NEON.
+ */
+mn_result_t mn_sub_int8_neon(mn_int8_t *dst, mn_int8_t *src1, mn_int8_t *src2, size_t count);
+mn_result_t mn_sub_uint8_neon(mn_uint8_t *dst, mn_uint8_t *src1, mn_uint8_t *src2, size_t count);
+mn_result_t mn_sub_int16_neon(mn_int16_t *dst, mn_int16_t *src1, mn_int16_t *src2, size_t count);
+mn_result_t mn_sub_uint16_neon(mn_uint16_t *dst, mn_uint16_t *src1, mn_uint16_t *src2, size_t count);
+
+/**
+ * @brief Subtracts two arrays of int8/uint8/int16/uint16 (saturating) using NEON.
+ */
+mn_result_t mn_sub_sat_int8_neon(mn_int8_t *dst, mn_int8_t *src1, mn_int8_t *src2, size_t count);
+mn_result_t mn_sub_sat_uint8_neon(mn_uint8_t *dst, mn_uint8_t *src1, mn_uint8_t *src2, size_t count);
+mn_result_t mn_sub_sat_int16_neon(mn_int16_t *dst, mn_int16_t *src1, mn_int16_t *src2, size_t count);
+mn_result_t mn_sub_sat_uint16_neon(mn_uint16_t *dst, mn_uint16_t *src1, mn_uint16_t *src2, size_t count);
+
+/**
+ * @brief Multiplies two arrays of int8/uint8/int16/uint16 (wrapping) using NEON.
+ */
+mn_result_t mn_mul_int8_neon(mn_int8_t *dst, mn_int8_t *src1, mn_int8_t *src2, size_t count);
+mn_result_t mn_mul_uint8_neon(mn_uint8_t *dst, mn_uint8_t *src1, mn_uint8_t *src2, size_t count);
+mn_result_t mn_mul_int16_neon(mn_int16_t *dst, mn_int16_t *src1, mn_int16_t *src2, size_t count);
+mn_result_t mn_mul_uint16_neon(mn_uint16_t *dst, mn_uint16_t *src1, mn_uint16_t *src2, size_t count);
+
+/**
+ * @brief Multiplies two arrays of int8/uint8/int16/uint16 (saturating) using NEON.
+ */
+mn_result_t mn_mul_sat_int8_neon(mn_int8_t *dst, mn_int8_t *src1, mn_int8_t *src2, size_t count);
+mn_result_t mn_mul_sat_uint8_neon(mn_uint8_t *dst, mn_uint8_t *src1, mn_uint8_t *src2, size_t count);
+mn_result_t mn_mul_sat_int16_neon(mn_int16_t *dst, mn_int16_t *src1, mn_int16_t *src2, size_t count);
+mn_result_t mn_mul_sat_uint16_neon(mn_uint16_t *dst, mn_uint16_t *src1, mn_uint16_t *src2, size_t count);
+
+/**
+ * @brief Adds a constant to an array of int8/uint8/int16/uint16 (wrapping) using NEON.
+ */
+mn_result_t mn_addc_int8_neon(mn_int8_t *dst, mn_int8_t *src, mn_int8_t cst, size_t count);
+mn_result_t mn_addc_uint8_neon(mn_uint8_t *dst, mn_uint8_t *src, mn_uint8_t cst, size_t count);
+mn_result_t mn_addc_int16_neon(mn_int16_t *dst, mn_int16_t *src, mn_int16_t cst, size_t count);
+mn_result_t mn_addc_uint16_neon(mn_uint16_t *dst, mn_uint16_t *src, mn_uint16_t cst, size_t count);
+
+/**
+ * @brief Adds a constant to an array of int8/uint8/int16/uint16 (saturating) using NEON.
+ */
+mn_result_t mn_addc_sat_int8_neon(mn_int8_t *dst, mn_int8_t *src, mn_int8_t cst, size_t count);
+mn_result_t mn_addc_sat_uint8_neon(mn_uint8_t *dst, mn_uint8_t *src, mn_uint8_t cst, size_t count);
+mn_result_t mn_addc_sat_int16_neon(mn_int16_t *dst, mn_int16_t *src, mn_int16_t cst, size_t count);
+mn_result_t mn_addc_sat_uint16_neon(mn_uint16_t *dst, mn_uint16_t *src, mn_uint16_t cst, size_t count);
+
+/**
+ * @brief Subtracts a constant from an array of int8/uint8/int16/uint16 (wrapping) using NEON.
+ */
+mn_result_t mn_subc_int8_neon(mn_int8_t *dst, mn_int8_t *src, mn_int8_t cst, size_t count);
+mn_result_t mn_subc_uint8_neon(mn_uint8_t *dst, mn_uint8_t *src, mn_uint8_t cst, size_t count);
+mn_result_t mn_subc_int16_neon(mn_int16_t *dst, mn_int16_t *src, mn_int16_t cst, size_t count);
+mn_result_t mn_subc_uint16_neon(mn_uint16_t *dst, mn_uint16_t *src, mn_uint16_t cst, size_t count);
+
+/**
+ * @brief Subtracts a constant from an array of int8/uint8/int16/uint16 (saturating) using NEON.
+ */
+mn_result_t mn_subc_sat_int8_neon(mn_int8_t *dst, mn_int8_t *src, mn_int8_t cst, size_t count);
+mn_result_t mn_subc_sat_uint8_neon(mn_uint8_t *dst, mn_uint8_t *src, mn_uint8_t cst, size_t count);
+mn_result_t mn_subc_sat_int16_neon(mn_int16_t *dst, mn_int16_t *src, mn_int16_t cst, size_t count);
+mn_result_t mn_subc_sat_uint16_neon(mn_uint16_t *dst, mn_uint16_t *src, mn_uint16_t cst, size_t count);
+
+/**
+ * @brief Multiplies an array by a constant of int8/uint8/int16/uint16 (wrapping) using NEON.
+ */
+mn_result_t mn_mulc_int8_neon(mn_int8_t *dst, mn_int8_t *src, mn_int8_t cst, size_t count);
+mn_result_t mn_mulc_uint8_neon(mn_uint8_t *dst, mn_uint8_t *src, mn_uint8_t cst, size_t count);
+mn_result_t mn_mulc_int16_neon(mn_int16_t *dst, mn_int16_t *src, mn_int16_t cst, size_t count);
+mn_result_t mn_mulc_uint16_neon(mn_uint16_t *dst, mn_uint16_t *src, mn_uint16_t cst, size_t count);
+
+/**
+ * @brief Multiplies an array by a constant of int8/uint8/int16/uint16 (saturating) using NEON.
+ */
+mn_result_t mn_mulc_sat_int8_neon(mn_int8_t *dst, mn_int8_t *src, mn_int8_t cst, size_t count);
+mn_result_t mn_mulc_sat_uint8_neon(mn_uint8_t *dst, mn_uint8_t *src, mn_uint8_t cst, size_t count);
+mn_result_t mn_mulc_sat_int16_neon(mn_int16_t *dst, mn_int16_t *src, mn_int16_t cst, size_t count);
+mn_result_t mn_mulc_sat_uint16_neon(mn_uint16_t *dst, mn_uint16_t *src, mn_uint16_t cst, size_t count);
+
+/**
+ * @brief Computes absolute value of int8/int16 arrays (wrapping) using NEON.
+ */
+mn_result_t mn_abs_int8_neon(mn_int8_t *dst, mn_int8_t *src, size_t count);
+mn_result_t mn_abs_int16_neon(mn_int16_t *dst, mn_int16_t *src, size_t count);
+
+/**
+ * @brief Computes absolute value of int8/int16 arrays (saturating) using NEON.
+ */
+mn_result_t mn_abs_sat_int8_neon(mn_int8_t *dst, mn_int8_t *src, size_t count);
+mn_result_t mn_abs_sat_int16_neon(mn_int16_t *dst, mn_int16_t *src, size_t count);
+
+/**
+ * @brief Multiplies Q15 fixed-point arrays using NEON: (src1 * src2) >> 15, -1 * -1 saturates.
+ */
+mn_result_t mn_mul_q15_int16_neon(mn_int16_t *dst, mn_int16_t *src1, mn_int16_t *src2, size_t count);
+mn_result_t mn_mulc_q15_int16_neon(mn_int16_t *dst, mn_int16_t *src, mn_int16_t cst, size_t count);
+
+/**
+ * ================================
+ * MN TYPE CONVERSIONS USING C & NEON
+ * ================================
+ *
+ * mn_cvt_<from>_<to>: dst = convert(src * cfg->scale + cfg->offset), see
+ * mn_cvt_config_t. A NULL cfg converts the values unchanged, rounding to
+ * nearest even. Integer targets saturate. float64 converts to and from
+ * float and int32, with the scaling done in float64.
+ */
+
+/**
+ * @brief Converts int8 arrays to the other element types using C.
+ */
+mn_result_t mn_cvt_int8_uint8_c(mn_uint8_t *dst, mn_int8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int8_int16_c(mn_int16_t *dst, mn_int8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int8_uint16_c(mn_uint16_t *dst, mn_int8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int8_int32_c(mn_int32_t *dst, mn_int8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int8_float_c(mn_float32_t *dst, mn_int8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int8_float16_c(mn_float16_t *dst, mn_int8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int8_bfloat16_c(mn_bfloat16_t *dst, mn_int8_t *src, const mn_cvt_config_t *cfg, size_t count);
+
+/**
+ * @brief Converts uint8 arrays to the other element types using C.
+ */
+mn_result_t mn_cvt_uint8_int8_c(mn_int8_t *dst, mn_uint8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint8_int16_c(mn_int16_t *dst, mn_uint8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint8_uint16_c(mn_uint16_t *dst, mn_uint8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint8_int32_c(mn_int32_t *dst, mn_uint8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint8_float_c(mn_float32_t *dst, mn_uint8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint8_float16_c(mn_float16_t *dst, mn_uint8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint8_bfloat16_c(mn_bfloat16_t *dst, mn_uint8_t *src, const mn_cvt_config_t *cfg, size_t count);
+
+/**
+ * @brief Converts int16 arrays to the other element types using C.
+ */
+mn_result_t mn_cvt_int16_int8_c(mn_int8_t *dst, mn_int16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int16_uint8_c(mn_uint8_t *dst, mn_int16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int16_uint16_c(mn_uint16_t *dst, mn_int16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int16_int32_c(mn_int32_t *dst, mn_int16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int16_float_c(mn_float32_t *dst, mn_int16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int16_float16_c(mn_float16_t *dst, mn_int16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int16_bfloat16_c(mn_bfloat16_t *dst, mn_int16_t *src, const mn_cvt_config_t *cfg, size_t count);
+
+/**
+ * @brief Converts uint16 arrays to the other element types using C.
+ */
+mn_result_t mn_cvt_uint16_int8_c(mn_int8_t *dst, mn_uint16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint16_uint8_c(mn_uint8_t *dst, mn_uint16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint16_int16_c(mn_int16_t *dst, mn_uint16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint16_int32_c(mn_int32_t *dst, mn_uint16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint16_float_c(mn_float32_t *dst, mn_uint16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint16_float16_c(mn_float16_t *dst, mn_uint16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint16_bfloat16_c(mn_bfloat16_t *dst, mn_uint16_t *src, const mn_cvt_config_t *cfg, size_t count);
+
+/**
+ * @brief Converts int32 arrays to the other element types using C.
+ */
+mn_result_t mn_cvt_int32_int8_c(mn_int8_t *dst, mn_int32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int32_uint8_c(mn_uint8_t *dst, mn_int32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int32_int16_c(mn_int16_t *dst, mn_int32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int32_uint16_c(mn_uint16_t *dst, mn_int32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int32_float_c(mn_float32_t *dst, mn_int32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int32_float16_c(mn_float16_t *dst, mn_int32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int32_bfloat16_c(mn_bfloat16_t *dst, mn_int32_t *src, const mn_cvt_config_t *cfg, size_t count);
+
+/**
+ * @brief Converts float arrays to the other element types using C.
+ */
+mn_result_t mn_cvt_float_int8_c(mn_int8_t *dst, mn_float32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float_uint8_c(mn_uint8_t *dst, mn_float32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float_int16_c(mn_int16_t *dst, mn_float32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float_uint16_c(mn_uint16_t *dst, mn_float32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float_int32_c(mn_int32_t *dst, mn_float32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float_float16_c(mn_float16_t *dst, mn_float32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float_bfloat16_c(mn_bfloat16_t *dst, mn_float32_t *src, const mn_cvt_config_t *cfg, size_t count);
+
+/**
+ * @brief Converts float16 arrays to the other element types using C.
+ */
+mn_result_t mn_cvt_float16_int8_c(mn_int8_t *dst, mn_float16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float16_uint8_c(mn_uint8_t *dst, mn_float16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float16_int16_c(mn_int16_t *dst, mn_float16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float16_uint16_c(mn_uint16_t *dst, mn_float16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float16_int32_c(mn_int32_t *dst, mn_float16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float16_float_c(mn_float32_t *dst, mn_float16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float16_bfloat16_c(mn_bfloat16_t *dst, mn_float16_t *src, const mn_cvt_config_t *cfg, size_t count);
+
+/**
+ * @brief Converts bfloat16 arrays to the other element types using C.
+ */
+mn_result_t mn_cvt_bfloat16_int8_c(mn_int8_t *dst, mn_bfloat16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_bfloat16_uint8_c(mn_uint8_t *dst, mn_bfloat16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_bfloat16_int16_c(mn_int16_t *dst, mn_bfloat16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_bfloat16_uint16_c(mn_uint16_t *dst, mn_bfloat16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_bfloat16_int32_c(mn_int32_t *dst, mn_bfloat16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_bfloat16_float_c(mn_float32_t *dst, mn_bfloat16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_bfloat16_float16_c(mn_float16_t *dst, mn_bfloat16_t *src, const mn_cvt_config_t *cfg, size_t count);
+
+/**
+ * @brief Converts int8 arrays to the other element types using NEON.
+ */
+mn_result_t mn_cvt_int8_uint8_neon(mn_uint8_t *dst, mn_int8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int8_int16_neon(mn_int16_t *dst, mn_int8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int8_uint16_neon(mn_uint16_t *dst, mn_int8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int8_int32_neon(mn_int32_t *dst, mn_int8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int8_float_neon(mn_float32_t *dst, mn_int8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int8_float16_neon(mn_float16_t *dst, mn_int8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int8_bfloat16_neon(mn_bfloat16_t *dst, mn_int8_t *src, const mn_cvt_config_t *cfg, size_t count);
+
+/**
+ * @brief Converts uint8 arrays to the other element types using NEON.
+ */
+mn_result_t mn_cvt_uint8_int8_neon(mn_int8_t *dst, mn_uint8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint8_int16_neon(mn_int16_t *dst, mn_uint8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint8_uint16_neon(mn_uint16_t *dst, mn_uint8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint8_int32_neon(mn_int32_t *dst, mn_uint8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint8_float_neon(mn_float32_t *dst, mn_uint8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint8_float16_neon(mn_float16_t *dst, mn_uint8_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint8_bfloat16_neon(mn_bfloat16_t *dst, mn_uint8_t *src, const mn_cvt_config_t *cfg, size_t count);
+
+/**
+ * @brief Converts int16 arrays to the other element types using NEON.
+ */
+mn_result_t mn_cvt_int16_int8_neon(mn_int8_t *dst, mn_int16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int16_uint8_neon(mn_uint8_t *dst, mn_int16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int16_uint16_neon(mn_uint16_t *dst, mn_int16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int16_int32_neon(mn_int32_t *dst, mn_int16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int16_float_neon(mn_float32_t *dst, mn_int16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int16_float16_neon(mn_float16_t *dst, mn_int16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int16_bfloat16_neon(mn_bfloat16_t *dst, mn_int16_t *src, const mn_cvt_config_t *cfg, size_t count);
+
+/**
+ * @brief Converts uint16 arrays to the other element types using NEON.
+ */
+mn_result_t mn_cvt_uint16_int8_neon(mn_int8_t *dst, mn_uint16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint16_uint8_neon(mn_uint8_t *dst, mn_uint16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint16_int16_neon(mn_int16_t *dst, mn_uint16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint16_int32_neon(mn_int32_t *dst, mn_uint16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint16_float_neon(mn_float32_t *dst, mn_uint16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint16_float16_neon(mn_float16_t *dst, mn_uint16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_uint16_bfloat16_neon(mn_bfloat16_t *dst, mn_uint16_t *src, const mn_cvt_config_t *cfg, size_t count);
+
+/**
+ * @brief Converts int32 arrays to the other element types using NEON.
+ */
+mn_result_t mn_cvt_int32_int8_neon(mn_int8_t *dst, mn_int32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int32_uint8_neon(mn_uint8_t *dst, mn_int32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int32_int16_neon(mn_int16_t *dst, mn_int32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int32_uint16_neon(mn_uint16_t *dst, mn_int32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int32_float_neon(mn_float32_t *dst, mn_int32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int32_float16_neon(mn_float16_t *dst, mn_int32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_int32_bfloat16_neon(mn_bfloat16_t *dst, mn_int32_t *src, const mn_cvt_config_t *cfg, size_t count);
+
+/**
+ * @brief Converts float arrays to the other element types using NEON.
+ */
+mn_result_t mn_cvt_float_int8_neon(mn_int8_t *dst, mn_float32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float_uint8_neon(mn_uint8_t *dst, mn_float32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float_int16_neon(mn_int16_t *dst, mn_float32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float_uint16_neon(mn_uint16_t *dst, mn_float32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float_int32_neon(mn_int32_t *dst, mn_float32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float_float16_neon(mn_float16_t *dst, mn_float32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float_bfloat16_neon(mn_bfloat16_t *dst, mn_float32_t *src, const mn_cvt_config_t *cfg, size_t count);
+
+/**
+ * @brief Converts float16 arrays to the other element types using NEON.
+ */
+mn_result_t mn_cvt_float16_int8_neon(mn_int8_t *dst, mn_float16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float16_uint8_neon(mn_uint8_t *dst, mn_float16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float16_int16_neon(mn_int16_t *dst, mn_float16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float16_uint16_neon(mn_uint16_t *dst, mn_float16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float16_int32_neon(mn_int32_t *dst, mn_float16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float16_float_neon(mn_float32_t *dst, mn_float16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float16_bfloat16_neon(mn_bfloat16_t *dst, mn_float16_t *src, const mn_cvt_config_t *cfg, size_t count);
+
+/**
+ * @brief Converts bfloat16 arrays to the other element types using NEON.
+ */
+mn_result_t mn_cvt_bfloat16_int8_neon(mn_int8_t *dst, mn_bfloat16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_bfloat16_uint8_neon(mn_uint8_t *dst, mn_bfloat16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_bfloat16_int16_neon(mn_int16_t *dst, mn_bfloat16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_bfloat16_uint16_neon(mn_uint16_t *dst, mn_bfloat16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_bfloat16_int32_neon(mn_int32_t *dst, mn_bfloat16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_bfloat16_float_neon(mn_float32_t *dst, mn_bfloat16_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_bfloat16_float16_neon(mn_float16_t *dst, mn_bfloat16_t *src, const mn_cvt_config_t *cfg, size_t count);
+
+/**
+ * @brief Converts between float64 and float / int32 arrays using C.
+ */
+mn_result_t mn_cvt_int32_float64_c(mn_float64_t *dst, mn_int32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float_float64_c(mn_float64_t *dst, mn_float32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float64_int32_c(mn_int32_t *dst, mn_float64_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float64_float_c(mn_float32_t *dst, mn_float64_t *src, const mn_cvt_config_t *cfg, size_t count);
+
+/**
+ * @brief Converts between float64 and float / int32 arrays using NEON.
+ */
+mn_result_t mn_cvt_int32_float64_neon(mn_float64_t *dst, mn_int32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float_float64_neon(mn_float64_t *dst, mn_float32_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float64_int32_neon(mn_int32_t *dst, mn_float64_t *src, const mn_cvt_config_t *cfg, size_t count);
+mn_result_t mn_cvt_float64_float_neon(mn_float32_t *dst, mn_float64_t *src, const mn_cvt_config_t *cfg, size_t count);
+
+/**
+ * ================================
+ * MN MATRIX OPERATORS USING C & NEON
+ * ================================
+ *
+ * Matrices are column major (mn_mat2f_t / mn_mat3f_t / mn_mat4f_t).
+ */
+
+/**
+ * @brief Multiplies arrays of 4x4 matrices, dst[i] = src1[i] * src2[i], using C.
+ */
+mn_result_t mn_mulmat_4x4f_c(mn_mat4f_t *dst, mn_mat4f_t *src1, mn_mat4f_t *src2, size_t count);
+
+/**
+ * @brief Transforms an array of vectors by one 4x4 matrix, dst[i] = mat * src[i], using C.
+ */
+mn_result_t mn_transform_vec4f_c(mn_vec4f_t *dst, mn_vec4f_t *src, const mn_mat4f_t *mat, size_t count);
+
+/**
+ * @brief Multiplies arrays of 4x4 matrices, dst[i] = src1[i] * src2[i], using NEON.
+ */
+mn_result_t mn_mulmat_4x4f_neon(mn_mat4f_t *dst, mn_mat4f_t *src1, mn_mat4f_t *src2, size_t count);
+
+/**
+ * @brief Transforms an array of vectors by one 4x4 matrix, dst[i] = mat * src[i], using NEON.
+ */
+mn_result_t mn_transform_vec4f_neon(mn_vec4f_t *dst, mn_vec4f_t *src, const mn_mat4f_t *mat, size_t count);
+
+/**
+ * @brief Adds / subtracts arrays of matrices, dst[i] = src1[i] +/- src2[i], using C.
+ */
+mn_result_t mn_addmat_2x2f_c(mn_mat2f_t *dst, mn_mat2f_t *src1, mn_mat2f_t *src2, size_t count);
+mn_result_t mn_addmat_3x3f_c(mn_mat3f_t *dst, mn_mat3f_t *src1, mn_mat3f_t *src2, size_t count);
+mn_result_t mn_addmat_4x4f_c(mn_mat4f_t *dst, mn_mat4f_t *src1, mn_mat4f_t *src2, size_t count);
+mn_result_t mn_submat_2x2f_c(mn_mat2f_t *dst, mn_mat2f_t *src1, mn_mat2f_t *src2, size_t count);
+mn_result_t mn_submat_3x3f_c(mn_mat3f_t *dst, mn_mat3f_t *src1, mn_mat3f_t *src2, size_t count);
+mn_result_t mn_submat_4x4f_c(mn_mat4f_t *dst, mn_mat4f_t *src1, mn_mat4f_t *src2, size_t count);
+
+/**
+ * @brief Transposes, inverts or takes the determinant of arrays of matrices using C.
+ *
+ * invmat stores the identity for a matrix whose determinant is 0.
+ */
+mn_result_t mn_transmat_2x2f_c(mn_mat2f_t *dst, mn_mat2f_t *src, size_t count);
+mn_result_t mn_transmat_3x3f_c(mn_mat3f_t *dst, mn_mat3f_t *src, size_t count);
+mn_result_t mn_transmat_4x4f_c(mn_mat4f_t *dst, mn_mat4f_t *src, size_t count);
+mn_result_t mn_detmat_2x2f_c(mn_float32_t *dst, mn_mat2f_t *src, size_t count);
+mn_result_t mn_detmat_3x3f_c(mn_float32_t *dst, mn_mat3f_t *src, size_t count);
+mn_result_t mn_detmat_4x4f_c(mn_float32_t *dst, mn_mat4f_t *src, size_t count);
+mn_result_t mn_invmat_2x2f_c(mn_mat2f_t *dst, mn_mat2f_t *src, size_t count);
+mn_result_t mn_invmat_3x3f_c(mn_mat3f_t *dst, mn_mat3f_t *src, size_t count);
+mn_result_t mn_invmat_4x4f_c(mn_mat4f_t *dst, mn_mat4f_t *src, size_t count);
+
+/**
+ * @brief Adds / subtracts arrays of matrices, dst[i] = src1[i] +/- src2[i], using NEON.
+ */
+mn_result_t mn_addmat_2x2f_neon(mn_mat2f_t *dst, mn_mat2f_t *src1, mn_mat2f_t *src2, size_t count);
+mn_result_t mn_addmat_3x3f_neon(mn_mat3f_t *dst, mn_mat3f_t *src1, mn_mat3f_t *src2, size_t count);
+mn_result_t mn_addmat_4x4f_neon(mn_mat4f_t *dst, mn_mat4f_t *src1, mn_mat4f_t *src2, size_t count);
+mn_result_t mn_submat_2x2f_neon(mn_mat2f_t *dst, mn_mat2f_t *src1, mn_mat2f_t *src2, size_t count);
+mn_result_t mn_submat_3x3f_neon(mn_mat3f_t *dst, mn_mat3f_t *src1, mn_mat3f_t *src2, size_t count);
+mn_result_t mn_submat_4x4f_neon(mn_mat4f_t *dst, mn_mat4f_t *src1, mn_mat4f_t *src2, size_t count);
+
+/**
+ * @brief Transposes, inverts or takes the determinant of arrays of matrices using NEON.
+ *
+ * invmat stores the identity for a matrix whose determinant is 0.
+ */
+mn_result_t mn_transmat_2x2f_neon(mn_mat2f_t *dst, mn_mat2f_t *src, size_t count);
+mn_result_t mn_transmat_3x3f_neon(mn_mat3f_t *dst, mn_mat3f_t *src, size_t count);
+mn_result_t mn_transmat_4x4f_neon(mn_mat4f_t *dst, mn_mat4f_t *src, size_t count);
+mn_result_t mn_detmat_2x2f_neon(mn_float32_t *dst, mn_mat2f_t *src, size_t count);
+mn_result_t mn_detmat_3x3f_neon(mn_float32_t *dst, mn_mat3f_t *src, size_t count);
+mn_result_t mn_detmat_4x4f_neon(mn_float32_t *dst, mn_mat4f_t *src, size_t count);
+mn_result_t mn_invmat_2x2f_neon(mn_mat2f_t *dst, mn_mat2f_t *src, size_t count);
+mn_result_t mn_invmat_3x3f_neon(mn_mat3f_t *dst, mn_mat3f_t *src, size_t count);
+mn_result_t mn_invmat_4x4f_neon(mn_mat4f_t *dst, mn_mat4f_t *src, size_t count);
+
+/**
+ * ================================
+ * MN SGEMM USING C & NEON
+ * ================================
+ *
+ * C = alpha * A * B + beta * C with column major A (M x K), B (K x N) and
+ * C (M x N); element (i, j) of C is C[i + j * ldc]. C is not read when beta == 0.
+ */
+
+/**
+ * @brief Single precision matrix multiply using C.
+ */
+mn_result_t mn_sgemm_c(size_t M, size_t N, size_t K,
+                       const mn_float32_t *A, size_t lda,
+                       const mn_float32_t *B, size_t ldb,
+                       mn_float32_t *C, size_t ldc,
+                       mn_float32_t alpha, mn_float32_t beta);
+
+/**
+ * @brief Single precision matrix multiply using NEON (packed panels, cache blocking,
+ *        8x12 micro-kernel). Returns MN_ERROR if the packing buffers cannot be allocated.
+ *        Runs on up to mn_set_threads threads; small products use fewer.
+ */
+mn_result_t mn_sgemm_neon(size_t M, size_t N, size_t K,
+                          const mn_float32_t *A, size_t lda,
+                          const mn_float32_t *B, size_t ldb,
+                          mn_float32_t *C, size_t ldc,
+                          mn_float32_t alpha, mn_float32_t beta);
+
+/**
+ * ================================
+ * MN COMPLEX USING C & NEON
+ * ================================
+ *
+ * mn_complexf_t arrays are interleaved re, im. cmul: a * b, cmulc: a * cst,
+ * cconjmul: a * conj(b), cabs: |a|, cmag2: |a|^2 (the last two write floats).
+ */
+
+/**
+ * @brief Complex multiply using C.
+ */
+mn_result_t mn_cmul_complexf_c(mn_complexf_t *dst, mn_complexf_t *src1, mn_complexf_t *src2, size_t count);
+mn_result_t mn_cmulc_complexf_c(mn_complexf_t *dst, mn_complexf_t *src, const mn_complexf_t *cst, size_t count);
+mn_result_t mn_cconjmul_complexf_c(mn_complexf_t *dst, mn_complexf_t *src1, mn_complexf_t *src2, size_t count);
+
+/**
+ * @brief Complex multiply using NEON (vcmlaq_f32 on ARMv8.3-A, vld2q_f32 deinterleaving otherwise).
+ */
+mn_result_t mn_cmul_complexf_neon(mn_complexf_t *dst, mn_complexf_t *src1, mn_complexf_t *src2, size_t count);
+mn_result_t mn_cmulc_complexf_neon(mn_complexf_t *dst, mn_complexf_t *src, const mn_complexf_t *cst, size_t count);
+mn_result_t mn_cconjmul_complexf_neon(mn_complexf_t *dst, mn_complexf_t *src1, mn_complexf_t *src2, size_t count);
+
+/**
+ * @brief Magnitude and squared magnitude using C.
+ */
+mn_result_t mn_cabs_complexf_c(mn_float32_t *dst, mn_complexf_t *src, size_t count);
+mn_result_t mn_cmag2_complexf_c(mn_float32_t *dst, mn_complexf_t *src, size_t count);
+
+/**
+ * @brief Magnitude and squared magnitude using NEON.
+ */
+mn_result_t mn_cabs_complexf_neon(mn_float32_t *dst, mn_complexf_t *src, size_t count);
+mn_result_t mn_cmag2_complexf_neon(mn_float32_t *dst, mn_complexf_t *src, size_t count);
+
+/**
+ * ================================
+ * MN FFT USING C & NEON
+ * ================================
+ *
+ * Forward X[k] = sum_j x[j] exp(-2 pi i j k / n), inverse scaled by 1 / n so
+ * inverse(forward(x)) == x. n may have the prime factors 2, 3 and 5.
+ * count transforms are stored back to back (batch). Complex transforms take n
+ * values and may run in place. Real transforms take n samples (n even) and
+ * give the n / 2 + 1 non-redundant values, X[0] and X[n / 2] with im == 0;
+ * they may not run in place. A plan holds scratch memory, so one plan must
+ * not run on two threads at the same time.
+ */
+
+/**
+ * @brief Precomputes the factors and twiddles of a complex (n points) or real
+ *        (n samples) transform. Returns MN_ERROR for unsupported n or when out of memory.
+ */
+mn_result_t mn_fft_plan_complex(mn_fft_plan_t *plan, size_t n);
+mn_result_t mn_fft_plan_real(mn_fft_plan_t *plan, size_t n);
+void mn_fft_plan_free(mn_fft_plan_t *plan);
+
+/**
+ * @brief Complex forward / inverse FFT using C. Returns MN_ERROR for a real plan.
+ */
+mn_result_t mn_fft_forward_c(const mn_fft_plan_t *plan, mn_complexf_t *dst, mn_complexf_t *src, size_t count);
+mn_result_t mn_fft_inverse_c(const mn_fft_plan_t *plan, mn_complexf_t *dst, mn_complexf_t *src, size_t count);
+
+/**
+ * @brief Complex forward / inverse FFT using NEON (Stockham stages on vld2q_f32 data).
+ */
+mn_result_t mn_fft_forward_neon(const mn_fft_plan_t *plan, mn_complexf_t *dst, mn_complexf_t *src, size_t count);
+mn_result_t mn_fft_inverse_neon(const mn_fft_plan_t *plan, mn_complexf_t *dst, mn_complexf_t *src, size_t count);
+
+/**
+ * @brief Real forward (n samples -> n / 2 + 1 values) / inverse FFT using C.
+ *        Returns MN_ERROR for a complex plan.
+ */
+mn_result_t mn_rfft_forward_c(const mn_fft_plan_t *plan, mn_complexf_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_rfft_inverse_c(const mn_fft_plan_t *plan, mn_float32_t *dst, mn_complexf_t *src, size_t count);
+
+/**
+ * @brief Real forward / inverse FFT using NEON.
+ */
+mn_result_t mn_rfft_forward_neon(const mn_fft_plan_t *plan, mn_complexf_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_rfft_inverse_neon(const mn_fft_plan_t *plan, mn_float32_t *dst, mn_complexf_t *src, size_t count);
+
+/**
+ * ================================
+ * MN FIR / CONVOLUTION USING C & NEON
+ * ================================
+ *
+ * fir:    y[n] = sum_k coeffs[k] * x[n - k]. The filter keeps the last num_taps - 1
+ *         inputs, so a signal fed in chunks gives the same output as in one call.
+ *         With decimation D only every D-th output is produced (count / D per
+ *         call, count must be a multiple of D).
+ * conv1d: valid-mode convolution, dst[n] = sum_k kernel[k] * src[n + taps - 1 - k]
+ *         for n < count - taps + 1.
+ * int16 uses Q15 coefficients: dst = sat16((sum + 2^14) >> 15), sum exact.
+ */
+
+/**
+ * @brief Sets up a filter. coeffs must stay valid while the filter is used.
+ *        Returns MN_ERROR if num_taps or decimation is 0 or the delay line cannot be allocated.
+ */
+mn_result_t mn_fir_init_float(mn_fir_float_t *fir, const mn_float32_t *coeffs, size_t num_taps, size_t decimation);
+mn_result_t mn_fir_init_int16(mn_fir_int16_t *fir, const mn_int16_t *coeffs, size_t num_taps, size_t decimation);
+
+/**
+ * @brief Clears the delay line (as if the filter had only seen zeros).
+ */
+mn_result_t mn_fir_reset_float(mn_fir_float_t *fir);
+mn_result_t mn_fir_reset_int16(mn_fir_int16_t *fir);
+
+/**
+ * @brief Releases the delay line.
+ */
+void mn_fir_free_float(mn_fir_float_t *fir);
+void mn_fir_free_int16(mn_fir_int16_t *fir);
+
+/**
+ * @brief Filters count samples using C, writing count / decimation outputs.
+ */
+mn_result_t mn_fir_float_c(mn_fir_float_t *fir, mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_fir_int16_c(mn_fir_int16_t *fir, mn_int16_t *dst, mn_int16_t *src, size_t count);
+
+/**
+ * @brief Filters count samples using NEON (register-blocked, 16 float / 8 int16 outputs per step).
+ */
+mn_result_t mn_fir_float_neon(mn_fir_float_t *fir, mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_fir_int16_neon(mn_fir_int16_t *fir, mn_int16_t *dst, mn_int16_t *src, size_t count);
+
+/**
+ * @brief Valid-mode 1D convolution using C. Writes count - taps + 1 outputs (none if count < taps).
+ */
+mn_result_t mn_conv1d_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count, const mn_float32_t *kernel, size_t taps);
+mn_result_t mn_conv1d_int16_c(mn_int16_t *dst, mn_int16_t *src, size_t count, const mn_int16_t *kernel, size_t taps);
+
+/**
+ * @brief Valid-mode 1D convolution using NEON.
+ */
+mn_result_t mn_conv1d_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count, const mn_float32_t *kernel, size_t taps);
+mn_result_t mn_conv1d_int16_neon(mn_int16_t *dst, mn_int16_t *src, size_t count, const mn_int16_t *kernel, size_t taps);
+
+/**
+ * ================================
+ * MN EXP / LOG / POW USING C & NEON
+ * ================================
+ *
+ * accuracy selects the NEON polynomials (MN_ACCURACY_*), measured against
+ * libm over all float inputs:
+ *   MN_ACCURACY_PRECISE - below 1.5 ULP (log2 below 1.6 ULP on 32-bit ARM
+ *                         without FMA); pow is computed in double (AArch64)
+ *                         and is within 1 ULP
+ *   MN_ACCURACY_FAST    - exp / exp2 below 2.5 ULP, log / log2 below 4.5 ULP
+ *   MN_ACCURACY_ULTRA   - below 1e-3 relative error
+ * The fast and ultra pow are exp2(y * log2(x)) in float: on top of the tier
+ * bound their error grows by about 2 ULP (fast) or 4e-4 (ultra) per unit of
+ * |y * log2(x)|.
+ * Special values (0, negative, inf, NaN, overflow / underflow) follow libm.
+ * The C versions call expf / exp2f / logf / log2f / powf for every tier.
+ * Unknown accuracy values return MN_ERROR. dst may be the same array as a source.
+ */
+
+/**
+ * @brief e^x, 2^x, natural and base-2 logarithm of a float array using C.
+ */
+mn_result_t mn_exp_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count, int accuracy);
+mn_result_t mn_exp2_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count, int accuracy);
+mn_result_t mn_log_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count, int accuracy);
+mn_result_t mn_log2_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count, int accuracy);
+
+/**
+ * @brief e^x, 2^x, natural and base-2 logarithm of a float array using NEON.
+ */
+mn_result_t mn_exp_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count, int accuracy);
+mn_result_t mn_exp2_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count, int accuracy);
+mn_result_t mn_log_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count, int accuracy);
+mn_result_t mn_log2_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count, int accuracy);
+
+/**
+ * @brief dst[i] = src1[i] ^ src2[i] using C.
+ */
+mn_result_t mn_pow_float_c(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, size_t count, int accuracy);
+
+/**
+ * @brief dst[i] = src1[i] ^ src2[i] using NEON. The precise tier runs powf on 32-bit ARM.
+ */
+mn_result_t mn_pow_float_neon(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, size_t count, int accuracy);
+
+/**
+ * ================================
+ * MN TRIGONOMETRY USING C & NEON
+ * ================================
+ *
+ * Angles are in radians. The NEON versions reduce x to [-pi/4, pi/4] around
+ * the nearest multiple of pi/2 (Cody-Waite) and evaluate minimax polynomials;
+ * measured against libm: sin / cos / sincos below 1.6 ULP (2.4 ULP on 32-bit
+ * ARM without FMA), tan below 3.5 ULP, atan2 below 3 ULP. Arguments with |x|
+ * above 2^17 (2^13 on 32-bit ARM without FMA), inf and NaN go through sinf /
+ * cosf / tanf, and atan2 lanes with zero, subnormal, huge (>= 2^126),
+ * infinite or NaN inputs through atan2f, so special values follow libm.
+ * The C versions call sinf / cosf / tanf / atan2f.
+ * dst may be the same array as a source; dst_sin and dst_cos must differ.
+ */
+
+/**
+ * @brief sin(x), cos(x) and tan(x) of a float array using C.
+ */
+mn_result_t mn_sin_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_cos_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_tan_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count);
+
+/**
+ * @brief sin(x), cos(x) and tan(x) of a float array using NEON.
+ */
+mn_result_t mn_sin_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_cos_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_tan_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count);
+
+/**
+ * @brief dst_sin[i] = sin(src[i]), dst_cos[i] = cos(src[i]) using C.
+ */
+mn_result_t mn_sincos_float_c(mn_float32_t *dst_sin, mn_float32_t *dst_cos, mn_float32_t *src, size_t count);
+
+/**
+ * @brief dst_sin[i] = sin(src[i]), dst_cos[i] = cos(src[i]) using NEON, one range reduction for both.
+ */
+mn_result_t mn_sincos_float_neon(mn_float32_t *dst_sin, mn_float32_t *dst_cos, mn_float32_t *src, size_t count);
+
+/**
+ * @brief dst[i] = atan2(src1[i], src2[i]) (y, x order as in atan2f) using C.
+ */
+mn_result_t mn_atan2_float_c(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, size_t count);
+
+/**
+ * @brief dst[i] = atan2(src1[i], src2[i]) (y, x order as in atan2f) using NEON.
+ */
+mn_result_t mn_atan2_float_neon(mn_float32_t *dst, mn_float32_t *src1, mn_float32_t *src2, size_t count);
+
+/**
+ * ================================
+ * MN SQRT / RSQRT / RECIP USING C & NEON
+ * ================================
+ *
+ * accuracy sets the NEON method (MN_ACCURACY_*), measured over all float inputs:
+ *   MN_ACCURACY_PRECISE  - vsqrtq_f32 / vdivq_f32, the same values as the C
+ *                          versions (the C loop on 32-bit ARM)
+ *   MN_ACCURACY_FAST     - estimate and two Newton steps, below 3 ULP
+ *   MN_ACCURACY_ULTRA    - estimate and one Newton step, below 2e-5 relative error
+ *   MN_ACCURACY_ESTIMATE - vrsqrteq_f32 / vrecpeq_f32 alone, below 4e-3 relative error
+ * sqrt is x * rsqrt(x) in the fast tiers. +-0, +inf, negative and NaN inputs
+ * give the IEEE results in every tier; recip of values at or above 2^126 may
+ * lose the subnormal bits of the result.
+ * The vecNf routines apply the function to every component.
+ * Unknown accuracy values return MN_ERROR. dst may be the same array as src.
+ */
+
+/**
+ * @brief dst = sqrt(x) of a float / vec2f / vec3f / vec4f array using C.
+ */
+mn_result_t mn_sqrt_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count, int accuracy);
+mn_result_t mn_sqrt_vec2f_c(mn_vec2f_t *dst, mn_vec2f_t *src, size_t count, int accuracy);
+mn_result_t mn_sqrt_vec3f_c(mn_vec3f_t *dst, mn_vec3f_t *src, size_t count, int accuracy);
+mn_result_t mn_sqrt_vec4f_c(mn_vec4f_t *dst, mn_vec4f_t *src, size_t count, int accuracy);
+
+/**
+ * @brief dst = sqrt(x) of a float / vec2f / vec3f / vec4f array using NEON.
+ */
+mn_result_t mn_sqrt_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count, int accuracy);
+mn_result_t mn_sqrt_vec2f_neon(mn_vec2f_t *dst, mn_vec2f_t *src, size_t count, int accuracy);
+mn_result_t mn_sqrt_vec3f_neon(mn_vec3f_t *dst, mn_vec3f_t *src, size_t count, int accuracy);
+mn_result_t mn_sqrt_vec4f_neon(mn_vec4f_t *dst, mn_vec4f_t *src, size_t count, int accuracy);
+
+/**
+ * @brief dst = 1 / sqrt(x) of a float / vec2f / vec3f / vec4f array using C.
+ */
+mn_result_t mn_rsqrt_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count, int accuracy);
+mn_result_t mn_rsqrt_vec2f_c(mn_vec2f_t *dst, mn_vec2f_t *src, size_t count, int accuracy);
+mn_result_t mn_rsqrt_vec3f_c(mn_vec3f_t *dst, mn_vec3f_t *src, size_t count, int accuracy);
+mn_result_t mn_rsqrt_vec4f_c(mn_vec4f_t *dst, mn_vec4f_t *src, size_t count, int accuracy);
+
+/**
+ * @brief dst = 1 / sqrt(x) of a float / vec2f / vec3f / vec4f array using NEON.
+ */
+mn_result_t mn_rsqrt_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count, int accuracy);
+mn_result_t mn_rsqrt_vec2f_neon(mn_vec2f_t *dst, mn_vec2f_t *src, size_t count, int accuracy);
+mn_result_t mn_rsqrt_vec3f_neon(mn_vec3f_t *dst, mn_vec3f_t *src, size_t count, int accuracy);
+mn_result_t mn_rsqrt_vec4f_neon(mn_vec4f_t *dst, mn_vec4f_t *src, size_t count, int accuracy);
+
+/**
+ * @brief dst = 1 / x of a float / vec2f / vec3f / vec4f array using C.
+ */
+mn_result_t mn_recip_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count, int accuracy);
+mn_result_t mn_recip_vec2f_c(mn_vec2f_t *dst, mn_vec2f_t *src, size_t count, int accuracy);
+mn_result_t mn_recip_vec3f_c(mn_vec3f_t *dst, mn_vec3f_t *src, size_t count, int accuracy);
+mn_result_t mn_recip_vec4f_c(mn_vec4f_t *dst, mn_vec4f_t *src, size_t count, int accuracy);
+
+/**
+ * @brief dst = 1 / x of a float / vec2f / vec3f / vec4f array using NEON.
+ */
+mn_result_t mn_recip_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count, int accuracy);
+mn_result_t mn_recip_vec2f_neon(mn_vec2f_t *dst, mn_vec2f_t *src, size_t count, int accuracy);
+mn_result_t mn_recip_vec3f_neon(mn_vec3f_t *dst, mn_vec3f_t *src, size_t count, int accuracy);
+mn_result_t mn_recip_vec4f_neon(mn_vec4f_t *dst, mn_vec4f_t *src, size_t count, int accuracy);
+
+/**
+ * ================================
+ * MN ACTIVATIONS USING C & NEON
+ * ================================
+ *
+ * Activation functions and softmax for neural network inference:
+ *   relu(x)       = max(x, 0), NaN stays NaN
+ *   leaky_relu(x) = x > 0 ? x : alpha * x
+ *   sigmoid(x)    = 1 / (1 + e^-x)
+ *   tanh(x)
+ *   gelu(x)       = 0.5 x (1 + tanh(sqrt(2 / pi) (x + 0.044715 x^3))), the
+ *                   tanh approximation
+ *   softmax(x)_i  = e^(x_i - max) / sum_j e^(x_j - max) over the whole array
+ * gelu is evaluated as x / (1 + e^-2u), u = sqrt(2 / pi) (x + 0.044715 x^3),
+ * which does not cancel for negative x. softmax subtracts the max, so large
+ * logits do not overflow.
+ * The C versions use libm and are the reference. The NEON versions give the
+ * same relu / leaky_relu values; sigmoid stays below 4 ULP (2.5 on AArch64),
+ * tanh below 2 ULP, gelu below 4 ULP for x >= 0 and 4 (1 + |2u|) ULP for
+ * x < 0, where rounding 2u in float dominates as in the C version. Results
+ * below 2^-120 may flush to zero on 32-bit ARM. softmax values are within
+ * 3e-6 relative error for up to 4096 values (the float sum adds more above).
+ * The NEON softmax reads src twice and writes dst once.
+ * The float16 versions compute in float and round to the nearest half; the
+ * NEON ones are within one half ulp of the C ones (the C loops without
+ * MN_FP16_NATIVE or MN_FP16_CVT). dst may be the same array as src.
+ */
+
+/**
+ * @brief dst = max(src, 0) of a float / float16 array using C.
+ */
+mn_result_t mn_relu_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_relu_float16_c(mn_float16_t *dst, mn_float16_t *src, size_t count);
+
+/**
+ * @brief dst = max(src, 0) of a float / float16 array using NEON.
+ */
+mn_result_t mn_relu_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_relu_float16_neon(mn_float16_t *dst, mn_float16_t *src, size_t count);
+
+/**
+ * @brief dst = src > 0 ? src : alpha * src of a float / float16 array using C.
+ */
+mn_result_t mn_leaky_relu_float_c(mn_float32_t *dst, mn_float32_t *src, mn_float32_t alpha, size_t count);
+mn_result_t mn_leaky_relu_float16_c(mn_float16_t *dst, mn_float16_t *src, mn_float32_t alpha, size_t count);
+
+/**
+ * @brief dst = src > 0 ? src : alpha * src of a float / float16 array using NEON.
+ */
+mn_result_t mn_leaky_relu_float_neon(mn_float32_t *dst, mn_float32_t *src, mn_float32_t alpha, size_t count);
+mn_result_t mn_leaky_relu_float16_neon(mn_float16_t *dst, mn_float16_t *src, mn_float32_t alpha, size_t count);
+
+/**
+ * @brief dst = 1 / (1 + e^-src) of a float / float16 array using C.
+ */
+mn_result_t mn_sigmoid_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_sigmoid_float16_c(mn_float16_t *dst, mn_float16_t *src, size_t count);
+
+/**
+ * @brief dst = 1 / (1 + e^-src) of a float / float16 array using NEON.
+ */
+mn_result_t mn_sigmoid_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_sigmoid_float16_neon(mn_float16_t *dst, mn_float16_t *src, size_t count);
+
+/**
+ * @brief dst = tanh(src) of a float / float16 array using C.
+ */
+mn_result_t mn_tanh_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_tanh_float16_c(mn_float16_t *dst, mn_float16_t *src, size_t count);
+
+/**
+ * @brief dst = tanh(src) of a float / float16 array using NEON.
+ */
+mn_result_t mn_tanh_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_tanh_float16_neon(mn_float16_t *dst, mn_float16_t *src, size_t count);
+
+/**
+ * @brief dst = gelu(src) (tanh approximation) of a float / float16 array using C.
+ */
+mn_result_t mn_gelu_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_gelu_float16_c(mn_float16_t *dst, mn_float16_t *src, size_t count);
+
+/**
+ * @brief dst = gelu(src) (tanh approximation) of a float / float16 array using NEON.
+ */
+mn_result_t mn_gelu_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_gelu_float16_neon(mn_float16_t *dst, mn_float16_t *src, size_t count);
+
+/**
+ * @brief dst = softmax(src) over count values of a float / float16 array using C.
+ */
+mn_result_t mn_softmax_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_softmax_float16_c(mn_float16_t *dst, mn_float16_t *src, size_t count);
+
+/**
+ * @brief dst = softmax(src) over count values of a float / float16 array using NEON.
+ */
+mn_result_t mn_softmax_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_softmax_float16_neon(mn_float16_t *dst, mn_float16_t *src, size_t count);
+
+/**
+ * ================================
+ * MN MEAN / VARIANCE AND LAYER NORMALIZATION USING C & NEON
+ * ================================
+ *
+ * meanvar gives the mean and the population variance sum((x - mean)^2) / count
+ * in one pass over src. layernorm computes them and writes
+ *   dst[i] = (src[i] - mean) / sqrt(var + eps) * gamma[i] + beta[i]
+ * with gamma == NULL meaning 1 and beta == NULL meaning 0, reading src twice.
+ * The rows routines do the same for each row of a rows x cols row-major
+ * array (mean / var hold rows values, gamma / beta hold cols values).
+ * The C versions use Welford's update in double. The NEON versions sum
+ * shifted values in float blocks and merge the blocks in double, and stay
+ * within 1e-6 relative error of the mean and variance for data whose mean
+ * is up to 1e4 times its spread. count == 0 (cols == 0) returns MN_ERROR. dst may be
+ * the same array as src.
+ */
+
+/**
+ * @brief Mean and population variance of a float array using C.
+ */
+mn_result_t mn_meanvar_float_c(mn_float32_t *mean, mn_float32_t *var, mn_float32_t *src, size_t count);
+
+/**
+ * @brief Mean and population variance of a float array using NEON.
+ */
+mn_result_t mn_meanvar_float_neon(mn_float32_t *mean, mn_float32_t *var, mn_float32_t *src, size_t count);
+
+/**
+ * @brief Mean and population variance of every row of a rows x cols float array using C.
+ */
+mn_result_t mn_meanvar_rows_float_c(mn_float32_t *mean, mn_float32_t *var, mn_float32_t *src, size_t rows, size_t cols);
+
+/**
+ * @brief Mean and population variance of every row of a rows x cols float array using NEON.
+ */
+mn_result_t mn_meanvar_rows_float_neon(mn_float32_t *mean, mn_float32_t *var, mn_float32_t *src, size_t rows,
+                                       size_t cols);
+
+/**
+ * @brief Layer normalization of a float array with per-channel gamma / beta using C.
+ */
+mn_result_t mn_layernorm_float_c(mn_float32_t *dst, mn_float32_t *src, mn_float32_t *gamma, mn_float32_t *beta,
+                                 mn_float32_t eps, size_t count);
+
+/**
+ * @brief Layer normalization of a float array with per-channel gamma / beta using NEON.
+ */
+mn_result_t mn_layernorm_float_neon(mn_float32_t *dst, mn_float32_t *src, mn_float32_t *gamma, mn_float32_t *beta,
+                                    mn_float32_t eps, size_t count);
+
+/**
+ * @brief Layer normalization of every row of a rows x cols float array using C.
+ */
+mn_result_t mn_layernorm_rows_float_c(mn_float32_t *dst, mn_float32_t *src, mn_float32_t *gamma, mn_float32_t *beta,
+                                      mn_float32_t eps, size_t rows, size_t cols);
+
+/**
+ * @brief Layer normalization of every row of a rows x cols float array using NEON.
+ */
+mn_result_t mn_layernorm_rows_float_neon(mn_float32_t *dst, mn_float32_t *src, mn_float32_t *gamma, mn_float32_t *beta,
+                                         mn_float32_t eps, size_t rows, size_t cols);
+
+/**
+ * ================================
+ * MN SCAN USING C & NEON
+ * ================================
+ *
+ * Prefix sums. The inclusive scan writes dst[i] = src[0] + ... + src[i], the
+ * exclusive scan dst[0] = 0 and dst[i] = src[0] + ... + src[i - 1]. Vector
+ * types scan each component separately. int32 sums wrap modulo 2^32 and the
+ * NEON and C results match exactly; the NEON float sums are grouped in
+ * blocks of 4 and can differ from the C ones in the last bits. dst may be
+ * the same array as src.
+ */
+
+/**
+ * @brief Inclusive scan of a float / int32 / vector array using C.
+ */
+mn_result_t mn_scan_inclusive_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_scan_inclusive_vec2f_c(mn_vec2f_t *dst, mn_vec2f_t *src, size_t count);
+mn_result_t mn_scan_inclusive_vec3f_c(mn_vec3f_t *dst, mn_vec3f_t *src, size_t count);
+mn_result_t mn_scan_inclusive_vec4f_c(mn_vec4f_t *dst, mn_vec4f_t *src, size_t count);
+mn_result_t mn_scan_inclusive_int32_c(mn_int32_t *dst, mn_int32_t *src, size_t count);
+mn_result_t mn_scan_inclusive_vec2i_c(mn_vec2i_t *dst, mn_vec2i_t *src, size_t count);
+mn_result_t mn_scan_inclusive_vec3i_c(mn_vec3i_t *dst, mn_vec3i_t *src, size_t count);
+mn_result_t mn_scan_inclusive_vec4i_c(mn_vec4i_t *dst, mn_vec4i_t *src, size_t count);
+
+/**
+ * @brief Exclusive scan of a float / int32 / vector array using C.
+ */
+mn_result_t mn_scan_exclusive_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_scan_exclusive_vec2f_c(mn_vec2f_t *dst, mn_vec2f_t *src, size_t count);
+mn_result_t mn_scan_exclusive_vec3f_c(mn_vec3f_t *dst, mn_vec3f_t *src, size_t count);
+mn_result_t mn_scan_exclusive_vec4f_c(mn_vec4f_t *dst, mn_vec4f_t *src, size_t count);
+mn_result_t mn_scan_exclusive_int32_c(mn_int32_t *dst, mn_int32_t *src, size_t count);
+mn_result_t mn_scan_exclusive_vec2i_c(mn_vec2i_t *dst, mn_vec2i_t *src, size_t count);
+mn_result_t mn_scan_exclusive_vec3i_c(mn_vec3i_t *dst, mn_vec3i_t *src, size_t count);
+mn_result_t mn_scan_exclusive_vec4i_c(mn_vec4i_t *dst, mn_vec4i_t *src, size_t count);
+
+/**
+ * @brief Inclusive scan of a float / int32 / vector array using NEON.
+ */
+mn_result_t mn_scan_inclusive_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_scan_inclusive_vec2f_neon(mn_vec2f_t *dst, mn_vec2f_t *src, size_t count);
+mn_result_t mn_scan_inclusive_vec3f_neon(mn_vec3f_t *dst, mn_vec3f_t *src, size_t count);
+mn_result_t mn_scan_inclusive_vec4f_neon(mn_vec4f_t *dst, mn_vec4f_t *src, size_t count);
+mn_result_t mn_scan_inclusive_int32_neon(mn_int32_t *dst, mn_int32_t *src, size_t count);
+mn_result_t mn_scan_inclusive_vec2i_neon(mn_vec2i_t *dst, mn_vec2i_t *src, size_t count);
+mn_result_t mn_scan_inclusive_vec3i_neon(mn_vec3i_t *dst, mn_vec3i_t *src, size_t count);
+mn_result_t mn_scan_inclusive_vec4i_neon(mn_vec4i_t *dst, mn_vec4i_t *src, size_t count);
+
+/**
+ * @brief Exclusive scan of a float / int32 / vector array using NEON.
+ */
+mn_result_t mn_scan_exclusive_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_scan_exclusive_vec2f_neon(mn_vec2f_t *dst, mn_vec2f_t *src, size_t count);
+mn_result_t mn_scan_exclusive_vec3f_neon(mn_vec3f_t *dst, mn_vec3f_t *src, size_t count);
+mn_result_t mn_scan_exclusive_vec4f_neon(mn_vec4f_t *dst, mn_vec4f_t *src, size_t count);
+mn_result_t mn_scan_exclusive_int32_neon(mn_int32_t *dst, mn_int32_t *src, size_t count);
+mn_result_t mn_scan_exclusive_vec2i_neon(mn_vec2i_t *dst, mn_vec2i_t *src, size_t count);
+mn_result_t mn_scan_exclusive_vec3i_neon(mn_vec3i_t *dst, mn_vec3i_t *src, size_t count);
+mn_result_t mn_scan_exclusive_vec4i_neon(mn_vec4i_t *dst, mn_vec4i_t *src, size_t count);
+
+/**
+ * ================================
+ * MN HISTOGRAM USING C & NEON
+ * ================================
+ *
+ * hist is overwritten with 32-bit counts. uint8 uses 256 bins, hist[v]
+ * counting the values equal to v. int32 is a bincount over bins bins:
+ * values outside [0, bins) are skipped. float splits [lo, hi) into bins
+ * uniform bins, value x going to bin (x - lo) * (bins / (hi - lo)) computed
+ * in float and clamped to bins - 1; values outside [lo, hi) and NaN are
+ * skipped. The C and NEON versions give identical counts. bins == 0,
+ * lo >= hi or bins / (hi - lo) not finite and positive returns MN_ERROR.
+ */
+
+/**
+ * @brief 256-bin histogram of a uint8 array using C / NEON.
+ */
+mn_result_t mn_histogram_uint8_c(mn_uint32_t *hist, mn_uint8_t *src, size_t count);
+mn_result_t mn_histogram_uint8_neon(mn_uint32_t *hist, mn_uint8_t *src, size_t count);
+
+/**
+ * @brief Counts of the values 0 .. bins - 1 in an int32 array using C / NEON.
+ */
+mn_result_t mn_histogram_int32_c(mn_uint32_t *hist, size_t bins, mn_int32_t *src, size_t count);
+mn_result_t mn_histogram_int32_neon(mn_uint32_t *hist, size_t bins, mn_int32_t *src, size_t count);
+
+/**
+ * @brief Histogram of a float array over bins uniform bins of [lo, hi) using C / NEON.
+ */
+mn_result_t mn_histogram_float_c(mn_uint32_t *hist, size_t bins, mn_float32_t *src, mn_float32_t lo, mn_float32_t hi,
+                                 size_t count);
+mn_result_t mn_histogram_float_neon(mn_uint32_t *hist, size_t bins, mn_float32_t *src, mn_float32_t lo,
+                                    mn_float32_t hi, size_t count);
+
+/**
+ * ================================
+ * MN COMPACTION USING C & NEON
+ * ================================
+ *
+ * Stream compaction (filter): the elements x = src1[i] for which
+ * x cmp src2[i] holds (x cmp cst for compactc) are copied to
+ * dst[0 .. *kept - 1], keeping their order. cmp is one of MN_CMP_EQ / NE /
+ * LT / LE / GT / GE; an unknown cmp returns MN_ERROR. dst needs room for
+ * count elements and may be the same array as a source; the NEON versions
+ * may overwrite the elements of dst past *kept.
+ */
+
+/**
+ * @brief Keeps the elements of src1 for which src1[i] cmp src2[i] holds, using C.
+ */
+mn_result_t mn_compact_float_c(mn_float32_t *dst, size_t *kept, mn_float32_t *src1, mn_float32_t *src2, size_t count,
+                               int cmp);
+mn_result_t mn_compact_int32_c(mn_int32_t *dst, size_t *kept, mn_int32_t *src1, mn_int32_t *src2, size_t count,
+                               int cmp);
+
+/**
+ * @brief Keeps the elements of src1 for which src1[i] cmp src2[i] holds, using NEON.
+ */
+mn_result_t mn_compact_float_neon(mn_float32_t *dst, size_t *kept, mn_float32_t *src1, mn_float32_t *src2,
+                                  size_t count, int cmp);
+mn_result_t mn_compact_int32_neon(mn_int32_t *dst, size_t *kept, mn_int32_t *src1, mn_int32_t *src2, size_t count,
+                                  int cmp);
+
+/**
+ * @brief Keeps the elements of src for which src[i] cmp cst holds, using C.
+ */
+mn_result_t mn_compactc_float_c(mn_float32_t *dst, size_t *kept, mn_float32_t *src, mn_float32_t cst, size_t count,
+                                int cmp);
+mn_result_t mn_compactc_int32_c(mn_int32_t *dst, size_t *kept, mn_int32_t *src, mn_int32_t cst, size_t count,
+                                int cmp);
+
+/**
+ * @brief Keeps the elements of src for which src[i] cmp cst holds, using NEON.
+ */
+mn_result_t mn_compactc_float_neon(mn_float32_t *dst, size_t *kept, mn_float32_t *src, mn_float32_t cst,
+                                   size_t count, int cmp);
+mn_result_t mn_compactc_int32_neon(mn_int32_t *dst, size_t *kept, mn_int32_t *src, mn_int32_t cst, size_t count,
+                                   int cmp);
+
+/**
+ * ================================
+ * MN SORT USING C & NEON
+ * ================================
+ *
+ * Ascending sorts of count keys from src into dst; dst may be the same
+ * array as src. The kv forms move a 32-bit value (an index, an id) with
+ * each key, from src_values to dst_values. Floats are ordered by their
+ * bits: -NaN < -inf < ... < -0 < +0 < ... < +inf < +NaN. The C versions
+ * are stable; the NEON versions may put the values of equal keys in any
+ * order. Both sort in scratch memory and return MN_ERROR when it cannot
+ * be allocated.
+ */
+
+/**
+ * @brief Sorts src into dst in ascending order, using C.
+ */
+mn_result_t mn_sort_float_c(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_sort_int32_c(mn_int32_t *dst, mn_int32_t *src, size_t count);
+
+/**
+ * @brief Sorts src into dst in ascending order, using NEON.
+ */
+mn_result_t mn_sort_float_neon(mn_float32_t *dst, mn_float32_t *src, size_t count);
+mn_result_t mn_sort_int32_neon(mn_int32_t *dst, mn_int32_t *src, size_t count);
+
+/**
+ * @brief Sorts the keys src into dst and moves src_values with them into dst_values, using C.
+ */
+mn_result_t mn_sort_kv_float_c(mn_float32_t *dst, mn_uint32_t *dst_values, mn_float32_t *src,
+                               mn_uint32_t *src_values, size_t count);
+mn_result_t mn_sort_kv_int32_c(mn_int32_t *dst, mn_uint32_t *dst_values, mn_int32_t *src, mn_uint32_t *src_values,
+                               size_t count);
+
+/**
+ * @brief Sorts the keys src into dst and moves src_values with them into dst_values, using NEON.
+ */
+mn_result_t mn_sort_kv_float_neon(mn_float32_t *dst, mn_uint32_t *dst_values, mn_float32_t *src,
+                                  mn_uint32_t *src_values, size_t count);
+mn_result_t mn_sort_kv_int32_neon(mn_int32_t *dst, mn_uint32_t *dst_values, mn_int32_t *src,
+                                  mn_uint32_t *src_values, size_t count);
+
+/**
+ * ================================
+ * MN PREFETCH CONTROL
+ * ================================
+ */
+
+/**
+ * @brief Sets how many bytes ahead of the current load the NEON main loops prefetch.
+ *        0 disables the prefetch. The initial value is MN_PREFETCH_DISTANCE.
+ */
+mn_result_t mn_set_prefetch_distance(size_t distance);
+size_t mn_get_prefetch_distance(void);
+
+/**
+ * ================================
+ * MN THREAD CONTROL
+ * ================================
+ */
+
+/**
+ * @brief Sets how many threads mn_sgemm_neon, the NEON scans and the NEON histograms
+ *        may use. 1 (the default) stays on the calling thread, 0 uses one thread per
+ *        online CPU, at most 64. Inputs too small to pay for a thread use fewer:
+ *        sgemm under 2^21 multiply-adds, scans under 2^18 elements and histograms
+ *        under 2^16 values (or bins values) per thread. Threaded float scans sum the
+ *        chunks in a different order, so they can differ from one thread in the
+ *        last bits.
+ */
+mn_result_t mn_set_threads(size_t threads);
+size_t mn_get_threads(void);
+
+/**
+ * ================================
+ * MN STREAMING HELPERS
+ * ================================
+ */
+
+#define MN_STREAM_DEFAULT_CHUNK ((size_t)1 << 20)
+
+/**
+ * @brief Defines op_stream, an mn_stream_unary_fn / mn_stream_binary_fn that calls the
+ *        existing operator op with its element type, e.g.
+ *        MN_STREAM_DEFINE_BINARY(mn_add_float_neon, mn_float32_t) at file scope, then
+ *        MN_STREAM_BINARY(mn_add_float_neon) where the function is passed. Calling op
+ *        through a cast function pointer instead would be undefined behaviour.
+ */
+#define MN_STREAM_DEFINE_UNARY(op, type) \
+static mn_result_t op##_stream (void *dst, void *src, size_t count) \
+{ \
+    return op((type *)dst, (type *)src, count); \
+}
+#define MN_STREAM_DEFINE_BINARY(op, type) \
+static mn_result_t op##_stream (void *dst, void *src1, void *src2, size_t count) \
+{ \
+    return op((type *)dst, (type *)src1, (type *)src2, count); \
+}
+#define MN_STREAM_UNARY(op)  op##_stream
+#define MN_STREAM_BINARY(op) op##_stream
+
+/**
+ * @brief Runs kernel over arrays of count elements (elem_size bytes each) chunk by chunk.
+ *        Meant for arrays backed by mmapped files: the next chunk is faulted in while
+ *        the current one is computed. src2 may be NULL. dst may equal a source.
+ */
+mn_result_t mn_stream_apply(void *dst, void *src1, void *src2, size_t count, size_t elem_size,
+                            mn_stream_kernel_fn kernel, void *ctx, const mn_stream_config_t *config);
+
+/**
+ * @brief mn_stream_apply for existing one-source / two-source operators.
+ */
+mn_result_t mn_stream_unary(void *dst, void *src, size_t count, size_t elem_size,
+                            mn_stream_unary_fn op, const mn_stream_config_t *config);
+mn_result_t mn_stream_binary(void *dst, void *src1, void *src2, size_t count, size_t elem_size,
+                             mn_stream_binary_fn op, const mn_stream_config_t *config);
+
+/**
+ * @brief Adapters for mn_stream_chunks: ctx points to an mn_stream_unary_fn / mn_stream_binary_fn.
+ */
+mn_result_t mn_stream_unary_kernel(void *ctx, void *dst, void *src1, void *src2, size_t count);
+mn_result_t mn_stream_binary_kernel(void *ctx, void *dst, void *src1, void *src2, size_t count);
+
+/**
+ * @brief Processes input that arrives in chunks: read fills a chunk, kernel runs in place
+ *        on it and write consumes the result. With io_thread the next chunk is read into
+ *        a second buffer while the current one is computed. sources is 1 or 2.
+ */
+mn_result_t mn_stream_chunks(mn_stream_read_fn read, void *read_ctx,
+                             mn_stream_write_fn write, void *write_ctx,
+                             size_t elem_size, int sources,
+                             mn_stream_kernel_fn kernel, void *ctx,
+                             const mn_stream_config_t *config);
+
+/**
+ * @brief Maps a file into memory. A writable map with size > 0 creates or resizes
+ *        the file (sparse) to size bytes; size 0 maps the whole existing file.
+ */
+mn_result_t mn_stream_map_file(mn_stream_map_t *map, const char *path, size_t size, int writable);
+mn_result_t mn_stream_unmap(mn_stream_map_t *map);
 
 #ifdef __cplusplus
 }
@@ -3,6 +3,7 @@
 #include "MN_math.h"
 #include <assert.h>
 #include <math.h>
+#include <stdlib.h>
 
 /*
 Function Input:
@@ -14,94 +15,86 @@ Function Input:
  */
 
 
-mn_result_t mn_abs_int32_c (mn_int32_t * dst, mn_int32_t * src, mn_uint32_t count)
+mn_result_t mn_abs_int32_c (mn_int32_t * dst, mn_int32_t * src, size_t count)
 {
     MN_ASSERT_DS;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[itr] = abs (src[itr]);
-    }
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_int32_t,
+        d[itr] = abs (s[itr]);
+    );
     return MN_SUCCESS;
 }
 
-mn_result_t mn_abs_vec2i_c (mn_vec2i_t * dst, mn_vec2i_t * src, mn_uint32_t count)
+mn_result_t mn_abs_vec2i_c (mn_vec2i_t * dst, mn_vec2i_t * src, size_t count)
 {
     MN_ASSERT_DS;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ].x = abs (src[ itr ].x);
-        dst[ itr ].y = abs (src[ itr ].y);
-    }
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec2i_t,
+        d[ itr ].x = abs (s[ itr ].x);
+        d[ itr ].y = abs (s[ itr ].y);
+    );
     return MN_SUCCESS;
 }
 
-mn_result_t mn_abs_vec3i_c (mn_vec3i_t * dst, mn_vec3i_t * src, mn_uint32_t count)
+mn_result_t mn_abs_vec3i_c (mn_vec3i_t * dst, mn_vec3i_t * src, size_t count)
 {
     MN_ASSERT_DS;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ].x = abs (src[ itr ].x);
-        dst[ itr ].y = abs (src[ itr ].y);
-        dst[ itr ].z = abs (src[ itr ].z);
-    }
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec3i_t,
+        d[ itr ].x = abs (s[ itr ].x);
+        d[ itr ].y = abs (s[ itr ].y);
+        d[ itr ].z = abs (s[ itr ].z);
+    );
     return MN_SUCCESS;
 }
 
-mn_result_t mn_abs_vec4i_c (mn_vec4i_t * dst, mn_vec4i_t * src, mn_uint32_t count)
+mn_result_t mn_abs_vec4i_c (mn_vec4i_t * dst, mn_vec4i_t * src, size_t count)
 {
     MN_ASSERT_DS;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ].x = abs (src[ itr ].x);
-        dst[ itr ].y = abs (src[ itr ].y);
-        dst[ itr ].z = abs (src[ itr ].z);
-        dst[ itr ].w = abs (src[ itr ].w);
-    }
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec4i_t,
+        d[ itr ].x = abs (s[ itr ].x);
+        d[ itr ].y = abs (s[ itr ].y);
+        d[ itr ].z = abs (s[ itr ].z);
+        d[ itr ].w = abs (s[ itr ].w);
+    );
     return MN_SUCCESS;
 }
 
-mn_result_t mn_abs_float_c (mn_float32_t * dst, mn_float32_t * src, mn_uint32_t count)
+mn_result_t mn_abs_float_c (mn_float32_t * dst, mn_float32_t * src, size_t count)
 {
     MN_ASSERT_DS;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[itr] = fabsf (src[itr]);
-    }
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float32_t,
+        d[itr] = fabsf (s[itr]);
+    );
     return MN_SUCCESS;
 }
 
-mn_result_t mn_abs_vec2f_c (mn_vec2f_t * dst, mn_vec2f_t * src, mn_uint32_t count)
+mn_result_t mn_abs_vec2f_c (mn_vec2f_t * dst, mn_vec2f_t * src, size_t count)
 {
     MN_ASSERT_DS;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ].x = fabsf (src[ itr ].x);
-        dst[ itr ].y = fabsf (src[ itr ].y);
-    }
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec2f_t,
+        d[ itr ].x = fabsf (s[ itr ].x);
+        d[ itr ].y = fabsf (s[ itr ].y);
+    );
     return MN_SUCCESS;
 }
 
-mn_result_t mn_abs_vec3f_c (mn_vec3f_t * dst, mn_vec3f_t * src, mn_uint32_t count)
+mn_result_t mn_abs_vec3f_c (mn_vec3f_t * dst, mn_vec3f_t * src, size_t count)
 {
     MN_ASSERT_DS;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ].x = fabsf (src[ itr ].x);
-        dst[ itr ].y = fabsf (src[ itr ].y);
-        dst[ itr ].z = fabsf (src[ itr ].z);
-    }
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec3f_t,
+        d[ itr ].x = fabsf (s[ itr ].x);
+        d[ itr ].y = fabsf (s[ itr ].y);
+        d[ itr ].z = fabsf (s[ itr ].z);
+    );
     return MN_SUCCESS;
 }
 
-mn_result_t mn_abs_vec4f_c (mn_vec4f_t * dst, mn_vec4f_t * src, mn_uint32_t count)
+mn_result_t mn_abs_vec4f_c (mn_vec4f_t * dst, mn_vec4f_t * src, size_t count)
 {
     MN_ASSERT_DS;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ].x = fabsf (src[ itr ].x);
-        dst[ itr ].y = fabsf (src[ itr ].y);
-        dst[ itr ].z = fabsf (src[ itr ].z);
-        dst[ itr ].w = fabsf (src[ itr ].w);
-    }
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec4f_t,
+        d[ itr ].x = fabsf (s[ itr ].x);
+        d[ itr ].y = fabsf (s[ itr ].y);
+        d[ itr ].z = fabsf (s[ itr ].z);
+        d[ itr ].w = fabsf (s[ itr ].w);
+    );
     return MN_SUCCESS;
 }
@@ -29,7 +29,7 @@ Intrinsics used:
 Supported routines: Int and Float 32-bit data types [1 to 4 Dimensional arrays]
 */
 
-mn_result_t mn_abs_float_neon(mn_float32_t * dst, mn_float32_t * src, uint32_t count)
+mn_result_t mn_abs_float_neon(mn_float32_t * dst, mn_float32_t * src, size_t count)
 {
     MN_ABS_DstSrc_DO_COUNT_TIMES_FLOAT_NEON( /*TO DO - Remove macro logic and replace it by actual neon abs*/
         MN_MAINLOOP_FLOAT_NEON_ABS,  /* SIMD main loop */ 
@@ -39,7 +39,7 @@ mn_result_t mn_abs_float_neon(mn_float32_t * dst, mn_float32_t * src, uint32_t c
     return MN_SUCCESS;
 }
 
-mn_result_t mn_abs_int32_neon(mn_int32_t * dst, mn_int32_t * src, uint32_t count)
+mn_result_t mn_abs_int32_neon(mn_int32_t * dst, mn_int32_t * src, size_t count)
 {
     MN_ABS_DstSrc_DO_COUNT_TIMES_INT32_NEON( /*TO DO - Remove macro logic and replace it by actual neon abs*/
         MN_MAINLOOP_INT32_NEON_ABS,  /* SIMD main loop */ 
@@ -49,7 +49,7 @@ mn_result_t mn_abs_int32_neon(mn_int32_t * dst, mn_int32_t * src, uint32_t count
     return MN_SUCCESS;
 }
 
-mn_result_t mn_abs_vec2f_neon(mn_vec2f_t * dst, mn_vec2f_t * src, uint32_t count)
+mn_result_t mn_abs_vec2f_neon(mn_vec2f_t * dst, mn_vec2f_t * src, size_t count)
 {
     MN_ABS_DstSrc_DO_COUNT_TIMES_VEC2F_NEON(
         n_dst  =  vabsq_f32(n_src); /* notice the q → quad = 128 bits (Main loop handles 4 x 32 bits) */
@@ -58,7 +58,7 @@ mn_result_t mn_abs_vec2f_neon(mn_vec2f_t * dst, mn_vec2f_t * src, uint32_t count
     );
 }
 
-mn_result_t mn_abs_vec2i_neon(mn_vec2i_t * dst, mn_vec2i_t * src, uint32_t count)
+mn_result_t mn_abs_vec2i_neon(mn_vec2i_t * dst, mn_vec2i_t * src, size_t count)
 {
     MN_ABS_DstSrc_DO_COUNT_TIMES_VEC2I_NEON(
         n_dst  =  vabsq_s32(n_src);
@@ -67,7 +67,7 @@ mn_result_t mn_abs_vec2i_neon(mn_vec2i_t * dst, mn_vec2i_t * src, uint32_t count
     );
 }
 
-mn_result_t mn_abs_vec3f_neon (mn_vec3f_t * dst, mn_vec3f_t * src, uint32_t count)
+mn_result_t mn_abs_vec3f_neon (mn_vec3f_t * dst, mn_vec3f_t * src, size_t count)
 {
     MN_ABS_DstSrc_DO_COUNT_TIMES_VEC3F_NEON
     (
@@ -81,7 +81,7 @@ mn_result_t mn_abs_vec3f_neon (mn_vec3f_t * dst, mn_vec3f_t * src, uint32_t coun
     );
 }
 
-mn_result_t mn_abs_vec3i_neon (mn_vec3i_t * dst, mn_vec3i_t * src, uint32_t count)
+mn_result_t mn_abs_vec3i_neon (mn_vec3i_t * dst, mn_vec3i_t * src, size_t count)
 {
     MN_ABS_DstSrc_DO_COUNT_TIMES_VEC3I_NEON
     (
@@ -95,7 +95,7 @@ mn_result_t mn_abs_vec3i_neon (mn_vec3i_t * dst, mn_vec3i_t * src, uint32_t coun
     );
 }
 
-mn_result_t mn_abs_vec4f_neon (mn_vec4f_t * dst, mn_vec4f_t * src, uint32_t count)
+mn_result_t mn_abs_vec4f_neon (mn_vec4f_t * dst, mn_vec4f_t * src, size_t count)
 {
     MN_ABS_DstSrc_DO_COUNT_TIMES_VEC4F_NEON
     (
@@ -103,7 +103,7 @@ mn_result_t mn_abs_vec4f_neon (mn_vec4f_t * dst, mn_vec4f_t * src, uint32_t coun
     );
 }
 
-mn_result_t mn_abs_vec4i_neon (mn_vec4i_t * dst, mn_vec4i_t * src, uint32_t count)
+mn_result_t mn_abs_vec4i_neon (mn_vec4i_t * dst, mn_vec4i_t * src, size_t count)
 {
     MN_ABS_DstSrc_DO_COUNT_TIMES_VEC4I_NEON
     (
@@ -0,0 +1,182 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <assert.h>
+#include <math.h>
+
+/*
+Function Input:
+    dst   - Destination array
+    src   - Source array
+    alpha - Slope of leaky_relu for negative inputs
+    count - Count is an integer that stores number of elements
+
+    C Implementation of the activation functions, the reference for the NEON
+    versions:
+        relu:       dst[i] = src[i] > 0 ? src[i] : 0 (NaN stays NaN)
+        leaky_relu: dst[i] = src[i] > 0 ? src[i] : alpha * src[i]
+        sigmoid:    dst[i] = 1 / (1 + expf(-src[i]))
+        tanh:       dst[i] = tanhf(src[i])
+        gelu:       dst[i] = 0.5 * x * (1 + tanh(u)), u = sqrt(2 / pi) * (x + 0.044715 * x^3),
+                    computed as x / (1 + expf(-2u)), the same value without
+                    1 + tanh(u) cancelling for negative x
+        softmax:    dst[i] = expf(src[i] - max) / sum(expf(src[j] - max))
+    The float16 versions widen every value to float, apply the same formula
+    and round the result back to a half. dst may be the same array as src.
+*/
+
+#define MN_GELU_K0 1.59576912160573f        /* 2 * sqrt(2 / pi) */
+#define MN_GELU_K1 0.0713548162726f         /* 2 * sqrt(2 / pi) * 0.044715 */
+
+#define MN_H2F(h) mn_f16_to_f32(h)
+#define MN_F2H(f) mn_f32_to_f16(f)
+
+static inline mn_float32_t mn_relu_c (mn_float32_t x)
+{
+    return (x > 0.0f || x != x) ? x : 0.0f;
+}
+
+static inline mn_float32_t mn_sigmoid_c (mn_float32_t x)
+{
+    return 1.0f / (1.0f + expf(-x));
+}
+
+static inline mn_float32_t mn_gelu_c (mn_float32_t x)
+{
+    return x / (1.0f + expf(-x * (MN_GELU_K0 + MN_GELU_K1 * x * x)));
+}
+
+mn_result_t mn_relu_float_c (mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float32_t,
+        d[itr] = mn_relu_c(s[itr]);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_leaky_relu_float_c (mn_float32_t * dst, mn_float32_t * src, mn_float32_t alpha, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float32_t,
+        d[itr] = s[itr] > 0.0f ? s[itr] : alpha * s[itr];
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_sigmoid_float_c (mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float32_t,
+        d[itr] = mn_sigmoid_c(s[itr]);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_tanh_float_c (mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float32_t,
+        d[itr] = tanhf(s[itr]);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_gelu_float_c (mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float32_t,
+        d[itr] = mn_gelu_c(s[itr]);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_softmax_float_c (mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    mn_float32_t max = -INFINITY, sum = 0.0f;
+
+    MN_ASSERT_DS;
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        max = src[ itr ] > max ? src[ itr ] : max;
+    }
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = expf(src[ itr ] - max);
+        sum += dst[ itr ];
+    }
+    const mn_float32_t inv = 1.0f / sum;
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] *= inv;
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_relu_float16_c (mn_float16_t * dst, mn_float16_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float16_t,
+        d[itr] = MN_F2H(mn_relu_c(MN_H2F(s[itr])));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_leaky_relu_float16_c (mn_float16_t * dst, mn_float16_t * src, mn_float32_t alpha, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float16_t,
+        const mn_float32_t x = MN_H2F(s[itr]);
+        d[itr] = MN_F2H(x > 0.0f ? x : alpha * x);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_sigmoid_float16_c (mn_float16_t * dst, mn_float16_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float16_t,
+        d[itr] = MN_F2H(mn_sigmoid_c(MN_H2F(s[itr])));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_tanh_float16_c (mn_float16_t * dst, mn_float16_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float16_t,
+        d[itr] = MN_F2H(tanhf(MN_H2F(s[itr])));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_gelu_float16_c (mn_float16_t * dst, mn_float16_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float16_t,
+        d[itr] = MN_F2H(mn_gelu_c(MN_H2F(s[itr])));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_softmax_float16_c (mn_float16_t * dst, mn_float16_t * src, size_t count)
+{
+    mn_float32_t max = -INFINITY, sum = 0.0f;
+
+    MN_ASSERT_DS;
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        const mn_float32_t x = MN_H2F(src[ itr ]);
+        max = x > max ? x : max;
+    }
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        sum += expf(MN_H2F(src[ itr ]) - max);
+    }
+    const mn_float32_t inv = 1.0f / sum;
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = MN_F2H(expf(MN_H2F(src[ itr ]) - max) * inv);
+    }
+    return MN_SUCCESS;
+}
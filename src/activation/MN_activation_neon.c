@@ -0,0 +1,388 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include "../common/MN_explog_neon.h"
+#include <arm_neon.h>
+#include <assert.h>
+#include <float.h>
+#include <math.h>
+
+/*
+Input Arguments:
+    dst   - Destination array
+    src   - Source array
+    alpha - Slope of leaky_relu for negative inputs
+    count - Count is an integer that stores number of elements
+
+Intrinsics used:
+    vmaxq_f32                   - relu (keeps NaN, gives +0 for -0), running max of softmax
+    vbslq_f32 / vcgtq_f32       - leaky_relu, tanh range select
+    vdivq_f32                   - 1 / (1 + e) on AArch64; vrecpeq_f32 and two
+                                  vrecpsq_f32 steps on 32-bit ARM
+    vcvt_f32_f16 / vcvt_f16_f32 - widen / narrow the float16 arrays
+    exp from MN_explog_neon.h (MN_ACCURACY_PRECISE, below 1.5 ULP)
+
+    sigmoid: 1 / (1 + e^-x)
+    tanh:    x + x^3 * P(x^2) for |x| < 0.5625 (minimax, relative error 1.4e-9),
+             sign(x) * (1 - 2 / (e^2|x| + 1)) above
+    gelu:    x / (1 + e^-2u), u = sqrt(2 / pi) * (x + 0.044715 x^3), as in C
+    softmax: pass 1 keeps a running max m and sum s of e^(x - m) per lane,
+             rescaling s by e^(m_old - m_new) once per 16 values; pass 2
+             writes e^(x - max) / sum. src is read twice and dst written
+             once, with no exp values stored in between.
+
+relu, leaky_relu, sigmoid, tanh, gelu and softmax pass 2 map their vector
+function over the array (MN_MAP_F32_NEON, tail padded with 0). Softmax pass
+1 takes 16 values per step, then 4, and pads its last 1 - 3 values with
+-inf, which adds nothing to the sum.
+
+The float16 routines widen 256 halves at a time into a float buffer, run the
+float code on it and narrow the results (round to nearest even). Without
+MN_FP16_NATIVE or MN_FP16_CVT they call the C implementations.
+
+Supported routines: relu, leaky_relu, sigmoid, tanh, gelu, softmax [float, float16]
+*/
+
+#define MN_ACT_TANH_SMALL 0.5625f
+#define MN_ACT_GELU_K0    1.59576912160573f      /* 2 * sqrt(2 / pi) */
+#define MN_ACT_GELU_K1    0.0713548162726f       /* 2 * sqrt(2 / pi) * 0.044715 */
+#define MN_ACT_F16_CHUNK  256
+
+/* tanh(x) = x + x^3 * P(x^2) on |x| < 0.5625 */
+static const mn_float32_t mn_act_c_tanh[ 5 ] = {
+    -3.333331347e-01f, 1.333245188e-01f, -5.383742973e-02f, 2.100746334e-02f, -6.179816090e-03f };
+
+static inline mn_float32_t mn_act_hmax (float32x4_t v)
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+    return vmaxvq_f32(v);
+#else
+    float32x2_t m = vmax_f32(vget_low_f32(v), vget_high_f32(v));
+    return vget_lane_f32(vpmax_f32(m, m), 0);
+#endif
+}
+
+static inline float32x4_t mn_act_relu (float32x4_t x)
+{
+    return vmaxq_f32(x, vdupq_n_f32(0.0f));
+}
+
+static inline float32x4_t mn_act_sigmoid (float32x4_t x)
+{
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    return mn_divq_f32(one, vaddq_f32(one, mn_explog_exp(vnegq_f32(x))));
+}
+
+static inline float32x4_t mn_act_tanh (float32x4_t x)
+{
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t ax = vabsq_f32(x);
+    const float32x4_t x2 = vmulq_f32(x, x);
+    const float32x4_t small = MN_FMAQ_F32(x, vmulq_f32(x, x2), mn_explog_poly(x2, mn_act_c_tanh, 5));
+    const float32x4_t e = mn_explog_exp(vaddq_f32(ax, ax));
+    const float32x4_t big = vsubq_f32(one, mn_divq_f32(vdupq_n_f32(2.0f), vaddq_f32(e, one)));
+    const float32x4_t res = vbslq_f32(vcltq_f32(ax, vdupq_n_f32(MN_ACT_TANH_SMALL)), small, big);
+    /* the sign of x, also for -0 which the polynomial turns into +0 */
+    return vbslq_f32(vdupq_n_u32(0x80000000u), x, res);
+}
+
+static inline float32x4_t mn_act_gelu (float32x4_t x)
+{
+    const float32x4_t x2 = vmulq_f32(x, x);
+    const float32x4_t t = vmulq_f32(x, MN_FMAQ_F32(vdupq_n_f32(MN_ACT_GELU_K0), x2, vdupq_n_f32(MN_ACT_GELU_K1)));
+    return mn_divq_f32(x, vaddq_f32(vdupq_n_f32(1.0f), mn_explog_exp(vnegq_f32(t))));
+}
+
+/* d[i] = VEC(s[i]) for n floats */
+#define MN_ACT_NEON(VEC) MN_MAP_F32_NEON(d, s, n, VEC, 0.0f)
+
+static void mn_act_relu_run (mn_float32_t * d, const mn_float32_t * s, size_t n)
+{
+    MN_ACT_NEON(mn_act_relu);
+}
+
+static void mn_act_leaky_relu_run (mn_float32_t * d, const mn_float32_t * s, size_t n, mn_float32_t alpha)
+{
+    const float32x4_t va = vdupq_n_f32(alpha);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+#define MN_ACT_LEAKY(x) vbslq_f32(vcgtq_f32((x), zero), (x), vmulq_f32((x), va))
+    MN_ACT_NEON(MN_ACT_LEAKY);
+#undef MN_ACT_LEAKY
+}
+
+static void mn_act_sigmoid_run (mn_float32_t * d, const mn_float32_t * s, size_t n)
+{
+    MN_ACT_NEON(mn_act_sigmoid);
+}
+
+static void mn_act_tanh_run (mn_float32_t * d, const mn_float32_t * s, size_t n)
+{
+    MN_ACT_NEON(mn_act_tanh);
+}
+
+static void mn_act_gelu_run (mn_float32_t * d, const mn_float32_t * s, size_t n)
+{
+    MN_ACT_NEON(mn_act_gelu);
+}
+
+/* running max and sum of the softmax, one per lane */
+typedef struct
+{
+    float32x4_t max;
+    float32x4_t sum;
+} mn_softmax_state_t;
+
+static void mn_softmax_init (mn_softmax_state_t * st)
+{
+    /* -FLT_MAX rather than -inf, so e^(max_old - max_new) is never e^(-inf + inf) */
+    st->max = vdupq_n_f32(-FLT_MAX);
+    st->sum = vdupq_n_f32(0.0f);
+}
+
+/* pass 1 over n floats */
+static void mn_softmax_accumulate (mn_softmax_state_t * st, const mn_float32_t * s, size_t n)
+{
+    float32x4_t m = st->max, sum = st->sum;
+    size_t itr = 0;
+
+    MN_PREFETCH_INIT;
+    for ( ; itr + 16 <= n; itr += 16 )
+    {
+        MN_PREFETCH_SRC_STEP(s + itr, 64);
+        const float32x4_t x0 = vld1q_f32(s + itr);
+        const float32x4_t x1 = vld1q_f32(s + itr + 4);
+        const float32x4_t x2 = vld1q_f32(s + itr + 8);
+        const float32x4_t x3 = vld1q_f32(s + itr + 12);
+        const float32x4_t mn = vmaxq_f32(m, vmaxq_f32(vmaxq_f32(x0, x1), vmaxq_f32(x2, x3)));
+        const float32x4_t e01 = vaddq_f32(mn_explog_exp(vsubq_f32(x0, mn)), mn_explog_exp(vsubq_f32(x1, mn)));
+        const float32x4_t e23 = vaddq_f32(mn_explog_exp(vsubq_f32(x2, mn)), mn_explog_exp(vsubq_f32(x3, mn)));
+        sum = MN_FMAQ_F32(vaddq_f32(e01, e23), sum, mn_explog_exp(vsubq_f32(m, mn)));
+        m = mn;
+    }
+    for ( ; itr < n; itr += 4 )
+    {
+        float32x4_t x;
+        if (itr + 4 <= n)
+        {
+            x = vld1q_f32(s + itr);
+        }
+        else
+        {
+            /* -inf lanes add e^-inf = 0 */
+            mn_float32_t buf[ 4 ] = { -INFINITY, -INFINITY, -INFINITY, -INFINITY };
+            for ( size_t i = 0; itr + i < n; i++ ) buf[ i ] = s[ itr + i ];
+            x = vld1q_f32(buf);
+        }
+        const float32x4_t mn = vmaxq_f32(m, x);
+        sum = MN_FMAQ_F32(mn_explog_exp(vsubq_f32(x, mn)), sum, mn_explog_exp(vsubq_f32(m, mn)));
+        m = mn;
+    }
+    st->max = m;
+    st->sum = sum;
+}
+
+/* the max and 1 / sum over all lanes */
+static void mn_softmax_finish (const mn_softmax_state_t * st, mn_float32_t * max, mn_float32_t * inv)
+{
+    *max = mn_act_hmax(st->max);
+    const float32x4_t scaled = vmulq_f32(st->sum, mn_explog_exp(vsubq_f32(st->max, vdupq_n_f32(*max))));
+    *inv = 1.0f / mn_hsumq_f32(scaled);
+}
+
+/* pass 2: d[i] = e^(s[i] - max) * inv */
+static void mn_softmax_write (mn_float32_t * d, const mn_float32_t * s, size_t n, mn_float32_t max, mn_float32_t inv)
+{
+    const float32x4_t vmax = vdupq_n_f32(max);
+    const float32x4_t vinv = vdupq_n_f32(inv);
+#define MN_ACT_SOFTMAX(x) vmulq_f32(mn_explog_exp(vsubq_f32((x), vmax)), vinv)
+    MN_ACT_NEON(MN_ACT_SOFTMAX);
+#undef MN_ACT_SOFTMAX
+}
+
+mn_result_t mn_relu_float_neon (mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    mn_act_relu_run(dst, src, count);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_leaky_relu_float_neon (mn_float32_t * dst, mn_float32_t * src, mn_float32_t alpha, size_t count)
+{
+    MN_ASSERT_DS;
+    mn_act_leaky_relu_run(dst, src, count, alpha);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_sigmoid_float_neon (mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    mn_act_sigmoid_run(dst, src, count);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_tanh_float_neon (mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    mn_act_tanh_run(dst, src, count);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_gelu_float_neon (mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    mn_act_gelu_run(dst, src, count);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_softmax_float_neon (mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    mn_softmax_state_t st;
+    mn_float32_t max, inv;
+
+    MN_ASSERT_DS;
+    if (count == 0)
+    {
+        return MN_SUCCESS;
+    }
+    mn_softmax_init(&st);
+    mn_softmax_accumulate(&st, src, count);
+    mn_softmax_finish(&st, &max, &inv);
+    mn_softmax_write(dst, src, count, max, inv);
+    return MN_SUCCESS;
+}
+
+#if defined(MN_FP16_NATIVE) || defined(MN_FP16_CVT)
+
+static void mn_act_f16_widen (mn_float32_t * d, const mn_float16_t * s, size_t n)
+{
+    size_t i = 0;
+    for ( ; i + 4 <= n; i += 4 )
+    {
+        vst1q_f32(d + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(s + i))));
+    }
+    for ( ; i < n; i++ )
+    {
+        d[ i ] = mn_f16_to_f32(s[ i ]);
+    }
+}
+
+static void mn_act_f16_narrow (mn_float16_t * d, const mn_float32_t * s, size_t n)
+{
+    size_t i = 0;
+    for ( ; i + 4 <= n; i += 4 )
+    {
+        vst1_u16(d + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(s + i))));
+    }
+    if (i < n)
+    {
+        mn_float32_t buf[ 4 ] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        uint16_t half[ 4 ];
+        for ( size_t k = 0; i + k < n; k++ ) buf[ k ] = s[ i + k ];
+        vst1_u16(half, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(buf))));
+        for ( size_t k = 0; i + k < n; k++ ) d[ i + k ] = half[ k ];
+    }
+}
+
+/* run a float kernel over the halves, one widened chunk (buf, n) at a time */
+#define MN_ACT_F16(RUN) \
+    do { \
+        mn_float32_t buf[ MN_ACT_F16_CHUNK ]; \
+        for ( size_t base = 0; base < count; base += MN_ACT_F16_CHUNK ) \
+        { \
+            const size_t n = count - base < MN_ACT_F16_CHUNK ? count - base : MN_ACT_F16_CHUNK; \
+            mn_act_f16_widen(buf, src + base, n); \
+            RUN; \
+            mn_act_f16_narrow(dst + base, buf, n); \
+        } \
+    } while (0)
+
+#define MN_ACT_HAVE_F16 1
+#endif
+
+mn_result_t mn_relu_float16_neon (mn_float16_t * dst, mn_float16_t * src, size_t count)
+{
+#if defined(MN_ACT_HAVE_F16)
+    MN_ASSERT_DS;
+    MN_ACT_F16(mn_act_relu_run(buf, buf, n));
+    return MN_SUCCESS;
+#else
+    return mn_relu_float16_c(dst, src, count);
+#endif
+}
+
+mn_result_t mn_leaky_relu_float16_neon (mn_float16_t * dst, mn_float16_t * src, mn_float32_t alpha, size_t count)
+{
+#if defined(MN_ACT_HAVE_F16)
+    MN_ASSERT_DS;
+    MN_ACT_F16(mn_act_leaky_relu_run(buf, buf, n, alpha));
+    return MN_SUCCESS;
+#else
+    return mn_leaky_relu_float16_c(dst, src, alpha, count);
+#endif
+}
+
+mn_result_t mn_sigmoid_float16_neon (mn_float16_t * dst, mn_float16_t * src, size_t count)
+{
+#if defined(MN_ACT_HAVE_F16)
+    MN_ASSERT_DS;
+    MN_ACT_F16(mn_act_sigmoid_run(buf, buf, n));
+    return MN_SUCCESS;
+#else
+    return mn_sigmoid_float16_c(dst, src, count);
+#endif
+}
+
+mn_result_t mn_tanh_float16_neon (mn_float16_t * dst, mn_float16_t * src, size_t count)
+{
+#if defined(MN_ACT_HAVE_F16)
+    MN_ASSERT_DS;
+    MN_ACT_F16(mn_act_tanh_run(buf, buf, n));
+    return MN_SUCCESS;
+#else
+    return mn_tanh_float16_c(dst, src, count);
+#endif
+}
+
+mn_result_t mn_gelu_float16_neon (mn_float16_t * dst, mn_float16_t * src, size_t count)
+{
+#if defined(MN_ACT_HAVE_F16)
+    MN_ASSERT_DS;
+    MN_ACT_F16(mn_act_gelu_run(buf, buf, n));
+    return MN_SUCCESS;
+#else
+    return mn_gelu_float16_c(dst, src, count);
+#endif
+}
+
+mn_result_t mn_softmax_float16_neon (mn_float16_t * dst, mn_float16_t * src, size_t count)
+{
+#if defined(MN_ACT_HAVE_F16)
+    mn_float32_t buf[ MN_ACT_F16_CHUNK ];
+    mn_softmax_state_t st;
+    mn_float32_t max, inv;
+
+    MN_ASSERT_DS;
+    if (count == 0)
+    {
+        return MN_SUCCESS;
+    }
+    mn_softmax_init(&st);
+    for ( size_t base = 0; base < count; base += MN_ACT_F16_CHUNK )
+    {
+        const size_t n = count - base < MN_ACT_F16_CHUNK ? count - base : MN_ACT_F16_CHUNK;
+        mn_act_f16_widen(buf, src + base, n);
+        mn_softmax_accumulate(&st, buf, n);
+    }
+    mn_softmax_finish(&st, &max, &inv);
+    for ( size_t base = 0; base < count; base += MN_ACT_F16_CHUNK )
+    {
+        const size_t n = count - base < MN_ACT_F16_CHUNK ? count - base : MN_ACT_F16_CHUNK;
+        mn_act_f16_widen(buf, src + base, n);
+        mn_softmax_write(buf, buf, n, max, inv);
+        mn_act_f16_narrow(dst + base, buf, n);
+    }
+    return MN_SUCCESS;
+#else
+    return mn_softmax_float16_c(dst, src, count);
+#endif
+}
@@ -4,94 +4,89 @@
 #include <assert.h>
 #include <math.h>
 
-mn_result_t mn_addc_float_c (mn_float32_t * dst, mn_float32_t * src, const mn_float32_t cst, mn_uint32_t count)
+mn_result_t mn_addc_float_c (mn_float32_t * dst, mn_float32_t * src, const mn_float32_t cst, size_t count)
 {
     MN_ASSERT_DS;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ] = src[ itr ] + cst;
-    }
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float32_t,
+        d[ itr ] = s[ itr ] + cst;
+    );
     return MN_OK;
 }
 
-mn_result_t mn_addc_vec2f_c (mn_vec2f_t * dst, mn_vec2f_t * src, const mn_vec2f_t * cst, mn_uint32_t count)
+mn_result_t mn_addc_vec2f_c (mn_vec2f_t * dst, mn_vec2f_t * src, const mn_vec2f_t * cst, size_t count)
 {
     MN_ASSERT_DS;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ].x = src[ itr ].x + cst->x;
-        dst[ itr ].y = src[ itr ].y + cst->y;
-    }
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec2f_t,
+        d[ itr ].x = s[ itr ].x + cst->x;
+        d[ itr ].y = s[ itr ].y + cst->y;
+    );
     return MN_OK;
 }
 
-mn_result_t mn_addc_vec3f_c (mn_vec3f_t * dst, mn_vec3f_t * src, const mn_vec3f_t * cst, mn_uint32_t count)
+mn_result_t mn_addc_vec3f_c (mn_vec3f_t * dst, mn_vec3f_t * src, const mn_vec3f_t * cst, size_t count)
 {
     MN_ASSERT_DS;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ].x = src[ itr ].x + cst->x;
-        dst[ itr ].y = src[ itr ].y + cst->y;
-        dst[ itr ].z = src[ itr ].z + cst->z;
-    }
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec3f_t,
+        d[ itr ].x = s[ itr ].x + cst->x;
+        d[ itr ].y = s[ itr ].y + cst->y;
+        d[ itr ].z = s[ itr ].z + cst->z;
+    );
     return MN_OK;
 }
 
-mn_result_t mn_addc_vec4f_c (mn_vec4f_t * dst, mn_vec4f_t * src, const mn_vec4f_t * cst, mn_uint32_t count)
+mn_result_t mn_addc_vec4f_c (mn_vec4f_t * dst, mn_vec4f_t * src, const mn_vec4f_t * cst, size_t count)
 {
     MN_ASSERT_DS;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ].x = src[ itr ].x + cst->x;
-        dst[ itr ].y = src[ itr ].y + cst->y;
-        dst[ itr ].z = src[ itr ].z + cst->z;
-        dst[ itr ].w = src[ itr ].w + cst->w;
-    }
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec4f_t,
+        d[ itr ].x = s[ itr ].x + cst->x;
+        d[ itr ].y = s[ itr ].y + cst->y;
+        d[ itr ].z = s[ itr ].z + cst->z;
+        d[ itr ].w = s[ itr ].w + cst->w;
+    );
     return MN_OK;
 }
 
-mn_result_t mn_addc_int32_c (mn_int32_t * dst, mn_int32_t * src, const mn_int32_t cst, mn_uint32_t count)
+mn_result_t mn_addc_int32_c (mn_int32_t * dst, mn_int32_t * src, const mn_int32_t cst, size_t count)
 {
     MN_ASSERT_DS;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ] = src[ itr ] + cst;
-    }
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_int32_t,
+        d[ itr ] = s[ itr ] + cst;
+    );
     return MN_OK;
 }
 
-mn_result_t mn_addc_vec2i_c (mn_vec2i_t * dst, mn_vec2i_t * src, const mn_vec2i_t * cst, mn_uint32_t count)
+mn_result_t mn_addc_vec2i_c (mn_vec2i_t * dst, mn_vec2i_t * src, const mn_vec2i_t * cst, size_t count)
 {
     MN_ASSERT_DS;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ].x = src[ itr ].x + cst->x;
-        dst[ itr ].y = src[ itr ].y + cst->y;
-    }
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec2i_t,
+        d[ itr ].x = s[ itr ].x + cst->x;
+        d[ itr ].y = s[ itr ].y + cst->y;
+    );
     return MN_OK;
 }
 
-mn_result_t mn_addc_vec3i_c (mn_vec3i_t * dst, mn_vec3i_t * src, const mn_vec3i_t * cst, mn_uint32_t count)
+mn_result_t mn_addc_vec3i_c (mn_vec3i_t * dst, mn_vec3i_t * src, const mn_vec3i_t * cst, size_t count)
 {
     MN_ASSERT_DS;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ].x = src[ itr ].x + cst->x;
-        dst[ itr ].y = src[ itr ].y + cst->y;
-        dst[ itr ].z = src[ itr ].z + cst->z;
-    }
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec3i_t,
+        d[ itr ].x = s[ itr ].x + cst->x;
+        d[ itr ].y = s[ itr ].y + cst->y;
+        d[ itr ].z = s[ itr ].z + cst->z;
+    );
     return MN_OK;
 }
 
-mn_result_t mn_addc_vec4i_c (mn_vec4i_t * dst, mn_vec4i_t * src, const mn_vec4i_t * cst, mn_uint32_t count)
+mn_result_t mn_addc_vec4i_c (mn_vec4i_t * dst, mn_vec4i_t * src, const mn_vec4i_t * cst, size_t count)
 {
     MN_ASSERT_DS;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ].x = src[ itr ].x + cst->x;
-        dst[ itr ].y = src[ itr ].y + cst->y;
-        dst[ itr ].z = src[ itr ].z + cst->z;
-        dst[ itr ].w = src[ itr ].w + cst->w;
-    }
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec4i_t,
+        d[ itr ].x = s[ itr ].x + cst->x;
+        d[ itr ].y = s[ itr ].y + cst->y;
+        d[ itr ].z = s[ itr ].z + cst->z;
+        d[ itr ].w = s[ itr ].w + cst->w;
+    );
     return MN_OK;
 }
+
+/* Saturating int32 addc: the result is clamped to [INT32_MIN, INT32_MAX] */
+MN_INTN_C_CONST(addc_sat, int32, mn_int32_t, int64_t, MN_SAT_CLAMP(mn_int32_t, INT32_MIN, INT32_MAX, x + y))
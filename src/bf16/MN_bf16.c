@@ -0,0 +1,128 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+/*
+Function Input:
+    dst   - Destination that store results (a single float32 for sum/dot)
+    src1  - Source that stores user input 1
+    src2  - Source that stores user input 2
+    src3  - Addend of fma (dst = src1 * src2 + src3)
+    cst   - Constant of addc / mulc
+    count - Count is an integer that stores number of elements
+
+    C Implementation of the bfloat16 operators. bfloat16 is the upper half of
+    a float32, so widening is a 16 bit shift. Every element is computed in
+    float32 and rounded back to bfloat16 (round to nearest even). sum and dot
+    accumulate in float32 and return a float32 result.
+*/
+
+/* ===== Scalar conversions ===== */
+
+mn_bfloat16_t mn_f32_to_bf16 (mn_float32_t value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    if ((bits & 0x7fffffffu) > 0x7f800000u)      /* NaN, keep it quiet */
+    {
+        return (mn_bfloat16_t)((bits >> 16) | 0x0040u);
+    }
+    bits += 0x7fffu + ((bits >> 16) & 1u);       /* may carry into the exponent, which is correct */
+    return (mn_bfloat16_t)(bits >> 16);
+}
+
+mn_float32_t mn_bf16_to_f32 (mn_bfloat16_t value)
+{
+    uint32_t bits = (uint32_t)value << 16;
+    mn_float32_t result;
+    memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+#define MN_B2F(h) mn_bf16_to_f32(h)
+#define MN_F2B(f) mn_f32_to_bf16(f)
+
+mn_result_t mn_add_bfloat16_c (mn_bfloat16_t * dst, mn_bfloat16_t * src1, mn_bfloat16_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_bfloat16_t,
+        d[itr] = MN_F2B(MN_B2F(s1[itr]) + MN_B2F(s2[itr]));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_sub_bfloat16_c (mn_bfloat16_t * dst, mn_bfloat16_t * src1, mn_bfloat16_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_bfloat16_t,
+        d[itr] = MN_F2B(MN_B2F(s1[itr]) - MN_B2F(s2[itr]));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mul_bfloat16_c (mn_bfloat16_t * dst, mn_bfloat16_t * src1, mn_bfloat16_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_bfloat16_t,
+        d[itr] = MN_F2B(MN_B2F(s1[itr]) * MN_B2F(s2[itr]));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_addc_bfloat16_c (mn_bfloat16_t * dst, mn_bfloat16_t * src, const mn_bfloat16_t cst, size_t count)
+{
+    MN_ASSERT_DS;
+    const mn_float32_t c = MN_B2F(cst);
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_bfloat16_t,
+        d[itr] = MN_F2B(MN_B2F(s[itr]) + c);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mulc_bfloat16_c (mn_bfloat16_t * dst, mn_bfloat16_t * src, const mn_bfloat16_t cst, size_t count)
+{
+    MN_ASSERT_DS;
+    const mn_float32_t c = MN_B2F(cst);
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_bfloat16_t,
+        d[itr] = MN_F2B(MN_B2F(s[itr]) * c);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_fma_bfloat16_c (mn_bfloat16_t * dst, mn_bfloat16_t * src1, mn_bfloat16_t * src2, mn_bfloat16_t * src3, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_ASSERT_DS1S2(dst, src3, src3);
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        dst[itr] = MN_F2B(fmaf(MN_B2F(src1[itr]), MN_B2F(src2[itr]), MN_B2F(src3[itr])));
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_sum_bfloat16_c (mn_float32_t * dst, mn_bfloat16_t * src, size_t count)
+{
+    assert(dst && src);
+    mn_float32_t acc = 0.0f;
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        acc += MN_B2F(src[itr]);
+    }
+    *dst = acc;
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_dot_bfloat16_c (mn_float32_t * dst, mn_bfloat16_t * src1, mn_bfloat16_t * src2, size_t count)
+{
+    assert(dst && src1 && src2);
+    mn_float32_t acc = 0.0f;
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        acc = fmaf(MN_B2F(src1[itr]), MN_B2F(src2[itr]), acc);
+    }
+    *dst = acc;
+    return MN_SUCCESS;
+}
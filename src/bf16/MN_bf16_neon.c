@@ -0,0 +1,211 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include "../common/MN_bf16_neon.h"
+#include <arm_neon.h>
+#include <assert.h>
+#include <string.h>
+
+/*
+Input Arguments:
+    dst    - Destination pointer that stores the results (a single float32 for sum/dot)
+    src1   - Source pointer to array 1
+    src2   - Source pointer to array 2
+    src3   - Addend of fma (dst = src1 * src2 + src3)
+    cst    - Constant of addc / mulc
+    count  - Number of elements to process
+
+Intrinsics used:
+    all targets:
+        vld1q_u16 / vst1q_u16 - load / store 8 bfloat16 values as raw bits
+        vshll_n_u16           - widen 4 bfloat16 values to float32 (shift into the upper half)
+        vaddq_f32 / vsubq_f32 / vmulq_f32 / vfmaq_f32 - the float32 op bodies
+        vshrn_n_u32           - narrow after adding the round to nearest even bias
+    BF16 extension (MN_BF16_NATIVE, ARMv8.6-A):
+        vcvtq_low_bf16_f32 / vcvtq_high_bf16_f32 - narrow 8 float32 values in two instructions
+        vbfdotq_f32           - dot product of bfloat16 pairs into float32 lanes
+
+Data stays bfloat16 in memory, so each element moves 2 bytes instead of 4.
+The product of two bfloat16 values is exact in float32, so the elementwise
+routines give the same bits as the C versions. sum and dot keep 8 partial
+sums (two vectors of lanes) and add them up at the end, while the C versions
+add in sequence: the summation order differs, so the two match only to
+rounding whenever the additions are inexact. vbfdotq_f32 also adds each pair
+of products before accumulating.
+
+Supported routines: bfloat16 data type [1 Dimensional arrays]
+*/
+
+/*
+ * Two-input kernel over n values: widen both 8-value blocks, run the float32
+ * op on each half and narrow. b_step is 8, or 0 for a broadcast constant
+ * block. The leftover (< 8) values go through a zero padded block.
+ */
+#define MN_BF16_BLOCK2(d, a, b, OP32) do { \
+        const uint16x8_t va = vld1q_u16(a); \
+        const uint16x8_t vb = vld1q_u16(b); \
+        vst1q_u16((d), mn_bf16_narrow(OP32(MN_BF16_WIDEN_LO(va), MN_BF16_WIDEN_LO(vb)), \
+                                      OP32(MN_BF16_WIDEN_HI(va), MN_BF16_WIDEN_HI(vb)))); \
+    } while (0)
+
+#define MN_BF16_DEFINE_KERNEL2(name, OP32) \
+static void name (mn_bfloat16_t * d, const mn_bfloat16_t * a, const mn_bfloat16_t * b, size_t n, size_t b_step) \
+{ \
+    size_t i = 0, bi = 0; \
+    MN_PREFETCH_INIT; \
+    for (; i + 8 <= n; i += 8, bi += b_step) \
+    { \
+        MN_PREFETCH_SRC(a + i); \
+        MN_BF16_BLOCK2(d + i, a + i, b + bi, OP32); \
+    } \
+    if (i < n) \
+    { \
+        uint16_t ta[8] = { 0 }, tb[8] = { 0 }, td[8]; \
+        memcpy(ta, a + i, (n - i) * sizeof(uint16_t)); \
+        memcpy(tb, b + bi, (b_step ? n - i : 8) * sizeof(uint16_t)); \
+        MN_BF16_BLOCK2(td, ta, tb, OP32); \
+        memcpy(d + i, td, (n - i) * sizeof(uint16_t)); \
+    } \
+}
+
+MN_BF16_DEFINE_KERNEL2(mn_bf16_add, vaddq_f32)
+MN_BF16_DEFINE_KERNEL2(mn_bf16_sub, vsubq_f32)
+MN_BF16_DEFINE_KERNEL2(mn_bf16_mul, vmulq_f32)
+
+#define MN_BF16_BLOCK_FMA(d, a, b, c) do { \
+        const uint16x8_t va = vld1q_u16(a); \
+        const uint16x8_t vb = vld1q_u16(b); \
+        const uint16x8_t vc = vld1q_u16(c); \
+        vst1q_u16((d), mn_bf16_narrow(MN_FMAQ_F32(MN_BF16_WIDEN_LO(vc), MN_BF16_WIDEN_LO(va), MN_BF16_WIDEN_LO(vb)), \
+                                      MN_FMAQ_F32(MN_BF16_WIDEN_HI(vc), MN_BF16_WIDEN_HI(va), MN_BF16_WIDEN_HI(vb)))); \
+    } while (0)
+
+static void mn_bf16_fma (mn_bfloat16_t * d, const mn_bfloat16_t * a, const mn_bfloat16_t * b, const mn_bfloat16_t * c, size_t n)
+{
+    size_t i = 0;
+    MN_PREFETCH_INIT;
+    for (; i + 8 <= n; i += 8)
+    {
+        MN_PREFETCH_SRC(a + i);
+        MN_PREFETCH_SRC(b + i);
+        MN_BF16_BLOCK_FMA(d + i, a + i, b + i, c + i);
+    }
+    if (i < n)
+    {
+        uint16_t ta[8] = { 0 }, tb[8] = { 0 }, tc[8] = { 0 }, td[8];
+        memcpy(ta, a + i, (n - i) * sizeof(uint16_t));
+        memcpy(tb, b + i, (n - i) * sizeof(uint16_t));
+        memcpy(tc, c + i, (n - i) * sizeof(uint16_t));
+        MN_BF16_BLOCK_FMA(td, ta, tb, tc);
+        memcpy(d + i, td, (n - i) * sizeof(uint16_t));
+    }
+}
+
+mn_result_t mn_add_bfloat16_neon(mn_bfloat16_t * dst, mn_bfloat16_t * src1, mn_bfloat16_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_bf16_add(dst, src1, src2, count, 8);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_sub_bfloat16_neon(mn_bfloat16_t * dst, mn_bfloat16_t * src1, mn_bfloat16_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_bf16_sub(dst, src1, src2, count, 8);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mul_bfloat16_neon(mn_bfloat16_t * dst, mn_bfloat16_t * src1, mn_bfloat16_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_bf16_mul(dst, src1, src2, count, 8);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_addc_bfloat16_neon(mn_bfloat16_t * dst, mn_bfloat16_t * src, const mn_bfloat16_t cst, size_t count)
+{
+    const mn_bfloat16_t block[8] = { cst, cst, cst, cst, cst, cst, cst, cst };
+    MN_ASSERT_DS;
+    mn_bf16_add(dst, src, block, count, 0);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mulc_bfloat16_neon(mn_bfloat16_t * dst, mn_bfloat16_t * src, const mn_bfloat16_t cst, size_t count)
+{
+    const mn_bfloat16_t block[8] = { cst, cst, cst, cst, cst, cst, cst, cst };
+    MN_ASSERT_DS;
+    mn_bf16_mul(dst, src, block, count, 0);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_fma_bfloat16_neon(mn_bfloat16_t * dst, mn_bfloat16_t * src1, mn_bfloat16_t * src2, mn_bfloat16_t * src3, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_ASSERT_DS1S2(dst, src3, src3);
+    mn_bf16_fma(dst, src1, src2, src3, count);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_sum_bfloat16_neon(mn_float32_t * dst, mn_bfloat16_t * src, size_t count)
+{
+    float32x4_t acc_lo = vdupq_n_f32(0.0f);
+    float32x4_t acc_hi = vdupq_n_f32(0.0f);
+    size_t i = 0;
+    assert(dst && src);
+    MN_PREFETCH_INIT;
+    for (; i + 8 <= count; i += 8)
+    {
+        const uint16x8_t v = vld1q_u16(src + i);
+        MN_PREFETCH_SRC(src + i);
+        acc_lo = vaddq_f32(acc_lo, MN_BF16_WIDEN_LO(v));
+        acc_hi = vaddq_f32(acc_hi, MN_BF16_WIDEN_HI(v));
+    }
+    if (i < count)
+    {
+        uint16_t t[8] = { 0 };
+        memcpy(t, src + i, (count - i) * sizeof(uint16_t));
+        const uint16x8_t v = vld1q_u16(t);
+        acc_lo = vaddq_f32(acc_lo, MN_BF16_WIDEN_LO(v));
+        acc_hi = vaddq_f32(acc_hi, MN_BF16_WIDEN_HI(v));
+    }
+    *dst = mn_hsumq_f32(vaddq_f32(acc_lo, acc_hi));
+    return MN_SUCCESS;
+}
+
+#if defined(MN_BF16_NATIVE)
+#define MN_BF16_DOT_BLOCK(acc_lo, acc_hi, va, vb) \
+    (acc_lo) = vbfdotq_f32((acc_lo), vreinterpretq_bf16_u16(va), vreinterpretq_bf16_u16(vb))
+#else
+#define MN_BF16_DOT_BLOCK(acc_lo, acc_hi, va, vb) do { \
+        (acc_lo) = MN_FMAQ_F32((acc_lo), MN_BF16_WIDEN_LO(va), MN_BF16_WIDEN_LO(vb)); \
+        (acc_hi) = MN_FMAQ_F32((acc_hi), MN_BF16_WIDEN_HI(va), MN_BF16_WIDEN_HI(vb)); \
+    } while (0)
+#endif
+
+mn_result_t mn_dot_bfloat16_neon(mn_float32_t * dst, mn_bfloat16_t * src1, mn_bfloat16_t * src2, size_t count)
+{
+    float32x4_t acc_lo = vdupq_n_f32(0.0f);
+    float32x4_t acc_hi = vdupq_n_f32(0.0f);
+    size_t i = 0;
+    assert(dst && src1 && src2);
+    MN_PREFETCH_INIT;
+    for (; i + 8 <= count; i += 8)
+    {
+        const uint16x8_t va = vld1q_u16(src1 + i);
+        const uint16x8_t vb = vld1q_u16(src2 + i);
+        MN_PREFETCH_SRC(src1 + i);
+        MN_PREFETCH_SRC(src2 + i);
+        MN_BF16_DOT_BLOCK(acc_lo, acc_hi, va, vb);
+    }
+    if (i < count)
+    {
+        uint16_t ta[8] = { 0 }, tb[8] = { 0 };
+        memcpy(ta, src1 + i, (count - i) * sizeof(uint16_t));
+        memcpy(tb, src2 + i, (count - i) * sizeof(uint16_t));
+        const uint16x8_t va = vld1q_u16(ta);
+        const uint16x8_t vb = vld1q_u16(tb);
+        MN_BF16_DOT_BLOCK(acc_lo, acc_hi, va, vb);
+    }
+    *dst = mn_hsumq_f32(vaddq_f32(acc_lo, acc_hi));
+    return MN_SUCCESS;
+}
@@ -0,0 +1,39 @@
+#ifndef MN_BF16_NEON_H
+#define MN_BF16_NEON_H
+
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include <arm_neon.h>
+
+/*
+bfloat16 widening / narrowing helpers shared by the bfloat16 and conversion
+NEON kernels. Not part of the public headers.
+*/
+
+#define MN_BF16_WIDEN_LO(v) vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(v), 16))
+#define MN_BF16_WIDEN_HI(v) vreinterpretq_f32_u32(vshll_n_u16(vget_high_u16(v), 16))
+
+#if defined(MN_BF16_NATIVE)
+static inline uint16x8_t mn_bf16_narrow (float32x4_t lo, float32x4_t hi)
+{
+    return vreinterpretq_u16_bf16(vcvtq_high_bf16_f32(vcvtq_low_bf16_f32(lo), hi));
+}
+#else
+/* Round to nearest even on the raw bits: add 0x7fff plus the lowest kept bit,
+ * then keep the upper half. NaNs skip the bias and get the quiet bit set. */
+static inline uint16x4_t mn_bf16_narrow4 (float32x4_t f)
+{
+    const uint32x4_t bits = vreinterpretq_u32_f32(f);
+    const uint32x4_t lsb = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+    const uint32x4_t rounded = vaddq_u32(bits, vaddq_u32(lsb, vdupq_n_u32(0x7fff)));
+    const uint32x4_t is_nan = vmvnq_u32(vceqq_f32(f, f));
+    return vshrn_n_u32(vbslq_u32(is_nan, vorrq_u32(bits, vdupq_n_u32(0x00400000)), rounded), 16);
+}
+
+static inline uint16x8_t mn_bf16_narrow (float32x4_t lo, float32x4_t hi)
+{
+    return vcombine_u16(mn_bf16_narrow4(lo), mn_bf16_narrow4(hi));
+}
+#endif
+
+#endif // MN_BF16_NEON_H
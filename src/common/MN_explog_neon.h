@@ -0,0 +1,233 @@
+#ifndef MN_EXPLOG_NEON_H
+#define MN_EXPLOG_NEON_H
+
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include <arm_neon.h>
+
+/*
+exp / exp2 / log / log2 on float32x4_t, shared by the transcendental kernels
+and the other NEON routines that need them. Not part of the public headers.
+
+exp2: x = n + f with n = round(x), |f| <= 1/2, 2^f = 1 + f * Q(f)
+exp:  x = n ln2 + r (ln2 split in two for an exact product), |r| <= ln2 / 2,
+      e^r = 1 + r + r^2 * P(r)
+log:  x = 2^e * (1 + r) with 1 + r in [2/3, 4/3),
+      log(x) = e ln2 + r + r^2 * P(r), log2(x) = e + r + r * Q(r)
+
+The polynomials are minimax fits of the relative error on those ranges, one
+set per accuracy tier (MN_ACCURACY_*). The ultra exp runs the ultra exp2
+on x * log2(e).
+
+exp / exp2 handle every input in the vector code: large inputs give +inf,
+small ones go through the subnormals to +0 and NaN stays NaN. The log
+helpers only cover positive normal inputs; mn_explog_log_special() flags
+the other lanes (zero, subnormal, negative, inf, NaN) for the caller to
+finish with libm.
+*/
+
+#define MN_EXPLOG_SHIFT   12582912.0f        /* 1.5 * 2^23, x + SHIFT rounds x to an integer in the low mantissa bits */
+#define MN_EXPLOG_LOG2E   1.44269504088896341f
+#define MN_EXPLOG_LN2_HI  0.693359375f       /* 9 significant bits, n * LN2_HI is exact */
+#define MN_EXPLOG_LN2_LO  -2.12194440e-4f
+#define MN_EXPLOG_EXP_LO  -104.0f            /* exp(-104) rounds to +0 */
+#define MN_EXPLOG_EXP_HI  89.0f              /* exp(89) overflows to +inf */
+#define MN_EXPLOG_EXP2_LO -151.0f
+#define MN_EXPLOG_EXP2_HI 129.0f
+
+/* e^r = 1 + r + r^2 * P(r) */
+static const mn_float32_t mn_explog_c_exp[ 5 ] = {
+    4.999999404e-01f, 1.666652113e-01f, 4.166838899e-02f, 8.368710056e-03f, 1.381461276e-03f };
+static const mn_float32_t mn_explog_c_exp_fast[ 4 ] = {
+    4.999923110e-01f, 1.666711420e-01f, 4.189011455e-02f, 8.312525228e-03f };
+
+/* 2^f = 1 + f * Q(f) */
+static const mn_float32_t mn_explog_c_exp2[ 6 ] = {
+    6.931471825e-01f, 2.402264774e-01f, 5.550332367e-02f, 9.618436918e-03f, 1.339887385e-03f, 1.535336196e-04f };
+static const mn_float32_t mn_explog_c_exp2_fast[ 5 ] = {
+    6.931470037e-01f, 2.402224243e-01f, 5.550733581e-02f, 9.671512991e-03f, 1.326472731e-03f };
+static const mn_float32_t mn_explog_c_exp2_ultra[ 3 ] = {
+    6.932829022e-01f, 2.422109544e-01f, 5.500893295e-02f };
+
+/* log(1 + r) = r + r^2 * P(r) */
+static const mn_float32_t mn_explog_c_log[ 9 ] = {
+    -5.000000000e-01f, 3.333320916e-01f, -2.499971688e-01f, 2.001074702e-01f, -1.668230593e-01f,
+    1.400116086e-01f, -1.216715425e-01f, 1.400475651e-01f, -1.294896603e-01f };
+static const mn_float32_t mn_explog_c_log_fast[ 7 ] = {
+    -4.999996126e-01f, 3.333673477e-01f, -2.500632405e-01f, 1.981817037e-01f, -1.644081026e-01f,
+    1.699055135e-01f, -1.526681185e-01f };
+static const mn_float32_t mn_explog_c_log_ultra[ 3 ] = {
+    -4.996150732e-01f, 3.531205952e-01f, -2.714513838e-01f };
+
+/* log2(1 + r) = r + r * Q(r) */
+static const mn_float32_t mn_explog_c_log2[ 10 ] = {
+    4.426950514e-01f, -7.213475704e-01f, 4.808958173e-01f, -3.606687784e-01f, 2.887183130e-01f,
+    -2.406998128e-01f, 2.016986609e-01f, -1.752623171e-01f, 2.032387257e-01f, -1.878333241e-01f };
+static const mn_float32_t mn_explog_c_log2_fast[ 8 ] = {
+    4.426948130e-01f, -7.213466167e-01f, 4.809654951e-01f, -3.607837260e-01f, 2.855820358e-01f,
+    -2.368917763e-01f, 2.468621731e-01f, -2.216800898e-01f };
+static const mn_float32_t mn_explog_c_log2_ultra[ 4 ] = {
+    4.422020614e-01f, -7.204248905e-01f, 5.155380964e-01f, -3.957717121e-01f };
+
+/* c[0] + x * (c[1] + x * (... + x * c[n - 1])), unrolled once inlined */
+static inline float32x4_t mn_explog_poly (float32x4_t x, const mn_float32_t * c, int n)
+{
+    float32x4_t p = vdupq_n_f32(c[ n - 1 ]);
+    for ( int i = n - 2; i >= 0; i-- )
+    {
+        p = MN_FMAQ_F32(vdupq_n_f32(c[ i ]), p, x);
+    }
+    return p;
+}
+
+/* p * 2^n for n in [-151, 129], in two steps so that both factors are normal */
+static inline float32x4_t mn_explog_ldexp (float32x4_t p, int32x4_t n)
+{
+    const int32x4_t n1 = vshrq_n_s32(n, 1);
+    const int32x4_t n2 = vsubq_s32(n, n1);
+    const float32x4_t s1 = vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(n1, vdupq_n_s32(127)), 23));
+    const float32x4_t s2 = vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(n2, vdupq_n_s32(127)), 23));
+    return vmulq_f32(vmulq_f32(p, s1), s2);
+}
+
+/* NaN lanes of x pass through (vmaxq / vminq already keep them on NEON, this makes it explicit) */
+static inline float32x4_t mn_explog_keep_nan (float32x4_t res, float32x4_t x)
+{
+    return vbslq_f32(vceqq_f32(x, x), res, x);
+}
+
+/* 2^x, Q is the tier's 2^f polynomial */
+static inline float32x4_t mn_explog_exp2_q (float32x4_t x, const mn_float32_t * q, int nq)
+{
+    const float32x4_t shift = vdupq_n_f32(MN_EXPLOG_SHIFT);
+    const float32x4_t xc = vminq_f32(vmaxq_f32(x, vdupq_n_f32(MN_EXPLOG_EXP2_LO)), vdupq_n_f32(MN_EXPLOG_EXP2_HI));
+    const float32x4_t z = vaddq_f32(xc, shift);
+    const int32x4_t n = vsubq_s32(vreinterpretq_s32_f32(z), vreinterpretq_s32_f32(shift));
+    const float32x4_t f = vsubq_f32(xc, vsubq_f32(z, shift));
+    const float32x4_t p = MN_FMAQ_F32(vdupq_n_f32(1.0f), f, mn_explog_poly(f, q, nq));
+    return mn_explog_keep_nan(mn_explog_ldexp(p, n), x);
+}
+
+static inline float32x4_t mn_explog_exp2 (float32x4_t x)
+{
+    return mn_explog_exp2_q(x, mn_explog_c_exp2, 6);
+}
+
+static inline float32x4_t mn_explog_exp2_fast (float32x4_t x)
+{
+    return mn_explog_exp2_q(x, mn_explog_c_exp2_fast, 5);
+}
+
+static inline float32x4_t mn_explog_exp2_ultra (float32x4_t x)
+{
+    return mn_explog_exp2_q(x, mn_explog_c_exp2_ultra, 3);
+}
+
+/* e^x, P is the tier's e^r polynomial */
+static inline float32x4_t mn_explog_exp_p (float32x4_t x, const mn_float32_t * p, int np)
+{
+    const float32x4_t shift = vdupq_n_f32(MN_EXPLOG_SHIFT);
+    const float32x4_t xc = vminq_f32(vmaxq_f32(x, vdupq_n_f32(MN_EXPLOG_EXP_LO)), vdupq_n_f32(MN_EXPLOG_EXP_HI));
+    const float32x4_t z = MN_FMAQ_F32(shift, xc, vdupq_n_f32(MN_EXPLOG_LOG2E));
+    const int32x4_t n = vsubq_s32(vreinterpretq_s32_f32(z), vreinterpretq_s32_f32(shift));
+    const float32x4_t k = vsubq_f32(z, shift);
+    float32x4_t r = MN_FMAQ_F32(xc, k, vdupq_n_f32(-MN_EXPLOG_LN2_HI));
+    r = MN_FMAQ_F32(r, k, vdupq_n_f32(-MN_EXPLOG_LN2_LO));
+    const float32x4_t r2 = vmulq_f32(r, r);
+    const float32x4_t e = vaddq_f32(vdupq_n_f32(1.0f), MN_FMAQ_F32(r, r2, mn_explog_poly(r, p, np)));
+    return mn_explog_keep_nan(mn_explog_ldexp(e, n), x);
+}
+
+static inline float32x4_t mn_explog_exp (float32x4_t x)
+{
+    return mn_explog_exp_p(x, mn_explog_c_exp, 5);
+}
+
+static inline float32x4_t mn_explog_exp_fast (float32x4_t x)
+{
+    return mn_explog_exp_p(x, mn_explog_c_exp_fast, 4);
+}
+
+static inline float32x4_t mn_explog_exp_ultra (float32x4_t x)
+{
+    const float32x4_t xc = vminq_f32(vmaxq_f32(x, vdupq_n_f32(MN_EXPLOG_EXP_LO)), vdupq_n_f32(MN_EXPLOG_EXP_HI));
+    return mn_explog_keep_nan(mn_explog_exp2_ultra(vmulq_f32(xc, vdupq_n_f32(MN_EXPLOG_LOG2E))), x);
+}
+
+/* All ones in the lanes the log helpers do not cover: x <= 0, subnormal, inf, NaN */
+static inline uint32x4_t mn_explog_log_special (float32x4_t x)
+{
+    const uint32x4_t u = vreinterpretq_u32_f32(x);
+    return vcgeq_u32(vsubq_u32(u, vdupq_n_u32(0x00800000)), vdupq_n_u32(0x7f000000));
+}
+
+/* x = 2^e * (1 + r) with 1 + r in [2/3, 4/3), for positive normal x */
+static inline float32x4_t mn_explog_log_reduce (float32x4_t x, float32x4_t * e)
+{
+    const int32x4_t u = vreinterpretq_s32_f32(x);
+    const int32x4_t ei = vshrq_n_s32(vsubq_s32(u, vdupq_n_s32(0x3f2aaaab)), 23);
+    const float32x4_t m = vreinterpretq_f32_s32(vsubq_s32(u, vshlq_n_s32(ei, 23)));
+    *e = vcvtq_f32_s32(ei);
+    return vsubq_f32(m, vdupq_n_f32(1.0f));
+}
+
+static inline float32x4_t mn_explog_log_p (float32x4_t x, const mn_float32_t * p, int np)
+{
+    float32x4_t e;
+    const float32x4_t r = mn_explog_log_reduce(x, &e);
+    const float32x4_t l = MN_FMAQ_F32(r, vmulq_f32(r, r), mn_explog_poly(r, p, np));
+    return MN_FMAQ_F32(MN_FMAQ_F32(l, e, vdupq_n_f32(MN_EXPLOG_LN2_LO)), e, vdupq_n_f32(MN_EXPLOG_LN2_HI));
+}
+
+static inline float32x4_t mn_explog_log (float32x4_t x)
+{
+    return mn_explog_log_p(x, mn_explog_c_log, 9);
+}
+
+static inline float32x4_t mn_explog_log_fast (float32x4_t x)
+{
+    return mn_explog_log_p(x, mn_explog_c_log_fast, 7);
+}
+
+static inline float32x4_t mn_explog_log_ultra (float32x4_t x)
+{
+    return mn_explog_log_p(x, mn_explog_c_log_ultra, 3);
+}
+
+static inline float32x4_t mn_explog_log2_q (float32x4_t x, const mn_float32_t * q, int nq)
+{
+    float32x4_t e;
+    const float32x4_t r = mn_explog_log_reduce(x, &e);
+    /* e + r as hi + lo (|e| >= 1 > |r| or e = 0), so the cancellation above 4/3 stays exact */
+    const float32x4_t hi = vaddq_f32(e, r);
+    const float32x4_t lo = vsubq_f32(r, vsubq_f32(hi, e));
+    return vaddq_f32(hi, MN_FMAQ_F32(lo, r, mn_explog_poly(r, q, nq)));
+}
+
+static inline float32x4_t mn_explog_log2 (float32x4_t x)
+{
+    return mn_explog_log2_q(x, mn_explog_c_log2, 10);
+}
+
+static inline float32x4_t mn_explog_log2_fast (float32x4_t x)
+{
+    return mn_explog_log2_q(x, mn_explog_c_log2_fast, 8);
+}
+
+static inline float32x4_t mn_explog_log2_ultra (float32x4_t x)
+{
+    return mn_explog_log2_q(x, mn_explog_c_log2_ultra, 4);
+}
+
+/* Non-zero if any lane of the mask is set */
+static inline uint32_t mn_explog_any (uint32x4_t mask)
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+    return vmaxvq_u32(mask);
+#else
+    const uint32x2_t m = vorr_u32(vget_low_u32(mask), vget_high_u32(mask));
+    return vget_lane_u32(vpmax_u32(m, m), 0);
+#endif
+}
+
+#endif // MN_EXPLOG_NEON_H
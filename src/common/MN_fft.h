@@ -0,0 +1,229 @@
+#ifndef MN_FFT_H
+#define MN_FFT_H
+
+#include "MN_dtype.h"
+#include <string.h>
+
+/*
+FFT pieces shared by the C and NEON transforms. Not part of the public
+headers.
+
+The complex transform is a mixed-radix Stockham FFT: every stage reads one
+buffer and writes the other, so no bit reversal is needed. A stage of radix
+p on a sub-transform size ns (the product of the earlier radices) computes,
+for j < m = nc / p and k = j % ns,
+    a[r] = in[j + r * m] * tw[(r - 1) * ns + k],  r = 0 .. p - 1 (no twiddle for r = 0)
+    out[(j - k) * p + k + r * ns] = DFT_p(a)[r]
+with tw[(r - 1) * ns + k] = exp(-2 pi i r k / (ns * p)). The inverse uses the
+conjugate twiddles and stores DFT_p(a)[(p - r) % p] instead of [r].
+
+A real transform of n = 2 * nc samples runs the complex transform on the
+samples read as nc complex values z[k] = x[2k] + i x[2k + 1] and then
+separates the even / odd halves (mn_fft_real_post_c, mn_fft_real_pre_c).
+*/
+
+#define MN_FFT_MAX_RADIX 5
+
+#define MN_FFT_PI 3.14159265358979323846
+
+/* cos / sin of 2 pi / 3, 2 pi / 5 and 4 pi / 5 */
+#define MN_FFT_S3  0.86602540378443864676f
+#define MN_FFT_C51 0.30901699437494742410f
+#define MN_FFT_C52 -0.80901699437494742410f
+#define MN_FFT_S51 0.95105651629515357212f
+#define MN_FFT_S52 0.58778525229247312917f
+
+static inline mn_complexf_t mn_fft_mul_c (mn_complexf_t a, mn_complexf_t b)
+{
+    mn_complexf_t r;
+    r.re = a.re * b.re - a.im * b.im;
+    r.im = a.re * b.im + a.im * b.re;
+    return r;
+}
+
+/* Forward DFT of a[0 .. p - 1] in place, p in 2, 3, 4, 5 */
+static inline void mn_fft_butterfly_c (mn_complexf_t * a, size_t p)
+{
+    mn_complexf_t t1, t2, d1, d2, m1, m2;
+
+    switch (p)
+    {
+    case 2:
+        t1 = a[0];
+        a[0].re = t1.re + a[1].re; a[0].im = t1.im + a[1].im;
+        a[1].re = t1.re - a[1].re; a[1].im = t1.im - a[1].im;
+        break;
+    case 3:
+        /* y1 / y2 = a0 - t / 2 -/+ i s3 d */
+        t1.re = a[1].re + a[2].re; t1.im = a[1].im + a[2].im;
+        d1.re = a[1].re - a[2].re; d1.im = a[1].im - a[2].im;
+        m1.re = a[0].re - 0.5f * t1.re; m1.im = a[0].im - 0.5f * t1.im;
+        a[0].re += t1.re; a[0].im += t1.im;
+        a[1].re = m1.re + MN_FFT_S3 * d1.im; a[1].im = m1.im - MN_FFT_S3 * d1.re;
+        a[2].re = m1.re - MN_FFT_S3 * d1.im; a[2].im = m1.im + MN_FFT_S3 * d1.re;
+        break;
+    case 4:
+        t1.re = a[0].re + a[2].re; t1.im = a[0].im + a[2].im;
+        d1.re = a[0].re - a[2].re; d1.im = a[0].im - a[2].im;
+        t2.re = a[1].re + a[3].re; t2.im = a[1].im + a[3].im;
+        d2.re = a[1].re - a[3].re; d2.im = a[1].im - a[3].im;
+        a[0].re = t1.re + t2.re; a[0].im = t1.im + t2.im;
+        a[2].re = t1.re - t2.re; a[2].im = t1.im - t2.im;
+        a[1].re = d1.re + d2.im; a[1].im = d1.im - d2.re;   /* d1 - i d2 */
+        a[3].re = d1.re - d2.im; a[3].im = d1.im + d2.re;   /* d1 + i d2 */
+        break;
+    case 5:
+        t1.re = a[1].re + a[4].re; t1.im = a[1].im + a[4].im;
+        d1.re = a[1].re - a[4].re; d1.im = a[1].im - a[4].im;
+        t2.re = a[2].re + a[3].re; t2.im = a[2].im + a[3].im;
+        d2.re = a[2].re - a[3].re; d2.im = a[2].im - a[3].im;
+        m1.re = a[0].re + MN_FFT_C51 * t1.re + MN_FFT_C52 * t2.re;
+        m1.im = a[0].im + MN_FFT_C51 * t1.im + MN_FFT_C52 * t2.im;
+        m2.re = a[0].re + MN_FFT_C52 * t1.re + MN_FFT_C51 * t2.re;
+        m2.im = a[0].im + MN_FFT_C52 * t1.im + MN_FFT_C51 * t2.im;
+        a[0].re += t1.re + t2.re; a[0].im += t1.im + t2.im;
+        /* t1 / t2 now hold the sine parts: s51 d1 + s52 d2 and s52 d1 - s51 d2 */
+        t1.re = MN_FFT_S51 * d1.re + MN_FFT_S52 * d2.re; t1.im = MN_FFT_S51 * d1.im + MN_FFT_S52 * d2.im;
+        t2.re = MN_FFT_S52 * d1.re - MN_FFT_S51 * d2.re; t2.im = MN_FFT_S52 * d1.im - MN_FFT_S51 * d2.im;
+        a[1].re = m1.re + t1.im; a[1].im = m1.im - t1.re;
+        a[4].re = m1.re - t1.im; a[4].im = m1.im + t1.re;
+        a[2].re = m2.re + t2.im; a[2].im = m2.im - t2.re;
+        a[3].re = m2.re - t2.im; a[3].im = m2.im + t2.re;
+        break;
+    default:
+        break;
+    }
+}
+
+/* One Stockham stage for j in [j0, nc / p), see above */
+static inline void mn_fft_stage_c (mn_complexf_t * out, const mn_complexf_t * in, size_t nc, size_t p, size_t ns,
+                                   const mn_complexf_t * tw, int inverse, size_t j0)
+{
+    const size_t m = nc / p;
+    mn_complexf_t a[ MN_FFT_MAX_RADIX ];
+
+    for ( size_t j = j0; j < m; j++ )
+    {
+        const size_t k = j % ns;
+        mn_complexf_t * o = out + (j - k) * p + k;
+
+        a[ 0 ] = in[ j ];
+        for ( size_t r = 1; r < p; r++ )
+        {
+            a[ r ] = mn_fft_mul_c(in[ j + r * m ], tw[ (r - 1) * ns + k ]);
+        }
+        mn_fft_butterfly_c(a, p);
+        for ( size_t r = 0; r < p; r++ )
+        {
+            o[ r * ns ] = a[ inverse ? (p - r) % p : r ];
+        }
+    }
+}
+
+/*
+Real forward, k in [k0, k1) with 0 < k < nc:
+    A = Z[k], B = conj(Z[nc - k])
+    X[k] = (A + B) / 2 + W^k * (-i (A - B) / 2),  W = exp(-2 pi i / n)
+*/
+static inline void mn_fft_real_post_c (mn_complexf_t * dst, const mn_complexf_t * z, const mn_complexf_t * w,
+                                       size_t nc, size_t k0, size_t k1)
+{
+    for ( size_t k = k0; k < k1; k++ )
+    {
+        const mn_complexf_t a = z[ k ], b = z[ nc - k ];
+        mn_complexf_t fe, fo;
+        fe.re = 0.5f * (a.re + b.re);
+        fe.im = 0.5f * (a.im - b.im);
+        fo.re = 0.5f * (a.im + b.im);
+        fo.im = -0.5f * (a.re - b.re);
+        fo = mn_fft_mul_c(fo, w[ k ]);
+        dst[ k ].re = fe.re + fo.re;
+        dst[ k ].im = fe.im + fo.im;
+    }
+}
+
+/*
+Real inverse, k in [k0, k1) with 0 <= k < nc:
+    A = X[k], B = conj(X[nc - k])
+    Z[k] = (A + B) / 2 + i conj(W^k) (A - B) / 2
+*/
+static inline void mn_fft_real_pre_c (mn_complexf_t * z, const mn_complexf_t * src, const mn_complexf_t * w,
+                                      size_t nc, size_t k0, size_t k1)
+{
+    for ( size_t k = k0; k < k1; k++ )
+    {
+        const mn_complexf_t a = src[ k ], b = src[ nc - k ];
+        mn_complexf_t fe, fo, wc;
+        fe.re = 0.5f * (a.re + b.re);
+        fe.im = 0.5f * (a.im - b.im);
+        fo.re = 0.5f * (a.re - b.re);
+        fo.im = 0.5f * (a.im + b.im);
+        wc.re = w[ k ].re;
+        wc.im = -w[ k ].im;
+        fo = mn_fft_mul_c(fo, wc);
+        z[ k ].re = fe.re - fo.im;
+        z[ k ].im = fe.im + fo.re;
+    }
+}
+
+/*
+Generates the transform drivers around a stage, a scale and the two real
+helpers:
+    STAGE(out, in, nc, p, ns, tw, inverse)
+    SCALE(float * dst, float * src, float factor, size_t count)
+    REAL_POST(dst, z, w, nc) - X[k] for 0 < k < nc
+    REAL_PRE(z, src, w, nc)  - Z[k] for 0 <= k < nc
+*/
+#define MN_FFT_DEFINE_RUN(prefix, STAGE, SCALE, REAL_POST, REAL_PRE) \
+static void prefix##_complex (const mn_fft_plan_t * plan, mn_complexf_t * dst, const mn_complexf_t * src, int inverse) \
+{ \
+    const size_t nc = plan->nc; \
+    const size_t stages = plan->num_factors; \
+    const mn_complexf_t * tw = inverse ? plan->itwiddles : plan->twiddles; \
+    const mn_complexf_t * in = src; \
+    size_t ns = 1; \
+    if (stages == 0) \
+    { \
+        memmove(dst, src, nc * sizeof(mn_complexf_t)); \
+        return; \
+    } \
+    /* the last stage must write dst; Stockham stages cannot run in place */ \
+    if (src == dst && stages % 2 == 1) \
+    { \
+        memcpy(plan->buffer + nc, src, nc * sizeof(mn_complexf_t)); \
+        in = plan->buffer + nc; \
+    } \
+    for ( size_t s = 0; s < stages; s++ ) \
+    { \
+        const size_t p = plan->factors[ s ]; \
+        mn_complexf_t * out = (stages - 1 - s) % 2 == 0 ? dst : plan->buffer; \
+        STAGE(out, in, nc, p, ns, tw, inverse); \
+        tw += (p - 1) * ns; \
+        ns *= p; \
+        in = out; \
+    } \
+    if (inverse) \
+    { \
+        SCALE((mn_float32_t *)dst, (mn_float32_t *)dst, 1.0f / (mn_float32_t)nc, 2 * nc); \
+    } \
+} \
+static void prefix##_real_forward (const mn_fft_plan_t * plan, mn_complexf_t * dst, const mn_float32_t * src) \
+{ \
+    const size_t nc = plan->nc; \
+    mn_complexf_t * z = plan->buffer + 2 * nc; \
+    prefix##_complex(plan, z, (const mn_complexf_t *)src, 0); \
+    dst[ 0 ].re = z[ 0 ].re + z[ 0 ].im; \
+    dst[ 0 ].im = 0.0f; \
+    dst[ nc ].re = z[ 0 ].re - z[ 0 ].im; \
+    dst[ nc ].im = 0.0f; \
+    REAL_POST(dst, z, plan->rtwiddles, nc); \
+} \
+static void prefix##_real_inverse (const mn_fft_plan_t * plan, mn_float32_t * dst, const mn_complexf_t * src) \
+{ \
+    const size_t nc = plan->nc; \
+    mn_complexf_t * z = plan->buffer + 2 * nc; \
+    REAL_PRE(z, src, plan->rtwiddles, nc); \
+    prefix##_complex(plan, (mn_complexf_t *)dst, z, 1); \
+}
+
+#endif // MN_FFT_H
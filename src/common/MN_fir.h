@@ -0,0 +1,53 @@
+#ifndef MN_FIR_H
+#define MN_FIR_H
+
+#include "MN_dtype.h"
+#include <string.h>
+
+/*
+Streaming FIR driver shared by the C and NEON filters. Not part of the public
+headers.
+
+A kernel computes nout outputs of a valid-mode convolution:
+    dst[m] = sum_{j < taps} h[taps - 1 - j] * x[m * step + j]
+
+The driver splits one call into
+    1. outputs whose window still reaches into the delay line: the delay line
+       and the first num_taps - 1 new inputs are contiguous in fir->state, the
+       kernel runs on that copy;
+    2. all other outputs: the kernel runs directly on src.
+and then keeps the last num_taps - 1 inputs as the new delay line.
+Decimation D keeps full rate output n = m * D + D - 1, so count must be a
+multiple of D and the phase is the same at the start of every call.
+*/
+
+#define MN_FIR_DEFINE_RUN(name, FIR_T, T, KERNEL) \
+static mn_result_t name (FIR_T * fir, T * dst, T * src, size_t count) \
+{ \
+    const size_t hist = fir->num_taps - 1; \
+    const size_t dec = fir->decimation; \
+    const size_t head = count < hist ? count : hist; \
+    size_t first; \
+    if (!fir->state || !dst || !src || count % dec != 0) \
+    { \
+        return MN_ERROR; \
+    } \
+    memcpy(fir->state + hist, src, head * sizeof(T)); \
+    first = head / dec; \
+    KERNEL(dst, fir->state + dec - 1, first, fir->coeffs, fir->num_taps, dec); \
+    if (count / dec > first) \
+    { \
+        KERNEL(dst + first, src + first * dec + dec - 1 - hist, count / dec - first, fir->coeffs, fir->num_taps, dec); \
+    } \
+    if (count >= hist) \
+    { \
+        memcpy(fir->state, src + count - hist, hist * sizeof(T)); \
+    } \
+    else \
+    { \
+        memmove(fir->state, fir->state + count, hist * sizeof(T)); \
+    } \
+    return MN_SUCCESS; \
+}
+
+#endif // MN_FIR_H
@@ -0,0 +1,98 @@
+#ifndef MN_MAT_FORMULA_H
+#define MN_MAT_FORMULA_H
+
+/*
+Determinant and adjugate formulas shared by the C and NEON matrix kernels, so
+both implementations evaluate the same products in the same order. Not part
+of the public headers.
+
+Before use, define for the element type (mn_float32_t in C, float32x4_t
+holding one element of four matrices in NEON):
+    MN_MAT_MUL(a, b), MN_MAT_ADD(a, b), MN_MAT_SUB(a, b), MN_MAT_NEG(a)
+
+a[] and b[] are column major: element (row r, column c) of an NxN matrix is
+a[c * N + r]. The source array must be named a. The adjugate macros write
+adj(a) to b[] (inverse = b / det) and the determinant to det.
+*/
+
+#define MN_MAT_A2(r, c) a[(c) * 2 + (r)]
+#define MN_MAT_A3(r, c) a[(c) * 3 + (r)]
+#define MN_MAT_A4(r, c) a[(c) * 4 + (r)]
+
+/* p * q - s * t: one 2x2 minor */
+#define MN_MAT_MINOR(p, q, s, t) MN_MAT_SUB(MN_MAT_MUL(p, q), MN_MAT_MUL(s, t))
+
+#define MN_MAT2_DET(a) MN_MAT_MINOR(MN_MAT_A2(0, 0), MN_MAT_A2(1, 1), MN_MAT_A2(0, 1), MN_MAT_A2(1, 0))
+
+#define MN_MAT2_ADJ(a, b, det) \
+    do { \
+        det = MN_MAT2_DET(a); \
+        b[0] = MN_MAT_A2(1, 1); \
+        b[1] = MN_MAT_NEG(MN_MAT_A2(1, 0)); \
+        b[2] = MN_MAT_NEG(MN_MAT_A2(0, 1)); \
+        b[3] = MN_MAT_A2(0, 0); \
+    } while (0)
+
+/* b[] receives the cofactors transposed: b(r, c) = cofactor(c, r) */
+#define MN_MAT3_ADJ(a, b, det) \
+    do { \
+        b[0] = MN_MAT_MINOR(MN_MAT_A3(1, 1), MN_MAT_A3(2, 2), MN_MAT_A3(1, 2), MN_MAT_A3(2, 1)); \
+        b[1] = MN_MAT_MINOR(MN_MAT_A3(1, 2), MN_MAT_A3(2, 0), MN_MAT_A3(1, 0), MN_MAT_A3(2, 2)); \
+        b[2] = MN_MAT_MINOR(MN_MAT_A3(1, 0), MN_MAT_A3(2, 1), MN_MAT_A3(1, 1), MN_MAT_A3(2, 0)); \
+        b[3] = MN_MAT_MINOR(MN_MAT_A3(0, 2), MN_MAT_A3(2, 1), MN_MAT_A3(0, 1), MN_MAT_A3(2, 2)); \
+        b[4] = MN_MAT_MINOR(MN_MAT_A3(0, 0), MN_MAT_A3(2, 2), MN_MAT_A3(0, 2), MN_MAT_A3(2, 0)); \
+        b[5] = MN_MAT_MINOR(MN_MAT_A3(0, 1), MN_MAT_A3(2, 0), MN_MAT_A3(0, 0), MN_MAT_A3(2, 1)); \
+        b[6] = MN_MAT_MINOR(MN_MAT_A3(0, 1), MN_MAT_A3(1, 2), MN_MAT_A3(0, 2), MN_MAT_A3(1, 1)); \
+        b[7] = MN_MAT_MINOR(MN_MAT_A3(0, 2), MN_MAT_A3(1, 0), MN_MAT_A3(0, 0), MN_MAT_A3(1, 2)); \
+        b[8] = MN_MAT_MINOR(MN_MAT_A3(0, 0), MN_MAT_A3(1, 1), MN_MAT_A3(0, 1), MN_MAT_A3(1, 0)); \
+        det = MN_MAT_ADD(MN_MAT_ADD(MN_MAT_MUL(MN_MAT_A3(0, 0), b[0]), MN_MAT_MUL(MN_MAT_A3(0, 1), b[1])), \
+                         MN_MAT_MUL(MN_MAT_A3(0, 2), b[2])); \
+    } while (0)
+
+/* Minors of rows 0-1 (s0-s5) and rows 2-3 (c0-c5), then Laplace expansion */
+#define MN_MAT4_MINORS(a, s, c) \
+    do { \
+        s[0] = MN_MAT_MINOR(MN_MAT_A4(0, 0), MN_MAT_A4(1, 1), MN_MAT_A4(1, 0), MN_MAT_A4(0, 1)); \
+        s[1] = MN_MAT_MINOR(MN_MAT_A4(0, 0), MN_MAT_A4(1, 2), MN_MAT_A4(1, 0), MN_MAT_A4(0, 2)); \
+        s[2] = MN_MAT_MINOR(MN_MAT_A4(0, 0), MN_MAT_A4(1, 3), MN_MAT_A4(1, 0), MN_MAT_A4(0, 3)); \
+        s[3] = MN_MAT_MINOR(MN_MAT_A4(0, 1), MN_MAT_A4(1, 2), MN_MAT_A4(1, 1), MN_MAT_A4(0, 2)); \
+        s[4] = MN_MAT_MINOR(MN_MAT_A4(0, 1), MN_MAT_A4(1, 3), MN_MAT_A4(1, 1), MN_MAT_A4(0, 3)); \
+        s[5] = MN_MAT_MINOR(MN_MAT_A4(0, 2), MN_MAT_A4(1, 3), MN_MAT_A4(1, 2), MN_MAT_A4(0, 3)); \
+        c[5] = MN_MAT_MINOR(MN_MAT_A4(2, 2), MN_MAT_A4(3, 3), MN_MAT_A4(3, 2), MN_MAT_A4(2, 3)); \
+        c[4] = MN_MAT_MINOR(MN_MAT_A4(2, 1), MN_MAT_A4(3, 3), MN_MAT_A4(3, 1), MN_MAT_A4(2, 3)); \
+        c[3] = MN_MAT_MINOR(MN_MAT_A4(2, 1), MN_MAT_A4(3, 2), MN_MAT_A4(3, 1), MN_MAT_A4(2, 2)); \
+        c[2] = MN_MAT_MINOR(MN_MAT_A4(2, 0), MN_MAT_A4(3, 3), MN_MAT_A4(3, 0), MN_MAT_A4(2, 3)); \
+        c[1] = MN_MAT_MINOR(MN_MAT_A4(2, 0), MN_MAT_A4(3, 2), MN_MAT_A4(3, 0), MN_MAT_A4(2, 2)); \
+        c[0] = MN_MAT_MINOR(MN_MAT_A4(2, 0), MN_MAT_A4(3, 1), MN_MAT_A4(3, 0), MN_MAT_A4(2, 1)); \
+    } while (0)
+
+#define MN_MAT4_DET_FROM_MINORS(s, c) \
+    MN_MAT_ADD(MN_MAT_ADD(MN_MAT_SUB(MN_MAT_MUL(s[0], c[5]), MN_MAT_MUL(s[1], c[4])), \
+                          MN_MAT_ADD(MN_MAT_MUL(s[2], c[3]), MN_MAT_MUL(s[3], c[2]))), \
+               MN_MAT_SUB(MN_MAT_MUL(s[5], c[0]), MN_MAT_MUL(s[4], c[1])))
+
+/* p * x - q * y + r * z */
+#define MN_MAT_TRIPLE(p, x, q, y, r, z) \
+    MN_MAT_ADD(MN_MAT_SUB(MN_MAT_MUL(p, x), MN_MAT_MUL(q, y)), MN_MAT_MUL(r, z))
+
+#define MN_MAT4_ADJ_FROM_MINORS(a, s, c, b) \
+    do { \
+        b[0]  = MN_MAT_TRIPLE(MN_MAT_A4(1, 1), c[5], MN_MAT_A4(1, 2), c[4], MN_MAT_A4(1, 3), c[3]); \
+        b[4]  = MN_MAT_NEG(MN_MAT_TRIPLE(MN_MAT_A4(0, 1), c[5], MN_MAT_A4(0, 2), c[4], MN_MAT_A4(0, 3), c[3])); \
+        b[8]  = MN_MAT_TRIPLE(MN_MAT_A4(3, 1), s[5], MN_MAT_A4(3, 2), s[4], MN_MAT_A4(3, 3), s[3]); \
+        b[12] = MN_MAT_NEG(MN_MAT_TRIPLE(MN_MAT_A4(2, 1), s[5], MN_MAT_A4(2, 2), s[4], MN_MAT_A4(2, 3), s[3])); \
+        b[1]  = MN_MAT_NEG(MN_MAT_TRIPLE(MN_MAT_A4(1, 0), c[5], MN_MAT_A4(1, 2), c[2], MN_MAT_A4(1, 3), c[1])); \
+        b[5]  = MN_MAT_TRIPLE(MN_MAT_A4(0, 0), c[5], MN_MAT_A4(0, 2), c[2], MN_MAT_A4(0, 3), c[1]); \
+        b[9]  = MN_MAT_NEG(MN_MAT_TRIPLE(MN_MAT_A4(3, 0), s[5], MN_MAT_A4(3, 2), s[2], MN_MAT_A4(3, 3), s[1])); \
+        b[13] = MN_MAT_TRIPLE(MN_MAT_A4(2, 0), s[5], MN_MAT_A4(2, 2), s[2], MN_MAT_A4(2, 3), s[1]); \
+        b[2]  = MN_MAT_TRIPLE(MN_MAT_A4(1, 0), c[4], MN_MAT_A4(1, 1), c[2], MN_MAT_A4(1, 3), c[0]); \
+        b[6]  = MN_MAT_NEG(MN_MAT_TRIPLE(MN_MAT_A4(0, 0), c[4], MN_MAT_A4(0, 1), c[2], MN_MAT_A4(0, 3), c[0])); \
+        b[10] = MN_MAT_TRIPLE(MN_MAT_A4(3, 0), s[4], MN_MAT_A4(3, 1), s[2], MN_MAT_A4(3, 3), s[0]); \
+        b[14] = MN_MAT_NEG(MN_MAT_TRIPLE(MN_MAT_A4(2, 0), s[4], MN_MAT_A4(2, 1), s[2], MN_MAT_A4(2, 3), s[0])); \
+        b[3]  = MN_MAT_NEG(MN_MAT_TRIPLE(MN_MAT_A4(1, 0), c[3], MN_MAT_A4(1, 1), c[1], MN_MAT_A4(1, 2), c[0])); \
+        b[7]  = MN_MAT_TRIPLE(MN_MAT_A4(0, 0), c[3], MN_MAT_A4(0, 1), c[1], MN_MAT_A4(0, 2), c[0]); \
+        b[11] = MN_MAT_NEG(MN_MAT_TRIPLE(MN_MAT_A4(3, 0), s[3], MN_MAT_A4(3, 1), s[1], MN_MAT_A4(3, 2), s[0])); \
+        b[15] = MN_MAT_TRIPLE(MN_MAT_A4(2, 0), s[3], MN_MAT_A4(2, 1), s[1], MN_MAT_A4(2, 2), s[0]); \
+    } while (0)
+
+#endif // MN_MAT_FORMULA_H
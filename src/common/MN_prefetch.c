@@ -0,0 +1,25 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+
+/*
+Software prefetch control for the NEON main loops.
+
+    mn_prefetch_distance - Number of bytes ahead of the current load that the
+                           MAINLOOP macros prefetch (see MN_factor.h).
+                           Starts at the build-time MN_PREFETCH_DISTANCE value.
+                           0 disables the prefetch.
+*/
+
+size_t mn_prefetch_distance = MN_PREFETCH_DISTANCE;
+
+mn_result_t mn_set_prefetch_distance (size_t distance)
+{
+    mn_prefetch_distance = distance;
+    return MN_SUCCESS;
+}
+
+size_t mn_get_prefetch_distance (void)
+{
+    return mn_prefetch_distance;
+}
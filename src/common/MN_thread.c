@@ -0,0 +1,156 @@
+#include "MN_thread.h"
+#include "MN_math.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+/*
+Thread helpers shared by the multi-threaded routines.
+
+    mn_thread_create - Starts fn(arg) on a new thread. The mn_thread_t must
+                       stay alive until mn_thread_join returns.
+    mn_thread_join   - Waits for the thread and releases it.
+    mn_thread_run    - Forks a batch of tasks over threads and joins them.
+
+    mn_threads - Threads the multi-threaded NEON routines (sgemm, scan,
+                 histogram) may use. 1 (the default) runs on the calling
+                 thread only, 0 uses one thread per online CPU.
+*/
+
+size_t mn_threads = 1;
+
+mn_result_t mn_set_threads (size_t threads)
+{
+    mn_threads = threads;
+    return MN_SUCCESS;
+}
+
+size_t mn_get_threads (void)
+{
+    return mn_threads;
+}
+
+size_t mn_thread_count (void)
+{
+    const size_t threads = mn_threads ? mn_threads : mn_cpu_count();
+    return threads < MN_THREAD_MAX ? threads : MN_THREAD_MAX;
+}
+
+mn_result_t mn_thread_run (mn_thread_fn fn, void * tasks, size_t size, size_t n)
+{
+    mn_thread_t workers[ MN_THREAD_MAX ];
+    int started[ MN_THREAD_MAX ];
+    char * base = (char *)tasks;
+    mn_result_t res = MN_SUCCESS;
+
+    for ( size_t t = 1; t < n; t++ )
+    {
+        started[ t ] = mn_thread_create(&workers[ t ], fn, base + t * size) == MN_SUCCESS;
+    }
+    if (n > 0)
+    {
+        fn(base);
+    }
+    for ( size_t t = 1; t < n; t++ )
+    {
+        if (started[ t ])
+        {
+            if (mn_thread_join(&workers[ t ]) != MN_SUCCESS) res = MN_ERROR;
+        }
+        else
+        {
+            fn(base + t * size);
+        }
+    }
+    return res;
+}
+
+#ifdef _WIN32
+
+static DWORD WINAPI mn_thread_entry (LPVOID param)
+{
+    mn_thread_t * thread = (mn_thread_t *)param;
+    thread->fn(thread->arg);
+    return 0;
+}
+
+mn_result_t mn_thread_create (mn_thread_t * thread, mn_thread_fn fn, void * arg)
+{
+    thread->fn = fn;
+    thread->arg = arg;
+    thread->handle = CreateThread(NULL, 0, mn_thread_entry, thread, 0, NULL);
+    return thread->handle != NULL ? MN_SUCCESS : MN_ERROR;
+}
+
+mn_result_t mn_thread_join (mn_thread_t * thread)
+{
+    if (WaitForSingleObject(thread->handle, INFINITE) != WAIT_OBJECT_0)
+    {
+        return MN_ERROR;
+    }
+    CloseHandle(thread->handle);
+    return MN_SUCCESS;
+}
+
+void mn_mutex_init (mn_mutex_t * mutex)    { InitializeSRWLock(&mutex->lock); }
+void mn_mutex_destroy (mn_mutex_t * mutex) { (void)mutex; }
+void mn_mutex_lock (mn_mutex_t * mutex)    { AcquireSRWLockExclusive(&mutex->lock); }
+void mn_mutex_unlock (mn_mutex_t * mutex)  { ReleaseSRWLockExclusive(&mutex->lock); }
+
+void mn_cond_init (mn_cond_t * cond)      { InitializeConditionVariable(&cond->cond); }
+void mn_cond_destroy (mn_cond_t * cond)   { (void)cond; }
+void mn_cond_wait (mn_cond_t * cond, mn_mutex_t * mutex)
+{
+    SleepConditionVariableSRW(&cond->cond, &mutex->lock, INFINITE, 0);
+}
+void mn_cond_broadcast (mn_cond_t * cond) { WakeAllConditionVariable(&cond->cond); }
+
+size_t mn_cpu_count (void)
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (size_t)info.dwNumberOfProcessors : 1;
+}
+
+#else
+
+static void * mn_thread_entry (void * param)
+{
+    mn_thread_t * thread = (mn_thread_t *)param;
+    thread->fn(thread->arg);
+    return NULL;
+}
+
+mn_result_t mn_thread_create (mn_thread_t * thread, mn_thread_fn fn, void * arg)
+{
+    thread->fn = fn;
+    thread->arg = arg;
+    return pthread_create(&thread->handle, NULL, mn_thread_entry, thread) == 0 ? MN_SUCCESS : MN_ERROR;
+}
+
+mn_result_t mn_thread_join (mn_thread_t * thread)
+{
+    return pthread_join(thread->handle, NULL) == 0 ? MN_SUCCESS : MN_ERROR;
+}
+
+void mn_mutex_init (mn_mutex_t * mutex)    { pthread_mutex_init(&mutex->lock, NULL); }
+void mn_mutex_destroy (mn_mutex_t * mutex) { pthread_mutex_destroy(&mutex->lock); }
+void mn_mutex_lock (mn_mutex_t * mutex)    { pthread_mutex_lock(&mutex->lock); }
+void mn_mutex_unlock (mn_mutex_t * mutex)  { pthread_mutex_unlock(&mutex->lock); }
+
+void mn_cond_init (mn_cond_t * cond)      { pthread_cond_init(&cond->cond, NULL); }
+void mn_cond_destroy (mn_cond_t * cond)   { pthread_cond_destroy(&cond->cond); }
+void mn_cond_wait (mn_cond_t * cond, mn_mutex_t * mutex)
+{
+    pthread_cond_wait(&cond->cond, &mutex->lock);
+}
+void mn_cond_broadcast (mn_cond_t * cond) { pthread_cond_broadcast(&cond->cond); }
+
+size_t mn_cpu_count (void)
+{
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (size_t)n : 1;
+}
+
+#endif
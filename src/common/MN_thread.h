@@ -0,0 +1,78 @@
+#ifndef MN_THREAD_H
+#define MN_THREAD_H
+
+#include "MN_dtype.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+/*
+Minimal thread, mutex and condition variable wrappers used internally by the
+library (Win32 threads on Windows, pthreads elsewhere). Not part of the public
+headers.
+*/
+
+typedef void (*mn_thread_fn)(void * arg);
+
+typedef struct
+{
+#ifdef _WIN32
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+    mn_thread_fn fn;
+    void * arg;
+} mn_thread_t;
+
+typedef struct
+{
+#ifdef _WIN32
+    SRWLOCK lock;
+#else
+    pthread_mutex_t lock;
+#endif
+} mn_mutex_t;
+
+typedef struct
+{
+#ifdef _WIN32
+    CONDITION_VARIABLE cond;
+#else
+    pthread_cond_t cond;
+#endif
+} mn_cond_t;
+
+mn_result_t mn_thread_create (mn_thread_t * thread, mn_thread_fn fn, void * arg);
+mn_result_t mn_thread_join (mn_thread_t * thread);
+
+void mn_mutex_init (mn_mutex_t * mutex);
+void mn_mutex_destroy (mn_mutex_t * mutex);
+void mn_mutex_lock (mn_mutex_t * mutex);
+void mn_mutex_unlock (mn_mutex_t * mutex);
+
+void mn_cond_init (mn_cond_t * cond);
+void mn_cond_destroy (mn_cond_t * cond);
+void mn_cond_wait (mn_cond_t * cond, mn_mutex_t * mutex);
+void mn_cond_broadcast (mn_cond_t * cond);
+
+/** @brief Number of online CPUs, at least 1. */
+size_t mn_cpu_count (void);
+
+/** @brief Most tasks mn_thread_run runs at once. */
+#define MN_THREAD_MAX 64
+
+/** @brief The mn_set_threads setting, 0 resolved to mn_cpu_count(), at most MN_THREAD_MAX. */
+size_t mn_thread_count (void);
+
+/**
+ * @brief Runs fn on each of the n tasks of size bytes at tasks, n <= MN_THREAD_MAX.
+ *        Task 0 runs on the calling thread, so does any task whose thread fails to
+ *        start. Returns MN_ERROR if a thread cannot be joined.
+ */
+mn_result_t mn_thread_run (mn_thread_fn fn, void * tasks, size_t size, size_t n);
+
+#endif // MN_THREAD_H
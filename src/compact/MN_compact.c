@@ -0,0 +1,139 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <assert.h>
+
+/*
+Function Input:
+    dst   - Destination array, room for count elements
+    kept  - Destination of the number of elements written to dst
+    src1  - Source array whose elements are kept or dropped (src for compactc)
+    src2  - Array compared element by element with src1
+    cst   - Constant compared with every element of src
+    count - Count is an integer that stores number of elements
+    cmp   - Predicate, one of MN_CMP_EQ / NE / LT / LE / GT / GE
+
+    C Implementation of stream compaction, the reference for the NEON
+    versions. The elements x = src1[i] for which x cmp src2[i] (x cmp cst
+    for compactc) holds are copied to dst[0 .. *kept - 1] in their original
+    order. dst may be the same array as a source. An unknown cmp returns
+    MN_ERROR.
+*/
+
+static inline int mn_compact_test_float (mn_float32_t x, mn_float32_t y, int cmp)
+{
+    switch (cmp)
+    {
+    case MN_CMP_EQ: return x == y;
+    case MN_CMP_NE: return x != y;
+    case MN_CMP_LT: return x < y;
+    case MN_CMP_LE: return x <= y;
+    case MN_CMP_GT: return x > y;
+    default:        return x >= y;
+    }
+}
+
+static inline int mn_compact_test_int32 (mn_int32_t x, mn_int32_t y, int cmp)
+{
+    switch (cmp)
+    {
+    case MN_CMP_EQ: return x == y;
+    case MN_CMP_NE: return x != y;
+    case MN_CMP_LT: return x < y;
+    case MN_CMP_LE: return x <= y;
+    case MN_CMP_GT: return x > y;
+    default:        return x >= y;
+    }
+}
+
+mn_result_t mn_compact_float_c (mn_float32_t * dst, size_t * kept, mn_float32_t * src1, mn_float32_t * src2,
+                                size_t count, int cmp)
+{
+    size_t n = 0;
+
+    assert(kept);
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    if (cmp < MN_CMP_EQ || cmp > MN_CMP_GE)
+    {
+        return MN_ERROR;
+    }
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        const mn_float32_t x = src1[ itr ];
+        if (mn_compact_test_float(x, src2[ itr ], cmp))
+        {
+            dst[ n++ ] = x;
+        }
+    }
+    *kept = n;
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_compactc_float_c (mn_float32_t * dst, size_t * kept, mn_float32_t * src, mn_float32_t cst,
+                                 size_t count, int cmp)
+{
+    size_t n = 0;
+
+    assert(kept);
+    MN_ASSERT_DS;
+    if (cmp < MN_CMP_EQ || cmp > MN_CMP_GE)
+    {
+        return MN_ERROR;
+    }
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        const mn_float32_t x = src[ itr ];
+        if (mn_compact_test_float(x, cst, cmp))
+        {
+            dst[ n++ ] = x;
+        }
+    }
+    *kept = n;
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_compact_int32_c (mn_int32_t * dst, size_t * kept, mn_int32_t * src1, mn_int32_t * src2,
+                                size_t count, int cmp)
+{
+    size_t n = 0;
+
+    assert(kept);
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    if (cmp < MN_CMP_EQ || cmp > MN_CMP_GE)
+    {
+        return MN_ERROR;
+    }
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        const mn_int32_t x = src1[ itr ];
+        if (mn_compact_test_int32(x, src2[ itr ], cmp))
+        {
+            dst[ n++ ] = x;
+        }
+    }
+    *kept = n;
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_compactc_int32_c (mn_int32_t * dst, size_t * kept, mn_int32_t * src, mn_int32_t cst,
+                                 size_t count, int cmp)
+{
+    size_t n = 0;
+
+    assert(kept);
+    MN_ASSERT_DS;
+    if (cmp < MN_CMP_EQ || cmp > MN_CMP_GE)
+    {
+        return MN_ERROR;
+    }
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        const mn_int32_t x = src[ itr ];
+        if (mn_compact_test_int32(x, cst, cmp))
+        {
+            dst[ n++ ] = x;
+        }
+    }
+    *kept = n;
+    return MN_SUCCESS;
+}
@@ -0,0 +1,236 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <arm_neon.h>
+#include <assert.h>
+#include <string.h>
+
+/*
+Input Arguments:
+    dst   - Destination array, room for count elements
+    kept  - Destination of the number of elements written to dst
+    src1  - Source array whose elements are kept or dropped (src for compactc)
+    src2  - Array compared element by element with src1
+    cst   - Constant compared with every element of src
+    count - Count is an integer that stores number of elements
+    cmp   - Predicate, one of MN_CMP_EQ / NE / LT / LE / GT / GE
+
+Intrinsics used:
+    vceqq / vcltq / vcleq / vcgtq / vcgeq - the predicate, 4 lanes at a time
+    vandq_u32 + vaddvq_u32 / vpadd_u32    - lane masks to a 4-bit index
+    vqtbl1q_u8 / vtbl2_u8                 - move the kept lanes to the front
+
+Lane compression without branches: the 4-bit mask of kept lanes picks one
+of 16 byte shuffles from a table, which packs the kept lanes into the low
+lanes of the vector. The whole vector is stored at dst + kept and kept
+advances by the popcount of the mask (a second table), so the next store
+overwrites the unused lanes. The loop does the same work whether 0 or 4
+lanes are kept and has no data-dependent branch to mispredict.
+
+A store covers at most the 4 elements just read, so dst may be the same
+array as a source, and dst needs room for count elements. Elements of dst
+after the kept ones may be overwritten with junk by the last stores.
+
+Supported routines: compaction of float / int32 arrays against a second
+array (compact) or a constant (compactc)
+*/
+
+/* byte shuffles packing the lanes set in the 4-bit index to the front */
+static const mn_uint8_t mn_compact_lut[ 16 ][ 16 ] =
+{
+    {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },
+    {  0,  1,  2,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },
+    {  4,  5,  6,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },
+    {  0,  1,  2,  3,  4,  5,  6,  7,  0,  0,  0,  0,  0,  0,  0,  0 },
+    {  8,  9, 10, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },
+    {  0,  1,  2,  3,  8,  9, 10, 11,  0,  0,  0,  0,  0,  0,  0,  0 },
+    {  4,  5,  6,  7,  8,  9, 10, 11,  0,  0,  0,  0,  0,  0,  0,  0 },
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11,  0,  0,  0,  0 },
+    { 12, 13, 14, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },
+    {  0,  1,  2,  3, 12, 13, 14, 15,  0,  0,  0,  0,  0,  0,  0,  0 },
+    {  4,  5,  6,  7, 12, 13, 14, 15,  0,  0,  0,  0,  0,  0,  0,  0 },
+    {  0,  1,  2,  3,  4,  5,  6,  7, 12, 13, 14, 15,  0,  0,  0,  0 },
+    {  8,  9, 10, 11, 12, 13, 14, 15,  0,  0,  0,  0,  0,  0,  0,  0 },
+    {  0,  1,  2,  3,  8,  9, 10, 11, 12, 13, 14, 15,  0,  0,  0,  0 },
+    {  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,  0,  0,  0,  0 },
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+};
+
+static const mn_uint8_t mn_compact_popcount[ 16 ] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+
+static const mn_uint32_t mn_compact_bits[ 4 ] = { 1, 2, 4, 8 };
+
+/* all-ones lanes of m to a 4-bit index, lane 0 in bit 0 */
+static inline unsigned mn_compact_mask (uint32x4_t m)
+{
+    const uint32x4_t bits = vandq_u32(m, vld1q_u32(mn_compact_bits));
+#if defined(__aarch64__) || defined(_M_ARM64)
+    return vaddvq_u32(bits);
+#else
+    const uint32x2_t s = vadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+    return vget_lane_u32(vpadd_u32(s, s), 0);
+#endif
+}
+
+static inline uint8x16_t mn_compact_shuffle (uint8x16_t v, unsigned mask)
+{
+    const uint8x16_t idx = vld1q_u8(mn_compact_lut[ mask ]);
+#if defined(__aarch64__) || defined(_M_ARM64)
+    return vqtbl1q_u8(v, idx);
+#else
+    uint8x8x2_t t;
+    t.val[ 0 ] = vget_low_u8(v);
+    t.val[ 1 ] = vget_high_u8(v);
+    return vcombine_u8(vtbl2_u8(t, vget_low_u8(idx)), vtbl2_u8(t, vget_high_u8(idx)));
+#endif
+}
+
+static inline float32x4_t mn_compact_lanes_f32 (float32x4_t v, unsigned mask)
+{
+    return vreinterpretq_f32_u8(mn_compact_shuffle(vreinterpretq_u8_f32(v), mask));
+}
+
+static inline int32x4_t mn_compact_lanes_s32 (int32x4_t v, unsigned mask)
+{
+    return vreinterpretq_s32_u8(mn_compact_shuffle(vreinterpretq_u8_s32(v), mask));
+}
+
+#define MN_COMPACT_EQ(S, a, b) vceqq_##S(a, b)
+#define MN_COMPACT_NE(S, a, b) vmvnq_u32(vceqq_##S(a, b))
+#define MN_COMPACT_LT(S, a, b) vcltq_##S(a, b)
+#define MN_COMPACT_LE(S, a, b) vcleq_##S(a, b)
+#define MN_COMPACT_GT(S, a, b) vcgtq_##S(a, b)
+#define MN_COMPACT_GE(S, a, b) vcgeq_##S(a, b)
+
+/* the right-hand side: 4 elements of src2, or the constant */
+#define MN_COMPACT_ARR(S, p, i) vld1q_##S((p) + (i))
+#define MN_COMPACT_CST(S, p, i) vcst
+
+/*
+ * One kernel per type, predicate and right-hand side. The tail is padded
+ * to 8 elements and the padding lanes are cleared from the masks; the
+ * packed result goes through a buffer so nothing past count is written.
+ */
+#define MN_COMPACT_KERNEL(NAME, T, V, S, CMP, REF) \
+static size_t NAME (T * dst, const T * src, const T * src2, T cst, size_t count) \
+{ \
+    const V vcst = vdupq_n_##S(cst); \
+    size_t itr = 0, kept = 0; \
+    (void)src2; \
+    (void)vcst; \
+    MN_PREFETCH_INIT; \
+    for ( ; itr + 8 <= count; itr += 8 ) \
+    { \
+        MN_PREFETCH_SRC_STEP(src + itr, 8 * sizeof(T)); \
+        const V x0 = vld1q_##S(src + itr); \
+        const V x1 = vld1q_##S(src + itr + 4); \
+        const unsigned b0 = mn_compact_mask(CMP(S, x0, REF(S, src2, itr))); \
+        const unsigned b1 = mn_compact_mask(CMP(S, x1, REF(S, src2, itr + 4))); \
+        vst1q_##S(dst + kept, mn_compact_lanes_##S(x0, b0)); \
+        kept += mn_compact_popcount[ b0 ]; \
+        vst1q_##S(dst + kept, mn_compact_lanes_##S(x1, b1)); \
+        kept += mn_compact_popcount[ b1 ]; \
+    } \
+    if (itr < count) \
+    { \
+        const size_t left = count - itr; \
+        T xs[ 8 ] = { 0 }, ys[ 8 ] = { 0 }, out[ 8 ]; \
+        memcpy(xs, src + itr, left * sizeof(T)); \
+        if (src2) memcpy(ys, src2 + itr, left * sizeof(T)); \
+        const V x0 = vld1q_##S(xs); \
+        const V x1 = vld1q_##S(xs + 4); \
+        const unsigned valid = (1u << left) - 1; \
+        const unsigned b0 = mn_compact_mask(CMP(S, x0, REF(S, ys, 0))) & valid; \
+        const unsigned b1 = mn_compact_mask(CMP(S, x1, REF(S, ys, 4))) & (valid >> 4); \
+        size_t n = mn_compact_popcount[ b0 ]; \
+        vst1q_##S(out, mn_compact_lanes_##S(x0, b0)); \
+        vst1q_##S(out + n, mn_compact_lanes_##S(x1, b1)); \
+        n += mn_compact_popcount[ b1 ]; \
+        memcpy(dst + kept, out, n * sizeof(T)); \
+        kept += n; \
+    } \
+    return kept; \
+}
+
+typedef size_t (*mn_compact_float_fn) (mn_float32_t *, const mn_float32_t *, const mn_float32_t *, mn_float32_t, size_t);
+typedef size_t (*mn_compact_int32_fn) (mn_int32_t *, const mn_int32_t *, const mn_int32_t *, mn_int32_t, size_t);
+
+/* kernels for both right-hand sides of one type, and the tables indexed by MN_CMP_* */
+#define MN_COMPACT_TYPE(TNAME, T, V, S) \
+MN_COMPACT_KERNEL(mn_compact_##TNAME##_eq, T, V, S, MN_COMPACT_EQ, MN_COMPACT_ARR) \
+MN_COMPACT_KERNEL(mn_compact_##TNAME##_ne, T, V, S, MN_COMPACT_NE, MN_COMPACT_ARR) \
+MN_COMPACT_KERNEL(mn_compact_##TNAME##_lt, T, V, S, MN_COMPACT_LT, MN_COMPACT_ARR) \
+MN_COMPACT_KERNEL(mn_compact_##TNAME##_le, T, V, S, MN_COMPACT_LE, MN_COMPACT_ARR) \
+MN_COMPACT_KERNEL(mn_compact_##TNAME##_gt, T, V, S, MN_COMPACT_GT, MN_COMPACT_ARR) \
+MN_COMPACT_KERNEL(mn_compact_##TNAME##_ge, T, V, S, MN_COMPACT_GE, MN_COMPACT_ARR) \
+MN_COMPACT_KERNEL(mn_compactc_##TNAME##_eq, T, V, S, MN_COMPACT_EQ, MN_COMPACT_CST) \
+MN_COMPACT_KERNEL(mn_compactc_##TNAME##_ne, T, V, S, MN_COMPACT_NE, MN_COMPACT_CST) \
+MN_COMPACT_KERNEL(mn_compactc_##TNAME##_lt, T, V, S, MN_COMPACT_LT, MN_COMPACT_CST) \
+MN_COMPACT_KERNEL(mn_compactc_##TNAME##_le, T, V, S, MN_COMPACT_LE, MN_COMPACT_CST) \
+MN_COMPACT_KERNEL(mn_compactc_##TNAME##_gt, T, V, S, MN_COMPACT_GT, MN_COMPACT_CST) \
+MN_COMPACT_KERNEL(mn_compactc_##TNAME##_ge, T, V, S, MN_COMPACT_GE, MN_COMPACT_CST) \
+static const mn_compact_##TNAME##_fn mn_compact_##TNAME##_fns[ 6 ] = \
+{ \
+    mn_compact_##TNAME##_eq, mn_compact_##TNAME##_ne, mn_compact_##TNAME##_lt, \
+    mn_compact_##TNAME##_le, mn_compact_##TNAME##_gt, mn_compact_##TNAME##_ge \
+}; \
+static const mn_compact_##TNAME##_fn mn_compactc_##TNAME##_fns[ 6 ] = \
+{ \
+    mn_compactc_##TNAME##_eq, mn_compactc_##TNAME##_ne, mn_compactc_##TNAME##_lt, \
+    mn_compactc_##TNAME##_le, mn_compactc_##TNAME##_gt, mn_compactc_##TNAME##_ge \
+};
+
+MN_COMPACT_TYPE(float, mn_float32_t, float32x4_t, f32)
+MN_COMPACT_TYPE(int32, mn_int32_t, int32x4_t, s32)
+
+mn_result_t mn_compact_float_neon (mn_float32_t * dst, size_t * kept, mn_float32_t * src1, mn_float32_t * src2,
+                                   size_t count, int cmp)
+{
+    assert(kept);
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    if (cmp < MN_CMP_EQ || cmp > MN_CMP_GE)
+    {
+        return MN_ERROR;
+    }
+    *kept = mn_compact_float_fns[ cmp ](dst, src1, src2, 0.0f, count);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_compactc_float_neon (mn_float32_t * dst, size_t * kept, mn_float32_t * src, mn_float32_t cst,
+                                    size_t count, int cmp)
+{
+    assert(kept);
+    MN_ASSERT_DS;
+    if (cmp < MN_CMP_EQ || cmp > MN_CMP_GE)
+    {
+        return MN_ERROR;
+    }
+    *kept = mn_compactc_float_fns[ cmp ](dst, src, NULL, cst, count);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_compact_int32_neon (mn_int32_t * dst, size_t * kept, mn_int32_t * src1, mn_int32_t * src2,
+                                   size_t count, int cmp)
+{
+    assert(kept);
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    if (cmp < MN_CMP_EQ || cmp > MN_CMP_GE)
+    {
+        return MN_ERROR;
+    }
+    *kept = mn_compact_int32_fns[ cmp ](dst, src1, src2, 0, count);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_compactc_int32_neon (mn_int32_t * dst, size_t * kept, mn_int32_t * src, mn_int32_t cst,
+                                    size_t count, int cmp)
+{
+    assert(kept);
+    MN_ASSERT_DS;
+    if (cmp < MN_CMP_EQ || cmp > MN_CMP_GE)
+    {
+        return MN_ERROR;
+    }
+    *kept = mn_compactc_int32_fns[ cmp ](dst, src, NULL, cst, count);
+    return MN_SUCCESS;
+}
@@ -0,0 +1,85 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <assert.h>
+#include <math.h>
+
+/*
+Function Input:
+    dst   - Destination array (mn_complexf_t, or mn_float32_t for cabs / cmag2)
+    src1  - Left complex numbers
+    src2  - Right complex numbers
+    src   - Complex numbers (cmulc, cabs, cmag2)
+    cst   - Complex constant (cmulc)
+    count - Count is an integer that stores number of elements
+
+    C Implementation of the complex routines, a = src1[i] (or src[i]), b = src2[i]:
+        cmul:      dst[i] = a * b
+        cmulc:     dst[i] = a * cst
+        cconjmul:  dst[i] = a * conj(b)
+        cabs:      dst[i] = |a| = sqrt(re^2 + im^2)
+        cmag2:     dst[i] = |a|^2 = re^2 + im^2
+    dst may be the same array as a source (in-place).
+*/
+
+/* (ar + i ai) * (br + i bi), written through temporaries for in-place */
+#define MN_COMPLEX_MUL(d, ar, ai, br, bi) \
+    do { \
+        const mn_float32_t re_ = (ar) * (br) - (ai) * (bi); \
+        const mn_float32_t im_ = (ar) * (bi) + (ai) * (br); \
+        (d).re = re_; \
+        (d).im = im_; \
+    } while (0)
+
+mn_result_t mn_cmul_complexf_c (mn_complexf_t * dst, mn_complexf_t * src1, mn_complexf_t * src2, size_t count)
+{
+    MN_CHECK_Dst1SRC1SRC2(dst, src1, src2);
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        MN_COMPLEX_MUL(dst[ itr ], src1[ itr ].re, src1[ itr ].im, src2[ itr ].re, src2[ itr ].im);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_cmulc_complexf_c (mn_complexf_t * dst, mn_complexf_t * src, const mn_complexf_t * cst, size_t count)
+{
+    const mn_complexf_t c = *cst;
+    MN_CHECK_DstSRC;
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        MN_COMPLEX_MUL(dst[ itr ], src[ itr ].re, src[ itr ].im, c.re, c.im);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_cconjmul_complexf_c (mn_complexf_t * dst, mn_complexf_t * src1, mn_complexf_t * src2, size_t count)
+{
+    MN_CHECK_Dst1SRC1SRC2(dst, src1, src2);
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        MN_COMPLEX_MUL(dst[ itr ], src1[ itr ].re, src1[ itr ].im, src2[ itr ].re, -src2[ itr ].im);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_cabs_complexf_c (mn_float32_t * dst, mn_complexf_t * src, size_t count)
+{
+    MN_CHECK_DstSRC;
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        const mn_complexf_t a = src[ itr ];
+        dst[ itr ] = sqrtf(a.re * a.re + a.im * a.im);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_cmag2_complexf_c (mn_float32_t * dst, mn_complexf_t * src, size_t count)
+{
+    MN_CHECK_DstSRC;
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        const mn_complexf_t a = src[ itr ];
+        dst[ itr ] = a.re * a.re + a.im * a.im;
+    }
+    return MN_SUCCESS;
+}
@@ -0,0 +1,236 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <arm_neon.h>
+#include <assert.h>
+#include <math.h>
+
+/*
+Input Arguments:
+    dst   - Destination array (mn_complexf_t, or mn_float32_t for cabs / cmag2)
+    src1  - Left complex numbers
+    src2  - Right complex numbers
+    src   - Complex numbers (cmulc, cabs, cmag2)
+    cst   - Complex constant (cmulc)
+    count - Count is an integer that stores number of elements
+
+Intrinsics used:
+    vcmlaq_f32 / vcmlaq_rot90_f32 / vcmlaq_rot270_f32 - ARMv8.3-A complex
+        multiply-add on interleaved re, im pairs (MN_COMPLEX_FCMLA)
+    vld2q_f32 / vst2q_f32 - otherwise, split 4 numbers into a real and an
+        imaginary vector and interleave them again on store
+    vfmaq_f32 / vfmsq_f32 - cross terms (vmlaq_f32 / vmlsq_f32 on 32-bit ARM without FMA)
+    vsqrtq_f32            - cabs (vrsqrteq_f32 + Newton steps on 32-bit ARM)
+
+8 numbers per step (two vector pairs in flight), then 4, then the scalar tail
+computed like the C version.
+
+Supported routines: cmul, cmulc, cconjmul, cabs, cmag2
+*/
+
+/* Scalar tail, same expression as the C version */
+#define MN_COMPLEX_MUL_SCALAR(d, ar, ai, br, bi) \
+    do { \
+        const mn_float32_t re_ = (ar) * (br) - (ai) * (bi); \
+        const mn_float32_t im_ = (ar) * (bi) + (ai) * (br); \
+        (d).re = re_; \
+        (d).im = im_; \
+    } while (0)
+
+#if defined(MN_COMPLEX_FCMLA)
+
+/* a * b: rot0 adds a.re * (b.re, b.im), rot90 adds a.im * (-b.im, b.re) */
+static inline float32x4_t mn_complex_mul (float32x4_t a, float32x4_t b)
+{
+    return vcmlaq_rot90_f32(vcmlaq_f32(vdupq_n_f32(0.0f), a, b), a, b);
+}
+
+/* a * conj(b) = conj(b) * a: rot0 adds b.re * (a.re, a.im), rot270 adds b.im * (a.im, -a.re) */
+static inline float32x4_t mn_complex_conjmul (float32x4_t a, float32x4_t b)
+{
+    return vcmlaq_rot270_f32(vcmlaq_f32(vdupq_n_f32(0.0f), b, a), b, a);
+}
+
+/* dst[0 .. count) = OP(s1[], s2[]) on interleaved vectors of 2 numbers; s2 advances by s2_step */
+#define MN_COMPLEX_BINARY_NEON(OP, s2_step, TAIL) \
+    size_t itr = 0; \
+    for ( ; itr + 8 <= count; itr += 8 ) \
+    { \
+        float32x4_t r0 = OP(vld1q_f32(&s1[ itr ].re), vld1q_f32(&s2[ (itr) * (s2_step) ].re)); \
+        float32x4_t r1 = OP(vld1q_f32(&s1[ itr + 2 ].re), vld1q_f32(&s2[ (itr + 2) * (s2_step) ].re)); \
+        float32x4_t r2 = OP(vld1q_f32(&s1[ itr + 4 ].re), vld1q_f32(&s2[ (itr + 4) * (s2_step) ].re)); \
+        float32x4_t r3 = OP(vld1q_f32(&s1[ itr + 6 ].re), vld1q_f32(&s2[ (itr + 6) * (s2_step) ].re)); \
+        vst1q_f32(&dst[ itr ].re, r0); \
+        vst1q_f32(&dst[ itr + 2 ].re, r1); \
+        vst1q_f32(&dst[ itr + 4 ].re, r2); \
+        vst1q_f32(&dst[ itr + 6 ].re, r3); \
+    } \
+    for ( ; itr + 2 <= count; itr += 2 ) \
+    { \
+        vst1q_f32(&dst[ itr ].re, OP(vld1q_f32(&s1[ itr ].re), vld1q_f32(&s2[ (itr) * (s2_step) ].re))); \
+    } \
+    for ( ; itr < count; itr++ ) \
+    { \
+        TAIL; \
+    }
+
+mn_result_t mn_cmul_complexf_neon (mn_complexf_t * dst, mn_complexf_t * src1, mn_complexf_t * src2, size_t count)
+{
+    const mn_complexf_t * s1 = src1;
+    const mn_complexf_t * s2 = src2;
+    MN_CHECK_Dst1SRC1SRC2(dst, src1, src2);
+    MN_COMPLEX_BINARY_NEON(mn_complex_mul, 1,
+        MN_COMPLEX_MUL_SCALAR(dst[ itr ], s1[ itr ].re, s1[ itr ].im, s2[ itr ].re, s2[ itr ].im));
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_cmulc_complexf_neon (mn_complexf_t * dst, mn_complexf_t * src, const mn_complexf_t * cst, size_t count)
+{
+    /* the constant twice, so s2[ itr * 0 ] loads it as a full vector */
+    const mn_complexf_t s2[ 2 ] = { *cst, *cst };
+    const mn_complexf_t * s1 = src;
+    MN_CHECK_DstSRC;
+    MN_COMPLEX_BINARY_NEON(mn_complex_mul, 0,
+        MN_COMPLEX_MUL_SCALAR(dst[ itr ], s1[ itr ].re, s1[ itr ].im, s2[ 0 ].re, s2[ 0 ].im));
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_cconjmul_complexf_neon (mn_complexf_t * dst, mn_complexf_t * src1, mn_complexf_t * src2, size_t count)
+{
+    const mn_complexf_t * s1 = src1;
+    const mn_complexf_t * s2 = src2;
+    MN_CHECK_Dst1SRC1SRC2(dst, src1, src2);
+    MN_COMPLEX_BINARY_NEON(mn_complex_conjmul, 1,
+        MN_COMPLEX_MUL_SCALAR(dst[ itr ], s1[ itr ].re, s1[ itr ].im, s2[ itr ].re, -s2[ itr ].im));
+    return MN_SUCCESS;
+}
+
+#else /* !MN_COMPLEX_FCMLA */
+
+/* d = a * b on split vectors (val[0] real, val[1] imaginary) */
+static inline float32x4x2_t mn_complex_mul (float32x4x2_t a, float32x4x2_t b)
+{
+    float32x4x2_t d;
+    d.val[0] = MN_FMSQ_F32(vmulq_f32(a.val[0], b.val[0]), a.val[1], b.val[1]);
+    d.val[1] = MN_FMAQ_F32(vmulq_f32(a.val[0], b.val[1]), a.val[1], b.val[0]);
+    return d;
+}
+
+/* d = a * conj(b) */
+static inline float32x4x2_t mn_complex_conjmul (float32x4x2_t a, float32x4x2_t b)
+{
+    float32x4x2_t d;
+    d.val[0] = MN_FMAQ_F32(vmulq_f32(a.val[0], b.val[0]), a.val[1], b.val[1]);
+    d.val[1] = MN_FMSQ_F32(vmulq_f32(a.val[1], b.val[0]), a.val[0], b.val[1]);
+    return d;
+}
+
+/* LOAD2(i) gives the second operand for numbers i .. i + 3 */
+#define MN_COMPLEX_BINARY_NEON(OP, LOAD2, TAIL) \
+    size_t itr = 0; \
+    for ( ; itr + 8 <= count; itr += 8 ) \
+    { \
+        float32x4x2_t r0 = OP(vld2q_f32(&s1[ itr ].re), LOAD2(itr)); \
+        float32x4x2_t r1 = OP(vld2q_f32(&s1[ itr + 4 ].re), LOAD2(itr + 4)); \
+        vst2q_f32(&dst[ itr ].re, r0); \
+        vst2q_f32(&dst[ itr + 4 ].re, r1); \
+    } \
+    for ( ; itr + 4 <= count; itr += 4 ) \
+    { \
+        vst2q_f32(&dst[ itr ].re, OP(vld2q_f32(&s1[ itr ].re), LOAD2(itr))); \
+    } \
+    for ( ; itr < count; itr++ ) \
+    { \
+        TAIL; \
+    }
+
+#define MN_COMPLEX_LOAD_SRC2(i) vld2q_f32(&s2[ i ].re)
+#define MN_COMPLEX_LOAD_CST(i)  c
+
+mn_result_t mn_cmul_complexf_neon (mn_complexf_t * dst, mn_complexf_t * src1, mn_complexf_t * src2, size_t count)
+{
+    const mn_complexf_t * s1 = src1;
+    const mn_complexf_t * s2 = src2;
+    MN_CHECK_Dst1SRC1SRC2(dst, src1, src2);
+    MN_COMPLEX_BINARY_NEON(mn_complex_mul, MN_COMPLEX_LOAD_SRC2,
+        MN_COMPLEX_MUL_SCALAR(dst[ itr ], s1[ itr ].re, s1[ itr ].im, s2[ itr ].re, s2[ itr ].im));
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_cmulc_complexf_neon (mn_complexf_t * dst, mn_complexf_t * src, const mn_complexf_t * cst, size_t count)
+{
+    const mn_complexf_t * s1 = src;
+    const mn_complexf_t k = *cst;
+    float32x4x2_t c;
+    MN_CHECK_DstSRC;
+    c.val[0] = vdupq_n_f32(k.re);
+    c.val[1] = vdupq_n_f32(k.im);
+    MN_COMPLEX_BINARY_NEON(mn_complex_mul, MN_COMPLEX_LOAD_CST,
+        MN_COMPLEX_MUL_SCALAR(dst[ itr ], s1[ itr ].re, s1[ itr ].im, k.re, k.im));
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_cconjmul_complexf_neon (mn_complexf_t * dst, mn_complexf_t * src1, mn_complexf_t * src2, size_t count)
+{
+    const mn_complexf_t * s1 = src1;
+    const mn_complexf_t * s2 = src2;
+    MN_CHECK_Dst1SRC1SRC2(dst, src1, src2);
+    MN_COMPLEX_BINARY_NEON(mn_complex_conjmul, MN_COMPLEX_LOAD_SRC2,
+        MN_COMPLEX_MUL_SCALAR(dst[ itr ], s1[ itr ].re, s1[ itr ].im, s2[ itr ].re, -s2[ itr ].im));
+    return MN_SUCCESS;
+}
+
+#endif /* MN_COMPLEX_FCMLA */
+
+/* ===== cabs / cmag2: re^2 + im^2 on deinterleaved vectors ===== */
+
+static inline float32x4_t mn_complex_mag2 (float32x4x2_t a)
+{
+    return MN_FMAQ_F32(vmulq_f32(a.val[0], a.val[0]), a.val[1], a.val[1]);
+}
+
+static inline float32x4_t mn_complex_sqrt (float32x4_t x)
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+    return vsqrtq_f32(x);
+#else
+    /* x * rsqrt(x) with two Newton steps; rsqrt(0) is inf, so zero lanes keep x */
+    float32x4_t r = vrsqrteq_f32(x);
+    r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(x, r), r));
+    r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(x, r), r));
+    return vbslq_f32(vceqq_f32(x, vdupq_n_f32(0.0f)), x, vmulq_f32(x, r));
+#endif
+}
+
+#define MN_COMPLEX_UNARY_NEON(VOP, SOP) \
+    size_t itr = 0; \
+    MN_CHECK_DstSRC; \
+    for ( ; itr + 8 <= count; itr += 8 ) \
+    { \
+        float32x4_t r0 = VOP(mn_complex_mag2(vld2q_f32(&src[ itr ].re))); \
+        float32x4_t r1 = VOP(mn_complex_mag2(vld2q_f32(&src[ itr + 4 ].re))); \
+        vst1q_f32(dst + itr, r0); \
+        vst1q_f32(dst + itr + 4, r1); \
+    } \
+    for ( ; itr + 4 <= count; itr += 4 ) \
+    { \
+        vst1q_f32(dst + itr, VOP(mn_complex_mag2(vld2q_f32(&src[ itr ].re)))); \
+    } \
+    for ( ; itr < count; itr++ ) \
+    { \
+        const mn_complexf_t a = src[ itr ]; \
+        dst[ itr ] = SOP(a.re * a.re + a.im * a.im); \
+    } \
+    return MN_SUCCESS;
+
+#define MN_COMPLEX_IDENTITY(x) (x)
+
+mn_result_t mn_cabs_complexf_neon (mn_float32_t * dst, mn_complexf_t * src, size_t count)
+{
+    MN_COMPLEX_UNARY_NEON(mn_complex_sqrt, sqrtf)
+}
+
+mn_result_t mn_cmag2_complexf_neon (mn_float32_t * dst, mn_complexf_t * src, size_t count)
+{
+    MN_COMPLEX_UNARY_NEON(MN_COMPLEX_IDENTITY, MN_COMPLEX_IDENTITY)
+}
@@ -0,0 +1,232 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+
+/*
+Function Input:
+    dst   - Destination array of the target type
+    src   - Source array
+    cfg   - Scale, offset and rounding mode (NULL: unchanged values, round to nearest even)
+    count - Count is an integer that stores number of elements
+
+    C Implementation of the conversions between int8, uint8, int16, uint16,
+    int32, float, float16 and bfloat16. Each element goes through float32:
+        f = fmaf(src, scale, offset)
+    then f is rounded with cfg->round and saturated for integer targets, or
+    rounded to nearest even for float16 / bfloat16 targets.
+
+    float64 converts to and from float and int32 through float64 instead:
+        d = fma(src, scale, offset)
+    so int32 values above 2^24 and the float64 mantissa survive the scaling;
+    d is rounded once to the target (float: nearest even, int32: cfg->round
+    and saturation).
+
+    Without a config the offset is -0.0f, so fmaf(x, 1, -0) returns every x
+    unchanged (including -0.0).
+*/
+
+/* Round half to even, independent of the current floating point rounding mode */
+static mn_float32_t mn_cvt_round_even (mn_float32_t v)
+{
+    mn_float32_t f = floorf(v);
+    mn_float32_t diff = v - f;
+    if (diff > 0.5f || (diff == 0.5f && fmodf(f, 2.0f) != 0.0f))
+    {
+        f += 1.0f;
+    }
+    return f;
+}
+
+/* Same result as vcvtnq / vcvtq / vcvtmq / vcvtpq_s32_f32 */
+static mn_int32_t mn_cvt_f32_to_i32 (mn_float32_t v, int round)
+{
+    if (v != v)
+    {
+        return 0;
+    }
+    switch (round)
+    {
+        case MN_ROUND_ZERO: v = truncf(v); break;
+        case MN_ROUND_DOWN: v = floorf(v); break;
+        case MN_ROUND_UP:   v = ceilf(v);  break;
+        default:            v = mn_cvt_round_even(v); break;
+    }
+    if (v >= 2147483648.0f)
+    {
+        return INT32_MAX;
+    }
+    if (v < -2147483648.0f)
+    {
+        return INT32_MIN;
+    }
+    return (mn_int32_t)v;
+}
+
+/* float64 version of mn_cvt_f32_to_i32 */
+static mn_int32_t mn_cvt_f64_to_i32 (mn_float64_t v, int round)
+{
+    if (v != v)
+    {
+        return 0;
+    }
+    switch (round)
+    {
+        case MN_ROUND_ZERO: v = trunc(v); break;
+        case MN_ROUND_DOWN: v = floor(v); break;
+        case MN_ROUND_UP:   v = ceil(v);  break;
+        default:
+        {
+            mn_float64_t f = floor(v);
+            mn_float64_t diff = v - f;
+            if (diff > 0.5 || (diff == 0.5 && fmod(f, 2.0) != 0.0))
+            {
+                f += 1.0;
+            }
+            v = f;
+            break;
+        }
+    }
+    if (v >= 2147483648.0)
+    {
+        return INT32_MAX;
+    }
+    if (v < -2147483648.0)
+    {
+        return INT32_MIN;
+    }
+    return (mn_int32_t)v;
+}
+
+#define MN_CVT_CLAMP(v, lo, hi) ((v) < (lo) ? (lo) : ((v) > (hi) ? (hi) : (v)))
+
+/* element -> float32 */
+#define MN_CVT_LD_int8(v)      ((mn_float32_t)(v))
+#define MN_CVT_LD_uint8(v)     ((mn_float32_t)(v))
+#define MN_CVT_LD_int16(v)     ((mn_float32_t)(v))
+#define MN_CVT_LD_uint16(v)    ((mn_float32_t)(v))
+#define MN_CVT_LD_int32(v)     ((mn_float32_t)(v))
+#define MN_CVT_LD_float(v)     (v)
+#define MN_CVT_LD_float16(v)   mn_f16_to_f32(v)
+#define MN_CVT_LD_bfloat16(v)  mn_bf16_to_f32(v)
+
+/* float32 -> element */
+#define MN_CVT_ST_int8(f, r)     ((mn_int8_t)MN_CVT_CLAMP(mn_cvt_f32_to_i32(f, r), INT8_MIN, INT8_MAX))
+#define MN_CVT_ST_uint8(f, r)    ((mn_uint8_t)MN_CVT_CLAMP(mn_cvt_f32_to_i32(f, r), 0, UINT8_MAX))
+#define MN_CVT_ST_int16(f, r)    ((mn_int16_t)MN_CVT_CLAMP(mn_cvt_f32_to_i32(f, r), INT16_MIN, INT16_MAX))
+#define MN_CVT_ST_uint16(f, r)   ((mn_uint16_t)MN_CVT_CLAMP(mn_cvt_f32_to_i32(f, r), 0, UINT16_MAX))
+#define MN_CVT_ST_int32(f, r)    mn_cvt_f32_to_i32(f, r)
+#define MN_CVT_ST_float(f, r)    (f)
+#define MN_CVT_ST_float16(f, r)  mn_f32_to_f16(f)
+#define MN_CVT_ST_bfloat16(f, r) mn_f32_to_bf16(f)
+
+#define MN_CVT_C_DEFINE(from, FT, to, TT) \
+mn_result_t mn_cvt_##from##_##to##_c (TT * dst, FT * src, const mn_cvt_config_t * cfg, size_t count) \
+{ \
+    const mn_float32_t scale = cfg ? cfg->scale : 1.0f; \
+    const mn_float32_t offset = cfg ? cfg->offset : -0.0f; \
+    const int round = cfg ? cfg->round : MN_ROUND_NEAREST; \
+    MN_CHECK_CVT(dst, src, count); \
+    (void)round; \
+    for ( size_t itr = 0; itr < count; itr++ ) \
+    { \
+        const mn_float32_t f = fmaf(MN_CVT_LD_##from(src[itr]), scale, offset); \
+        dst[itr] = MN_CVT_ST_##to(f, round); \
+    } \
+    return MN_SUCCESS; \
+}
+
+MN_CVT_C_DEFINE(int8, mn_int8_t, uint8, mn_uint8_t)
+MN_CVT_C_DEFINE(int8, mn_int8_t, int16, mn_int16_t)
+MN_CVT_C_DEFINE(int8, mn_int8_t, uint16, mn_uint16_t)
+MN_CVT_C_DEFINE(int8, mn_int8_t, int32, mn_int32_t)
+MN_CVT_C_DEFINE(int8, mn_int8_t, float, mn_float32_t)
+MN_CVT_C_DEFINE(int8, mn_int8_t, float16, mn_float16_t)
+MN_CVT_C_DEFINE(int8, mn_int8_t, bfloat16, mn_bfloat16_t)
+
+MN_CVT_C_DEFINE(uint8, mn_uint8_t, int8, mn_int8_t)
+MN_CVT_C_DEFINE(uint8, mn_uint8_t, int16, mn_int16_t)
+MN_CVT_C_DEFINE(uint8, mn_uint8_t, uint16, mn_uint16_t)
+MN_CVT_C_DEFINE(uint8, mn_uint8_t, int32, mn_int32_t)
+MN_CVT_C_DEFINE(uint8, mn_uint8_t, float, mn_float32_t)
+MN_CVT_C_DEFINE(uint8, mn_uint8_t, float16, mn_float16_t)
+MN_CVT_C_DEFINE(uint8, mn_uint8_t, bfloat16, mn_bfloat16_t)
+
+MN_CVT_C_DEFINE(int16, mn_int16_t, int8, mn_int8_t)
+MN_CVT_C_DEFINE(int16, mn_int16_t, uint8, mn_uint8_t)
+MN_CVT_C_DEFINE(int16, mn_int16_t, uint16, mn_uint16_t)
+MN_CVT_C_DEFINE(int16, mn_int16_t, int32, mn_int32_t)
+MN_CVT_C_DEFINE(int16, mn_int16_t, float, mn_float32_t)
+MN_CVT_C_DEFINE(int16, mn_int16_t, float16, mn_float16_t)
+MN_CVT_C_DEFINE(int16, mn_int16_t, bfloat16, mn_bfloat16_t)
+
+MN_CVT_C_DEFINE(uint16, mn_uint16_t, int8, mn_int8_t)
+MN_CVT_C_DEFINE(uint16, mn_uint16_t, uint8, mn_uint8_t)
+MN_CVT_C_DEFINE(uint16, mn_uint16_t, int16, mn_int16_t)
+MN_CVT_C_DEFINE(uint16, mn_uint16_t, int32, mn_int32_t)
+MN_CVT_C_DEFINE(uint16, mn_uint16_t, float, mn_float32_t)
+MN_CVT_C_DEFINE(uint16, mn_uint16_t, float16, mn_float16_t)
+MN_CVT_C_DEFINE(uint16, mn_uint16_t, bfloat16, mn_bfloat16_t)
+
+MN_CVT_C_DEFINE(int32, mn_int32_t, int8, mn_int8_t)
+MN_CVT_C_DEFINE(int32, mn_int32_t, uint8, mn_uint8_t)
+MN_CVT_C_DEFINE(int32, mn_int32_t, int16, mn_int16_t)
+MN_CVT_C_DEFINE(int32, mn_int32_t, uint16, mn_uint16_t)
+MN_CVT_C_DEFINE(int32, mn_int32_t, float, mn_float32_t)
+MN_CVT_C_DEFINE(int32, mn_int32_t, float16, mn_float16_t)
+MN_CVT_C_DEFINE(int32, mn_int32_t, bfloat16, mn_bfloat16_t)
+
+MN_CVT_C_DEFINE(float, mn_float32_t, int8, mn_int8_t)
+MN_CVT_C_DEFINE(float, mn_float32_t, uint8, mn_uint8_t)
+MN_CVT_C_DEFINE(float, mn_float32_t, int16, mn_int16_t)
+MN_CVT_C_DEFINE(float, mn_float32_t, uint16, mn_uint16_t)
+MN_CVT_C_DEFINE(float, mn_float32_t, int32, mn_int32_t)
+MN_CVT_C_DEFINE(float, mn_float32_t, float16, mn_float16_t)
+MN_CVT_C_DEFINE(float, mn_float32_t, bfloat16, mn_bfloat16_t)
+
+MN_CVT_C_DEFINE(float16, mn_float16_t, int8, mn_int8_t)
+MN_CVT_C_DEFINE(float16, mn_float16_t, uint8, mn_uint8_t)
+MN_CVT_C_DEFINE(float16, mn_float16_t, int16, mn_int16_t)
+MN_CVT_C_DEFINE(float16, mn_float16_t, uint16, mn_uint16_t)
+MN_CVT_C_DEFINE(float16, mn_float16_t, int32, mn_int32_t)
+MN_CVT_C_DEFINE(float16, mn_float16_t, float, mn_float32_t)
+MN_CVT_C_DEFINE(float16, mn_float16_t, bfloat16, mn_bfloat16_t)
+
+MN_CVT_C_DEFINE(bfloat16, mn_bfloat16_t, int8, mn_int8_t)
+MN_CVT_C_DEFINE(bfloat16, mn_bfloat16_t, uint8, mn_uint8_t)
+MN_CVT_C_DEFINE(bfloat16, mn_bfloat16_t, int16, mn_int16_t)
+MN_CVT_C_DEFINE(bfloat16, mn_bfloat16_t, uint16, mn_uint16_t)
+MN_CVT_C_DEFINE(bfloat16, mn_bfloat16_t, int32, mn_int32_t)
+MN_CVT_C_DEFINE(bfloat16, mn_bfloat16_t, float, mn_float32_t)
+MN_CVT_C_DEFINE(bfloat16, mn_bfloat16_t, float16, mn_float16_t)
+
+/* element <-> float64, for the float64 pairs */
+#define MN_CVT_LD64_int32(v)     ((mn_float64_t)(v))
+#define MN_CVT_LD64_float(v)     ((mn_float64_t)(v))
+#define MN_CVT_LD64_float64(v)   (v)
+#define MN_CVT_ST64_int32(d, r)  mn_cvt_f64_to_i32(d, r)
+#define MN_CVT_ST64_float(d, r)  ((mn_float32_t)(d))
+#define MN_CVT_ST64_float64(d, r) (d)
+
+#define MN_CVT_C_DEFINE64(from, FT, to, TT) \
+mn_result_t mn_cvt_##from##_##to##_c (TT * dst, FT * src, const mn_cvt_config_t * cfg, size_t count) \
+{ \
+    const mn_float64_t scale = cfg ? cfg->scale : 1.0; \
+    const mn_float64_t offset = cfg ? cfg->offset : -0.0; \
+    const int round = cfg ? cfg->round : MN_ROUND_NEAREST; \
+    MN_CHECK_CVT(dst, src, count); \
+    (void)round; \
+    for ( size_t itr = 0; itr < count; itr++ ) \
+    { \
+        const mn_float64_t d = fma(MN_CVT_LD64_##from(src[itr]), scale, offset); \
+        dst[itr] = MN_CVT_ST64_##to(d, round); \
+    } \
+    return MN_SUCCESS; \
+}
+
+MN_CVT_C_DEFINE64(int32, mn_int32_t, float64, mn_float64_t)
+MN_CVT_C_DEFINE64(float, mn_float32_t, float64, mn_float64_t)
+MN_CVT_C_DEFINE64(float64, mn_float64_t, int32, mn_int32_t)
+MN_CVT_C_DEFINE64(float64, mn_float64_t, float, mn_float32_t)
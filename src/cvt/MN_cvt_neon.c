@@ -0,0 +1,336 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include "../common/MN_bf16_neon.h"
+#include <arm_neon.h>
+#include <assert.h>
+#include <string.h>
+
+/*
+Input Arguments:
+    dst    - Destination array of the target type
+    src    - Source array
+    cfg    - Scale, offset and rounding mode (NULL: unchanged values, round to nearest even)
+    count  - Number of elements to process
+
+Intrinsics used (AArch64, MN_CVT_NEON):
+    widening to float32:
+        vmovl_s8 / vmovl_u8 / vmovl_s16 / vmovl_u16 - sign / zero extend integers
+        vcvtq_f32_s32 / vcvtq_f32_u32               - integer to float32
+        vcvt_f32_f16                                - float16 to float32
+        vshll_n_u16                                 - bfloat16 to float32
+    scaling:
+        vfmaq_f32 - src * scale + offset in one fused step, no separate mulc / addc pass
+    narrowing from float32:
+        vcvtnq / vcvtq / vcvtmq / vcvtpq_s32_f32    - float32 to int32 (nearest, zero, down, up)
+        vqmovn_s32 / vqmovun_s32 / vqmovn_s16 / vqmovn_u16 - saturating narrow
+        vcvt_f16_f32                                - float32 to float16 (round to nearest even)
+        vcvtq_low/high_bf16_f32 or integer rounding - float32 to bfloat16
+    float64 pairs:
+        vcvt_f64_f32 / vcvt_high_f64_f32 / vmovl_s32 + vcvtq_f64_s64 - to float64
+        vfmaq_f64                                   - scale and offset in float64
+        vcvt_f32_f64 / vcvt_high_f32_f64            - float64 to float32
+        vcvt{n,m,p}q_s64_f64 / vcvtq_s64_f64 + vqmovn_s64 - float64 to int32
+
+Every kernel handles 8 elements per step (two float32x4_t). A power of two
+scale on an integer source gives the same result as the fixed-point
+vcvtq_n_f32_s32, whose shift has to be a compile-time constant. The leftover
+(< 8) elements go through a zero padded block. The float64 pairs scale in
+float64 (float32 would round int32 values above 2^24) and handle 4 elements
+per step as two float64x2_t.
+
+Supported routines: every pair of int8, uint8, int16, uint16, int32, float,
+float16 and bfloat16, and float64 <-> float / int32 [1 Dimensional arrays]
+*/
+
+#if defined(MN_CVT_NEON)
+
+/* load 8 elements as two float32x4_t */
+#define MN_CVT_LD8_int8(p, lo, hi) do { \
+        const int16x8_t w_ = vmovl_s8(vld1_s8(p)); \
+        lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(w_))); \
+        hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(w_))); \
+    } while (0)
+#define MN_CVT_LD8_uint8(p, lo, hi) do { \
+        const uint16x8_t w_ = vmovl_u8(vld1_u8(p)); \
+        lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(w_))); \
+        hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(w_))); \
+    } while (0)
+#define MN_CVT_LD8_int16(p, lo, hi) do { \
+        const int16x8_t w_ = vld1q_s16(p); \
+        lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(w_))); \
+        hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(w_))); \
+    } while (0)
+#define MN_CVT_LD8_uint16(p, lo, hi) do { \
+        const uint16x8_t w_ = vld1q_u16(p); \
+        lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(w_))); \
+        hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(w_))); \
+    } while (0)
+#define MN_CVT_LD8_int32(p, lo, hi) do { \
+        lo = vcvtq_f32_s32(vld1q_s32(p)); \
+        hi = vcvtq_f32_s32(vld1q_s32((p) + 4)); \
+    } while (0)
+#define MN_CVT_LD8_float(p, lo, hi) do { \
+        lo = vld1q_f32(p); \
+        hi = vld1q_f32((p) + 4); \
+    } while (0)
+#define MN_CVT_LD8_float16(p, lo, hi) do { \
+        lo = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(p))); \
+        hi = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16((p) + 4))); \
+    } while (0)
+#define MN_CVT_LD8_bfloat16(p, lo, hi) do { \
+        const uint16x8_t w_ = vld1q_u16(p); \
+        lo = MN_BF16_WIDEN_LO(w_); \
+        hi = MN_BF16_WIDEN_HI(w_); \
+    } while (0)
+
+/* store two float32x4_t as 8 elements, RND converts float32x4_t to int32x4_t */
+#define MN_CVT_ST8_int8(p, lo, hi, RND) \
+    vst1_s8((p), vqmovn_s16(vcombine_s16(vqmovn_s32(RND(lo)), vqmovn_s32(RND(hi)))))
+#define MN_CVT_ST8_uint8(p, lo, hi, RND) \
+    vst1_u8((p), vqmovn_u16(vcombine_u16(vqmovun_s32(RND(lo)), vqmovun_s32(RND(hi)))))
+#define MN_CVT_ST8_int16(p, lo, hi, RND) \
+    vst1q_s16((p), vcombine_s16(vqmovn_s32(RND(lo)), vqmovn_s32(RND(hi))))
+#define MN_CVT_ST8_uint16(p, lo, hi, RND) \
+    vst1q_u16((p), vcombine_u16(vqmovun_s32(RND(lo)), vqmovun_s32(RND(hi))))
+#define MN_CVT_ST8_int32(p, lo, hi, RND) do { \
+        vst1q_s32((p), RND(lo)); \
+        vst1q_s32((p) + 4, RND(hi)); \
+    } while (0)
+#define MN_CVT_ST8_float(p, lo, hi, RND) do { \
+        vst1q_f32((p), (lo)); \
+        vst1q_f32((p) + 4, (hi)); \
+    } while (0)
+#define MN_CVT_ST8_float16(p, lo, hi, RND) \
+    vst1q_u16((p), vcombine_u16(vreinterpret_u16_f16(vcvt_f16_f32(lo)), vreinterpret_u16_f16(vcvt_f16_f32(hi))))
+#define MN_CVT_ST8_bfloat16(p, lo, hi, RND) \
+    vst1q_u16((p), mn_bf16_narrow((lo), (hi)))
+
+#define MN_CVT_NEON_KERNEL(kname, from, FT, to, TT, RND) \
+static void kname (TT * dst, const FT * src, size_t count, float32x4_t n_scale, float32x4_t n_offset) \
+{ \
+    float32x4_t n_lo, n_hi; \
+    size_t i = 0; \
+    MN_PREFETCH_INIT; \
+    for (; i + 8 <= count; i += 8) \
+    { \
+        MN_PREFETCH_SRC_STEP(src + i, 8 * sizeof(FT)); \
+        MN_CVT_LD8_##from(src + i, n_lo, n_hi); \
+        n_lo = vfmaq_f32(n_offset, n_lo, n_scale); \
+        n_hi = vfmaq_f32(n_offset, n_hi, n_scale); \
+        MN_CVT_ST8_##to(dst + i, n_lo, n_hi, RND); \
+    } \
+    if (i < count) \
+    { \
+        FT ts[8] = { 0 }; \
+        TT td[8]; \
+        memcpy(ts, src + i, (count - i) * sizeof(FT)); \
+        MN_CVT_LD8_##from(ts, n_lo, n_hi); \
+        n_lo = vfmaq_f32(n_offset, n_lo, n_scale); \
+        n_hi = vfmaq_f32(n_offset, n_hi, n_scale); \
+        MN_CVT_ST8_##to(td, n_lo, n_hi, RND); \
+        memcpy(dst + i, td, (count - i) * sizeof(TT)); \
+    } \
+}
+
+#define MN_CVT_NEON_PROLOGUE \
+    const float32x4_t n_scale = vdupq_n_f32(cfg ? cfg->scale : 1.0f); \
+    const float32x4_t n_offset = vdupq_n_f32(cfg ? cfg->offset : -0.0f); \
+    MN_CHECK_CVT(dst, src, count)
+
+/* integer target: one kernel per rounding mode, picked once per call */
+#define MN_CVT_NEON_DEFINE_INT(from, FT, to, TT) \
+MN_CVT_NEON_KERNEL(mn_cvt_##from##_##to##_n, from, FT, to, TT, vcvtnq_s32_f32) \
+MN_CVT_NEON_KERNEL(mn_cvt_##from##_##to##_z, from, FT, to, TT, vcvtq_s32_f32) \
+MN_CVT_NEON_KERNEL(mn_cvt_##from##_##to##_m, from, FT, to, TT, vcvtmq_s32_f32) \
+MN_CVT_NEON_KERNEL(mn_cvt_##from##_##to##_p, from, FT, to, TT, vcvtpq_s32_f32) \
+mn_result_t mn_cvt_##from##_##to##_neon (TT * dst, FT * src, const mn_cvt_config_t * cfg, size_t count) \
+{ \
+    MN_CVT_NEON_PROLOGUE; \
+    switch (cfg ? cfg->round : MN_ROUND_NEAREST) \
+    { \
+        case MN_ROUND_ZERO: mn_cvt_##from##_##to##_z(dst, src, count, n_scale, n_offset); break; \
+        case MN_ROUND_DOWN: mn_cvt_##from##_##to##_m(dst, src, count, n_scale, n_offset); break; \
+        case MN_ROUND_UP:   mn_cvt_##from##_##to##_p(dst, src, count, n_scale, n_offset); break; \
+        default:            mn_cvt_##from##_##to##_n(dst, src, count, n_scale, n_offset); break; \
+    } \
+    return MN_SUCCESS; \
+}
+
+/* floating point target: the rounding mode does not apply */
+#define MN_CVT_NEON_DEFINE_FLT(from, FT, to, TT) \
+MN_CVT_NEON_KERNEL(mn_cvt_##from##_##to##_k, from, FT, to, TT, vcvtnq_s32_f32) \
+mn_result_t mn_cvt_##from##_##to##_neon (TT * dst, FT * src, const mn_cvt_config_t * cfg, size_t count) \
+{ \
+    MN_CVT_NEON_PROLOGUE; \
+    mn_cvt_##from##_##to##_k(dst, src, count, n_scale, n_offset); \
+    return MN_SUCCESS; \
+}
+
+/* load 4 elements as two float64x2_t */
+#define MN_CVT_LD4_int32(p, lo, hi) do { \
+        const int32x4_t w_ = vld1q_s32(p); \
+        lo = vcvtq_f64_s64(vmovl_s32(vget_low_s32(w_))); \
+        hi = vcvtq_f64_s64(vmovl_s32(vget_high_s32(w_))); \
+    } while (0)
+#define MN_CVT_LD4_float(p, lo, hi) do { \
+        const float32x4_t w_ = vld1q_f32(p); \
+        lo = vcvt_f64_f32(vget_low_f32(w_)); \
+        hi = vcvt_high_f64_f32(w_); \
+    } while (0)
+#define MN_CVT_LD4_float64(p, lo, hi) do { \
+        lo = vld1q_f64(p); \
+        hi = vld1q_f64((p) + 2); \
+    } while (0)
+
+/* store two float64x2_t as 4 elements, RND converts float64x2_t to int64x2_t */
+#define MN_CVT_ST4_int32(p, lo, hi, RND) \
+    vst1q_s32((p), vcombine_s32(vqmovn_s64(RND(lo)), vqmovn_s64(RND(hi))))
+#define MN_CVT_ST4_float(p, lo, hi, RND) \
+    vst1q_f32((p), vcvt_high_f32_f64(vcvt_f32_f64(lo), (hi)))
+#define MN_CVT_ST4_float64(p, lo, hi, RND) do { \
+        vst1q_f64((p), (lo)); \
+        vst1q_f64((p) + 2, (hi)); \
+    } while (0)
+
+#define MN_CVT_NEON_KERNEL64(kname, from, FT, to, TT, RND) \
+static void kname (TT * dst, const FT * src, size_t count, float64x2_t n_scale, float64x2_t n_offset) \
+{ \
+    float64x2_t n_lo, n_hi; \
+    size_t i = 0; \
+    MN_PREFETCH_INIT; \
+    for (; i + 4 <= count; i += 4) \
+    { \
+        MN_PREFETCH_SRC_STEP(src + i, 4 * sizeof(FT)); \
+        MN_CVT_LD4_##from(src + i, n_lo, n_hi); \
+        n_lo = vfmaq_f64(n_offset, n_lo, n_scale); \
+        n_hi = vfmaq_f64(n_offset, n_hi, n_scale); \
+        MN_CVT_ST4_##to(dst + i, n_lo, n_hi, RND); \
+    } \
+    if (i < count) \
+    { \
+        FT ts[4] = { 0 }; \
+        TT td[4]; \
+        memcpy(ts, src + i, (count - i) * sizeof(FT)); \
+        MN_CVT_LD4_##from(ts, n_lo, n_hi); \
+        n_lo = vfmaq_f64(n_offset, n_lo, n_scale); \
+        n_hi = vfmaq_f64(n_offset, n_hi, n_scale); \
+        MN_CVT_ST4_##to(td, n_lo, n_hi, RND); \
+        memcpy(dst + i, td, (count - i) * sizeof(TT)); \
+    } \
+}
+
+#define MN_CVT_NEON_PROLOGUE64 \
+    const float64x2_t n_scale = vdupq_n_f64(cfg ? cfg->scale : 1.0); \
+    const float64x2_t n_offset = vdupq_n_f64(cfg ? cfg->offset : -0.0); \
+    MN_CHECK_CVT(dst, src, count)
+
+#define MN_CVT_NEON_DEFINE64_INT(from, FT, to, TT) \
+MN_CVT_NEON_KERNEL64(mn_cvt_##from##_##to##_n, from, FT, to, TT, vcvtnq_s64_f64) \
+MN_CVT_NEON_KERNEL64(mn_cvt_##from##_##to##_z, from, FT, to, TT, vcvtq_s64_f64) \
+MN_CVT_NEON_KERNEL64(mn_cvt_##from##_##to##_m, from, FT, to, TT, vcvtmq_s64_f64) \
+MN_CVT_NEON_KERNEL64(mn_cvt_##from##_##to##_p, from, FT, to, TT, vcvtpq_s64_f64) \
+mn_result_t mn_cvt_##from##_##to##_neon (TT * dst, FT * src, const mn_cvt_config_t * cfg, size_t count) \
+{ \
+    MN_CVT_NEON_PROLOGUE64; \
+    switch (cfg ? cfg->round : MN_ROUND_NEAREST) \
+    { \
+        case MN_ROUND_ZERO: mn_cvt_##from##_##to##_z(dst, src, count, n_scale, n_offset); break; \
+        case MN_ROUND_DOWN: mn_cvt_##from##_##to##_m(dst, src, count, n_scale, n_offset); break; \
+        case MN_ROUND_UP:   mn_cvt_##from##_##to##_p(dst, src, count, n_scale, n_offset); break; \
+        default:            mn_cvt_##from##_##to##_n(dst, src, count, n_scale, n_offset); break; \
+    } \
+    return MN_SUCCESS; \
+}
+
+#define MN_CVT_NEON_DEFINE64_FLT(from, FT, to, TT) \
+MN_CVT_NEON_KERNEL64(mn_cvt_##from##_##to##_k, from, FT, to, TT, vcvtnq_s64_f64) \
+mn_result_t mn_cvt_##from##_##to##_neon (TT * dst, FT * src, const mn_cvt_config_t * cfg, size_t count) \
+{ \
+    MN_CVT_NEON_PROLOGUE64; \
+    mn_cvt_##from##_##to##_k(dst, src, count, n_scale, n_offset); \
+    return MN_SUCCESS; \
+}
+
+#else
+
+#define MN_CVT_NEON_DEFINE_C(from, FT, to, TT) \
+mn_result_t mn_cvt_##from##_##to##_neon (TT * dst, FT * src, const mn_cvt_config_t * cfg, size_t count) \
+{ \
+    return mn_cvt_##from##_##to##_c(dst, src, cfg, count); \
+}
+#define MN_CVT_NEON_DEFINE_INT MN_CVT_NEON_DEFINE_C
+#define MN_CVT_NEON_DEFINE_FLT MN_CVT_NEON_DEFINE_C
+#define MN_CVT_NEON_DEFINE64_INT MN_CVT_NEON_DEFINE_C
+#define MN_CVT_NEON_DEFINE64_FLT MN_CVT_NEON_DEFINE_C
+
+#endif
+
+MN_CVT_NEON_DEFINE_INT(int8, mn_int8_t, uint8, mn_uint8_t)
+MN_CVT_NEON_DEFINE_INT(int8, mn_int8_t, int16, mn_int16_t)
+MN_CVT_NEON_DEFINE_INT(int8, mn_int8_t, uint16, mn_uint16_t)
+MN_CVT_NEON_DEFINE_INT(int8, mn_int8_t, int32, mn_int32_t)
+MN_CVT_NEON_DEFINE_FLT(int8, mn_int8_t, float, mn_float32_t)
+MN_CVT_NEON_DEFINE_FLT(int8, mn_int8_t, float16, mn_float16_t)
+MN_CVT_NEON_DEFINE_FLT(int8, mn_int8_t, bfloat16, mn_bfloat16_t)
+
+MN_CVT_NEON_DEFINE_INT(uint8, mn_uint8_t, int8, mn_int8_t)
+MN_CVT_NEON_DEFINE_INT(uint8, mn_uint8_t, int16, mn_int16_t)
+MN_CVT_NEON_DEFINE_INT(uint8, mn_uint8_t, uint16, mn_uint16_t)
+MN_CVT_NEON_DEFINE_INT(uint8, mn_uint8_t, int32, mn_int32_t)
+MN_CVT_NEON_DEFINE_FLT(uint8, mn_uint8_t, float, mn_float32_t)
+MN_CVT_NEON_DEFINE_FLT(uint8, mn_uint8_t, float16, mn_float16_t)
+MN_CVT_NEON_DEFINE_FLT(uint8, mn_uint8_t, bfloat16, mn_bfloat16_t)
+
+MN_CVT_NEON_DEFINE_INT(int16, mn_int16_t, int8, mn_int8_t)
+MN_CVT_NEON_DEFINE_INT(int16, mn_int16_t, uint8, mn_uint8_t)
+MN_CVT_NEON_DEFINE_INT(int16, mn_int16_t, uint16, mn_uint16_t)
+MN_CVT_NEON_DEFINE_INT(int16, mn_int16_t, int32, mn_int32_t)
+MN_CVT_NEON_DEFINE_FLT(int16, mn_int16_t, float, mn_float32_t)
+MN_CVT_NEON_DEFINE_FLT(int16, mn_int16_t, float16, mn_float16_t)
+MN_CVT_NEON_DEFINE_FLT(int16, mn_int16_t, bfloat16, mn_bfloat16_t)
+
+MN_CVT_NEON_DEFINE_INT(uint16, mn_uint16_t, int8, mn_int8_t)
+MN_CVT_NEON_DEFINE_INT(uint16, mn_uint16_t, uint8, mn_uint8_t)
+MN_CVT_NEON_DEFINE_INT(uint16, mn_uint16_t, int16, mn_int16_t)
+MN_CVT_NEON_DEFINE_INT(uint16, mn_uint16_t, int32, mn_int32_t)
+MN_CVT_NEON_DEFINE_FLT(uint16, mn_uint16_t, float, mn_float32_t)
+MN_CVT_NEON_DEFINE_FLT(uint16, mn_uint16_t, float16, mn_float16_t)
+MN_CVT_NEON_DEFINE_FLT(uint16, mn_uint16_t, bfloat16, mn_bfloat16_t)
+
+MN_CVT_NEON_DEFINE_INT(int32, mn_int32_t, int8, mn_int8_t)
+MN_CVT_NEON_DEFINE_INT(int32, mn_int32_t, uint8, mn_uint8_t)
+MN_CVT_NEON_DEFINE_INT(int32, mn_int32_t, int16, mn_int16_t)
+MN_CVT_NEON_DEFINE_INT(int32, mn_int32_t, uint16, mn_uint16_t)
+MN_CVT_NEON_DEFINE_FLT(int32, mn_int32_t, float, mn_float32_t)
+MN_CVT_NEON_DEFINE_FLT(int32, mn_int32_t, float16, mn_float16_t)
+MN_CVT_NEON_DEFINE_FLT(int32, mn_int32_t, bfloat16, mn_bfloat16_t)
+
+MN_CVT_NEON_DEFINE_INT(float, mn_float32_t, int8, mn_int8_t)
+MN_CVT_NEON_DEFINE_INT(float, mn_float32_t, uint8, mn_uint8_t)
+MN_CVT_NEON_DEFINE_INT(float, mn_float32_t, int16, mn_int16_t)
+MN_CVT_NEON_DEFINE_INT(float, mn_float32_t, uint16, mn_uint16_t)
+MN_CVT_NEON_DEFINE_INT(float, mn_float32_t, int32, mn_int32_t)
+MN_CVT_NEON_DEFINE_FLT(float, mn_float32_t, float16, mn_float16_t)
+MN_CVT_NEON_DEFINE_FLT(float, mn_float32_t, bfloat16, mn_bfloat16_t)
+
+MN_CVT_NEON_DEFINE_INT(float16, mn_float16_t, int8, mn_int8_t)
+MN_CVT_NEON_DEFINE_INT(float16, mn_float16_t, uint8, mn_uint8_t)
+MN_CVT_NEON_DEFINE_INT(float16, mn_float16_t, int16, mn_int16_t)
+MN_CVT_NEON_DEFINE_INT(float16, mn_float16_t, uint16, mn_uint16_t)
+MN_CVT_NEON_DEFINE_INT(float16, mn_float16_t, int32, mn_int32_t)
+MN_CVT_NEON_DEFINE_FLT(float16, mn_float16_t, float, mn_float32_t)
+MN_CVT_NEON_DEFINE_FLT(float16, mn_float16_t, bfloat16, mn_bfloat16_t)
+
+MN_CVT_NEON_DEFINE_INT(bfloat16, mn_bfloat16_t, int8, mn_int8_t)
+MN_CVT_NEON_DEFINE_INT(bfloat16, mn_bfloat16_t, uint8, mn_uint8_t)
+MN_CVT_NEON_DEFINE_INT(bfloat16, mn_bfloat16_t, int16, mn_int16_t)
+MN_CVT_NEON_DEFINE_INT(bfloat16, mn_bfloat16_t, uint16, mn_uint16_t)
+MN_CVT_NEON_DEFINE_INT(bfloat16, mn_bfloat16_t, int32, mn_int32_t)
+MN_CVT_NEON_DEFINE_FLT(bfloat16, mn_bfloat16_t, float, mn_float32_t)
+MN_CVT_NEON_DEFINE_FLT(bfloat16, mn_bfloat16_t, float16, mn_float16_t)
+
+MN_CVT_NEON_DEFINE64_FLT(int32, mn_int32_t, float64, mn_float64_t)
+MN_CVT_NEON_DEFINE64_FLT(float, mn_float32_t, float64, mn_float64_t)
+MN_CVT_NEON_DEFINE64_INT(float64, mn_float64_t, int32, mn_int32_t)
+MN_CVT_NEON_DEFINE64_FLT(float64, mn_float64_t, float, mn_float32_t)
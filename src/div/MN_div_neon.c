@@ -32,7 +32,7 @@ Intrinsics used:
 Supported routines: Int and Float 32-bit data types [1 to 4 Dimensional arrays]
 */
 
-mn_result_t mn_div_float_neon(mn_float32_t * dst, mn_float32_t * src1, mn_float32_t * src2, uint32_t count)
+mn_result_t mn_div_float_neon(mn_float32_t * dst, mn_float32_t * src1, mn_float32_t * src2, size_t count)
 {
     MN_DIV_DstSrc1Src2_DO_COUNT_TIMES_FLOAT_NEON(
         MN_MAINLOOP_FLOAT_NEON_DIV,      /* SIMD block for 4 elements */
@@ -40,7 +40,7 @@ mn_result_t mn_div_float_neon(mn_float32_t * dst, mn_float32_t * src1, mn_float3
     );
 }
 
-mn_result_t mn_div_int32_neon(mn_int32_t * dst, mn_int32_t * src1, mn_int32_t * src2, uint32_t count)
+mn_result_t mn_div_int32_neon(mn_int32_t * dst, mn_int32_t * src1, mn_int32_t * src2, size_t count)
 {
     MN_DIV_DstSrc1Src2_DO_COUNT_TIMES_INT32_NEON(
         MN_MAINLOOP_INT32_NEON_DIV,      /* SIMD block for 4 elements */
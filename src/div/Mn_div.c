@@ -17,94 +17,86 @@ Function Input:
     Supports 1-4 Dimensional vectors
 */
 
-mn_result_t mn_div_int32_c (mn_int32_t * dst, mn_int32_t * src1, mn_int32_t * src2, mn_uint32_t count)
+mn_result_t mn_div_int32_c (mn_int32_t * dst, mn_int32_t * src1, mn_int32_t * src2, size_t count)
 {
-    MN_ASSERT_DS1S2(dst, src1, src2);;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[itr] = (src1[itr]/src2[itr]);
-    }
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_int32_t,
+        d[itr] = (s1[itr]/s2[itr]);
+    );
     return MN_SUCCESS;
 }
 
-mn_result_t mn_div_vec2i_c (mn_vec2i_t * dst, mn_vec2i_t * src1, mn_vec2i_t * src2, mn_uint32_t count)
+mn_result_t mn_div_vec2i_c (mn_vec2i_t * dst, mn_vec2i_t * src1, mn_vec2i_t * src2, size_t count)
 {
-    MN_ASSERT_DS1S2(dst, src1, src2);;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ].x = (src1[ itr ].x/src2[ itr ].x);
-        dst[ itr ].y = (src1[ itr ].y/src2[ itr ].y);
-    }
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec2i_t,
+        d[ itr ].x = (s1[ itr ].x/s2[ itr ].x);
+        d[ itr ].y = (s1[ itr ].y/s2[ itr ].y);
+    );
     return MN_SUCCESS;
 }
 
-mn_result_t mn_div_vec3i_c (mn_vec3i_t * dst, mn_vec3i_t * src1, mn_vec3i_t * src2, mn_uint32_t count)
+mn_result_t mn_div_vec3i_c (mn_vec3i_t * dst, mn_vec3i_t * src1, mn_vec3i_t * src2, size_t count)
 {
-    MN_ASSERT_DS1S2(dst, src1, src2);;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ].x = (src1[ itr ].x/src2[ itr ].x);
-        dst[ itr ].y = (src1[ itr ].y/src2[ itr ].y);
-        dst[ itr ].z = (src1[ itr ].z/src2[ itr ].z);
-    }
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec3i_t,
+        d[ itr ].x = (s1[ itr ].x/s2[ itr ].x);
+        d[ itr ].y = (s1[ itr ].y/s2[ itr ].y);
+        d[ itr ].z = (s1[ itr ].z/s2[ itr ].z);
+    );
     return MN_SUCCESS;
 }
 
-mn_result_t mn_div_vec4i_c (mn_vec4i_t * dst, mn_vec4i_t * src1, mn_vec4i_t * src2, mn_uint32_t count)
+mn_result_t mn_div_vec4i_c (mn_vec4i_t * dst, mn_vec4i_t * src1, mn_vec4i_t * src2, size_t count)
 {
-    MN_ASSERT_DS1S2(dst, src1, src2);;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ].x = (src1[ itr ].x/src2[ itr ].x);
-        dst[ itr ].y = (src1[ itr ].y/src2[ itr ].y);
-        dst[ itr ].z = (src1[ itr ].z/src2[ itr ].z);
-        dst[ itr ].w = (src1[ itr ].w/src2[ itr ].w);
-    }
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec4i_t,
+        d[ itr ].x = (s1[ itr ].x/s2[ itr ].x);
+        d[ itr ].y = (s1[ itr ].y/s2[ itr ].y);
+        d[ itr ].z = (s1[ itr ].z/s2[ itr ].z);
+        d[ itr ].w = (s1[ itr ].w/s2[ itr ].w);
+    );
     return MN_SUCCESS;
 }
 
-mn_result_t mn_div_float_c (mn_float32_t * dst, mn_float32_t * src1, mn_float32_t * src2, mn_uint32_t count)
+mn_result_t mn_div_float_c (mn_float32_t * dst, mn_float32_t * src1, mn_float32_t * src2, size_t count)
 {
-    MN_ASSERT_DS1S2(dst, src1, src2);;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[itr] = (src1[itr]/src2[itr]);
-    }
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_float32_t,
+        d[itr] = (s1[itr]/s2[itr]);
+    );
     return MN_SUCCESS;
 }
 
-mn_result_t mn_div_vec2f_c (mn_vec2f_t * dst, mn_vec2f_t * src1, mn_vec2f_t * src2, mn_uint32_t count)
+mn_result_t mn_div_vec2f_c (mn_vec2f_t * dst, mn_vec2f_t * src1, mn_vec2f_t * src2, size_t count)
 {
-    MN_ASSERT_DS1S2(dst, src1, src2);;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ].x = (src1[ itr ].x/src2[ itr ].x);
-        dst[ itr ].y = (src1[ itr ].y/src2[ itr ].y);
-    }
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec2f_t,
+        d[ itr ].x = (s1[ itr ].x/s2[ itr ].x);
+        d[ itr ].y = (s1[ itr ].y/s2[ itr ].y);
+    );
     return MN_SUCCESS;
 }
 
-mn_result_t mn_div_vec3f_c (mn_vec3f_t * dst, mn_vec3f_t * src1, mn_vec3f_t * src2, mn_uint32_t count)
+mn_result_t mn_div_vec3f_c (mn_vec3f_t * dst, mn_vec3f_t * src1, mn_vec3f_t * src2, size_t count)
 {
-    MN_ASSERT_DS1S2(dst, src1, src2);;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ].x = (src1[ itr ].x/src2[ itr ].x);
-        dst[ itr ].y = (src1[ itr ].y/src2[ itr ].y);
-        dst[ itr ].z = (src1[ itr ].z/src2[ itr ].z);
-    }
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec3f_t,
+        d[ itr ].x = (s1[ itr ].x/s2[ itr ].x);
+        d[ itr ].y = (s1[ itr ].y/s2[ itr ].y);
+        d[ itr ].z = (s1[ itr ].z/s2[ itr ].z);
+    );
     return MN_SUCCESS;
 }
 
-mn_result_t mn_div_vec4f_c (mn_vec4f_t * dst, mn_vec4f_t * src1, mn_vec4f_t * src2, mn_uint32_t count)
+mn_result_t mn_div_vec4f_c (mn_vec4f_t * dst, mn_vec4f_t * src1, mn_vec4f_t * src2, size_t count)
 {
-    MN_ASSERT_DS1S2(dst, src1, src2);;
-    for ( unsigned int itr = 0; itr < count; itr++ )
-    {
-        dst[ itr ].x = (src1[ itr ].x/src2[ itr ].x);
-        dst[ itr ].y = (src1[ itr ].y/src2[ itr ].y);
-        dst[ itr ].z = (src1[ itr ].z/src2[ itr ].z);
-        dst[ itr ].w = (src1[ itr ].w/src2[ itr ].w);
-    }
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec4f_t,
+        d[ itr ].x = (s1[ itr ].x/s2[ itr ].x);
+        d[ itr ].y = (s1[ itr ].y/s2[ itr ].y);
+        d[ itr ].z = (s1[ itr ].z/s2[ itr ].z);
+        d[ itr ].w = (s1[ itr ].w/s2[ itr ].w);
+    );
     return MN_SUCCESS;
 }
@@ -0,0 +1,74 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <assert.h>
+#include <math.h>
+
+/*
+Function Input:
+    dst      - Destination array
+    src      - Arguments (exp, exp2, log, log2)
+    src1     - Bases (pow)
+    src2     - Exponents (pow)
+    count    - Count is an integer that stores number of elements
+    accuracy - MN_ACCURACY_PRECISE, MN_ACCURACY_FAST or MN_ACCURACY_ULTRA
+
+    C Implementation of the transcendental routines with the libm float
+    functions, the reference for the NEON versions:
+        exp:  dst[i] = expf(src[i])
+        exp2: dst[i] = exp2f(src[i])
+        log:  dst[i] = logf(src[i])
+        log2: dst[i] = log2f(src[i])
+        pow:  dst[i] = powf(src1[i], src2[i])
+    libm is at least as accurate as every tier, so accuracy is only checked
+    (MN_ERROR for an unknown value). dst may be the same array as a source.
+*/
+
+#define MN_EXPLOG_CHECK_ACCURACY(accuracy) \
+    do { \
+        if ((accuracy) != MN_ACCURACY_PRECISE && (accuracy) != MN_ACCURACY_FAST && \
+            (accuracy) != MN_ACCURACY_ULTRA) \
+        { \
+            return MN_ERROR; \
+        } \
+    } while (0)
+
+#define MN_EXPLOG_UNARY_C(fn) \
+    MN_CHECK_DstSRC; \
+    MN_EXPLOG_CHECK_ACCURACY(accuracy); \
+    for ( size_t itr = 0; itr < count; itr++ ) \
+    { \
+        dst[ itr ] = fn(src[ itr ]); \
+    } \
+    return MN_OK;
+
+mn_result_t mn_exp_float_c (mn_float32_t * dst, mn_float32_t * src, size_t count, int accuracy)
+{
+    MN_EXPLOG_UNARY_C(expf)
+}
+
+mn_result_t mn_exp2_float_c (mn_float32_t * dst, mn_float32_t * src, size_t count, int accuracy)
+{
+    MN_EXPLOG_UNARY_C(exp2f)
+}
+
+mn_result_t mn_log_float_c (mn_float32_t * dst, mn_float32_t * src, size_t count, int accuracy)
+{
+    MN_EXPLOG_UNARY_C(logf)
+}
+
+mn_result_t mn_log2_float_c (mn_float32_t * dst, mn_float32_t * src, size_t count, int accuracy)
+{
+    MN_EXPLOG_UNARY_C(log2f)
+}
+
+mn_result_t mn_pow_float_c (mn_float32_t * dst, mn_float32_t * src1, mn_float32_t * src2, size_t count, int accuracy)
+{
+    MN_CHECK_Dst1SRC1SRC2(dst, src1, src2);
+    MN_EXPLOG_CHECK_ACCURACY(accuracy);
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = powf(src1[ itr ], src2[ itr ]);
+    }
+    return MN_OK;
+}
@@ -0,0 +1,297 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include "../common/MN_explog_neon.h"
+#include <arm_neon.h>
+#include <assert.h>
+#include <math.h>
+
+/*
+Input Arguments:
+    dst      - Destination array
+    src      - Arguments (exp, exp2, log, log2)
+    src1     - Bases (pow)
+    src2     - Exponents (pow)
+    count    - Count is an integer that stores number of elements
+    accuracy - MN_ACCURACY_PRECISE, MN_ACCURACY_FAST or MN_ACCURACY_ULTRA
+
+Intrinsics used:
+    vfmaq_f32       - polynomial evaluation and range reduction
+                      (vmlaq_f32 on 32-bit ARM without FMA)
+    vshlq_n_s32 / vshrq_n_s32 - build 2^n and split the exponent field
+    vmaxvq_u32      - any lane outside the vector path (vpmax_u32 on 32-bit ARM)
+    vcvt_f64_f32 / vdivq_f64 / vrndnq_f64 - precise pow in double (AArch64)
+
+The polynomials and the range reductions live in ../common/MN_explog_neon.h.
+exp / exp2 map the vector function over the array (MN_MAP_F32_NEON). log /
+log2 use the same 16 / 4 / padded tail steps but also flag special lanes per
+vector; pow keeps two vectors of bases and exponents in flight and pads its
+tail with 1.0f.
+
+log / log2 / pow lanes outside the vector path (zero, negative, subnormal,
+inf, NaN, non-finite exponents) are recomputed with logf / log2f / powf, so
+the special values match libm. The precise pow computes y * log2(x) and the
+exp2 in double on AArch64; 32-bit ARM has no double NEON and runs powf.
+
+Supported routines: exp, exp2, log, log2, pow
+*/
+
+/* dst[i] = VEC(src[i]) */
+#define MN_EXPLOG_UNARY_NEON(VEC) MN_MAP_F32_NEON(dst, src, count, VEC, 0.0f)
+
+/* Redo the flagged lanes of dst[0 .. 3] with the libm function (x kept in registers for in-place calls) */
+static inline void mn_explog_fix_unary (mn_float32_t * dst, float32x4_t x, uint32x4_t mask, float (*fn)(float))
+{
+    mn_float32_t v[ 4 ];
+    mn_uint32_t m[ 4 ];
+    vst1q_f32(v, x);
+    vst1q_u32(m, mask);
+    for ( int i = 0; i < 4; i++ )
+    {
+        if (m[ i ]) dst[ i ] = fn(v[ i ]);
+    }
+}
+
+/* dst[i] = VEC(src[i]), lanes outside the log vector path from SCALAR */
+#define MN_EXPLOG_LOG_NEON(VEC, SCALAR) \
+    do { \
+        size_t itr = 0; \
+        for ( ; itr + 16 <= count; itr += 16 ) \
+        { \
+            const float32x4_t x0 = vld1q_f32(src + itr); \
+            const float32x4_t x1 = vld1q_f32(src + itr + 4); \
+            const float32x4_t x2 = vld1q_f32(src + itr + 8); \
+            const float32x4_t x3 = vld1q_f32(src + itr + 12); \
+            const uint32x4_t s0 = mn_explog_log_special(x0); \
+            const uint32x4_t s1 = mn_explog_log_special(x1); \
+            const uint32x4_t s2 = mn_explog_log_special(x2); \
+            const uint32x4_t s3 = mn_explog_log_special(x3); \
+            const float32x4_t r0 = VEC(x0); \
+            const float32x4_t r1 = VEC(x1); \
+            const float32x4_t r2 = VEC(x2); \
+            const float32x4_t r3 = VEC(x3); \
+            vst1q_f32(dst + itr, r0); \
+            vst1q_f32(dst + itr + 4, r1); \
+            vst1q_f32(dst + itr + 8, r2); \
+            vst1q_f32(dst + itr + 12, r3); \
+            if (mn_explog_any(vorrq_u32(vorrq_u32(s0, s1), vorrq_u32(s2, s3)))) \
+            { \
+                mn_explog_fix_unary(dst + itr, x0, s0, SCALAR); \
+                mn_explog_fix_unary(dst + itr + 4, x1, s1, SCALAR); \
+                mn_explog_fix_unary(dst + itr + 8, x2, s2, SCALAR); \
+                mn_explog_fix_unary(dst + itr + 12, x3, s3, SCALAR); \
+            } \
+        } \
+        for ( ; itr + 4 <= count; itr += 4 ) \
+        { \
+            const float32x4_t x = vld1q_f32(src + itr); \
+            const uint32x4_t sp = mn_explog_log_special(x); \
+            vst1q_f32(dst + itr, VEC(x)); \
+            if (mn_explog_any(sp)) mn_explog_fix_unary(dst + itr, x, sp, SCALAR); \
+        } \
+        if (itr < count) \
+        { \
+            mn_float32_t in[ 4 ] = { 1.0f, 1.0f, 1.0f, 1.0f }, out[ 4 ]; \
+            for ( size_t i = 0; itr + i < count; i++ ) in[ i ] = src[ itr + i ]; \
+            const float32x4_t x = vld1q_f32(in); \
+            vst1q_f32(out, VEC(x)); \
+            mn_explog_fix_unary(out, x, mn_explog_log_special(x), SCALAR); \
+            for ( size_t i = 0; itr + i < count; i++ ) dst[ itr + i ] = out[ i ]; \
+        } \
+    } while (0)
+
+mn_result_t mn_exp_float_neon (mn_float32_t * dst, mn_float32_t * src, size_t count, int accuracy)
+{
+    MN_CHECK_DstSRC;
+    switch (accuracy)
+    {
+    case MN_ACCURACY_PRECISE: MN_EXPLOG_UNARY_NEON(mn_explog_exp); break;
+    case MN_ACCURACY_FAST:    MN_EXPLOG_UNARY_NEON(mn_explog_exp_fast); break;
+    case MN_ACCURACY_ULTRA:   MN_EXPLOG_UNARY_NEON(mn_explog_exp_ultra); break;
+    default: return MN_ERROR;
+    }
+    return MN_OK;
+}
+
+mn_result_t mn_exp2_float_neon (mn_float32_t * dst, mn_float32_t * src, size_t count, int accuracy)
+{
+    MN_CHECK_DstSRC;
+    switch (accuracy)
+    {
+    case MN_ACCURACY_PRECISE: MN_EXPLOG_UNARY_NEON(mn_explog_exp2); break;
+    case MN_ACCURACY_FAST:    MN_EXPLOG_UNARY_NEON(mn_explog_exp2_fast); break;
+    case MN_ACCURACY_ULTRA:   MN_EXPLOG_UNARY_NEON(mn_explog_exp2_ultra); break;
+    default: return MN_ERROR;
+    }
+    return MN_OK;
+}
+
+mn_result_t mn_log_float_neon (mn_float32_t * dst, mn_float32_t * src, size_t count, int accuracy)
+{
+    MN_CHECK_DstSRC;
+    switch (accuracy)
+    {
+    case MN_ACCURACY_PRECISE: MN_EXPLOG_LOG_NEON(mn_explog_log, logf); break;
+    case MN_ACCURACY_FAST:    MN_EXPLOG_LOG_NEON(mn_explog_log_fast, logf); break;
+    case MN_ACCURACY_ULTRA:   MN_EXPLOG_LOG_NEON(mn_explog_log_ultra, logf); break;
+    default: return MN_ERROR;
+    }
+    return MN_OK;
+}
+
+mn_result_t mn_log2_float_neon (mn_float32_t * dst, mn_float32_t * src, size_t count, int accuracy)
+{
+    MN_CHECK_DstSRC;
+    switch (accuracy)
+    {
+    case MN_ACCURACY_PRECISE: MN_EXPLOG_LOG_NEON(mn_explog_log2, log2f); break;
+    case MN_ACCURACY_FAST:    MN_EXPLOG_LOG_NEON(mn_explog_log2_fast, log2f); break;
+    case MN_ACCURACY_ULTRA:   MN_EXPLOG_LOG_NEON(mn_explog_log2_ultra, log2f); break;
+    default: return MN_ERROR;
+    }
+    return MN_OK;
+}
+
+/* ===== pow ===== */
+
+/* All ones where y is inf or NaN */
+static inline uint32x4_t mn_pow_y_special (float32x4_t y)
+{
+    const uint32x4_t u = vandq_u32(vreinterpretq_u32_f32(y), vdupq_n_u32(0x7fffffff));
+    return vcgeq_u32(u, vdupq_n_u32(0x7f800000));
+}
+
+static inline float32x4_t mn_pow_fast (float32x4_t x, float32x4_t y)
+{
+    return mn_explog_exp2_fast(vmulq_f32(y, mn_explog_log2_fast(x)));
+}
+
+static inline float32x4_t mn_pow_ultra (float32x4_t x, float32x4_t y)
+{
+    return mn_explog_exp2_ultra(vmulq_f32(y, mn_explog_log2_ultra(x)));
+}
+
+#if defined(MN_FP64_NEON)
+/*
+x^y for 2 lanes in double, x > 0 finite (float subnormals are normal here):
+    x = 2^e * m, m in [sqrt(1/2), sqrt(2)), s = (m - 1) / (m + 1)
+    log2(x) = e + 2 log2(e) * s * (1 + s^2 / 3 + ... + s^12 / 13)   (|s| < 0.172)
+    t = y * log2(x) = n + f, 2^f = sum (f ln2)^k / k!, k <= 9           (|f| <= 1/2)
+Both series are well below the float rounding error, so the result is
+correctly rounded in nearly all cases once narrowed back to float.
+*/
+static inline float64x2_t mn_pow_f64 (float64x2_t x, float64x2_t y)
+{
+    const float64x2_t one = vdupq_n_f64(1.0);
+    const int64x2_t u = vreinterpretq_s64_f64(x);
+    const int64x2_t ei = vshrq_n_s64(vsubq_s64(u, vdupq_n_s64(0x3fe6a09e667f3bcdLL)), 52);
+    const float64x2_t m = vreinterpretq_f64_s64(vsubq_s64(u, vshlq_n_s64(ei, 52)));
+    const float64x2_t s = vdivq_f64(vsubq_f64(m, one), vaddq_f64(m, one));
+    const float64x2_t s2 = vmulq_f64(s, s);
+    float64x2_t p = vdupq_n_f64(1.0 / 13.0);
+    p = vfmaq_f64(vdupq_n_f64(1.0 / 11.0), p, s2);
+    p = vfmaq_f64(vdupq_n_f64(1.0 / 9.0), p, s2);
+    p = vfmaq_f64(vdupq_n_f64(1.0 / 7.0), p, s2);
+    p = vfmaq_f64(vdupq_n_f64(1.0 / 5.0), p, s2);
+    p = vfmaq_f64(vdupq_n_f64(1.0 / 3.0), p, s2);
+    p = vfmaq_f64(one, p, s2);
+    const float64x2_t l2 = vfmaq_f64(vcvtq_f64_s64(ei), vmulq_f64(s, p), vdupq_n_f64(2.0 * 1.4426950408889634));
+
+    /* beyond [-160, 130] the float result is 0 or inf anyway */
+    const float64x2_t t = vminq_f64(vmaxq_f64(vmulq_f64(y, l2), vdupq_n_f64(-160.0)), vdupq_n_f64(130.0));
+    const float64x2_t n = vrndnq_f64(t);
+    const float64x2_t g = vmulq_f64(vsubq_f64(t, n), vdupq_n_f64(0.69314718055994531));
+    float64x2_t e = vdupq_n_f64(1.0 / 362880.0);
+    e = vfmaq_f64(vdupq_n_f64(1.0 / 40320.0), e, g);
+    e = vfmaq_f64(vdupq_n_f64(1.0 / 5040.0), e, g);
+    e = vfmaq_f64(vdupq_n_f64(1.0 / 720.0), e, g);
+    e = vfmaq_f64(vdupq_n_f64(1.0 / 120.0), e, g);
+    e = vfmaq_f64(vdupq_n_f64(1.0 / 24.0), e, g);
+    e = vfmaq_f64(vdupq_n_f64(1.0 / 6.0), e, g);
+    e = vfmaq_f64(vdupq_n_f64(0.5), e, g);
+    e = vfmaq_f64(one, e, g);
+    e = vfmaq_f64(one, e, g);
+    return vreinterpretq_f64_s64(vaddq_s64(vreinterpretq_s64_f64(e), vshlq_n_s64(vcvtq_s64_f64(n), 52)));
+}
+
+static inline float32x4_t mn_pow_precise (float32x4_t x, float32x4_t y)
+{
+    const float64x2_t lo = mn_pow_f64(vcvt_f64_f32(vget_low_f32(x)), vcvt_f64_f32(vget_low_f32(y)));
+    const float64x2_t hi = mn_pow_f64(vcvt_high_f64_f32(x), vcvt_high_f64_f32(y));
+    return vcvt_high_f32_f64(vcvt_f32_f64(lo), hi);
+}
+
+/* x <= 0, inf or NaN; subnormal x are fine in double */
+static inline uint32x4_t mn_pow_x_special (float32x4_t x)
+{
+    const uint32x4_t u = vreinterpretq_u32_f32(x);
+    return vcgeq_u32(vsubq_u32(u, vdupq_n_u32(1)), vdupq_n_u32(0x7f7fffff));
+}
+#endif
+
+static inline void mn_pow_fix (mn_float32_t * dst, float32x4_t x, float32x4_t y, uint32x4_t mask)
+{
+    mn_float32_t a[ 4 ], b[ 4 ];
+    mn_uint32_t m[ 4 ];
+    vst1q_f32(a, x);
+    vst1q_f32(b, y);
+    vst1q_u32(m, mask);
+    for ( int i = 0; i < 4; i++ )
+    {
+        if (m[ i ]) dst[ i ] = powf(a[ i ], b[ i ]);
+    }
+}
+
+/* dst[i] = VEC(src1[i], src2[i]), lanes flagged by XSPECIAL or a non-finite exponent from powf */
+#define MN_POW_NEON(VEC, XSPECIAL) \
+    do { \
+        size_t itr = 0; \
+        for ( ; itr + 8 <= count; itr += 8 ) \
+        { \
+            const float32x4_t x0 = vld1q_f32(src1 + itr); \
+            const float32x4_t x1 = vld1q_f32(src1 + itr + 4); \
+            const float32x4_t y0 = vld1q_f32(src2 + itr); \
+            const float32x4_t y1 = vld1q_f32(src2 + itr + 4); \
+            const uint32x4_t s0 = vorrq_u32(XSPECIAL(x0), mn_pow_y_special(y0)); \
+            const uint32x4_t s1 = vorrq_u32(XSPECIAL(x1), mn_pow_y_special(y1)); \
+            const float32x4_t r0 = VEC(x0, y0); \
+            const float32x4_t r1 = VEC(x1, y1); \
+            vst1q_f32(dst + itr, r0); \
+            vst1q_f32(dst + itr + 4, r1); \
+            if (mn_explog_any(vorrq_u32(s0, s1))) \
+            { \
+                mn_pow_fix(dst + itr, x0, y0, s0); \
+                mn_pow_fix(dst + itr + 4, x1, y1, s1); \
+            } \
+        } \
+        for ( ; itr < count; itr += 4 ) \
+        { \
+            mn_float32_t a[ 4 ] = { 1.0f, 1.0f, 1.0f, 1.0f }, b[ 4 ] = { 1.0f, 1.0f, 1.0f, 1.0f }, out[ 4 ]; \
+            const size_t n = count - itr < 4 ? count - itr : 4; \
+            for ( size_t i = 0; i < n; i++ ) { a[ i ] = src1[ itr + i ]; b[ i ] = src2[ itr + i ]; } \
+            const float32x4_t x = vld1q_f32(a); \
+            const float32x4_t y = vld1q_f32(b); \
+            vst1q_f32(out, VEC(x, y)); \
+            mn_pow_fix(out, x, y, vorrq_u32(XSPECIAL(x), mn_pow_y_special(y))); \
+            for ( size_t i = 0; i < n; i++ ) dst[ itr + i ] = out[ i ]; \
+        } \
+    } while (0)
+
+mn_result_t mn_pow_float_neon (mn_float32_t * dst, mn_float32_t * src1, mn_float32_t * src2, size_t count, int accuracy)
+{
+    MN_CHECK_Dst1SRC1SRC2(dst, src1, src2);
+    switch (accuracy)
+    {
+    case MN_ACCURACY_PRECISE:
+#if defined(MN_FP64_NEON)
+        MN_POW_NEON(mn_pow_precise, mn_pow_x_special);
+        break;
+#else
+        return mn_pow_float_c(dst, src1, src2, count, accuracy);
+#endif
+    case MN_ACCURACY_FAST:  MN_POW_NEON(mn_pow_fast, mn_explog_log_special); break;
+    case MN_ACCURACY_ULTRA: MN_POW_NEON(mn_pow_ultra, mn_explog_log_special); break;
+    default: return MN_ERROR;
+    }
+    return MN_OK;
+}
@@ -0,0 +1,207 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include "../common/MN_fft.h"
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+Function Input:
+    plan  - Plan from mn_fft_plan_complex / mn_fft_plan_real
+    n     - Transform length: complex points, or real samples (even) for real plans
+    dst   - count transforms back to back: n complex values (fft), n / 2 + 1
+            complex values (rfft forward) or n real samples (rfft inverse)
+    src   - count transforms back to back, same layouts as dst
+    count - Number of transforms (batch)
+
+    C Implementation of
+        fft forward:  X[k] = sum_j x[j] exp(-2 pi i j k / n)
+        fft inverse:  x[j] = 1 / n * sum_k X[k] exp(2 pi i j k / n)
+        rfft forward: the first n / 2 + 1 values of the forward FFT of a real signal
+        rfft inverse: the real signal back from those n / 2 + 1 values
+    so inverse(forward(x)) == x. n may have the prime factors 2, 3 and 5.
+    fft may run in place (dst == src), rfft may not.
+*/
+
+static void mn_fft_stage_run_c (mn_complexf_t * out, const mn_complexf_t * in, size_t nc, size_t p, size_t ns,
+                                const mn_complexf_t * tw, int inverse)
+{
+    mn_fft_stage_c(out, in, nc, p, ns, tw, inverse, 0);
+}
+
+static void mn_fft_real_post_run_c (mn_complexf_t * dst, const mn_complexf_t * z, const mn_complexf_t * w, size_t nc)
+{
+    mn_fft_real_post_c(dst, z, w, nc, 1, nc);
+}
+
+static void mn_fft_real_pre_run_c (mn_complexf_t * z, const mn_complexf_t * src, const mn_complexf_t * w, size_t nc)
+{
+    mn_fft_real_pre_c(z, src, w, nc, 0, nc);
+}
+
+MN_FFT_DEFINE_RUN(mn_fft_run_c, mn_fft_stage_run_c, mn_mulc_float_c, mn_fft_real_post_run_c, mn_fft_real_pre_run_c)
+
+/* ===== plans ===== */
+
+static mn_complexf_t mn_fft_root (size_t k, size_t n)
+{
+    const double angle = -2.0 * MN_FFT_PI * (double)(k % n) / (double)n;
+    mn_complexf_t w;
+    w.re = (mn_float32_t)cos(angle);
+    w.im = (mn_float32_t)sin(angle);
+    return w;
+}
+
+/* Radix 4 stages first so later stages see ns % 4 == 0 (the NEON fast path) */
+static mn_result_t mn_fft_factorize (mn_fft_plan_t * plan, size_t nc)
+{
+    static const size_t radices[] = { 4, 2, 3, 5 };
+    size_t rest = nc;
+
+    plan->num_factors = 0;
+    for ( size_t r = 0; r < sizeof(radices) / sizeof(radices[0]); r++ )
+    {
+        while (rest % radices[ r ] == 0)
+        {
+            plan->factors[ plan->num_factors++ ] = radices[ r ];
+            rest /= radices[ r ];
+        }
+    }
+    return rest == 1 ? MN_SUCCESS : MN_ERROR;
+}
+
+static mn_result_t mn_fft_plan_init (mn_fft_plan_t * plan, size_t n, size_t nc, int real)
+{
+    size_t ns = 1, pos = 0;
+
+    assert(plan);
+    memset(plan, 0, sizeof(*plan));
+    if (nc == 0 || mn_fft_factorize(plan, nc) != MN_SUCCESS)
+    {
+        return MN_ERROR;
+    }
+    plan->n = n;
+    plan->nc = nc;
+    plan->real = real;
+    plan->twiddles = (mn_complexf_t *)malloc(nc * sizeof(mn_complexf_t));
+    plan->itwiddles = (mn_complexf_t *)malloc(nc * sizeof(mn_complexf_t));
+    plan->buffer = (mn_complexf_t *)malloc((real ? 3 : 2) * nc * sizeof(mn_complexf_t));
+    if (real)
+    {
+        plan->rtwiddles = (mn_complexf_t *)malloc(nc * sizeof(mn_complexf_t));
+    }
+    if (!plan->twiddles || !plan->itwiddles || !plan->buffer || (real && !plan->rtwiddles))
+    {
+        mn_fft_plan_free(plan);
+        return MN_ERROR;
+    }
+
+    /* stage s: tw[(r - 1) * ns + k] = exp(-2 pi i r k / (ns * p)), nc - 1 values in all */
+    for ( size_t s = 0; s < plan->num_factors; s++ )
+    {
+        const size_t p = plan->factors[ s ];
+        for ( size_t r = 1; r < p; r++ )
+        {
+            for ( size_t k = 0; k < ns; k++, pos++ )
+            {
+                plan->twiddles[ pos ] = mn_fft_root(r * k, ns * p);
+                plan->itwiddles[ pos ].re = plan->twiddles[ pos ].re;
+                plan->itwiddles[ pos ].im = -plan->twiddles[ pos ].im;
+            }
+        }
+        ns *= p;
+    }
+    for ( size_t k = 0; real && k < nc; k++ )
+    {
+        plan->rtwiddles[ k ] = mn_fft_root(k, n);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_fft_plan_complex (mn_fft_plan_t * plan, size_t n)
+{
+    return mn_fft_plan_init(plan, n, n, 0);
+}
+
+mn_result_t mn_fft_plan_real (mn_fft_plan_t * plan, size_t n)
+{
+    if (n % 2 != 0)
+    {
+        assert(plan);
+        memset(plan, 0, sizeof(*plan));
+        return MN_ERROR;
+    }
+    return mn_fft_plan_init(plan, n, n / 2, 1);
+}
+
+void mn_fft_plan_free (mn_fft_plan_t * plan)
+{
+    if (plan)
+    {
+        free(plan->twiddles);
+        free(plan->itwiddles);
+        free(plan->rtwiddles);
+        free(plan->buffer);
+        plan->twiddles = plan->itwiddles = plan->rtwiddles = plan->buffer = NULL;
+    }
+}
+
+/* ===== transforms ===== */
+
+mn_result_t mn_fft_forward_c (const mn_fft_plan_t * plan, mn_complexf_t * dst, mn_complexf_t * src, size_t count)
+{
+    assert(plan && dst && src);
+    if (plan->real || !plan->buffer)
+    {
+        return MN_ERROR;
+    }
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        mn_fft_run_c_complex(plan, dst + itr * plan->n, src + itr * plan->n, 0);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_fft_inverse_c (const mn_fft_plan_t * plan, mn_complexf_t * dst, mn_complexf_t * src, size_t count)
+{
+    assert(plan && dst && src);
+    if (plan->real || !plan->buffer)
+    {
+        return MN_ERROR;
+    }
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        mn_fft_run_c_complex(plan, dst + itr * plan->n, src + itr * plan->n, 1);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_rfft_forward_c (const mn_fft_plan_t * plan, mn_complexf_t * dst, mn_float32_t * src, size_t count)
+{
+    assert(plan && dst && src);
+    if (!plan->real || !plan->buffer)
+    {
+        return MN_ERROR;
+    }
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        mn_fft_run_c_real_forward(plan, dst + itr * (plan->nc + 1), src + itr * plan->n);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_rfft_inverse_c (const mn_fft_plan_t * plan, mn_float32_t * dst, mn_complexf_t * src, size_t count)
+{
+    assert(plan && dst && src);
+    if (!plan->real || !plan->buffer)
+    {
+        return MN_ERROR;
+    }
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        mn_fft_run_c_real_inverse(plan, dst + itr * plan->n, src + itr * (plan->nc + 1));
+    }
+    return MN_SUCCESS;
+}
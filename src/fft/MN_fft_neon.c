@@ -0,0 +1,323 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include "../common/MN_fft.h"
+#include <arm_neon.h>
+#include <assert.h>
+
+/*
+Input Arguments:
+    plan  - Plan from mn_fft_plan_complex / mn_fft_plan_real (see mn_fft_forward_c)
+    dst   - count transforms back to back
+    src   - count transforms back to back
+    count - Number of transforms (batch)
+
+Intrinsics used:
+    vld2q_f32 / vst2q_f32 - 4 complex values as float32x4x2_t (val[0] real, val[1] imaginary)
+    vfmaq_f32 / vfmsq_f32 - twiddle multiply (vmlaq_f32 / vmlsq_f32 on 32-bit ARM without FMA)
+    vtrnq_f32 / vcombine_f32 - 4x4 transpose for the first radix-4 stage
+    vrev64q_f32 / vextq_f32  - mirrored Z[nc - k] for the real transforms
+
+Stockham stages (../common/MN_fft.h) read in[j + r * m] and write
+out[(j - k) * p + k + r * ns] with k = j % ns. Once ns is a multiple of 4,
+4 consecutive j share j / ns, so inputs, twiddles and outputs are all
+contiguous runs of 4 values: one vld2q_f32 / vst2q_f32 each, the butterfly
+(radix 2, 3, 4 or 5) runs on 4 points at once.
+The first stage (ns == 1, radix 4, no twiddles) writes out[4 j + r]: the
+results are transposed in registers and stored as rows of 4.
+Stages with other ns (short or odd lengths) use the C stage.
+
+Batched transforms reuse the plan's twiddles, which stay in cache.
+
+Supported routines: complex forward / inverse FFT, real forward / inverse FFT
+*/
+
+static inline float32x4x2_t mn_fft_vmul (float32x4x2_t a, float32x4x2_t w)
+{
+    float32x4x2_t r;
+    r.val[0] = MN_FMSQ_F32(vmulq_f32(a.val[0], w.val[0]), a.val[1], w.val[1]);
+    r.val[1] = MN_FMAQ_F32(vmulq_f32(a.val[0], w.val[1]), a.val[1], w.val[0]);
+    return r;
+}
+
+static inline float32x4x2_t mn_fft_vadd (float32x4x2_t a, float32x4x2_t b)
+{
+    float32x4x2_t r;
+    r.val[0] = vaddq_f32(a.val[0], b.val[0]);
+    r.val[1] = vaddq_f32(a.val[1], b.val[1]);
+    return r;
+}
+
+static inline float32x4x2_t mn_fft_vsub (float32x4x2_t a, float32x4x2_t b)
+{
+    float32x4x2_t r;
+    r.val[0] = vsubq_f32(a.val[0], b.val[0]);
+    r.val[1] = vsubq_f32(a.val[1], b.val[1]);
+    return r;
+}
+
+/* m - i v and m + i v */
+static inline void mn_fft_vrot (float32x4x2_t * lo, float32x4x2_t * hi, float32x4x2_t m, float32x4x2_t v)
+{
+    lo->val[0] = vaddq_f32(m.val[0], v.val[1]);
+    lo->val[1] = vsubq_f32(m.val[1], v.val[0]);
+    hi->val[0] = vsubq_f32(m.val[0], v.val[1]);
+    hi->val[1] = vaddq_f32(m.val[1], v.val[0]);
+}
+
+static inline float32x4x2_t mn_fft_vscale (float32x4x2_t a, mn_float32_t c)
+{
+    float32x4x2_t r;
+    r.val[0] = vmulq_n_f32(a.val[0], c);
+    r.val[1] = vmulq_n_f32(a.val[1], c);
+    return r;
+}
+
+/* ===== butterflies: forward DFT of a[0 .. p - 1], same steps as mn_fft_butterfly_c ===== */
+
+static inline void mn_fft_bfly2_neon (float32x4x2_t * a)
+{
+    const float32x4x2_t t = a[0];
+    a[0] = mn_fft_vadd(t, a[1]);
+    a[1] = mn_fft_vsub(t, a[1]);
+}
+
+static inline void mn_fft_bfly3_neon (float32x4x2_t * a)
+{
+    const float32x4x2_t t = mn_fft_vadd(a[1], a[2]);
+    const float32x4x2_t d = mn_fft_vscale(mn_fft_vsub(a[1], a[2]), MN_FFT_S3);
+    const float32x4x2_t m = mn_fft_vsub(a[0], mn_fft_vscale(t, 0.5f));
+    a[0] = mn_fft_vadd(a[0], t);
+    mn_fft_vrot(&a[1], &a[2], m, d);
+}
+
+static inline void mn_fft_bfly4_neon (float32x4x2_t * a)
+{
+    const float32x4x2_t t1 = mn_fft_vadd(a[0], a[2]);
+    const float32x4x2_t d1 = mn_fft_vsub(a[0], a[2]);
+    const float32x4x2_t t2 = mn_fft_vadd(a[1], a[3]);
+    const float32x4x2_t d2 = mn_fft_vsub(a[1], a[3]);
+    a[0] = mn_fft_vadd(t1, t2);
+    a[2] = mn_fft_vsub(t1, t2);
+    mn_fft_vrot(&a[1], &a[3], d1, d2);
+}
+
+static inline void mn_fft_bfly5_neon (float32x4x2_t * a)
+{
+    const float32x4x2_t t1 = mn_fft_vadd(a[1], a[4]);
+    const float32x4x2_t d1 = mn_fft_vsub(a[1], a[4]);
+    const float32x4x2_t t2 = mn_fft_vadd(a[2], a[3]);
+    const float32x4x2_t d2 = mn_fft_vsub(a[2], a[3]);
+    const float32x4x2_t m1 = mn_fft_vadd(a[0], mn_fft_vadd(mn_fft_vscale(t1, MN_FFT_C51), mn_fft_vscale(t2, MN_FFT_C52)));
+    const float32x4x2_t m2 = mn_fft_vadd(a[0], mn_fft_vadd(mn_fft_vscale(t1, MN_FFT_C52), mn_fft_vscale(t2, MN_FFT_C51)));
+    const float32x4x2_t s1 = mn_fft_vadd(mn_fft_vscale(d1, MN_FFT_S51), mn_fft_vscale(d2, MN_FFT_S52));
+    const float32x4x2_t s2 = mn_fft_vsub(mn_fft_vscale(d1, MN_FFT_S52), mn_fft_vscale(d2, MN_FFT_S51));
+    a[0] = mn_fft_vadd(a[0], mn_fft_vadd(t1, t2));
+    mn_fft_vrot(&a[1], &a[4], m1, s1);
+    mn_fft_vrot(&a[2], &a[3], m2, s2);
+}
+
+/* ===== stages ===== */
+
+/* ns % 4 == 0: 4 consecutive j give 4 consecutive k, inputs / twiddles / outputs */
+#define MN_FFT_STAGE_NEON(P, BFLY) \
+    for ( size_t j = 0; j < m; j += 4 ) \
+    { \
+        const size_t k = j % ns; \
+        mn_complexf_t * o = out + (j - k) * (P) + k; \
+        float32x4x2_t a[ P ]; \
+        a[ 0 ] = vld2q_f32(&in[ j ].re); \
+        for ( size_t r = 1; r < (P); r++ ) \
+        { \
+            a[ r ] = mn_fft_vmul(vld2q_f32(&in[ j + r * m ].re), vld2q_f32(&tw[ (r - 1) * ns + k ].re)); \
+        } \
+        BFLY(a); \
+        for ( size_t r = 0; r < (P); r++ ) \
+        { \
+            vst2q_f32(&o[ r * ns ].re, a[ inverse ? ((P) - r) % (P) : r ]); \
+        } \
+    }
+
+/* rows q of 4 lanes t -> rows t of 4 lanes q */
+static inline void mn_fft_transpose4 (float32x4_t * v)
+{
+    const float32x4x2_t t01 = vtrnq_f32(v[0], v[1]);
+    const float32x4x2_t t23 = vtrnq_f32(v[2], v[3]);
+    v[0] = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+    v[1] = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+    v[2] = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+    v[3] = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+}
+
+/* First radix-4 stage (ns == 1): twiddles are 1, point j writes out[4 j .. 4 j + 3] */
+static void mn_fft_stage_first4_neon (mn_complexf_t * out, const mn_complexf_t * in, size_t m, int inverse)
+{
+    for ( size_t j = 0; j < m; j += 4 )
+    {
+        float32x4x2_t a[ 4 ];
+        float32x4_t re[ 4 ], im[ 4 ];
+
+        for ( size_t r = 0; r < 4; r++ )
+        {
+            a[ r ] = vld2q_f32(&in[ j + r * m ].re);
+        }
+        mn_fft_bfly4_neon(a);
+        for ( size_t r = 0; r < 4; r++ )
+        {
+            const size_t q = inverse ? (4 - r) % 4 : r;
+            re[ r ] = a[ q ].val[0];
+            im[ r ] = a[ q ].val[1];
+        }
+        mn_fft_transpose4(re);
+        mn_fft_transpose4(im);
+        for ( size_t t = 0; t < 4; t++ )
+        {
+            float32x4x2_t row;
+            row.val[0] = re[ t ];
+            row.val[1] = im[ t ];
+            vst2q_f32(&out[ 4 * (j + t) ].re, row);
+        }
+    }
+}
+
+static void mn_fft_stage_neon (mn_complexf_t * out, const mn_complexf_t * in, size_t nc, size_t p, size_t ns,
+                               const mn_complexf_t * tw, int inverse)
+{
+    const size_t m = nc / p;
+
+    if (ns % 4 == 0)
+    {
+        switch (p)
+        {
+        case 2: MN_FFT_STAGE_NEON(2, mn_fft_bfly2_neon) break;
+        case 3: MN_FFT_STAGE_NEON(3, mn_fft_bfly3_neon) break;
+        case 4: MN_FFT_STAGE_NEON(4, mn_fft_bfly4_neon) break;
+        default: MN_FFT_STAGE_NEON(5, mn_fft_bfly5_neon) break;
+        }
+    }
+    else if (ns == 1 && p == 4 && m % 4 == 0)
+    {
+        mn_fft_stage_first4_neon(out, in, m, inverse);
+    }
+    else
+    {
+        mn_fft_stage_c(out, in, nc, p, ns, tw, inverse, 0);
+    }
+}
+
+/* ===== real transforms ===== */
+
+static inline float32x4_t mn_fft_reverse (float32x4_t v)
+{
+    const float32x4_t r = vrev64q_f32(v);
+    return vextq_f32(r, r, 2);
+}
+
+/* B = Z[nc - k .. nc - k - 3] (not yet conjugated), in lane order k .. k + 3 */
+static inline float32x4x2_t mn_fft_load_mirror (const mn_complexf_t * z, size_t nc, size_t k)
+{
+    float32x4x2_t b = vld2q_f32(&z[ nc - k - 3 ].re);
+    b.val[0] = mn_fft_reverse(b.val[0]);
+    b.val[1] = mn_fft_reverse(b.val[1]);
+    return b;
+}
+
+static void mn_fft_real_post_neon (mn_complexf_t * dst, const mn_complexf_t * z, const mn_complexf_t * w, size_t nc)
+{
+    size_t k = 1;
+    for ( ; k + 4 <= nc; k += 4 )
+    {
+        const float32x4x2_t a = vld2q_f32(&z[ k ].re);
+        const float32x4x2_t b = mn_fft_load_mirror(z, nc, k);
+        float32x4x2_t fe, fo;
+        fe.val[0] = vmulq_n_f32(vaddq_f32(a.val[0], b.val[0]), 0.5f);
+        fe.val[1] = vmulq_n_f32(vsubq_f32(a.val[1], b.val[1]), 0.5f);
+        fo.val[0] = vmulq_n_f32(vaddq_f32(a.val[1], b.val[1]), 0.5f);
+        fo.val[1] = vmulq_n_f32(vsubq_f32(b.val[0], a.val[0]), 0.5f);
+        fo = mn_fft_vmul(fo, vld2q_f32(&w[ k ].re));
+        vst2q_f32(&dst[ k ].re, mn_fft_vadd(fe, fo));
+    }
+    mn_fft_real_post_c(dst, z, w, nc, k, nc);
+}
+
+static void mn_fft_real_pre_neon (mn_complexf_t * z, const mn_complexf_t * src, const mn_complexf_t * w, size_t nc)
+{
+    size_t k = 0;
+    for ( ; k + 4 <= nc; k += 4 )
+    {
+        const float32x4x2_t a = vld2q_f32(&src[ k ].re);
+        const float32x4x2_t b = mn_fft_load_mirror(src, nc, k);
+        float32x4x2_t fe, fo, wc, r;
+        fe.val[0] = vmulq_n_f32(vaddq_f32(a.val[0], b.val[0]), 0.5f);
+        fe.val[1] = vmulq_n_f32(vsubq_f32(a.val[1], b.val[1]), 0.5f);
+        fo.val[0] = vmulq_n_f32(vsubq_f32(a.val[0], b.val[0]), 0.5f);
+        fo.val[1] = vmulq_n_f32(vaddq_f32(a.val[1], b.val[1]), 0.5f);
+        wc = vld2q_f32(&w[ k ].re);
+        wc.val[1] = vnegq_f32(wc.val[1]);
+        fo = mn_fft_vmul(fo, wc);
+        r.val[0] = vsubq_f32(fe.val[0], fo.val[1]);
+        r.val[1] = vaddq_f32(fe.val[1], fo.val[0]);
+        vst2q_f32(&z[ k ].re, r);
+    }
+    mn_fft_real_pre_c(z, src, w, nc, k, nc);
+}
+
+MN_FFT_DEFINE_RUN(mn_fft_run_neon, mn_fft_stage_neon, mn_mulc_float_neon, mn_fft_real_post_neon, mn_fft_real_pre_neon)
+
+/* ===== transforms ===== */
+
+mn_result_t mn_fft_forward_neon (const mn_fft_plan_t * plan, mn_complexf_t * dst, mn_complexf_t * src, size_t count)
+{
+    assert(plan && dst && src);
+    if (plan->real || !plan->buffer)
+    {
+        return MN_ERROR;
+    }
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        mn_fft_run_neon_complex(plan, dst + itr * plan->n, src + itr * plan->n, 0);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_fft_inverse_neon (const mn_fft_plan_t * plan, mn_complexf_t * dst, mn_complexf_t * src, size_t count)
+{
+    assert(plan && dst && src);
+    if (plan->real || !plan->buffer)
+    {
+        return MN_ERROR;
+    }
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        mn_fft_run_neon_complex(plan, dst + itr * plan->n, src + itr * plan->n, 1);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_rfft_forward_neon (const mn_fft_plan_t * plan, mn_complexf_t * dst, mn_float32_t * src, size_t count)
+{
+    assert(plan && dst && src);
+    if (!plan->real || !plan->buffer)
+    {
+        return MN_ERROR;
+    }
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        mn_fft_run_neon_real_forward(plan, dst + itr * (plan->nc + 1), src + itr * plan->n);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_rfft_inverse_neon (const mn_fft_plan_t * plan, mn_float32_t * dst, mn_complexf_t * src, size_t count)
+{
+    assert(plan && dst && src);
+    if (!plan->real || !plan->buffer)
+    {
+        return MN_ERROR;
+    }
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        mn_fft_run_neon_real_inverse(plan, dst + itr * plan->n, src + itr * (plan->nc + 1));
+    }
+    return MN_SUCCESS;
+}
@@ -0,0 +1,145 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include "../common/MN_fir.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+Function Input:
+    fir      - Filter set up by mn_fir_init_float / mn_fir_init_int16
+    coeffs   - num_taps coefficients (Q15 for int16), coeffs[0] weights the newest sample
+    num_taps - Number of coefficients, at least 1
+    decimation - 1 for one output per input, D for one output per D inputs
+    dst      - count / decimation outputs (fir) or count - taps + 1 outputs (conv1d)
+    src      - count input samples
+    kernel, taps - conv1d coefficients and their number
+
+    C Implementation of
+        fir:    y[n] = sum_k coeffs[k] * x[n - k], x before the first call is 0,
+                the delay line carries over between calls
+        conv1d: valid-mode convolution, dst[n] = sum_k kernel[k] * src[n + taps - 1 - k]
+    int16 sums the Q15 products exactly (64-bit) and rounds once,
+    dst = sat16((sum + 2^14) >> 15).
+*/
+
+/* ===== kernels: dst[m] = sum_j h[taps - 1 - j] * x[m * step + j] ===== */
+
+static void mn_fir_kernel_float_c (mn_float32_t * dst, const mn_float32_t * x, size_t nout,
+                                   const mn_float32_t * h, size_t taps, size_t step)
+{
+    for ( size_t m = 0; m < nout; m++ )
+    {
+        const mn_float32_t * xm = x + m * step;
+        mn_float32_t acc = 0.0f;
+        for ( size_t j = 0; j < taps; j++ )
+        {
+            acc += h[ taps - 1 - j ] * xm[ j ];
+        }
+        dst[ m ] = acc;
+    }
+}
+
+static void mn_fir_kernel_int16_c (mn_int16_t * dst, const mn_int16_t * x, size_t nout,
+                                   const mn_int16_t * h, size_t taps, size_t step)
+{
+    for ( size_t m = 0; m < nout; m++ )
+    {
+        const mn_int16_t * xm = x + m * step;
+        int64_t acc = 0;
+        for ( size_t j = 0; j < taps; j++ )
+        {
+            acc += (int32_t)h[ taps - 1 - j ] * xm[ j ];
+        }
+        acc = (acc + (1 << 14)) >> 15;
+        dst[ m ] = (mn_int16_t)MN_SAT_CLAMP(int64_t, INT16_MIN, INT16_MAX, acc);
+    }
+}
+
+/* ===== setup ===== */
+
+#define MN_FIR_DEFINE_INIT(tname, FIR_T, T) \
+mn_result_t mn_fir_init_##tname (FIR_T * fir, const T * coeffs, size_t num_taps, size_t decimation) \
+{ \
+    assert(fir); \
+    fir->state = NULL; \
+    if (!coeffs || num_taps == 0 || decimation == 0) \
+    { \
+        return MN_ERROR; \
+    } \
+    /* delay line + scratch for the first num_taps - 1 new inputs (at least one element) */ \
+    fir->state = (T *)calloc(2 * (num_taps - 1) + 1, sizeof(T)); \
+    if (!fir->state) \
+    { \
+        return MN_ERROR; \
+    } \
+    fir->coeffs = coeffs; \
+    fir->num_taps = num_taps; \
+    fir->decimation = decimation; \
+    return MN_SUCCESS; \
+} \
+mn_result_t mn_fir_reset_##tname (FIR_T * fir) \
+{ \
+    assert(fir && fir->state); \
+    memset(fir->state, 0, (fir->num_taps - 1) * sizeof(T)); \
+    return MN_SUCCESS; \
+} \
+void mn_fir_free_##tname (FIR_T * fir) \
+{ \
+    if (fir) \
+    { \
+        free(fir->state); \
+        fir->state = NULL; \
+    } \
+}
+
+MN_FIR_DEFINE_INIT(float, mn_fir_float_t, mn_float32_t)
+MN_FIR_DEFINE_INIT(int16, mn_fir_int16_t, mn_int16_t)
+
+/* ===== fir ===== */
+
+MN_FIR_DEFINE_RUN(mn_fir_run_float_c, mn_fir_float_t, mn_float32_t, mn_fir_kernel_float_c)
+MN_FIR_DEFINE_RUN(mn_fir_run_int16_c, mn_fir_int16_t, mn_int16_t, mn_fir_kernel_int16_c)
+
+mn_result_t mn_fir_float_c (mn_fir_float_t * fir, mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    assert(fir);
+    return mn_fir_run_float_c(fir, dst, src, count);
+}
+
+mn_result_t mn_fir_int16_c (mn_fir_int16_t * fir, mn_int16_t * dst, mn_int16_t * src, size_t count)
+{
+    assert(fir);
+    return mn_fir_run_int16_c(fir, dst, src, count);
+}
+
+/* ===== conv1d ===== */
+
+mn_result_t mn_conv1d_float_c (mn_float32_t * dst, mn_float32_t * src, size_t count, const mn_float32_t * kernel, size_t taps)
+{
+    assert(dst && src && kernel);
+    if (taps == 0)
+    {
+        return MN_ERROR;
+    }
+    if (count >= taps)
+    {
+        mn_fir_kernel_float_c(dst, src, count - taps + 1, kernel, taps, 1);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_conv1d_int16_c (mn_int16_t * dst, mn_int16_t * src, size_t count, const mn_int16_t * kernel, size_t taps)
+{
+    assert(dst && src && kernel);
+    if (taps == 0)
+    {
+        return MN_ERROR;
+    }
+    if (count >= taps)
+    {
+        mn_fir_kernel_int16_c(dst, src, count - taps + 1, kernel, taps, 1);
+    }
+    return MN_SUCCESS;
+}
@@ -0,0 +1,290 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include "../common/MN_fir.h"
+#include <arm_neon.h>
+#include <assert.h>
+
+/*
+Input Arguments:
+    fir    - Filter set up by mn_fir_init_float / mn_fir_init_int16 (see mn_fir_float_c)
+    dst    - count / decimation outputs (fir) or count - taps + 1 outputs (conv1d)
+    src    - count input samples
+    kernel, taps - conv1d coefficients and their number
+
+Intrinsics used:
+    vld1q_f32 / vextq_f32     - one load per 4 samples, shifted windows built in registers
+    vrev64q_f32               - 4 coefficients in reversed (time) order
+    vfmaq_laneq_f32 / vfmaq_f32 - 4 outputs x 1 tap (vmlaq_lane_f32 / vmlaq_f32 on 32-bit ARM without FMA)
+    vmull_n_s16 / vmull_s16   - exact Q15 products
+    vaddw_s32 / vpadalq_s32   - 64-bit accumulation
+    vqrshrn_n_s64 / vqmovn_s32 - round, shift by 15 and saturate to int16
+
+Register blocking:
+    float, decimation 1 - 16 outputs in 4 accumulators, taps 4 at a time: 5 loads
+                          of x give the 16 x 4 windows through vextq_f32, so each
+                          tap costs 4 fma and ~1 load
+    int16, decimation 1 - 8 outputs in 4 int64x2 accumulators, one tap per step
+    decimation D > 1    - outputs are D samples apart, so vectors run along the
+                          taps instead (4 float outputs at a time, reduced with
+                          pairwise adds; int16 one output with 8 taps per step)
+
+Streaming is shared with the C version (../common/MN_fir.h): the kernels only
+ever see a contiguous window, either the delay line copy or src itself.
+
+Supported routines: float and Q15 int16 streaming FIR (optionally decimating),
+valid-mode float and int16 1D convolution
+*/
+
+/* h[j], h[j - 1], h[j - 2], h[j - 3]: taps j .. j - 3 in sample order */
+static inline float32x4_t mn_fir_load_rev_f32 (const mn_float32_t * h, size_t j)
+{
+    float32x4_t r = vrev64q_f32(vld1q_f32(h + j - 3));
+    return vextq_f32(r, r, 2);
+}
+
+/* acc += 4 taps (hr lanes 0..3) on the window starting at a; b holds the next 4 samples */
+#define MN_FIR_4TAPS(acc, a, b, hr) \
+    do { \
+        acc = MN_FMAQ_LANEQ_F32(acc, a, hr, 0); \
+        acc = MN_FMAQ_LANEQ_F32(acc, vextq_f32(a, b, 1), hr, 1); \
+        acc = MN_FMAQ_LANEQ_F32(acc, vextq_f32(a, b, 2), hr, 2); \
+        acc = MN_FMAQ_LANEQ_F32(acc, vextq_f32(a, b, 3), hr, 3); \
+    } while (0)
+
+/* ===== float kernels: dst[m] = sum_j h[taps - 1 - j] * x[m * step + j] ===== */
+
+static void mn_fir_kernel_float_neon (mn_float32_t * dst, const mn_float32_t * x, size_t nout,
+                                      const mn_float32_t * h, size_t taps, size_t step)
+{
+    size_t m = 0;
+
+    if (step == 1)
+    {
+        for ( ; m + 16 <= nout; m += 16 )
+        {
+            const mn_float32_t * xm = x + m;
+            float32x4_t acc0 = vdupq_n_f32(0.0f), acc1 = vdupq_n_f32(0.0f);
+            float32x4_t acc2 = vdupq_n_f32(0.0f), acc3 = vdupq_n_f32(0.0f);
+            size_t j = 0;
+
+            for ( ; j + 4 <= taps; j += 4 )
+            {
+                float32x4_t hr = mn_fir_load_rev_f32(h, taps - 1 - j);
+                float32x4_t x0 = vld1q_f32(xm + j);
+                float32x4_t x1 = vld1q_f32(xm + j + 4);
+                float32x4_t x2 = vld1q_f32(xm + j + 8);
+                float32x4_t x3 = vld1q_f32(xm + j + 12);
+                /* only lanes 0-2 of x4 are used, load from j + 15 so the last block stays in bounds */
+                float32x4_t x4 = vextq_f32(vld1q_f32(xm + j + 15), x3, 1);
+
+                MN_FIR_4TAPS(acc0, x0, x1, hr);
+                MN_FIR_4TAPS(acc1, x1, x2, hr);
+                MN_FIR_4TAPS(acc2, x2, x3, hr);
+                MN_FIR_4TAPS(acc3, x3, x4, hr);
+            }
+            for ( ; j < taps; j++ )
+            {
+                float32x4_t c = vdupq_n_f32(h[ taps - 1 - j ]);
+                acc0 = MN_FMAQ_F32(acc0, vld1q_f32(xm + j), c);
+                acc1 = MN_FMAQ_F32(acc1, vld1q_f32(xm + j + 4), c);
+                acc2 = MN_FMAQ_F32(acc2, vld1q_f32(xm + j + 8), c);
+                acc3 = MN_FMAQ_F32(acc3, vld1q_f32(xm + j + 12), c);
+            }
+
+            vst1q_f32(dst + m, acc0);
+            vst1q_f32(dst + m + 4, acc1);
+            vst1q_f32(dst + m + 8, acc2);
+            vst1q_f32(dst + m + 12, acc3);
+        }
+        for ( ; m + 4 <= nout; m += 4 )
+        {
+            const mn_float32_t * xm = x + m;
+            float32x4_t acc = vdupq_n_f32(0.0f);
+
+            for ( size_t j = 0; j < taps; j++ )
+            {
+                acc = MN_FMAQ_F32(acc, vld1q_f32(xm + j), vdupq_n_f32(h[ taps - 1 - j ]));
+            }
+            vst1q_f32(dst + m, acc);
+        }
+    }
+    else
+    {
+        for ( ; m + 4 <= nout; m += 4 )
+        {
+            const mn_float32_t * x0 = x + m * step;
+            const mn_float32_t * x1 = x0 + step;
+            const mn_float32_t * x2 = x1 + step;
+            const mn_float32_t * x3 = x2 + step;
+            float32x4_t acc0 = vdupq_n_f32(0.0f), acc1 = vdupq_n_f32(0.0f);
+            float32x4_t acc2 = vdupq_n_f32(0.0f), acc3 = vdupq_n_f32(0.0f);
+            mn_float32_t s[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            float32x2_t lo, hi;
+            size_t j = 0;
+
+            for ( ; j + 4 <= taps; j += 4 )
+            {
+                float32x4_t hr = mn_fir_load_rev_f32(h, taps - 1 - j);
+                acc0 = MN_FMAQ_F32(acc0, vld1q_f32(x0 + j), hr);
+                acc1 = MN_FMAQ_F32(acc1, vld1q_f32(x1 + j), hr);
+                acc2 = MN_FMAQ_F32(acc2, vld1q_f32(x2 + j), hr);
+                acc3 = MN_FMAQ_F32(acc3, vld1q_f32(x3 + j), hr);
+            }
+            for ( ; j < taps; j++ )
+            {
+                mn_float32_t c = h[ taps - 1 - j ];
+                s[0] += c * x0[ j ];
+                s[1] += c * x1[ j ];
+                s[2] += c * x2[ j ];
+                s[3] += c * x3[ j ];
+            }
+
+            /* lane k of the result = horizontal sum of acck */
+            lo = vpadd_f32(vadd_f32(vget_low_f32(acc0), vget_high_f32(acc0)),
+                           vadd_f32(vget_low_f32(acc1), vget_high_f32(acc1)));
+            hi = vpadd_f32(vadd_f32(vget_low_f32(acc2), vget_high_f32(acc2)),
+                           vadd_f32(vget_low_f32(acc3), vget_high_f32(acc3)));
+            vst1q_f32(dst + m, vaddq_f32(vcombine_f32(lo, hi), vld1q_f32(s)));
+        }
+    }
+
+    for ( ; m < nout; m++ )
+    {
+        const mn_float32_t * xm = x + m * step;
+        mn_float32_t acc = 0.0f;
+        for ( size_t j = 0; j < taps; j++ )
+        {
+            acc += h[ taps - 1 - j ] * xm[ j ];
+        }
+        dst[ m ] = acc;
+    }
+}
+
+/* ===== int16 kernels (Q15, exact 64-bit sums, one rounding) ===== */
+
+static inline mn_int16_t mn_fir_round_q15 (int64_t acc)
+{
+    acc = (acc + (1 << 14)) >> 15;
+    return (mn_int16_t)MN_SAT_CLAMP(int64_t, INT16_MIN, INT16_MAX, acc);
+}
+
+static inline int16x4_t mn_fir_narrow_q15 (int64x2_t lo, int64x2_t hi)
+{
+    return vqmovn_s32(vcombine_s32(vqrshrn_n_s64(lo, 15), vqrshrn_n_s64(hi, 15)));
+}
+
+static void mn_fir_kernel_int16_neon (mn_int16_t * dst, const mn_int16_t * x, size_t nout,
+                                      const mn_int16_t * h, size_t taps, size_t step)
+{
+    size_t m = 0;
+
+    if (step == 1)
+    {
+        for ( ; m + 8 <= nout; m += 8 )
+        {
+            const mn_int16_t * xm = x + m;
+            int64x2_t acc0 = vdupq_n_s64(0), acc1 = vdupq_n_s64(0);
+            int64x2_t acc2 = vdupq_n_s64(0), acc3 = vdupq_n_s64(0);
+
+            for ( size_t j = 0; j < taps; j++ )
+            {
+                int16x8_t xv = vld1q_s16(xm + j);
+                int16_t c = h[ taps - 1 - j ];
+                int32x4_t p0 = vmull_n_s16(vget_low_s16(xv), c);
+                int32x4_t p1 = vmull_n_s16(vget_high_s16(xv), c);
+
+                acc0 = vaddw_s32(acc0, vget_low_s32(p0));
+                acc1 = vaddw_s32(acc1, vget_high_s32(p0));
+                acc2 = vaddw_s32(acc2, vget_low_s32(p1));
+                acc3 = vaddw_s32(acc3, vget_high_s32(p1));
+            }
+
+            vst1_s16(dst + m, mn_fir_narrow_q15(acc0, acc1));
+            vst1_s16(dst + m + 4, mn_fir_narrow_q15(acc2, acc3));
+        }
+    }
+    else
+    {
+        for ( ; m < nout; m++ )
+        {
+            const mn_int16_t * xm = x + m * step;
+            int64x2_t acc0 = vdupq_n_s64(0), acc1 = vdupq_n_s64(0);
+            int64_t acc;
+            size_t j = 0;
+
+            for ( ; j + 8 <= taps; j += 8 )
+            {
+                int16x4_t h0 = vrev64_s16(vld1_s16(h + taps - 4 - j));
+                int16x4_t h1 = vrev64_s16(vld1_s16(h + taps - 8 - j));
+                acc0 = vpadalq_s32(acc0, vmull_s16(vld1_s16(xm + j), h0));
+                acc1 = vpadalq_s32(acc1, vmull_s16(vld1_s16(xm + j + 4), h1));
+            }
+            acc0 = vaddq_s64(acc0, acc1);
+            acc = vgetq_lane_s64(acc0, 0) + vgetq_lane_s64(acc0, 1);
+            for ( ; j < taps; j++ )
+            {
+                acc += (int32_t)h[ taps - 1 - j ] * xm[ j ];
+            }
+            dst[ m ] = mn_fir_round_q15(acc);
+        }
+    }
+
+    for ( ; m < nout; m++ )
+    {
+        const mn_int16_t * xm = x + m * step;
+        int64_t acc = 0;
+        for ( size_t j = 0; j < taps; j++ )
+        {
+            acc += (int32_t)h[ taps - 1 - j ] * xm[ j ];
+        }
+        dst[ m ] = mn_fir_round_q15(acc);
+    }
+}
+
+/* ===== fir ===== */
+
+MN_FIR_DEFINE_RUN(mn_fir_run_float_neon, mn_fir_float_t, mn_float32_t, mn_fir_kernel_float_neon)
+MN_FIR_DEFINE_RUN(mn_fir_run_int16_neon, mn_fir_int16_t, mn_int16_t, mn_fir_kernel_int16_neon)
+
+mn_result_t mn_fir_float_neon (mn_fir_float_t * fir, mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    assert(fir);
+    return mn_fir_run_float_neon(fir, dst, src, count);
+}
+
+mn_result_t mn_fir_int16_neon (mn_fir_int16_t * fir, mn_int16_t * dst, mn_int16_t * src, size_t count)
+{
+    assert(fir);
+    return mn_fir_run_int16_neon(fir, dst, src, count);
+}
+
+/* ===== conv1d ===== */
+
+mn_result_t mn_conv1d_float_neon (mn_float32_t * dst, mn_float32_t * src, size_t count, const mn_float32_t * kernel, size_t taps)
+{
+    assert(dst && src && kernel);
+    if (taps == 0)
+    {
+        return MN_ERROR;
+    }
+    if (count >= taps)
+    {
+        mn_fir_kernel_float_neon(dst, src, count - taps + 1, kernel, taps, 1);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_conv1d_int16_neon (mn_int16_t * dst, mn_int16_t * src, size_t count, const mn_int16_t * kernel, size_t taps)
+{
+    assert(dst && src && kernel);
+    if (taps == 0)
+    {
+        return MN_ERROR;
+    }
+    if (count >= taps)
+    {
+        mn_fir_kernel_int16_neon(dst, src, count - taps + 1, kernel, taps, 1);
+    }
+    return MN_SUCCESS;
+}
@@ -0,0 +1,421 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+/*
+Function Input:
+    dst   - Destination that store results
+    src1  - Source that stores user input 1
+    src2  - Source that stores user input 2
+    src3  - Addend of fma (dst = src1 * src2 + src3)
+    cst   - Constant of addc / mulc
+    count - Count is an integer that stores number of elements
+
+    C Implementation of the float16 operators. Every element is widened to
+    float32, computed and rounded back to half (round to nearest even). For
+    add/sub/mul the float32 result is exact enough that the final rounding
+    gives the correctly rounded half result.
+*/
+
+/* ===== Scalar conversions ===== */
+
+mn_float16_t mn_f32_to_f16 (mn_float32_t value)
+{
+    uint32_t bits, abs_bits, sign, exp, mant, half, rem;
+    memcpy(&bits, &value, sizeof(bits));
+    sign = (bits >> 16) & 0x8000u;
+    abs_bits = bits & 0x7fffffffu;
+
+    if (abs_bits >= 0x7f800000u)                 /* Inf or NaN (keep NaN quiet) */
+    {
+        return (mn_float16_t)(sign | 0x7c00u | (abs_bits > 0x7f800000u ? 0x0200u | ((abs_bits >> 13) & 0x03ffu) : 0u));
+    }
+    if (abs_bits >= 0x477ff000u)                 /* rounds past 65504 */
+    {
+        return (mn_float16_t)(sign | 0x7c00u);
+    }
+
+    exp = abs_bits >> 23;
+    mant = abs_bits & 0x007fffffu;
+    if (exp < 113)                               /* half subnormal or zero */
+    {
+        uint32_t shift = 126 - exp;
+        if (shift > 24)
+        {
+            return (mn_float16_t)sign;
+        }
+        mant |= 0x00800000u;
+        half = mant >> shift;
+        rem = mant & ((1u << shift) - 1u);
+        if (rem > (1u << (shift - 1)) || (rem == (1u << (shift - 1)) && (half & 1u)))
+        {
+            half++;
+        }
+        return (mn_float16_t)(sign | half);
+    }
+
+    half = ((exp - 112) << 10) | (mant >> 13);
+    rem = mant & 0x1fffu;
+    if (rem > 0x1000u || (rem == 0x1000u && (half & 1u)))
+    {
+        half++;                                  /* may carry into the exponent, which is correct */
+    }
+    return (mn_float16_t)(sign | half);
+}
+
+mn_float32_t mn_f16_to_f32 (mn_float16_t value)
+{
+    uint32_t sign = ((uint32_t)value & 0x8000u) << 16;
+    uint32_t exp = ((uint32_t)value >> 10) & 0x1fu;
+    uint32_t mant = (uint32_t)value & 0x03ffu;
+    uint32_t bits;
+    mn_float32_t result;
+
+    if (exp == 0)
+    {
+        result = (mn_float32_t)mant * 5.9604644775390625e-8f;   /* mant * 2^-24, exact */
+        return sign ? -result : result;
+    }
+    if (exp == 31)
+    {
+        bits = sign | 0x7f800000u | (mant << 13);
+    }
+    else
+    {
+        bits = sign | ((exp + 112) << 23) | (mant << 13);
+    }
+    memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+#define MN_H2F(h) mn_f16_to_f32(h)
+#define MN_F2H(f) mn_f32_to_f16(f)
+
+mn_result_t mn_add_float16_c (mn_float16_t * dst, mn_float16_t * src1, mn_float16_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_float16_t,
+        d[itr] = MN_F2H(MN_H2F(s1[itr]) + MN_H2F(s2[itr]));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_sub_float16_c (mn_float16_t * dst, mn_float16_t * src1, mn_float16_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_float16_t,
+        d[itr] = MN_F2H(MN_H2F(s1[itr]) - MN_H2F(s2[itr]));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mul_float16_c (mn_float16_t * dst, mn_float16_t * src1, mn_float16_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_float16_t,
+        d[itr] = MN_F2H(MN_H2F(s1[itr]) * MN_H2F(s2[itr]));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_addc_float16_c (mn_float16_t * dst, mn_float16_t * src, const mn_float16_t cst, size_t count)
+{
+    MN_ASSERT_DS;
+    const mn_float32_t c = MN_H2F(cst);
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float16_t,
+        d[itr] = MN_F2H(MN_H2F(s[itr]) + c);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mulc_float16_c (mn_float16_t * dst, mn_float16_t * src, const mn_float16_t cst, size_t count)
+{
+    MN_ASSERT_DS;
+    const mn_float32_t c = MN_H2F(cst);
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float16_t,
+        d[itr] = MN_F2H(MN_H2F(s[itr]) * c);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_abs_float16_c (mn_float16_t * dst, mn_float16_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    /* clearing the sign bit is exact, no conversion needed */
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float16_t,
+        d[itr] = (mn_float16_t)(s[itr] & 0x7fffu);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_fma_float16_c (mn_float16_t * dst, mn_float16_t * src1, mn_float16_t * src2, mn_float16_t * src3, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_ASSERT_DS1S2(dst, src3, src3);
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        dst[itr] = MN_F2H(fmaf(MN_H2F(src1[itr]), MN_H2F(src2[itr]), MN_H2F(src3[itr])));
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_add_vec2h_c (mn_vec2h_t * dst, mn_vec2h_t * src1, mn_vec2h_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec2h_t,
+        d[ itr ].x = MN_F2H(MN_H2F(s1[ itr ].x) + MN_H2F(s2[ itr ].x));
+        d[ itr ].y = MN_F2H(MN_H2F(s1[ itr ].y) + MN_H2F(s2[ itr ].y));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_sub_vec2h_c (mn_vec2h_t * dst, mn_vec2h_t * src1, mn_vec2h_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec2h_t,
+        d[ itr ].x = MN_F2H(MN_H2F(s1[ itr ].x) - MN_H2F(s2[ itr ].x));
+        d[ itr ].y = MN_F2H(MN_H2F(s1[ itr ].y) - MN_H2F(s2[ itr ].y));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mul_vec2h_c (mn_vec2h_t * dst, mn_vec2h_t * src1, mn_vec2h_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec2h_t,
+        d[ itr ].x = MN_F2H(MN_H2F(s1[ itr ].x) * MN_H2F(s2[ itr ].x));
+        d[ itr ].y = MN_F2H(MN_H2F(s1[ itr ].y) * MN_H2F(s2[ itr ].y));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_addc_vec2h_c (mn_vec2h_t * dst, mn_vec2h_t * src, const mn_vec2h_t * cst, size_t count)
+{
+    MN_ASSERT_DS;
+    const mn_float32_t cx = MN_H2F(cst->x);
+    const mn_float32_t cy = MN_H2F(cst->y);
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec2h_t,
+        d[ itr ].x = MN_F2H(MN_H2F(s[ itr ].x) + cx);
+        d[ itr ].y = MN_F2H(MN_H2F(s[ itr ].y) + cy);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mulc_vec2h_c (mn_vec2h_t * dst, mn_vec2h_t * src, const mn_vec2h_t * cst, size_t count)
+{
+    MN_ASSERT_DS;
+    const mn_float32_t cx = MN_H2F(cst->x);
+    const mn_float32_t cy = MN_H2F(cst->y);
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec2h_t,
+        d[ itr ].x = MN_F2H(MN_H2F(s[ itr ].x) * cx);
+        d[ itr ].y = MN_F2H(MN_H2F(s[ itr ].y) * cy);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_abs_vec2h_c (mn_vec2h_t * dst, mn_vec2h_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    /* clearing the sign bit is exact, no conversion needed */
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec2h_t,
+        d[ itr ].x = (mn_float16_t)(s[ itr ].x & 0x7fffu);
+        d[ itr ].y = (mn_float16_t)(s[ itr ].y & 0x7fffu);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_fma_vec2h_c (mn_vec2h_t * dst, mn_vec2h_t * src1, mn_vec2h_t * src2, mn_vec2h_t * src3, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_ASSERT_DS1S2(dst, src3, src3);
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ].x = MN_F2H(fmaf(MN_H2F(src1[ itr ].x), MN_H2F(src2[ itr ].x), MN_H2F(src3[ itr ].x)));
+        dst[ itr ].y = MN_F2H(fmaf(MN_H2F(src1[ itr ].y), MN_H2F(src2[ itr ].y), MN_H2F(src3[ itr ].y)));
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_add_vec3h_c (mn_vec3h_t * dst, mn_vec3h_t * src1, mn_vec3h_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec3h_t,
+        d[ itr ].x = MN_F2H(MN_H2F(s1[ itr ].x) + MN_H2F(s2[ itr ].x));
+        d[ itr ].y = MN_F2H(MN_H2F(s1[ itr ].y) + MN_H2F(s2[ itr ].y));
+        d[ itr ].z = MN_F2H(MN_H2F(s1[ itr ].z) + MN_H2F(s2[ itr ].z));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_sub_vec3h_c (mn_vec3h_t * dst, mn_vec3h_t * src1, mn_vec3h_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec3h_t,
+        d[ itr ].x = MN_F2H(MN_H2F(s1[ itr ].x) - MN_H2F(s2[ itr ].x));
+        d[ itr ].y = MN_F2H(MN_H2F(s1[ itr ].y) - MN_H2F(s2[ itr ].y));
+        d[ itr ].z = MN_F2H(MN_H2F(s1[ itr ].z) - MN_H2F(s2[ itr ].z));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mul_vec3h_c (mn_vec3h_t * dst, mn_vec3h_t * src1, mn_vec3h_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec3h_t,
+        d[ itr ].x = MN_F2H(MN_H2F(s1[ itr ].x) * MN_H2F(s2[ itr ].x));
+        d[ itr ].y = MN_F2H(MN_H2F(s1[ itr ].y) * MN_H2F(s2[ itr ].y));
+        d[ itr ].z = MN_F2H(MN_H2F(s1[ itr ].z) * MN_H2F(s2[ itr ].z));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_addc_vec3h_c (mn_vec3h_t * dst, mn_vec3h_t * src, const mn_vec3h_t * cst, size_t count)
+{
+    MN_ASSERT_DS;
+    const mn_float32_t cx = MN_H2F(cst->x);
+    const mn_float32_t cy = MN_H2F(cst->y);
+    const mn_float32_t cz = MN_H2F(cst->z);
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec3h_t,
+        d[ itr ].x = MN_F2H(MN_H2F(s[ itr ].x) + cx);
+        d[ itr ].y = MN_F2H(MN_H2F(s[ itr ].y) + cy);
+        d[ itr ].z = MN_F2H(MN_H2F(s[ itr ].z) + cz);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mulc_vec3h_c (mn_vec3h_t * dst, mn_vec3h_t * src, const mn_vec3h_t * cst, size_t count)
+{
+    MN_ASSERT_DS;
+    const mn_float32_t cx = MN_H2F(cst->x);
+    const mn_float32_t cy = MN_H2F(cst->y);
+    const mn_float32_t cz = MN_H2F(cst->z);
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec3h_t,
+        d[ itr ].x = MN_F2H(MN_H2F(s[ itr ].x) * cx);
+        d[ itr ].y = MN_F2H(MN_H2F(s[ itr ].y) * cy);
+        d[ itr ].z = MN_F2H(MN_H2F(s[ itr ].z) * cz);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_abs_vec3h_c (mn_vec3h_t * dst, mn_vec3h_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    /* clearing the sign bit is exact, no conversion needed */
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec3h_t,
+        d[ itr ].x = (mn_float16_t)(s[ itr ].x & 0x7fffu);
+        d[ itr ].y = (mn_float16_t)(s[ itr ].y & 0x7fffu);
+        d[ itr ].z = (mn_float16_t)(s[ itr ].z & 0x7fffu);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_fma_vec3h_c (mn_vec3h_t * dst, mn_vec3h_t * src1, mn_vec3h_t * src2, mn_vec3h_t * src3, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_ASSERT_DS1S2(dst, src3, src3);
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ].x = MN_F2H(fmaf(MN_H2F(src1[ itr ].x), MN_H2F(src2[ itr ].x), MN_H2F(src3[ itr ].x)));
+        dst[ itr ].y = MN_F2H(fmaf(MN_H2F(src1[ itr ].y), MN_H2F(src2[ itr ].y), MN_H2F(src3[ itr ].y)));
+        dst[ itr ].z = MN_F2H(fmaf(MN_H2F(src1[ itr ].z), MN_H2F(src2[ itr ].z), MN_H2F(src3[ itr ].z)));
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_add_vec4h_c (mn_vec4h_t * dst, mn_vec4h_t * src1, mn_vec4h_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec4h_t,
+        d[ itr ].x = MN_F2H(MN_H2F(s1[ itr ].x) + MN_H2F(s2[ itr ].x));
+        d[ itr ].y = MN_F2H(MN_H2F(s1[ itr ].y) + MN_H2F(s2[ itr ].y));
+        d[ itr ].z = MN_F2H(MN_H2F(s1[ itr ].z) + MN_H2F(s2[ itr ].z));
+        d[ itr ].w = MN_F2H(MN_H2F(s1[ itr ].w) + MN_H2F(s2[ itr ].w));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_sub_vec4h_c (mn_vec4h_t * dst, mn_vec4h_t * src1, mn_vec4h_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec4h_t,
+        d[ itr ].x = MN_F2H(MN_H2F(s1[ itr ].x) - MN_H2F(s2[ itr ].x));
+        d[ itr ].y = MN_F2H(MN_H2F(s1[ itr ].y) - MN_H2F(s2[ itr ].y));
+        d[ itr ].z = MN_F2H(MN_H2F(s1[ itr ].z) - MN_H2F(s2[ itr ].z));
+        d[ itr ].w = MN_F2H(MN_H2F(s1[ itr ].w) - MN_H2F(s2[ itr ].w));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mul_vec4h_c (mn_vec4h_t * dst, mn_vec4h_t * src1, mn_vec4h_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec4h_t,
+        d[ itr ].x = MN_F2H(MN_H2F(s1[ itr ].x) * MN_H2F(s2[ itr ].x));
+        d[ itr ].y = MN_F2H(MN_H2F(s1[ itr ].y) * MN_H2F(s2[ itr ].y));
+        d[ itr ].z = MN_F2H(MN_H2F(s1[ itr ].z) * MN_H2F(s2[ itr ].z));
+        d[ itr ].w = MN_F2H(MN_H2F(s1[ itr ].w) * MN_H2F(s2[ itr ].w));
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_addc_vec4h_c (mn_vec4h_t * dst, mn_vec4h_t * src, const mn_vec4h_t * cst, size_t count)
+{
+    MN_ASSERT_DS;
+    const mn_float32_t cx = MN_H2F(cst->x);
+    const mn_float32_t cy = MN_H2F(cst->y);
+    const mn_float32_t cz = MN_H2F(cst->z);
+    const mn_float32_t cw = MN_H2F(cst->w);
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec4h_t,
+        d[ itr ].x = MN_F2H(MN_H2F(s[ itr ].x) + cx);
+        d[ itr ].y = MN_F2H(MN_H2F(s[ itr ].y) + cy);
+        d[ itr ].z = MN_F2H(MN_H2F(s[ itr ].z) + cz);
+        d[ itr ].w = MN_F2H(MN_H2F(s[ itr ].w) + cw);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mulc_vec4h_c (mn_vec4h_t * dst, mn_vec4h_t * src, const mn_vec4h_t * cst, size_t count)
+{
+    MN_ASSERT_DS;
+    const mn_float32_t cx = MN_H2F(cst->x);
+    const mn_float32_t cy = MN_H2F(cst->y);
+    const mn_float32_t cz = MN_H2F(cst->z);
+    const mn_float32_t cw = MN_H2F(cst->w);
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec4h_t,
+        d[ itr ].x = MN_F2H(MN_H2F(s[ itr ].x) * cx);
+        d[ itr ].y = MN_F2H(MN_H2F(s[ itr ].y) * cy);
+        d[ itr ].z = MN_F2H(MN_H2F(s[ itr ].z) * cz);
+        d[ itr ].w = MN_F2H(MN_H2F(s[ itr ].w) * cw);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_abs_vec4h_c (mn_vec4h_t * dst, mn_vec4h_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    /* clearing the sign bit is exact, no conversion needed */
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec4h_t,
+        d[ itr ].x = (mn_float16_t)(s[ itr ].x & 0x7fffu);
+        d[ itr ].y = (mn_float16_t)(s[ itr ].y & 0x7fffu);
+        d[ itr ].z = (mn_float16_t)(s[ itr ].z & 0x7fffu);
+        d[ itr ].w = (mn_float16_t)(s[ itr ].w & 0x7fffu);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_fma_vec4h_c (mn_vec4h_t * dst, mn_vec4h_t * src1, mn_vec4h_t * src2, mn_vec4h_t * src3, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_ASSERT_DS1S2(dst, src3, src3);
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ].x = MN_F2H(fmaf(MN_H2F(src1[ itr ].x), MN_H2F(src2[ itr ].x), MN_H2F(src3[ itr ].x)));
+        dst[ itr ].y = MN_F2H(fmaf(MN_H2F(src1[ itr ].y), MN_H2F(src2[ itr ].y), MN_H2F(src3[ itr ].y)));
+        dst[ itr ].z = MN_F2H(fmaf(MN_H2F(src1[ itr ].z), MN_H2F(src2[ itr ].z), MN_H2F(src3[ itr ].z)));
+        dst[ itr ].w = MN_F2H(fmaf(MN_H2F(src1[ itr ].w), MN_H2F(src2[ itr ].w), MN_H2F(src3[ itr ].w)));
+    }
+    return MN_SUCCESS;
+}
@@ -0,0 +1,450 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <arm_neon.h>
+#include <assert.h>
+#include <string.h>
+
+/*
+Input Arguments:
+    dst    - Destination pointer that stores the results
+    src1   - Source pointer to array 1
+    src2   - Source pointer to array 2
+    src3   - Addend of fma (dst = src1 * src2 + src3)
+    cst    - Constant of addc / mulc
+    count  - Number of elements to process
+
+Intrinsics used:
+    native FP16 (MN_FP16_NATIVE, ARMv8.2-A):
+        vaddq_f16 / vsubq_f16 / vmulq_f16 / vfmaq_f16 - 8 halves per instruction
+    widening fallback (MN_FP16_CVT):
+        vcvt_f32_f16 - NEON intrinsic to widen 4 halves to float32
+        vcvt_f16_f32 - NEON intrinsic to narrow 4 float32 values to halves (round to nearest even)
+    both:
+        vld1q_u16 / vst1q_u16 - load / store 8 halves as raw bits
+        vandq_u16             - abs by clearing the sign bit
+
+Vector types are stored as consecutive halves, so add/sub/mul/fma/abs run on
+count * components halves. addc/mulc use a 24-half pattern of the constant
+(24 is a multiple of 8 lanes and of 2, 3 and 4 components).
+
+The fallback rounds fma twice (float32 fma, then narrowing), which can differ
+from native FP16 by one ulp in rare ties. Without MN_FP16_NATIVE or
+MN_FP16_CVT the entry points call the C implementations.
+
+Supported routines: float16 data type [1 to 4 Dimensional arrays]
+*/
+
+#define MN_F16_PATTERN 24
+
+static void mn_f16_abs (mn_float16_t * dst, const mn_float16_t * src, size_t n)
+{
+    const uint16x8_t mask = vdupq_n_u16(0x7fff);
+    size_t i = 0;
+    MN_PREFETCH_INIT;
+    for (; i + 8 <= n; i += 8)
+    {
+        MN_PREFETCH_SRC(src + i);
+        vst1q_u16(dst + i, vandq_u16(vld1q_u16(src + i), mask));
+    }
+    for (; i < n; i++)
+    {
+        dst[i] = (mn_float16_t)(src[i] & 0x7fffu);
+    }
+}
+
+#if defined(MN_FP16_NATIVE) || defined(MN_FP16_CVT)
+
+static void mn_f16_pattern (mn_float16_t * pattern, const mn_float16_t * cst, size_t comps)
+{
+    for (size_t k = 0; k < MN_F16_PATTERN; k++)
+    {
+        pattern[k] = cst[k % comps];
+    }
+}
+
+#if defined(MN_FP16_NATIVE)
+#define MN_F16_LD(p)     vreinterpretq_f16_u16(vld1q_u16(p))
+#define MN_F16_ST(p, v)  vst1q_u16((p), vreinterpretq_u16_f16(v))
+#define MN_F16_BLOCK2(d, a, b, OP16, OP32) \
+    MN_F16_ST((d), OP16(MN_F16_LD(a), MN_F16_LD(b)))
+#define MN_F16_BLOCK_FMA(d, a, b, c) \
+    MN_F16_ST((d), vfmaq_f16(MN_F16_LD(c), MN_F16_LD(a), MN_F16_LD(b)))
+#else
+#define MN_F16_LD_LO(p)  vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(p)))
+#define MN_F16_LD_HI(p)  vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16((p) + 4)))
+#define MN_F16_ST2(p, lo, hi) \
+    vst1q_u16((p), vcombine_u16(vreinterpret_u16_f16(vcvt_f16_f32(lo)), vreinterpret_u16_f16(vcvt_f16_f32(hi))))
+#define MN_F16_BLOCK2(d, a, b, OP16, OP32) \
+    MN_F16_ST2((d), OP32(MN_F16_LD_LO(a), MN_F16_LD_LO(b)), OP32(MN_F16_LD_HI(a), MN_F16_LD_HI(b)))
+#define MN_F16_BLOCK_FMA(d, a, b, c) \
+    MN_F16_ST2((d), MN_FMAQ_F32(MN_F16_LD_LO(c), MN_F16_LD_LO(a), MN_F16_LD_LO(b)), \
+                    MN_FMAQ_F32(MN_F16_LD_HI(c), MN_F16_LD_HI(a), MN_F16_LD_HI(b)))
+#endif
+
+/*
+ * Two-input kernel over n halves. With period == 0, b advances with a;
+ * otherwise b is a constant pattern of `period` halves that wraps around.
+ * The leftover (< 8) halves go through a zero padded 8-lane block.
+ */
+#define MN_F16_DEFINE_KERNEL2(name, OP16, OP32) \
+static void name (mn_float16_t * d, const mn_float16_t * a, const mn_float16_t * b, size_t n, size_t period) \
+{ \
+    size_t i = 0, bi = 0; \
+    MN_PREFETCH_INIT; \
+    for (; i + 8 <= n; i += 8) \
+    { \
+        MN_PREFETCH_SRC(a + i); \
+        MN_F16_BLOCK2(d + i, a + i, b + bi, OP16, OP32); \
+        bi += 8; \
+        if (bi == period) bi = 0; \
+    } \
+    if (i < n) \
+    { \
+        uint16_t ta[8] = { 0 }, tb[8] = { 0 }, td[8]; \
+        memcpy(ta, a + i, (n - i) * sizeof(uint16_t)); \
+        memcpy(tb, b + bi, (n - i) * sizeof(uint16_t)); \
+        MN_F16_BLOCK2(td, ta, tb, OP16, OP32); \
+        memcpy(d + i, td, (n - i) * sizeof(uint16_t)); \
+    } \
+}
+
+MN_F16_DEFINE_KERNEL2(mn_f16_add, vaddq_f16, vaddq_f32)
+MN_F16_DEFINE_KERNEL2(mn_f16_sub, vsubq_f16, vsubq_f32)
+MN_F16_DEFINE_KERNEL2(mn_f16_mul, vmulq_f16, vmulq_f32)
+
+static void mn_f16_fma (mn_float16_t * d, const mn_float16_t * a, const mn_float16_t * b, const mn_float16_t * c, size_t n)
+{
+    size_t i = 0;
+    MN_PREFETCH_INIT;
+    for (; i + 8 <= n; i += 8)
+    {
+        MN_PREFETCH_SRC(a + i);
+        MN_PREFETCH_SRC(b + i);
+        MN_F16_BLOCK_FMA(d + i, a + i, b + i, c + i);
+    }
+    if (i < n)
+    {
+        uint16_t ta[8] = { 0 }, tb[8] = { 0 }, tc[8] = { 0 }, td[8];
+        memcpy(ta, a + i, (n - i) * sizeof(uint16_t));
+        memcpy(tb, b + i, (n - i) * sizeof(uint16_t));
+        memcpy(tc, c + i, (n - i) * sizeof(uint16_t));
+        MN_F16_BLOCK_FMA(td, ta, tb, tc);
+        memcpy(d + i, td, (n - i) * sizeof(uint16_t));
+    }
+}
+
+#define MN_F16_HAVE_KERNELS 1
+#endif
+
+mn_result_t mn_add_float16_neon(mn_float16_t * dst, mn_float16_t * src1, mn_float16_t * src2, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f16_add(dst, src1, src2, count, 0);
+    return MN_SUCCESS;
+#else
+    return mn_add_float16_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_sub_float16_neon(mn_float16_t * dst, mn_float16_t * src1, mn_float16_t * src2, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f16_sub(dst, src1, src2, count, 0);
+    return MN_SUCCESS;
+#else
+    return mn_sub_float16_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_mul_float16_neon(mn_float16_t * dst, mn_float16_t * src1, mn_float16_t * src2, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f16_mul(dst, src1, src2, count, 0);
+    return MN_SUCCESS;
+#else
+    return mn_mul_float16_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_addc_float16_neon(mn_float16_t * dst, mn_float16_t * src, const mn_float16_t cst, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    mn_float16_t pattern[MN_F16_PATTERN];
+    MN_ASSERT_DS;
+    mn_f16_pattern(pattern, &cst, 1);
+    mn_f16_add(dst, src, pattern, count, MN_F16_PATTERN);
+    return MN_SUCCESS;
+#else
+    return mn_addc_float16_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_mulc_float16_neon(mn_float16_t * dst, mn_float16_t * src, const mn_float16_t cst, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    mn_float16_t pattern[MN_F16_PATTERN];
+    MN_ASSERT_DS;
+    mn_f16_pattern(pattern, &cst, 1);
+    mn_f16_mul(dst, src, pattern, count, MN_F16_PATTERN);
+    return MN_SUCCESS;
+#else
+    return mn_mulc_float16_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_abs_float16_neon(mn_float16_t * dst, mn_float16_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    mn_f16_abs(dst, src, count);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_fma_float16_neon(mn_float16_t * dst, mn_float16_t * src1, mn_float16_t * src2, mn_float16_t * src3, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_ASSERT_DS1S2(dst, src3, src3);
+    mn_f16_fma(dst, src1, src2, src3, count);
+    return MN_SUCCESS;
+#else
+    return mn_fma_float16_c(dst, src1, src2, src3, count);
+#endif
+}
+
+mn_result_t mn_add_vec2h_neon(mn_vec2h_t * dst, mn_vec2h_t * src1, mn_vec2h_t * src2, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f16_add((mn_float16_t *)dst, (mn_float16_t *)src1, (mn_float16_t *)src2, count * 2, 0);
+    return MN_SUCCESS;
+#else
+    return mn_add_vec2h_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_sub_vec2h_neon(mn_vec2h_t * dst, mn_vec2h_t * src1, mn_vec2h_t * src2, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f16_sub((mn_float16_t *)dst, (mn_float16_t *)src1, (mn_float16_t *)src2, count * 2, 0);
+    return MN_SUCCESS;
+#else
+    return mn_sub_vec2h_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_mul_vec2h_neon(mn_vec2h_t * dst, mn_vec2h_t * src1, mn_vec2h_t * src2, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f16_mul((mn_float16_t *)dst, (mn_float16_t *)src1, (mn_float16_t *)src2, count * 2, 0);
+    return MN_SUCCESS;
+#else
+    return mn_mul_vec2h_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_addc_vec2h_neon(mn_vec2h_t * dst, mn_vec2h_t * src, const mn_vec2h_t * cst, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    mn_float16_t pattern[MN_F16_PATTERN];
+    MN_ASSERT_DS;
+    mn_f16_pattern(pattern, (const mn_float16_t *)cst, 2);
+    mn_f16_add((mn_float16_t *)dst, (mn_float16_t *)src, pattern, count * 2, MN_F16_PATTERN);
+    return MN_SUCCESS;
+#else
+    return mn_addc_vec2h_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_mulc_vec2h_neon(mn_vec2h_t * dst, mn_vec2h_t * src, const mn_vec2h_t * cst, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    mn_float16_t pattern[MN_F16_PATTERN];
+    MN_ASSERT_DS;
+    mn_f16_pattern(pattern, (const mn_float16_t *)cst, 2);
+    mn_f16_mul((mn_float16_t *)dst, (mn_float16_t *)src, pattern, count * 2, MN_F16_PATTERN);
+    return MN_SUCCESS;
+#else
+    return mn_mulc_vec2h_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_abs_vec2h_neon(mn_vec2h_t * dst, mn_vec2h_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    mn_f16_abs((mn_float16_t *)dst, (mn_float16_t *)src, count * 2);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_fma_vec2h_neon(mn_vec2h_t * dst, mn_vec2h_t * src1, mn_vec2h_t * src2, mn_vec2h_t * src3, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_ASSERT_DS1S2(dst, src3, src3);
+    mn_f16_fma((mn_float16_t *)dst, (mn_float16_t *)src1, (mn_float16_t *)src2, (mn_float16_t *)src3, count * 2);
+    return MN_SUCCESS;
+#else
+    return mn_fma_vec2h_c(dst, src1, src2, src3, count);
+#endif
+}
+
+mn_result_t mn_add_vec3h_neon(mn_vec3h_t * dst, mn_vec3h_t * src1, mn_vec3h_t * src2, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f16_add((mn_float16_t *)dst, (mn_float16_t *)src1, (mn_float16_t *)src2, count * 3, 0);
+    return MN_SUCCESS;
+#else
+    return mn_add_vec3h_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_sub_vec3h_neon(mn_vec3h_t * dst, mn_vec3h_t * src1, mn_vec3h_t * src2, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f16_sub((mn_float16_t *)dst, (mn_float16_t *)src1, (mn_float16_t *)src2, count * 3, 0);
+    return MN_SUCCESS;
+#else
+    return mn_sub_vec3h_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_mul_vec3h_neon(mn_vec3h_t * dst, mn_vec3h_t * src1, mn_vec3h_t * src2, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f16_mul((mn_float16_t *)dst, (mn_float16_t *)src1, (mn_float16_t *)src2, count * 3, 0);
+    return MN_SUCCESS;
+#else
+    return mn_mul_vec3h_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_addc_vec3h_neon(mn_vec3h_t * dst, mn_vec3h_t * src, const mn_vec3h_t * cst, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    mn_float16_t pattern[MN_F16_PATTERN];
+    MN_ASSERT_DS;
+    mn_f16_pattern(pattern, (const mn_float16_t *)cst, 3);
+    mn_f16_add((mn_float16_t *)dst, (mn_float16_t *)src, pattern, count * 3, MN_F16_PATTERN);
+    return MN_SUCCESS;
+#else
+    return mn_addc_vec3h_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_mulc_vec3h_neon(mn_vec3h_t * dst, mn_vec3h_t * src, const mn_vec3h_t * cst, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    mn_float16_t pattern[MN_F16_PATTERN];
+    MN_ASSERT_DS;
+    mn_f16_pattern(pattern, (const mn_float16_t *)cst, 3);
+    mn_f16_mul((mn_float16_t *)dst, (mn_float16_t *)src, pattern, count * 3, MN_F16_PATTERN);
+    return MN_SUCCESS;
+#else
+    return mn_mulc_vec3h_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_abs_vec3h_neon(mn_vec3h_t * dst, mn_vec3h_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    mn_f16_abs((mn_float16_t *)dst, (mn_float16_t *)src, count * 3);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_fma_vec3h_neon(mn_vec3h_t * dst, mn_vec3h_t * src1, mn_vec3h_t * src2, mn_vec3h_t * src3, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_ASSERT_DS1S2(dst, src3, src3);
+    mn_f16_fma((mn_float16_t *)dst, (mn_float16_t *)src1, (mn_float16_t *)src2, (mn_float16_t *)src3, count * 3);
+    return MN_SUCCESS;
+#else
+    return mn_fma_vec3h_c(dst, src1, src2, src3, count);
+#endif
+}
+
+mn_result_t mn_add_vec4h_neon(mn_vec4h_t * dst, mn_vec4h_t * src1, mn_vec4h_t * src2, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f16_add((mn_float16_t *)dst, (mn_float16_t *)src1, (mn_float16_t *)src2, count * 4, 0);
+    return MN_SUCCESS;
+#else
+    return mn_add_vec4h_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_sub_vec4h_neon(mn_vec4h_t * dst, mn_vec4h_t * src1, mn_vec4h_t * src2, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f16_sub((mn_float16_t *)dst, (mn_float16_t *)src1, (mn_float16_t *)src2, count * 4, 0);
+    return MN_SUCCESS;
+#else
+    return mn_sub_vec4h_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_mul_vec4h_neon(mn_vec4h_t * dst, mn_vec4h_t * src1, mn_vec4h_t * src2, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f16_mul((mn_float16_t *)dst, (mn_float16_t *)src1, (mn_float16_t *)src2, count * 4, 0);
+    return MN_SUCCESS;
+#else
+    return mn_mul_vec4h_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_addc_vec4h_neon(mn_vec4h_t * dst, mn_vec4h_t * src, const mn_vec4h_t * cst, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    mn_float16_t pattern[MN_F16_PATTERN];
+    MN_ASSERT_DS;
+    mn_f16_pattern(pattern, (const mn_float16_t *)cst, 4);
+    mn_f16_add((mn_float16_t *)dst, (mn_float16_t *)src, pattern, count * 4, MN_F16_PATTERN);
+    return MN_SUCCESS;
+#else
+    return mn_addc_vec4h_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_mulc_vec4h_neon(mn_vec4h_t * dst, mn_vec4h_t * src, const mn_vec4h_t * cst, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    mn_float16_t pattern[MN_F16_PATTERN];
+    MN_ASSERT_DS;
+    mn_f16_pattern(pattern, (const mn_float16_t *)cst, 4);
+    mn_f16_mul((mn_float16_t *)dst, (mn_float16_t *)src, pattern, count * 4, MN_F16_PATTERN);
+    return MN_SUCCESS;
+#else
+    return mn_mulc_vec4h_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_abs_vec4h_neon(mn_vec4h_t * dst, mn_vec4h_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    mn_f16_abs((mn_float16_t *)dst, (mn_float16_t *)src, count * 4);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_fma_vec4h_neon(mn_vec4h_t * dst, mn_vec4h_t * src1, mn_vec4h_t * src2, mn_vec4h_t * src3, size_t count)
+{
+#if defined(MN_F16_HAVE_KERNELS)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_ASSERT_DS1S2(dst, src3, src3);
+    mn_f16_fma((mn_float16_t *)dst, (mn_float16_t *)src1, (mn_float16_t *)src2, (mn_float16_t *)src3, count * 4);
+    return MN_SUCCESS;
+#else
+    return mn_fma_vec4h_c(dst, src1, src2, src3, count);
+#endif
+}
@@ -0,0 +1,353 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <assert.h>
+#include <math.h>
+
+/*
+Function Input:
+    dst   - Destination that store results
+    src1  - Source that stores user input 1 (dividend for div)
+    src2  - Source that stores user input 2 (divisor for div)
+    cst   - Constant of addc / subc / mulc
+    count - Count is an integer that stores number of elements
+
+    C Implementation of the float64 operators (abs/add/sub/mul/div/addc/subc/mulc).
+    Supports 1-4 Dimensional vectors
+*/
+
+mn_result_t mn_add_float64_c (mn_float64_t * dst, mn_float64_t * src1, mn_float64_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_float64_t,
+        d[ itr ] = s1[ itr ] + s2[ itr ];
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_add_vec2d_c (mn_vec2d_t * dst, mn_vec2d_t * src1, mn_vec2d_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec2d_t,
+        d[ itr ].x = s1[ itr ].x + s2[ itr ].x;
+        d[ itr ].y = s1[ itr ].y + s2[ itr ].y;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_add_vec3d_c (mn_vec3d_t * dst, mn_vec3d_t * src1, mn_vec3d_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec3d_t,
+        d[ itr ].x = s1[ itr ].x + s2[ itr ].x;
+        d[ itr ].y = s1[ itr ].y + s2[ itr ].y;
+        d[ itr ].z = s1[ itr ].z + s2[ itr ].z;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_add_vec4d_c (mn_vec4d_t * dst, mn_vec4d_t * src1, mn_vec4d_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec4d_t,
+        d[ itr ].x = s1[ itr ].x + s2[ itr ].x;
+        d[ itr ].y = s1[ itr ].y + s2[ itr ].y;
+        d[ itr ].z = s1[ itr ].z + s2[ itr ].z;
+        d[ itr ].w = s1[ itr ].w + s2[ itr ].w;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_sub_float64_c (mn_float64_t * dst, mn_float64_t * src1, mn_float64_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_float64_t,
+        d[ itr ] = s1[ itr ] - s2[ itr ];
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_sub_vec2d_c (mn_vec2d_t * dst, mn_vec2d_t * src1, mn_vec2d_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec2d_t,
+        d[ itr ].x = s1[ itr ].x - s2[ itr ].x;
+        d[ itr ].y = s1[ itr ].y - s2[ itr ].y;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_sub_vec3d_c (mn_vec3d_t * dst, mn_vec3d_t * src1, mn_vec3d_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec3d_t,
+        d[ itr ].x = s1[ itr ].x - s2[ itr ].x;
+        d[ itr ].y = s1[ itr ].y - s2[ itr ].y;
+        d[ itr ].z = s1[ itr ].z - s2[ itr ].z;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_sub_vec4d_c (mn_vec4d_t * dst, mn_vec4d_t * src1, mn_vec4d_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec4d_t,
+        d[ itr ].x = s1[ itr ].x - s2[ itr ].x;
+        d[ itr ].y = s1[ itr ].y - s2[ itr ].y;
+        d[ itr ].z = s1[ itr ].z - s2[ itr ].z;
+        d[ itr ].w = s1[ itr ].w - s2[ itr ].w;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mul_float64_c (mn_float64_t * dst, mn_float64_t * src1, mn_float64_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_float64_t,
+        d[ itr ] = s1[ itr ] * s2[ itr ];
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mul_vec2d_c (mn_vec2d_t * dst, mn_vec2d_t * src1, mn_vec2d_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec2d_t,
+        d[ itr ].x = s1[ itr ].x * s2[ itr ].x;
+        d[ itr ].y = s1[ itr ].y * s2[ itr ].y;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mul_vec3d_c (mn_vec3d_t * dst, mn_vec3d_t * src1, mn_vec3d_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec3d_t,
+        d[ itr ].x = s1[ itr ].x * s2[ itr ].x;
+        d[ itr ].y = s1[ itr ].y * s2[ itr ].y;
+        d[ itr ].z = s1[ itr ].z * s2[ itr ].z;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mul_vec4d_c (mn_vec4d_t * dst, mn_vec4d_t * src1, mn_vec4d_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec4d_t,
+        d[ itr ].x = s1[ itr ].x * s2[ itr ].x;
+        d[ itr ].y = s1[ itr ].y * s2[ itr ].y;
+        d[ itr ].z = s1[ itr ].z * s2[ itr ].z;
+        d[ itr ].w = s1[ itr ].w * s2[ itr ].w;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_div_float64_c (mn_float64_t * dst, mn_float64_t * src1, mn_float64_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_float64_t,
+        d[ itr ] = s1[ itr ] / s2[ itr ];
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_div_vec2d_c (mn_vec2d_t * dst, mn_vec2d_t * src1, mn_vec2d_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec2d_t,
+        d[ itr ].x = s1[ itr ].x / s2[ itr ].x;
+        d[ itr ].y = s1[ itr ].y / s2[ itr ].y;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_div_vec3d_c (mn_vec3d_t * dst, mn_vec3d_t * src1, mn_vec3d_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec3d_t,
+        d[ itr ].x = s1[ itr ].x / s2[ itr ].x;
+        d[ itr ].y = s1[ itr ].y / s2[ itr ].y;
+        d[ itr ].z = s1[ itr ].z / s2[ itr ].z;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_div_vec4d_c (mn_vec4d_t * dst, mn_vec4d_t * src1, mn_vec4d_t * src2, size_t count)
+{
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    MN_C_DstSrc1Src2_DO_COUNT_TIMES(mn_vec4d_t,
+        d[ itr ].x = s1[ itr ].x / s2[ itr ].x;
+        d[ itr ].y = s1[ itr ].y / s2[ itr ].y;
+        d[ itr ].z = s1[ itr ].z / s2[ itr ].z;
+        d[ itr ].w = s1[ itr ].w / s2[ itr ].w;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_addc_float64_c (mn_float64_t * dst, mn_float64_t * src, const mn_float64_t cst, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float64_t,
+        d[ itr ] = s[ itr ] + cst;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_addc_vec2d_c (mn_vec2d_t * dst, mn_vec2d_t * src, const mn_vec2d_t * cst, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec2d_t,
+        d[ itr ].x = s[ itr ].x + cst->x;
+        d[ itr ].y = s[ itr ].y + cst->y;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_addc_vec3d_c (mn_vec3d_t * dst, mn_vec3d_t * src, const mn_vec3d_t * cst, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec3d_t,
+        d[ itr ].x = s[ itr ].x + cst->x;
+        d[ itr ].y = s[ itr ].y + cst->y;
+        d[ itr ].z = s[ itr ].z + cst->z;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_addc_vec4d_c (mn_vec4d_t * dst, mn_vec4d_t * src, const mn_vec4d_t * cst, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec4d_t,
+        d[ itr ].x = s[ itr ].x + cst->x;
+        d[ itr ].y = s[ itr ].y + cst->y;
+        d[ itr ].z = s[ itr ].z + cst->z;
+        d[ itr ].w = s[ itr ].w + cst->w;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_subc_float64_c (mn_float64_t * dst, mn_float64_t * src, const mn_float64_t cst, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float64_t,
+        d[ itr ] = s[ itr ] - cst;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_subc_vec2d_c (mn_vec2d_t * dst, mn_vec2d_t * src, const mn_vec2d_t * cst, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec2d_t,
+        d[ itr ].x = s[ itr ].x - cst->x;
+        d[ itr ].y = s[ itr ].y - cst->y;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_subc_vec3d_c (mn_vec3d_t * dst, mn_vec3d_t * src, const mn_vec3d_t * cst, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec3d_t,
+        d[ itr ].x = s[ itr ].x - cst->x;
+        d[ itr ].y = s[ itr ].y - cst->y;
+        d[ itr ].z = s[ itr ].z - cst->z;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_subc_vec4d_c (mn_vec4d_t * dst, mn_vec4d_t * src, const mn_vec4d_t * cst, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec4d_t,
+        d[ itr ].x = s[ itr ].x - cst->x;
+        d[ itr ].y = s[ itr ].y - cst->y;
+        d[ itr ].z = s[ itr ].z - cst->z;
+        d[ itr ].w = s[ itr ].w - cst->w;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mulc_float64_c (mn_float64_t * dst, mn_float64_t * src, const mn_float64_t cst, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float64_t,
+        d[ itr ] = s[ itr ] * cst;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mulc_vec2d_c (mn_vec2d_t * dst, mn_vec2d_t * src, const mn_vec2d_t * cst, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec2d_t,
+        d[ itr ].x = s[ itr ].x * cst->x;
+        d[ itr ].y = s[ itr ].y * cst->y;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mulc_vec3d_c (mn_vec3d_t * dst, mn_vec3d_t * src, const mn_vec3d_t * cst, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec3d_t,
+        d[ itr ].x = s[ itr ].x * cst->x;
+        d[ itr ].y = s[ itr ].y * cst->y;
+        d[ itr ].z = s[ itr ].z * cst->z;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_mulc_vec4d_c (mn_vec4d_t * dst, mn_vec4d_t * src, const mn_vec4d_t * cst, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec4d_t,
+        d[ itr ].x = s[ itr ].x * cst->x;
+        d[ itr ].y = s[ itr ].y * cst->y;
+        d[ itr ].z = s[ itr ].z * cst->z;
+        d[ itr ].w = s[ itr ].w * cst->w;
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_abs_float64_c (mn_float64_t * dst, mn_float64_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_float64_t,
+        d[ itr ] = fabs(s[ itr ]);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_abs_vec2d_c (mn_vec2d_t * dst, mn_vec2d_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec2d_t,
+        d[ itr ].x = fabs(s[ itr ].x);
+        d[ itr ].y = fabs(s[ itr ].y);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_abs_vec3d_c (mn_vec3d_t * dst, mn_vec3d_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec3d_t,
+        d[ itr ].x = fabs(s[ itr ].x);
+        d[ itr ].y = fabs(s[ itr ].y);
+        d[ itr ].z = fabs(s[ itr ].z);
+    );
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_abs_vec4d_c (mn_vec4d_t * dst, mn_vec4d_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    MN_C_DstSrc_DO_COUNT_TIMES(mn_vec4d_t,
+        d[ itr ].x = fabs(s[ itr ].x);
+        d[ itr ].y = fabs(s[ itr ].y);
+        d[ itr ].z = fabs(s[ itr ].z);
+        d[ itr ].w = fabs(s[ itr ].w);
+    );
+    return MN_SUCCESS;
+}
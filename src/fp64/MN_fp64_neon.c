@@ -0,0 +1,470 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <arm_neon.h>
+#include <assert.h>
+#include <math.h>
+
+/*
+Input Arguments:
+    dst    - Destination pointer that stores the results
+    src1   - Source pointer to array 1 (dividend for div)
+    src2   - Source pointer to array 2 (divisor for div)
+    cst    - Constant of addc / subc / mulc
+    count  - Number of elements to process
+
+Intrinsics used (AArch64, MN_FP64_NEON):
+    vld1q_f64 / vst1q_f64 - load / store 2 float64 values
+    vaddq_f64 / vsubq_f64 / vmulq_f64 - 2 lanes per instruction
+    vdivq_f64             - IEEE division, same result as the C version
+    vabsq_f64             - absolute value
+
+Vector types are stored as consecutive doubles, so every routine runs on
+count * components doubles. The constant routines walk a pattern of the
+constant (2 doubles for float64/vec2d, 4 for vec4d, 6 for vec3d) alongside
+the source. An odd leftover double is computed in scalar code.
+
+Without MN_FP64_NEON (32-bit ARM) the entry points call the C implementations.
+
+Supported routines: float64 data type [1 to 4 Dimensional arrays]
+*/
+
+#if defined(MN_FP64_NEON)
+
+#define MN_F64_ADD(a, b) ((a) + (b))
+#define MN_F64_SUB(a, b) ((a) - (b))
+#define MN_F64_MUL(a, b) ((a) * (b))
+#define MN_F64_DIV(a, b) ((a) / (b))
+
+/*
+ * Two-input kernel over n doubles. With period == 0, b advances with a
+ * (two registers per step); otherwise b is a constant pattern of `period`
+ * doubles that wraps around.
+ */
+#define MN_F64_DEFINE_KERNEL2(name, VOP, SOP) \
+static void name (mn_float64_t * d, const mn_float64_t * a, const mn_float64_t * b, size_t n, size_t period) \
+{ \
+    size_t i = 0, bi = 0; \
+    MN_PREFETCH_INIT; \
+    if (period == 0) \
+    { \
+        for (; i + 4 <= n; i += 4) \
+        { \
+            MN_PREFETCH_SRC_STEP(a + i, 32); \
+            MN_PREFETCH_SRC_STEP(b + i, 32); \
+            vst1q_f64(d + i, VOP(vld1q_f64(a + i), vld1q_f64(b + i))); \
+            vst1q_f64(d + i + 2, VOP(vld1q_f64(a + i + 2), vld1q_f64(b + i + 2))); \
+        } \
+        for (; i + 2 <= n; i += 2) \
+        { \
+            vst1q_f64(d + i, VOP(vld1q_f64(a + i), vld1q_f64(b + i))); \
+        } \
+        if (i < n) \
+        { \
+            d[i] = SOP(a[i], b[i]); \
+        } \
+        return; \
+    } \
+    for (; i + 2 <= n; i += 2) \
+    { \
+        MN_PREFETCH_SRC(a + i); \
+        vst1q_f64(d + i, VOP(vld1q_f64(a + i), vld1q_f64(b + bi))); \
+        bi += 2; \
+        if (bi == period) bi = 0; \
+    } \
+    if (i < n) \
+    { \
+        d[i] = SOP(a[i], b[bi]); \
+    } \
+}
+
+MN_F64_DEFINE_KERNEL2(mn_f64_add, vaddq_f64, MN_F64_ADD)
+MN_F64_DEFINE_KERNEL2(mn_f64_sub, vsubq_f64, MN_F64_SUB)
+MN_F64_DEFINE_KERNEL2(mn_f64_mul, vmulq_f64, MN_F64_MUL)
+MN_F64_DEFINE_KERNEL2(mn_f64_div, vdivq_f64, MN_F64_DIV)
+
+static void mn_f64_abs (mn_float64_t * d, const mn_float64_t * a, size_t n)
+{
+    size_t i = 0;
+    MN_PREFETCH_INIT;
+    for (; i + 4 <= n; i += 4)
+    {
+        MN_PREFETCH_SRC_STEP(a + i, 32);
+        vst1q_f64(d + i, vabsq_f64(vld1q_f64(a + i)));
+        vst1q_f64(d + i + 2, vabsq_f64(vld1q_f64(a + i + 2)));
+    }
+    for (; i + 2 <= n; i += 2)
+    {
+        vst1q_f64(d + i, vabsq_f64(vld1q_f64(a + i)));
+    }
+    if (i < n)
+    {
+        d[i] = fabs(a[i]);
+    }
+}
+
+#endif
+
+mn_result_t mn_add_float64_neon(mn_float64_t * dst, mn_float64_t * src1, mn_float64_t * src2, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f64_add(dst, src1, src2, count, 0);
+    return MN_SUCCESS;
+#else
+    return mn_add_float64_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_add_vec2d_neon(mn_vec2d_t * dst, mn_vec2d_t * src1, mn_vec2d_t * src2, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f64_add((mn_float64_t *)dst, (mn_float64_t *)src1, (mn_float64_t *)src2, count * 2, 0);
+    return MN_SUCCESS;
+#else
+    return mn_add_vec2d_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_add_vec3d_neon(mn_vec3d_t * dst, mn_vec3d_t * src1, mn_vec3d_t * src2, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f64_add((mn_float64_t *)dst, (mn_float64_t *)src1, (mn_float64_t *)src2, count * 3, 0);
+    return MN_SUCCESS;
+#else
+    return mn_add_vec3d_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_add_vec4d_neon(mn_vec4d_t * dst, mn_vec4d_t * src1, mn_vec4d_t * src2, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f64_add((mn_float64_t *)dst, (mn_float64_t *)src1, (mn_float64_t *)src2, count * 4, 0);
+    return MN_SUCCESS;
+#else
+    return mn_add_vec4d_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_sub_float64_neon(mn_float64_t * dst, mn_float64_t * src1, mn_float64_t * src2, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f64_sub(dst, src1, src2, count, 0);
+    return MN_SUCCESS;
+#else
+    return mn_sub_float64_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_sub_vec2d_neon(mn_vec2d_t * dst, mn_vec2d_t * src1, mn_vec2d_t * src2, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f64_sub((mn_float64_t *)dst, (mn_float64_t *)src1, (mn_float64_t *)src2, count * 2, 0);
+    return MN_SUCCESS;
+#else
+    return mn_sub_vec2d_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_sub_vec3d_neon(mn_vec3d_t * dst, mn_vec3d_t * src1, mn_vec3d_t * src2, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f64_sub((mn_float64_t *)dst, (mn_float64_t *)src1, (mn_float64_t *)src2, count * 3, 0);
+    return MN_SUCCESS;
+#else
+    return mn_sub_vec3d_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_sub_vec4d_neon(mn_vec4d_t * dst, mn_vec4d_t * src1, mn_vec4d_t * src2, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f64_sub((mn_float64_t *)dst, (mn_float64_t *)src1, (mn_float64_t *)src2, count * 4, 0);
+    return MN_SUCCESS;
+#else
+    return mn_sub_vec4d_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_mul_float64_neon(mn_float64_t * dst, mn_float64_t * src1, mn_float64_t * src2, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f64_mul(dst, src1, src2, count, 0);
+    return MN_SUCCESS;
+#else
+    return mn_mul_float64_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_mul_vec2d_neon(mn_vec2d_t * dst, mn_vec2d_t * src1, mn_vec2d_t * src2, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f64_mul((mn_float64_t *)dst, (mn_float64_t *)src1, (mn_float64_t *)src2, count * 2, 0);
+    return MN_SUCCESS;
+#else
+    return mn_mul_vec2d_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_mul_vec3d_neon(mn_vec3d_t * dst, mn_vec3d_t * src1, mn_vec3d_t * src2, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f64_mul((mn_float64_t *)dst, (mn_float64_t *)src1, (mn_float64_t *)src2, count * 3, 0);
+    return MN_SUCCESS;
+#else
+    return mn_mul_vec3d_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_mul_vec4d_neon(mn_vec4d_t * dst, mn_vec4d_t * src1, mn_vec4d_t * src2, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f64_mul((mn_float64_t *)dst, (mn_float64_t *)src1, (mn_float64_t *)src2, count * 4, 0);
+    return MN_SUCCESS;
+#else
+    return mn_mul_vec4d_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_div_float64_neon(mn_float64_t * dst, mn_float64_t * src1, mn_float64_t * src2, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f64_div(dst, src1, src2, count, 0);
+    return MN_SUCCESS;
+#else
+    return mn_div_float64_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_div_vec2d_neon(mn_vec2d_t * dst, mn_vec2d_t * src1, mn_vec2d_t * src2, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f64_div((mn_float64_t *)dst, (mn_float64_t *)src1, (mn_float64_t *)src2, count * 2, 0);
+    return MN_SUCCESS;
+#else
+    return mn_div_vec2d_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_div_vec3d_neon(mn_vec3d_t * dst, mn_vec3d_t * src1, mn_vec3d_t * src2, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f64_div((mn_float64_t *)dst, (mn_float64_t *)src1, (mn_float64_t *)src2, count * 3, 0);
+    return MN_SUCCESS;
+#else
+    return mn_div_vec3d_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_div_vec4d_neon(mn_vec4d_t * dst, mn_vec4d_t * src1, mn_vec4d_t * src2, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS1S2(dst, src1, src2);
+    mn_f64_div((mn_float64_t *)dst, (mn_float64_t *)src1, (mn_float64_t *)src2, count * 4, 0);
+    return MN_SUCCESS;
+#else
+    return mn_div_vec4d_c(dst, src1, src2, count);
+#endif
+}
+
+mn_result_t mn_addc_float64_neon(mn_float64_t * dst, mn_float64_t * src, const mn_float64_t cst, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    const mn_float64_t pattern[2] = { cst, cst };
+    MN_ASSERT_DS;
+    mn_f64_add(dst, src, pattern, count, 2);
+    return MN_SUCCESS;
+#else
+    return mn_addc_float64_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_addc_vec2d_neon(mn_vec2d_t * dst, mn_vec2d_t * src, const mn_vec2d_t * cst, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    const mn_float64_t pattern[2] = { cst->x, cst->y };
+    MN_ASSERT_DS;
+    mn_f64_add((mn_float64_t *)dst, (mn_float64_t *)src, pattern, count * 2, 2);
+    return MN_SUCCESS;
+#else
+    return mn_addc_vec2d_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_addc_vec3d_neon(mn_vec3d_t * dst, mn_vec3d_t * src, const mn_vec3d_t * cst, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    const mn_float64_t pattern[6] = { cst->x, cst->y, cst->z, cst->x, cst->y, cst->z };
+    MN_ASSERT_DS;
+    mn_f64_add((mn_float64_t *)dst, (mn_float64_t *)src, pattern, count * 3, 6);
+    return MN_SUCCESS;
+#else
+    return mn_addc_vec3d_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_addc_vec4d_neon(mn_vec4d_t * dst, mn_vec4d_t * src, const mn_vec4d_t * cst, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    const mn_float64_t pattern[4] = { cst->x, cst->y, cst->z, cst->w };
+    MN_ASSERT_DS;
+    mn_f64_add((mn_float64_t *)dst, (mn_float64_t *)src, pattern, count * 4, 4);
+    return MN_SUCCESS;
+#else
+    return mn_addc_vec4d_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_subc_float64_neon(mn_float64_t * dst, mn_float64_t * src, const mn_float64_t cst, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    const mn_float64_t pattern[2] = { cst, cst };
+    MN_ASSERT_DS;
+    mn_f64_sub(dst, src, pattern, count, 2);
+    return MN_SUCCESS;
+#else
+    return mn_subc_float64_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_subc_vec2d_neon(mn_vec2d_t * dst, mn_vec2d_t * src, const mn_vec2d_t * cst, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    const mn_float64_t pattern[2] = { cst->x, cst->y };
+    MN_ASSERT_DS;
+    mn_f64_sub((mn_float64_t *)dst, (mn_float64_t *)src, pattern, count * 2, 2);
+    return MN_SUCCESS;
+#else
+    return mn_subc_vec2d_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_subc_vec3d_neon(mn_vec3d_t * dst, mn_vec3d_t * src, const mn_vec3d_t * cst, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    const mn_float64_t pattern[6] = { cst->x, cst->y, cst->z, cst->x, cst->y, cst->z };
+    MN_ASSERT_DS;
+    mn_f64_sub((mn_float64_t *)dst, (mn_float64_t *)src, pattern, count * 3, 6);
+    return MN_SUCCESS;
+#else
+    return mn_subc_vec3d_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_subc_vec4d_neon(mn_vec4d_t * dst, mn_vec4d_t * src, const mn_vec4d_t * cst, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    const mn_float64_t pattern[4] = { cst->x, cst->y, cst->z, cst->w };
+    MN_ASSERT_DS;
+    mn_f64_sub((mn_float64_t *)dst, (mn_float64_t *)src, pattern, count * 4, 4);
+    return MN_SUCCESS;
+#else
+    return mn_subc_vec4d_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_mulc_float64_neon(mn_float64_t * dst, mn_float64_t * src, const mn_float64_t cst, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    const mn_float64_t pattern[2] = { cst, cst };
+    MN_ASSERT_DS;
+    mn_f64_mul(dst, src, pattern, count, 2);
+    return MN_SUCCESS;
+#else
+    return mn_mulc_float64_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_mulc_vec2d_neon(mn_vec2d_t * dst, mn_vec2d_t * src, const mn_vec2d_t * cst, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    const mn_float64_t pattern[2] = { cst->x, cst->y };
+    MN_ASSERT_DS;
+    mn_f64_mul((mn_float64_t *)dst, (mn_float64_t *)src, pattern, count * 2, 2);
+    return MN_SUCCESS;
+#else
+    return mn_mulc_vec2d_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_mulc_vec3d_neon(mn_vec3d_t * dst, mn_vec3d_t * src, const mn_vec3d_t * cst, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    const mn_float64_t pattern[6] = { cst->x, cst->y, cst->z, cst->x, cst->y, cst->z };
+    MN_ASSERT_DS;
+    mn_f64_mul((mn_float64_t *)dst, (mn_float64_t *)src, pattern, count * 3, 6);
+    return MN_SUCCESS;
+#else
+    return mn_mulc_vec3d_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_mulc_vec4d_neon(mn_vec4d_t * dst, mn_vec4d_t * src, const mn_vec4d_t * cst, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    const mn_float64_t pattern[4] = { cst->x, cst->y, cst->z, cst->w };
+    MN_ASSERT_DS;
+    mn_f64_mul((mn_float64_t *)dst, (mn_float64_t *)src, pattern, count * 4, 4);
+    return MN_SUCCESS;
+#else
+    return mn_mulc_vec4d_c(dst, src, cst, count);
+#endif
+}
+
+mn_result_t mn_abs_float64_neon(mn_float64_t * dst, mn_float64_t * src, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS;
+    mn_f64_abs(dst, src, count);
+    return MN_SUCCESS;
+#else
+    return mn_abs_float64_c(dst, src, count);
+#endif
+}
+
+mn_result_t mn_abs_vec2d_neon(mn_vec2d_t * dst, mn_vec2d_t * src, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS;
+    mn_f64_abs((mn_float64_t *)dst, (mn_float64_t *)src, count * 2);
+    return MN_SUCCESS;
+#else
+    return mn_abs_vec2d_c(dst, src, count);
+#endif
+}
+
+mn_result_t mn_abs_vec3d_neon(mn_vec3d_t * dst, mn_vec3d_t * src, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS;
+    mn_f64_abs((mn_float64_t *)dst, (mn_float64_t *)src, count * 3);
+    return MN_SUCCESS;
+#else
+    return mn_abs_vec3d_c(dst, src, count);
+#endif
+}
+
+mn_result_t mn_abs_vec4d_neon(mn_vec4d_t * dst, mn_vec4d_t * src, size_t count)
+{
+#if defined(MN_FP64_NEON)
+    MN_ASSERT_DS;
+    mn_f64_abs((mn_float64_t *)dst, (mn_float64_t *)src, count * 4);
+    return MN_SUCCESS;
+#else
+    return mn_abs_vec4d_c(dst, src, count);
+#endif
+}
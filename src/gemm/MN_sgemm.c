@@ -0,0 +1,47 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <assert.h>
+
+/*
+Function Input:
+    M, N, K - C is M x N, A is M x K, B is K x N
+    A       - Column major matrix, element (i, k) at A[i + k * lda], lda >= M
+    B       - Column major matrix, element (k, j) at B[k + j * ldb], ldb >= K
+    C       - Column major matrix, element (i, j) at C[i + j * ldc], ldc >= M
+    alpha   - Scale of A * B
+    beta    - Scale of the old C. With beta == 0, C is not read (it may hold NaN)
+
+    C Implementation of C = alpha * A * B + beta * C (single precision GEMM),
+    column major like mn_mat4f_t and BLAS. Loop order j, k, i walks A and C
+    down their contiguous columns.
+*/
+
+mn_result_t mn_sgemm_c (size_t M, size_t N, size_t K,
+                        const mn_float32_t * A, size_t lda,
+                        const mn_float32_t * B, size_t ldb,
+                        mn_float32_t * C, size_t ldc,
+                        mn_float32_t alpha, mn_float32_t beta)
+{
+    assert(A && B && C);
+    assert(lda >= M && ldb >= K && ldc >= M);
+
+    for ( size_t j = 0; j < N; j++ )
+    {
+        mn_float32_t * c = C + j * ldc;
+        for ( size_t i = 0; i < M; i++ )
+        {
+            c[ i ] = beta == 0.0f ? 0.0f : beta * c[ i ];
+        }
+        for ( size_t k = 0; k < K; k++ )
+        {
+            const mn_float32_t b = alpha * B[ k + j * ldb ];
+            const mn_float32_t * a = A + k * lda;
+            for ( size_t i = 0; i < M; i++ )
+            {
+                c[ i ] += a[ i ] * b;
+            }
+        }
+    }
+    return MN_SUCCESS;
+}
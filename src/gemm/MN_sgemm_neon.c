@@ -0,0 +1,308 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include "../common/MN_thread.h"
+#include <arm_neon.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+Input Arguments:
+    M, N, K - C is M x N, A is M x K, B is K x N (column major, see mn_sgemm_c)
+    A, lda  - Left matrix and its column stride
+    B, ldb  - Right matrix and its column stride
+    C, ldc  - Result matrix and its column stride
+    alpha   - Scale of A * B
+    beta    - Scale of the old C, C is not read when beta == 0
+
+Intrinsics used:
+    vld1q_f32 / vst1q_f32 - panels and C columns
+    vfmaq_laneq_f32       - micro-kernel rank-1 update (vmlaq_lane_f32 on 32-bit ARM)
+    vmulq_n_f32 / vfmaq_n_f32 - alpha / beta on the result tile (vmlaq_n_f32 on 32-bit ARM)
+
+Blocking (Goto / BLIS style):
+    jc loop - MN_SGEMM_NC columns of B and C
+    pc loop - MN_SGEMM_KC deep slice; B[pc:pc+KC, jc:jc+NC] is packed into
+              12-column panels (k-major, stays in L2 / L3)
+    ic loop - MN_SGEMM_MC rows; A[ic:ic+MC, pc:pc+KC] is packed into 8-row
+              panels (k-major, stays in L2)
+    micro-kernel - one 8 x 12 tile of C in 24 registers, each k step loads
+              8 floats of A and 12 of B (one A panel + one B panel sit in L1)
+              and runs 24 vfmaq_laneq_f32
+
+Panels are zero padded to 8 rows / 12 columns, so the kernel has no edge
+cases; partial tiles are written through a small buffer. beta is applied on
+the first KC slice only, later slices accumulate.
+
+Threads (mn_set_threads): C is split into column blocks (or row blocks
+when M > N), each thread packs its own panels and runs the loops above on its
+part. No synchronisation is needed because the parts of C do not overlap.
+
+Supported routines: single precision GEMM, C = alpha * A * B + beta * C
+*/
+
+#ifndef MN_SGEMM_MC
+#define MN_SGEMM_MC 128     /* multiple of MN_SGEMM_MR */
+#endif
+#ifndef MN_SGEMM_KC
+#define MN_SGEMM_KC 256
+#endif
+#ifndef MN_SGEMM_NC
+#define MN_SGEMM_NC 384     /* multiple of MN_SGEMM_NR */
+#endif
+
+#define MN_SGEMM_MR 8
+#define MN_SGEMM_NR 12
+
+/* Below this many multiply-adds per thread, extra threads cost more than they save */
+#define MN_SGEMM_MIN_WORK_PER_THREAD ((size_t)1 << 21)
+
+/* ===== packing ===== */
+
+/* A[0:mc, 0:kc] -> 8-row panels, each k step stores 8 consecutive floats */
+static void mn_sgemm_pack_a (mn_float32_t * dst, const mn_float32_t * A, size_t lda, size_t mc, size_t kc)
+{
+    for (size_t ir = 0; ir < mc; ir += MN_SGEMM_MR)
+    {
+        const size_t mr = mc - ir < MN_SGEMM_MR ? mc - ir : MN_SGEMM_MR;
+        const mn_float32_t * a = A + ir;
+        if (mr == MN_SGEMM_MR)
+        {
+            for (size_t k = 0; k < kc; k++, a += lda, dst += MN_SGEMM_MR)
+            {
+                vst1q_f32(dst, vld1q_f32(a));
+                vst1q_f32(dst + 4, vld1q_f32(a + 4));
+            }
+        }
+        else
+        {
+            for (size_t k = 0; k < kc; k++, a += lda, dst += MN_SGEMM_MR)
+            {
+                size_t r = 0;
+                for (; r < mr; r++) dst[r] = a[r];
+                for (; r < MN_SGEMM_MR; r++) dst[r] = 0.0f;
+            }
+        }
+    }
+}
+
+/* B[0:kc, 0:nc] -> 12-column panels, each k step stores one row of the panel */
+static void mn_sgemm_pack_b (mn_float32_t * dst, const mn_float32_t * B, size_t ldb, size_t kc, size_t nc)
+{
+    for (size_t jr = 0; jr < nc; jr += MN_SGEMM_NR)
+    {
+        const size_t nr = nc - jr < MN_SGEMM_NR ? nc - jr : MN_SGEMM_NR;
+        const mn_float32_t * b = B + jr * ldb;
+        for (size_t k = 0; k < kc; k++, dst += MN_SGEMM_NR)
+        {
+            size_t c = 0;
+            for (; c < nr; c++) dst[c] = b[k + c * ldb];
+            for (; c < MN_SGEMM_NR; c++) dst[c] = 0.0f;
+        }
+    }
+}
+
+/* ===== micro-kernel ===== */
+
+#define MN_SGEMM_ACC_DECL(j) \
+    float32x4_t c##j##_lo = vdupq_n_f32(0.0f), c##j##_hi = vdupq_n_f32(0.0f)
+
+#define MN_SGEMM_ACC_FMA(j, bv, l) \
+    c##j##_lo = MN_FMAQ_LANEQ_F32(c##j##_lo, a_lo, bv, l); \
+    c##j##_hi = MN_FMAQ_LANEQ_F32(c##j##_hi, a_hi, bv, l)
+
+/* column j of the tile: c = alpha * acc + beta * c (c is not read when beta == 0) */
+#define MN_SGEMM_ACC_STORE(j) \
+    do { \
+        mn_float32_t * cj_ = c + (j) * ldc; \
+        float32x4_t lo_ = vmulq_n_f32(c##j##_lo, alpha); \
+        float32x4_t hi_ = vmulq_n_f32(c##j##_hi, alpha); \
+        if (beta != 0.0f) \
+        { \
+            lo_ = MN_FMAQ_N_F32(lo_, vld1q_f32(cj_), beta); \
+            hi_ = MN_FMAQ_N_F32(hi_, vld1q_f32(cj_ + 4), beta); \
+        } \
+        vst1q_f32(cj_, lo_); \
+        vst1q_f32(cj_ + 4, hi_); \
+    } while (0)
+
+/* C[0:8, 0:12] = alpha * Ap * Bp + beta * C, Ap / Bp are packed panels of depth kc */
+static void mn_sgemm_kernel_8x12 (size_t kc, const mn_float32_t * a, const mn_float32_t * b,
+                                  mn_float32_t * c, size_t ldc, mn_float32_t alpha, mn_float32_t beta)
+{
+    MN_SGEMM_ACC_DECL(0); MN_SGEMM_ACC_DECL(1); MN_SGEMM_ACC_DECL(2);  MN_SGEMM_ACC_DECL(3);
+    MN_SGEMM_ACC_DECL(4); MN_SGEMM_ACC_DECL(5); MN_SGEMM_ACC_DECL(6);  MN_SGEMM_ACC_DECL(7);
+    MN_SGEMM_ACC_DECL(8); MN_SGEMM_ACC_DECL(9); MN_SGEMM_ACC_DECL(10); MN_SGEMM_ACC_DECL(11);
+
+    for (size_t k = 0; k < kc; k++, a += MN_SGEMM_MR, b += MN_SGEMM_NR)
+    {
+        const float32x4_t a_lo = vld1q_f32(a);
+        const float32x4_t a_hi = vld1q_f32(a + 4);
+        const float32x4_t b0 = vld1q_f32(b);
+        const float32x4_t b1 = vld1q_f32(b + 4);
+        const float32x4_t b2 = vld1q_f32(b + 8);
+        MN_SGEMM_ACC_FMA(0, b0, 0); MN_SGEMM_ACC_FMA(1, b0, 1); MN_SGEMM_ACC_FMA(2, b0, 2);  MN_SGEMM_ACC_FMA(3, b0, 3);
+        MN_SGEMM_ACC_FMA(4, b1, 0); MN_SGEMM_ACC_FMA(5, b1, 1); MN_SGEMM_ACC_FMA(6, b1, 2);  MN_SGEMM_ACC_FMA(7, b1, 3);
+        MN_SGEMM_ACC_FMA(8, b2, 0); MN_SGEMM_ACC_FMA(9, b2, 1); MN_SGEMM_ACC_FMA(10, b2, 2); MN_SGEMM_ACC_FMA(11, b2, 3);
+    }
+
+    MN_SGEMM_ACC_STORE(0); MN_SGEMM_ACC_STORE(1); MN_SGEMM_ACC_STORE(2);  MN_SGEMM_ACC_STORE(3);
+    MN_SGEMM_ACC_STORE(4); MN_SGEMM_ACC_STORE(5); MN_SGEMM_ACC_STORE(6);  MN_SGEMM_ACC_STORE(7);
+    MN_SGEMM_ACC_STORE(8); MN_SGEMM_ACC_STORE(9); MN_SGEMM_ACC_STORE(10); MN_SGEMM_ACC_STORE(11);
+}
+
+/* Edge tile (mr < 8 or nr < 12): run the kernel into a buffer, then merge the valid part */
+static void mn_sgemm_kernel_edge (size_t kc, const mn_float32_t * a, const mn_float32_t * b,
+                                  mn_float32_t * c, size_t ldc, size_t mr, size_t nr,
+                                  mn_float32_t alpha, mn_float32_t beta)
+{
+    mn_float32_t tile[MN_SGEMM_MR * MN_SGEMM_NR];
+    mn_sgemm_kernel_8x12(kc, a, b, tile, MN_SGEMM_MR, alpha, 0.0f);
+    for (size_t j = 0; j < nr; j++)
+    {
+        for (size_t i = 0; i < mr; i++)
+        {
+            const mn_float32_t t = tile[j * MN_SGEMM_MR + i];
+            c[i + j * ldc] = beta == 0.0f ? t : t + beta * c[i + j * ldc];
+        }
+    }
+}
+
+/* ===== blocked driver ===== */
+
+typedef struct
+{
+    size_t M, N, K;
+    const mn_float32_t * A;
+    size_t lda;
+    const mn_float32_t * B;
+    size_t ldb;
+    mn_float32_t * C;
+    size_t ldc;
+    mn_float32_t alpha, beta;
+    mn_float32_t * pack_a;   /* MN_SGEMM_MC * MN_SGEMM_KC floats */
+    mn_float32_t * pack_b;   /* MN_SGEMM_KC * MN_SGEMM_NC floats */
+} mn_sgemm_task_t;
+
+static void mn_sgemm_blocked (void * arg)
+{
+    const mn_sgemm_task_t * t = (const mn_sgemm_task_t *)arg;
+
+    for (size_t jc = 0; jc < t->N; jc += MN_SGEMM_NC)
+    {
+        const size_t nc = t->N - jc < MN_SGEMM_NC ? t->N - jc : MN_SGEMM_NC;
+        for (size_t pc = 0; pc < t->K; pc += MN_SGEMM_KC)
+        {
+            const size_t kc = t->K - pc < MN_SGEMM_KC ? t->K - pc : MN_SGEMM_KC;
+            const mn_float32_t beta = pc == 0 ? t->beta : 1.0f;
+            mn_sgemm_pack_b(t->pack_b, t->B + pc + jc * t->ldb, t->ldb, kc, nc);
+
+            for (size_t ic = 0; ic < t->M; ic += MN_SGEMM_MC)
+            {
+                const size_t mc = t->M - ic < MN_SGEMM_MC ? t->M - ic : MN_SGEMM_MC;
+                mn_sgemm_pack_a(t->pack_a, t->A + ic + pc * t->lda, t->lda, mc, kc);
+
+                for (size_t jr = 0; jr < nc; jr += MN_SGEMM_NR)
+                {
+                    const size_t nr = nc - jr < MN_SGEMM_NR ? nc - jr : MN_SGEMM_NR;
+                    const mn_float32_t * bp = t->pack_b + jr * kc;
+                    for (size_t ir = 0; ir < mc; ir += MN_SGEMM_MR)
+                    {
+                        const size_t mr = mc - ir < MN_SGEMM_MR ? mc - ir : MN_SGEMM_MR;
+                        const mn_float32_t * ap = t->pack_a + ir * kc;
+                        mn_float32_t * c = t->C + (ic + ir) + (jc + jr) * t->ldc;
+                        if (mr == MN_SGEMM_MR && nr == MN_SGEMM_NR)
+                        {
+                            mn_sgemm_kernel_8x12(kc, ap, bp, c, t->ldc, t->alpha, beta);
+                        }
+                        else
+                        {
+                            mn_sgemm_kernel_edge(kc, ap, bp, c, t->ldc, mr, nr, t->alpha, beta);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/* C = beta * C for the K == 0 / alpha == 0 shortcut */
+static void mn_sgemm_scale (size_t M, size_t N, mn_float32_t * C, size_t ldc, mn_float32_t beta)
+{
+    for (size_t j = 0; j < N; j++)
+    {
+        mn_float32_t * c = C + j * ldc;
+        for (size_t i = 0; i < M; i++)
+        {
+            c[i] = beta == 0.0f ? 0.0f : beta * c[i];
+        }
+    }
+}
+
+mn_result_t mn_sgemm_neon (size_t M, size_t N, size_t K,
+                           const mn_float32_t * A, size_t lda,
+                           const mn_float32_t * B, size_t ldb,
+                           mn_float32_t * C, size_t ldc,
+                           mn_float32_t alpha, mn_float32_t beta)
+{
+    mn_sgemm_task_t tasks[MN_THREAD_MAX];
+    size_t threads = mn_thread_count();
+    const int split_m = M > N;
+    const size_t dim = split_m ? M : N;
+    const size_t unit = split_m ? MN_SGEMM_MR : MN_SGEMM_NR;
+    const size_t per_pack = (size_t)MN_SGEMM_MC * MN_SGEMM_KC + (size_t)MN_SGEMM_KC * MN_SGEMM_NC;
+    size_t units, step;
+    mn_float32_t * buffers;
+    mn_result_t res;
+
+    assert(A && B && C);
+    assert(lda >= M && ldb >= K && ldc >= M);
+
+    if (M == 0 || N == 0)
+    {
+        return MN_SUCCESS;
+    }
+    if (K == 0 || alpha == 0.0f)
+    {
+        mn_sgemm_scale(M, N, C, ldc, beta);
+        return MN_SUCCESS;
+    }
+
+    /* threads each get whole 8-row / 12-column units and enough work to pay off */
+    units = (dim + unit - 1) / unit;
+    if (threads > units) threads = units;
+    while (threads > 1 && (double)M * N * K / threads < (double)MN_SGEMM_MIN_WORK_PER_THREAD) threads--;
+    step = (units + threads - 1) / threads * unit;
+    threads = (dim + step - 1) / step;
+
+    buffers = (mn_float32_t *)malloc(sizeof(mn_float32_t) * per_pack * threads);
+    if (!buffers)
+    {
+        return MN_ERROR;
+    }
+
+    for (size_t t = 0; t < threads; t++)
+    {
+        const size_t first = t * step;
+        const size_t len = dim - first < step ? dim - first : step;
+        mn_sgemm_task_t * task = &tasks[t];
+        task->M = split_m ? len : M;
+        task->N = split_m ? N : len;
+        task->K = K;
+        task->A = split_m ? A + first : A;
+        task->lda = lda;
+        task->B = split_m ? B : B + first * ldb;
+        task->ldb = ldb;
+        task->C = split_m ? C + first : C + first * ldc;
+        task->ldc = ldc;
+        task->alpha = alpha;
+        task->beta = beta;
+        task->pack_a = buffers + t * per_pack;
+        task->pack_b = task->pack_a + (size_t)MN_SGEMM_MC * MN_SGEMM_KC;
+    }
+
+    res = mn_thread_run(mn_sgemm_blocked, tasks, sizeof(tasks[0]), threads);
+    free(buffers);
+    return res;
+}
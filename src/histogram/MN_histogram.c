@@ -0,0 +1,78 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+/*
+Function Input:
+    hist  - Destination counts, 256 for uint8, bins otherwise (overwritten)
+    bins  - Number of bins
+    src   - Source array
+    lo    - Lower edge of the first float bin (included)
+    hi    - Upper edge of the last float bin (excluded)
+    count - Count is an integer that stores number of elements
+
+    C Implementation of the histograms, the reference for the NEON versions:
+        uint8: hist[v] counts the values equal to v
+        int32: hist[v] counts the values equal to v for 0 <= v < bins (a
+               bincount), other values are skipped
+        float: values in [lo, hi) go to bin (size_t)((x - lo) * scale),
+               scale = bins / (hi - lo) in float, clamped to bins - 1; values
+               outside [lo, hi) and NaN are skipped
+    Counts are 32-bit. bins == 0, lo >= hi or a scale that is not finite and
+    positive (hi - lo overflowing, say) returns MN_ERROR.
+*/
+
+mn_result_t mn_histogram_uint8_c (mn_uint32_t * hist, mn_uint8_t * src, size_t count)
+{
+    assert(hist && src);
+    memset(hist, 0, 256 * sizeof(mn_uint32_t));
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        hist[ src[ itr ] ]++;
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_histogram_int32_c (mn_uint32_t * hist, size_t bins, mn_int32_t * src, size_t count)
+{
+    assert(hist && src);
+    if (bins == 0)
+    {
+        return MN_ERROR;
+    }
+    memset(hist, 0, bins * sizeof(mn_uint32_t));
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        if (src[ itr ] >= 0 && (size_t)src[ itr ] < bins)
+        {
+            hist[ src[ itr ] ]++;
+        }
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_histogram_float_c (mn_uint32_t * hist, size_t bins, mn_float32_t * src, mn_float32_t lo,
+                                  mn_float32_t hi, size_t count)
+{
+    const mn_float32_t scale = (mn_float32_t)bins / (hi - lo);
+
+    assert(hist && src);
+    if (bins == 0 || !(lo < hi) || !(scale > 0.0f) || !isfinite(scale))
+    {
+        return MN_ERROR;
+    }
+    memset(hist, 0, bins * sizeof(mn_uint32_t));
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        const mn_float32_t x = src[ itr ];
+        if (x >= lo && x < hi)
+        {
+            const size_t bin = (size_t)((x - lo) * scale);
+            hist[ bin < bins ? bin : bins - 1 ]++;
+        }
+    }
+    return MN_SUCCESS;
+}
@@ -0,0 +1,325 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include "../common/MN_thread.h"
+#include <arm_neon.h>
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+Input Arguments:
+    hist  - Destination counts, 256 for uint8, bins otherwise (overwritten)
+    bins  - Number of bins
+    src   - Source array
+    lo    - Lower edge of the first float bin (included)
+    hi    - Upper edge of the last float bin (excluded)
+    count - Count is an integer that stores number of elements
+
+Intrinsics used:
+    vsubq_f32 / vmulq_f32 / vcvtq_u32_f32 - float bin indices, 4 at a time
+    vcgeq_f32 / vcltq_f32 / vcltq_u32     - range checks
+    vbslq_u32 / vminq_u32                 - skipped values to the spare bin, clamp to bins - 1
+    vaddq_u32                             - merging sub-histograms
+
+Incrementing one histogram stalls whenever neighbouring values hit the same
+bin: each increment has to wait for the store of the previous one. The
+counts are spread over 4 private sub-histograms instead (value j goes to
+sub-histogram j % 4), so runs of equal values, common in images and
+latency data, increment 4 independent counters. The sub-histograms are
+added together at the end with vector adds.
+
+The int32 and float bin indices are computed 4 lanes at a time with the
+same float operations as the C version, so both give identical counts.
+Values to skip are sent to a spare bin (index bins) instead of branching,
+and that bin is dropped at the end. uint8 values are their own index and
+are read 8 at a time out of 64-bit lanes.
+
+The sub-histograms are only used for fewer than MN_HIST_SUB_MAX_BINS (4096)
+bins. From MN_HIST_SUB_MAX_BINS bins up, collisions are rare and 4 copies no
+longer fit in cache, so a single private histogram is used.
+
+Threads (mn_set_threads): arrays of at least MN_HIST_MIN_PER_THREAD
+values per thread are split into equal chunks, each thread counts its chunk
+into its own sub-histograms and folds them into one, and the calling thread
+adds the per-thread histograms into hist. Each thread also needs at least
+bins values, since the merge costs bins adds per thread.
+
+Supported routines: histogram [uint8 with 256 bins, int32 bincount, float
+with uniform bins over [lo, hi)]
+*/
+
+#define MN_HIST_SUBS 4
+
+/* bins < MN_HIST_SUB_MAX_BINS use MN_HIST_SUBS sub-histograms, larger bin counts one */
+#ifndef MN_HIST_SUB_MAX_BINS
+#define MN_HIST_SUB_MAX_BINS 4096
+#endif
+
+/* Below this many values per thread, extra threads cost more than they save */
+#ifndef MN_HIST_MIN_PER_THREAD
+#define MN_HIST_MIN_PER_THREAD ((size_t)1 << 16)
+#endif
+
+typedef enum
+{
+    MN_HIST_UINT8,
+    MN_HIST_INT32,
+    MN_HIST_FLOAT
+} mn_hist_kind_t;
+
+typedef struct
+{
+    mn_hist_kind_t kind;
+    const void * src;
+    size_t count;
+    size_t bins;
+    mn_float32_t lo, hi, scale;
+    size_t subs;            /* 1 or MN_HIST_SUBS */
+    mn_uint32_t * counts;   /* subs x (bins + 1), the last bin of each collects skipped values */
+} mn_hist_task_t;
+
+/* dst[i] += src[i] */
+static void mn_hist_add (mn_uint32_t * dst, const mn_uint32_t * src, size_t n)
+{
+    size_t itr = 0;
+    for ( ; itr + 8 <= n; itr += 8 )
+    {
+        vst1q_u32(dst + itr, vaddq_u32(vld1q_u32(dst + itr), vld1q_u32(src + itr)));
+        vst1q_u32(dst + itr + 4, vaddq_u32(vld1q_u32(dst + itr + 4), vld1q_u32(src + itr + 4)));
+    }
+    for ( ; itr < n; itr++ )
+    {
+        dst[ itr ] += src[ itr ];
+    }
+}
+
+/* four values of w, a 64-bit lane of bytes, into four sub-histograms */
+#define MN_HIST_BYTES4(w, shift) \
+    do { \
+        h0[ ((w) >> (shift)) & 0xff ]++; \
+        h1[ ((w) >> ((shift) + 8)) & 0xff ]++; \
+        h2[ ((w) >> ((shift) + 16)) & 0xff ]++; \
+        h3[ ((w) >> ((shift) + 24)) & 0xff ]++; \
+    } while (0)
+
+static void mn_hist_uint8 (mn_uint32_t * h0, mn_uint32_t * h1, mn_uint32_t * h2, mn_uint32_t * h3,
+                           const mn_uint8_t * s, size_t count)
+{
+    size_t itr = 0;
+    MN_PREFETCH_INIT;
+    for ( ; itr + 16 <= count; itr += 16 )
+    {
+        MN_PREFETCH_SRC(s + itr);
+        const uint64x2_t v = vreinterpretq_u64_u8(vld1q_u8(s + itr));
+        const uint64_t w0 = vgetq_lane_u64(v, 0);
+        const uint64_t w1 = vgetq_lane_u64(v, 1);
+        MN_HIST_BYTES4(w0, 0);
+        MN_HIST_BYTES4(w0, 32);
+        MN_HIST_BYTES4(w1, 0);
+        MN_HIST_BYTES4(w1, 32);
+    }
+    for ( ; itr < count; itr++ )
+    {
+        h0[ s[ itr ] ]++;
+    }
+}
+
+/* the four lanes of idx into four sub-histograms */
+#define MN_HIST_LANES4(idx) \
+    do { \
+        h0[ vgetq_lane_u32(idx, 0) ]++; \
+        h1[ vgetq_lane_u32(idx, 1) ]++; \
+        h2[ vgetq_lane_u32(idx, 2) ]++; \
+        h3[ vgetq_lane_u32(idx, 3) ]++; \
+    } while (0)
+
+/* v if 0 <= v < bins, else the spare bin; the unsigned compare rejects negatives */
+static inline uint32x4_t mn_hist_index_int32 (int32x4_t v, uint32x4_t vbins)
+{
+    const uint32x4_t u = vreinterpretq_u32_s32(v);
+    return vbslq_u32(vcltq_u32(u, vbins), u, vbins);
+}
+
+/* (x - lo) * scale clamped to bins - 1 if lo <= x < hi, else the spare bin */
+static inline uint32x4_t mn_hist_index_float (float32x4_t x, float32x4_t vlo, float32x4_t vhi, float32x4_t vscale,
+                                              uint32x4_t vbins, uint32x4_t vlast)
+{
+    const uint32x4_t in = vandq_u32(vcgeq_f32(x, vlo), vcltq_f32(x, vhi));
+    const uint32x4_t bin = vminq_u32(vcvtq_u32_f32(vmulq_f32(vsubq_f32(x, vlo), vscale)), vlast);
+    return vbslq_u32(in, bin, vbins);
+}
+
+static void mn_hist_int32 (mn_uint32_t * h0, mn_uint32_t * h1, mn_uint32_t * h2, mn_uint32_t * h3,
+                           const mn_int32_t * s, size_t count, size_t bins)
+{
+    const uint32x4_t vbins = vdupq_n_u32((mn_uint32_t)bins);
+    size_t itr = 0;
+    MN_PREFETCH_INIT;
+    for ( ; itr + 8 <= count; itr += 8 )
+    {
+        MN_PREFETCH_SRC_STEP(s + itr, 32);
+        const uint32x4_t i0 = mn_hist_index_int32(vld1q_s32(s + itr), vbins);
+        const uint32x4_t i1 = mn_hist_index_int32(vld1q_s32(s + itr + 4), vbins);
+        MN_HIST_LANES4(i0);
+        MN_HIST_LANES4(i1);
+    }
+    for ( ; itr < count; itr++ )
+    {
+        const mn_uint32_t u = (mn_uint32_t)s[ itr ];
+        h0[ u < bins ? u : bins ]++;
+    }
+}
+
+static void mn_hist_float (mn_uint32_t * h0, mn_uint32_t * h1, mn_uint32_t * h2, mn_uint32_t * h3,
+                           const mn_float32_t * s, size_t count, size_t bins, mn_float32_t lo, mn_float32_t hi,
+                           mn_float32_t scale)
+{
+    const float32x4_t vlo = vdupq_n_f32(lo), vhi = vdupq_n_f32(hi), vscale = vdupq_n_f32(scale);
+    const uint32x4_t vbins = vdupq_n_u32((mn_uint32_t)bins), vlast = vdupq_n_u32((mn_uint32_t)bins - 1);
+    size_t itr = 0;
+    MN_PREFETCH_INIT;
+    for ( ; itr + 8 <= count; itr += 8 )
+    {
+        MN_PREFETCH_SRC_STEP(s + itr, 32);
+        const uint32x4_t i0 = mn_hist_index_float(vld1q_f32(s + itr), vlo, vhi, vscale, vbins, vlast);
+        const uint32x4_t i1 = mn_hist_index_float(vld1q_f32(s + itr + 4), vlo, vhi, vscale, vbins, vlast);
+        MN_HIST_LANES4(i0);
+        MN_HIST_LANES4(i1);
+    }
+    if (itr < count)
+    {
+        /* NaN padding lands in the spare bin and is dropped */
+        mn_float32_t buf[ 8 ];
+        for ( size_t i = 0; i < 8; i++ ) buf[ i ] = itr + i < count ? s[ itr + i ] : NAN;
+        const uint32x4_t i0 = mn_hist_index_float(vld1q_f32(buf), vlo, vhi, vscale, vbins, vlast);
+        const uint32x4_t i1 = mn_hist_index_float(vld1q_f32(buf + 4), vlo, vhi, vscale, vbins, vlast);
+        MN_HIST_LANES4(i0);
+        MN_HIST_LANES4(i1);
+    }
+}
+
+/* counts the task's chunk into its sub-histograms and folds them into the first */
+static void mn_hist_task (void * arg)
+{
+    mn_hist_task_t * task = (mn_hist_task_t *)arg;
+    const size_t stride = task->bins + 1;
+    mn_uint32_t * h0 = task->counts;
+    mn_uint32_t * h1 = task->subs > 1 ? h0 + stride : h0;
+    mn_uint32_t * h2 = task->subs > 1 ? h0 + 2 * stride : h0;
+    mn_uint32_t * h3 = task->subs > 1 ? h0 + 3 * stride : h0;
+
+    memset(h0, 0, task->subs * stride * sizeof(mn_uint32_t));
+    switch (task->kind)
+    {
+    case MN_HIST_UINT8:
+        mn_hist_uint8(h0, h1, h2, h3, (const mn_uint8_t *)task->src, task->count);
+        break;
+    case MN_HIST_INT32:
+        mn_hist_int32(h0, h1, h2, h3, (const mn_int32_t *)task->src, task->count, task->bins);
+        break;
+    case MN_HIST_FLOAT:
+        mn_hist_float(h0, h1, h2, h3, (const mn_float32_t *)task->src, task->count, task->bins, task->lo,
+                      task->hi, task->scale);
+        break;
+    }
+    for ( size_t k = 1; k < task->subs; k++ )
+    {
+        mn_hist_add(h0, h0 + k * stride, task->bins);
+    }
+}
+
+static mn_result_t mn_hist_neon (mn_uint32_t * hist, const mn_hist_task_t * proto, size_t esize)
+{
+    mn_hist_task_t tasks[ MN_THREAD_MAX ];
+    const size_t count = proto->count;
+    const size_t subs = proto->bins < MN_HIST_SUB_MAX_BINS ? MN_HIST_SUBS : 1;
+    const size_t per_task = subs * (proto->bins + 1);
+    size_t threads = mn_thread_count();
+    size_t step;
+    mn_uint32_t * counts;
+    mn_result_t res;
+
+    if (threads > count / MN_HIST_MIN_PER_THREAD) threads = count / MN_HIST_MIN_PER_THREAD;
+    if (threads > count / proto->bins) threads = count / proto->bins;     /* merging costs bins per thread */
+    if (threads < 1) threads = 1;
+    step = ((count + threads - 1) / threads + 15) & ~(size_t)15;
+    threads = step ? (count + step - 1) / step : 1;
+    if (threads < 1) threads = 1;
+
+    counts = (mn_uint32_t *)malloc(sizeof(mn_uint32_t) * per_task * threads);
+    if (!counts)
+    {
+        return MN_ERROR;
+    }
+    for ( size_t t = 0; t < threads; t++ )
+    {
+        tasks[ t ] = *proto;
+        tasks[ t ].src = (const char *)proto->src + t * step * esize;
+        tasks[ t ].count = count - t * step < step ? count - t * step : step;
+        tasks[ t ].subs = subs;
+        tasks[ t ].counts = counts + t * per_task;
+    }
+
+    res = mn_thread_run(mn_hist_task, tasks, sizeof(tasks[ 0 ]), threads);
+    memcpy(hist, tasks[ 0 ].counts, proto->bins * sizeof(mn_uint32_t));
+    for ( size_t t = 1; t < threads; t++ )
+    {
+        mn_hist_add(hist, tasks[ t ].counts, proto->bins);
+    }
+    free(counts);
+    return res;
+}
+
+mn_result_t mn_histogram_uint8_neon (mn_uint32_t * hist, mn_uint8_t * src, size_t count)
+{
+    mn_hist_task_t task;
+
+    assert(hist && src);
+    memset(&task, 0, sizeof(task));
+    task.kind = MN_HIST_UINT8;
+    task.src = src;
+    task.count = count;
+    task.bins = 256;
+    return mn_hist_neon(hist, &task, sizeof(mn_uint8_t));
+}
+
+mn_result_t mn_histogram_int32_neon (mn_uint32_t * hist, size_t bins, mn_int32_t * src, size_t count)
+{
+    mn_hist_task_t task;
+
+    assert(hist && src);
+    if (bins == 0)
+    {
+        return MN_ERROR;
+    }
+    memset(&task, 0, sizeof(task));
+    task.kind = MN_HIST_INT32;
+    task.src = src;
+    task.count = count;
+    task.bins = bins;
+    return mn_hist_neon(hist, &task, sizeof(mn_int32_t));
+}
+
+mn_result_t mn_histogram_float_neon (mn_uint32_t * hist, size_t bins, mn_float32_t * src, mn_float32_t lo,
+                                     mn_float32_t hi, size_t count)
+{
+    mn_hist_task_t task;
+    const mn_float32_t scale = (mn_float32_t)bins / (hi - lo);
+
+    assert(hist && src);
+    if (bins == 0 || !(lo < hi) || !(scale > 0.0f) || !isfinite(scale))
+    {
+        return MN_ERROR;
+    }
+    memset(&task, 0, sizeof(task));
+    task.kind = MN_HIST_FLOAT;
+    task.src = src;
+    task.count = count;
+    task.bins = bins;
+    task.lo = lo;
+    task.hi = hi;
+    task.scale = scale;
+    return mn_hist_neon(hist, &task, sizeof(mn_float32_t));
+}
@@ -0,0 +1,32 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <assert.h>
+#include <stdint.h>
+
+/*
+Function Input:
+    dst   - Destination that store results
+    src1  - Source that stores user input 1
+    src2  - Source that stores user input 2
+    cst   - Constant of addc / subc / mulc
+    count - Count is an integer that stores number of elements
+
+    C Implementation of the int16 / uint16 operators. The plain routines wrap
+    around on overflow like the NEON instructions do, the _sat routines clamp
+    the result to the range of the type. The functions are generated by
+    MN_INTN_C_FAMILY / MN_INTN_C_ABS in MN_factor.h.
+
+    mul_q15 / mulc_q15 multiply Q15 fixed-point values: (src1 * src2) >> 15,
+    truncated, with -1.0 * -1.0 saturating to 0x7fff (same as vqdmulhq_s16).
+*/
+
+MN_INTN_C_FAMILY(int16, mn_int16_t, INT16_MIN, INT16_MAX)
+MN_INTN_C_ABS(int16, mn_int16_t, INT16_MIN, INT16_MAX)
+
+MN_INTN_C_FAMILY(uint16, mn_uint16_t, 0, UINT16_MAX)
+
+#define MN_Q15_MUL(x, y) ((x) == INT16_MIN && (y) == INT16_MIN ? INT16_MAX : ((x) * (y)) >> 15)
+
+MN_INTN_C_BINARY(mul_q15, int16, mn_int16_t, int32_t, MN_Q15_MUL(x, y))
+MN_INTN_C_CONST(mulc_q15, int16, mn_int16_t, int32_t, MN_Q15_MUL(x, y))
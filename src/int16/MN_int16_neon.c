@@ -0,0 +1,47 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <arm_neon.h>
+#include <assert.h>
+#include <string.h>
+
+/*
+Input Arguments:
+    dst    - Destination pointer that stores the results
+    src1   - Source pointer to array 1
+    src2   - Source pointer to array 2
+    cst    - Constant of addc / subc / mulc
+    count  - Number of elements to process
+
+Intrinsics used:
+    vld1q_s16 / vst1q_s16, vld1q_u16 / vst1q_u16 - load / store 8 elements
+    vaddq / vsubq / vmulq                       - wrapping add, sub and mul
+    vqaddq / vqsubq                             - saturating add and sub
+    vmull + vqmovn                              - saturating mul (widen to 32 bit, narrow with saturation)
+    vabsq_s16 / vqabsq_s16                      - wrapping and saturating abs
+    vqdmulhq_s16                                - Q15 multiply (mul_q15 / mulc_q15)
+
+Each instruction handles 8 lanes, twice the elements of the int32 kernels.
+
+Supported routines: int16 and uint16 data types [1 Dimensional arrays]
+*/
+
+static inline int16x8_t mn_qmulq_s16 (int16x8_t a, int16x8_t b)
+{
+    return vcombine_s16(vqmovn_s32(vmull_s16(vget_low_s16(a), vget_low_s16(b))),
+                        vqmovn_s32(vmull_s16(vget_high_s16(a), vget_high_s16(b))));
+}
+
+static inline uint16x8_t mn_qmulq_u16 (uint16x8_t a, uint16x8_t b)
+{
+    return vcombine_u16(vqmovn_u32(vmull_u16(vget_low_u16(a), vget_low_u16(b))),
+                        vqmovn_u32(vmull_u16(vget_high_u16(a), vget_high_u16(b))));
+}
+
+MN_INTN_NEON_FAMILY(int16, mn_int16_t, int16x8_t, 8, s16)
+MN_INTN_NEON_ABS(int16, mn_int16_t, int16x8_t, 8, s16)
+
+MN_INTN_NEON_FAMILY(uint16, mn_uint16_t, uint16x8_t, 8, u16)
+
+MN_INTN_NEON_BINARY(mul_q15, int16, mn_int16_t, int16x8_t, 8, s16, vqdmulhq_s16)
+MN_INTN_NEON_CONST(mulc_q15, int16, mn_int16_t, int16x8_t, 8, s16, vqdmulhq_s16)
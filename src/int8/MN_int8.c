@@ -0,0 +1,24 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <assert.h>
+#include <stdint.h>
+
+/*
+Function Input:
+    dst   - Destination that store results
+    src1  - Source that stores user input 1
+    src2  - Source that stores user input 2
+    cst   - Constant of addc / subc / mulc
+    count - Count is an integer that stores number of elements
+
+    C Implementation of the int8 / uint8 operators. The plain routines wrap
+    around on overflow like the NEON instructions do, the _sat routines clamp
+    the result to the range of the type. The functions are generated by
+    MN_INTN_C_FAMILY / MN_INTN_C_ABS in MN_factor.h.
+*/
+
+MN_INTN_C_FAMILY(int8, mn_int8_t, INT8_MIN, INT8_MAX)
+MN_INTN_C_ABS(int8, mn_int8_t, INT8_MIN, INT8_MAX)
+
+MN_INTN_C_FAMILY(uint8, mn_uint8_t, 0, UINT8_MAX)
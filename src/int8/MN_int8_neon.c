@@ -0,0 +1,43 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <arm_neon.h>
+#include <assert.h>
+#include <string.h>
+
+/*
+Input Arguments:
+    dst    - Destination pointer that stores the results
+    src1   - Source pointer to array 1
+    src2   - Source pointer to array 2
+    cst    - Constant of addc / subc / mulc
+    count  - Number of elements to process
+
+Intrinsics used:
+    vld1q_s8 / vst1q_s8, vld1q_u8 / vst1q_u8 - load / store 16 elements
+    vaddq / vsubq / vmulq                   - wrapping add, sub and mul
+    vqaddq / vqsubq                         - saturating add and sub
+    vmull + vqmovn                          - saturating mul (widen to 16 bit, narrow with saturation)
+    vabsq_s8 / vqabsq_s8                    - wrapping and saturating abs
+
+Each instruction handles 16 lanes, four times the elements of the int32 kernels.
+
+Supported routines: int8 and uint8 data types [1 Dimensional arrays]
+*/
+
+static inline int8x16_t mn_qmulq_s8 (int8x16_t a, int8x16_t b)
+{
+    return vcombine_s8(vqmovn_s16(vmull_s8(vget_low_s8(a), vget_low_s8(b))),
+                       vqmovn_s16(vmull_s8(vget_high_s8(a), vget_high_s8(b))));
+}
+
+static inline uint8x16_t mn_qmulq_u8 (uint8x16_t a, uint8x16_t b)
+{
+    return vcombine_u8(vqmovn_u16(vmull_u8(vget_low_u8(a), vget_low_u8(b))),
+                       vqmovn_u16(vmull_u8(vget_high_u8(a), vget_high_u8(b))));
+}
+
+MN_INTN_NEON_FAMILY(int8, mn_int8_t, int8x16_t, 16, s8)
+MN_INTN_NEON_ABS(int8, mn_int8_t, int8x16_t, 16, s8)
+
+MN_INTN_NEON_FAMILY(uint8, mn_uint8_t, uint8x16_t, 16, u8)
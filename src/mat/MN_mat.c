@@ -0,0 +1,194 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include "../common/MN_mat_formula.h"
+#include <assert.h>
+#include <string.h>
+
+/*
+Function Input:
+    dst   - Destination array of matrices / vectors
+    src1  - Left matrices (mulmat)
+    src2  - Right matrices (mulmat)
+    src   - Vectors to transform (transform)
+    mat   - Matrix applied to every vector (transform)
+    count - Count is an integer that stores number of elements
+
+    C Implementation of the batched matrix routines. Matrices are column major
+    (see mn_mat4f_t):
+        mulmat:    dst[i] = src1[i] * src2[i]
+        transform: dst[i] = mat * src[i]
+        addmat / submat: dst[i] = src1[i] +/- src2[i]
+        transmat:  dst[i] = transpose(src[i])
+        detmat:    dst[i] = det(src[i])      (dst is an mn_float32_t array)
+        invmat:    dst[i] = inverse(src[i]), the identity when det(src[i]) == 0
+    dst may be the same array as a source (in-place).
+*/
+
+#define MN_MAT_MUL(a, b) ((a) * (b))
+#define MN_MAT_ADD(a, b) ((a) + (b))
+#define MN_MAT_SUB(a, b) ((a) - (b))
+#define MN_MAT_NEG(a)    (-(a))
+
+/* r = m * v for a column major 4x4 matrix */
+#define MN_MAT4_MUL_VEC(r, m, v) \
+    do { \
+        (r).x = (m).c1.x * (v).x + (m).c2.x * (v).y + (m).c3.x * (v).z + (m).c4.x * (v).w; \
+        (r).y = (m).c1.y * (v).x + (m).c2.y * (v).y + (m).c3.y * (v).z + (m).c4.y * (v).w; \
+        (r).z = (m).c1.z * (v).x + (m).c2.z * (v).y + (m).c3.z * (v).z + (m).c4.z * (v).w; \
+        (r).w = (m).c1.w * (v).x + (m).c2.w * (v).y + (m).c3.w * (v).z + (m).c4.w * (v).w; \
+    } while (0)
+
+mn_result_t mn_mulmat_4x4f_c (mn_mat4f_t * dst, mn_mat4f_t * src1, mn_mat4f_t * src2, size_t count)
+{
+    MN_CHECK_Dst1SRC1SRC2(dst, src1, src2);
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        /* column j of the product is src1 * (column j of src2); work on copies for in-place */
+        const mn_mat4f_t a = src1[ itr ];
+        const mn_mat4f_t b = src2[ itr ];
+        MN_MAT4_MUL_VEC(dst[ itr ].c1, a, b.c1);
+        MN_MAT4_MUL_VEC(dst[ itr ].c2, a, b.c2);
+        MN_MAT4_MUL_VEC(dst[ itr ].c3, a, b.c3);
+        MN_MAT4_MUL_VEC(dst[ itr ].c4, a, b.c4);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_transform_vec4f_c (mn_vec4f_t * dst, mn_vec4f_t * src, const mn_mat4f_t * mat, size_t count)
+{
+    const mn_mat4f_t m = *mat;
+    MN_CHECK_DstSRC;
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        const mn_vec4f_t v = src[ itr ];
+        MN_MAT4_MUL_VEC(dst[ itr ], m, v);
+    }
+    return MN_SUCCESS;
+}
+
+/* add / sub are element wise, a matrix array is a plain float array */
+#define MN_MAT_C_ELEMENTWISE(op, N) \
+mn_result_t mn_##op##mat_##N##x##N##f_c (mn_mat##N##f_t * dst, mn_mat##N##f_t * src1, mn_mat##N##f_t * src2, size_t count) \
+{ \
+    return mn_##op##_float_c((mn_float32_t *)dst, (mn_float32_t *)src1, (mn_float32_t *)src2, count * N * N); \
+}
+
+MN_MAT_C_ELEMENTWISE(add, 2)
+MN_MAT_C_ELEMENTWISE(add, 3)
+MN_MAT_C_ELEMENTWISE(add, 4)
+MN_MAT_C_ELEMENTWISE(sub, 2)
+MN_MAT_C_ELEMENTWISE(sub, 3)
+MN_MAT_C_ELEMENTWISE(sub, 4)
+
+#define MN_MAT_C_TRANSPOSE(N) \
+mn_result_t mn_transmat_##N##x##N##f_c (mn_mat##N##f_t * dst, mn_mat##N##f_t * src, size_t count) \
+{ \
+    MN_CHECK_DstSRC; \
+    for ( size_t itr = 0; itr < count; itr++ ) \
+    { \
+        mn_float32_t a[N * N]; \
+        mn_float32_t * d = (mn_float32_t *)&dst[ itr ]; \
+        memcpy(a, &src[ itr ], sizeof(a)); \
+        for ( int c = 0; c < N; c++ ) \
+        { \
+            for ( int r = 0; r < N; r++ ) \
+            { \
+                d[c * N + r] = a[r * N + c]; \
+            } \
+        } \
+    } \
+    return MN_SUCCESS; \
+}
+
+MN_MAT_C_TRANSPOSE(2)
+MN_MAT_C_TRANSPOSE(3)
+MN_MAT_C_TRANSPOSE(4)
+
+mn_result_t mn_detmat_2x2f_c (mn_float32_t * dst, mn_mat2f_t * src, size_t count)
+{
+    assert(dst && src);
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        const mn_float32_t * a = (const mn_float32_t *)&src[ itr ];
+        dst[ itr ] = MN_MAT2_DET(a);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_detmat_3x3f_c (mn_float32_t * dst, mn_mat3f_t * src, size_t count)
+{
+    assert(dst && src);
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        const mn_float32_t * a = (const mn_float32_t *)&src[ itr ];
+        mn_float32_t b[9], det;
+        MN_MAT3_ADJ(a, b, det);
+        dst[ itr ] = det;
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_detmat_4x4f_c (mn_float32_t * dst, mn_mat4f_t * src, size_t count)
+{
+    assert(dst && src);
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        const mn_float32_t * a = (const mn_float32_t *)&src[ itr ];
+        mn_float32_t s[6], c[6];
+        MN_MAT4_MINORS(a, s, c);
+        dst[ itr ] = MN_MAT4_DET_FROM_MINORS(s, c);
+    }
+    return MN_SUCCESS;
+}
+
+/* b holds the adjugate: scale by 1 / det, or store the identity for a singular matrix */
+#define MN_MAT_C_STORE_INVERSE(d, b, det, N) \
+    do { \
+        const mn_float32_t rdet_ = 1.0f / (det); \
+        for ( int k = 0; k < N * N; k++ ) \
+        { \
+            (d)[k] = (det) == 0.0f ? (k % (N + 1) == 0 ? 1.0f : 0.0f) : (b)[k] * rdet_; \
+        } \
+    } while (0)
+
+mn_result_t mn_invmat_2x2f_c (mn_mat2f_t * dst, mn_mat2f_t * src, size_t count)
+{
+    MN_CHECK_DstSRC;
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        mn_float32_t a[4], b[4], det;
+        memcpy(a, &src[ itr ], sizeof(a));
+        MN_MAT2_ADJ(a, b, det);
+        MN_MAT_C_STORE_INVERSE((mn_float32_t *)&dst[ itr ], b, det, 2);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_invmat_3x3f_c (mn_mat3f_t * dst, mn_mat3f_t * src, size_t count)
+{
+    MN_CHECK_DstSRC;
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        mn_float32_t a[9], b[9], det;
+        memcpy(a, &src[ itr ], sizeof(a));
+        MN_MAT3_ADJ(a, b, det);
+        MN_MAT_C_STORE_INVERSE((mn_float32_t *)&dst[ itr ], b, det, 3);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_invmat_4x4f_c (mn_mat4f_t * dst, mn_mat4f_t * src, size_t count)
+{
+    MN_CHECK_DstSRC;
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        mn_float32_t a[16], b[16], s[6], c[6], det;
+        memcpy(a, &src[ itr ], sizeof(a));
+        MN_MAT4_MINORS(a, s, c);
+        det = MN_MAT4_DET_FROM_MINORS(s, c);
+        MN_MAT4_ADJ_FROM_MINORS(a, s, c, b);
+        MN_MAT_C_STORE_INVERSE((mn_float32_t *)&dst[ itr ], b, det, 4);
+    }
+    return MN_SUCCESS;
+}
@@ -0,0 +1,334 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include "../common/MN_mat_formula.h"
+#include <arm_neon.h>
+#include <assert.h>
+#include <string.h>
+
+/*
+Input Arguments:
+    dst    - Destination array of matrices / vectors
+    src1   - Left matrices (mulmat)
+    src2   - Right matrices (mulmat)
+    src    - Vectors to transform (transform)
+    mat    - Matrix applied to every vector (transform)
+    count  - Number of matrices / vectors to process
+
+Intrinsics used:
+    vld1q_f32 / vst1q_f32 - load / store one column (or one vec4f)
+    vmulq_laneq_f32       - column 1 times one lane of the vector
+    vfmaq_laneq_f32       - accumulate columns 2-4 times the other lanes (AArch64;
+                            vmlaq_lane_f32 on the low / high halves on 32-bit ARM)
+    vtrnq_f32 / vcombine_f32 - 4x4 transposes between matrix (AoS) and element (SoA) order
+    vdivq_f32             - 1 / det (vrecpeq_f32 + two vrecpsq_f32 steps on 32-bit ARM)
+    vceqq_f32 / vbslq_f32 - identity for singular matrices
+
+A column major matrix times a vector is a sum of its columns scaled by the
+vector lanes, so every column of the result takes one multiply and three
+fused multiply-adds on whole registers, with no transposes or horizontal adds.
+
+transform keeps the four columns of mat in registers for the whole call and
+runs four independent vectors per step so the FMA chains overlap; the loop is
+limited by the load / store bandwidth.
+
+transmat / detmat / invmat work on four matrices per step in SoA form: register
+k holds element k of the four matrices, built with 4x4 transposes (vtrnq_f32)
+of one 4-float row of each matrix. Every formula then runs on four matrices
+per instruction, without lane shuffles; transmat is only a renaming of the SoA
+registers. A leftover (< 4 matrices) is padded with zero matrices.
+
+addmat / submat are element wise and run the float32 add / sub kernels.
+
+Supported routines: mulmat 4x4, transform vec4f, add/sub/trans/det/inv 2x2, 3x3, 4x4 [batched]
+*/
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define MN_MAT_MUL_LANE(a, v, l)     vmulq_laneq_f32((a), (v), l)
+#else
+#define MN_MAT_MUL_LANE(a, v, l)     MN_MAT_MUL_LANE_##l(a, v)
+#define MN_MAT_MUL_LANE_0(a, v)      vmulq_lane_f32((a), vget_low_f32(v), 0)
+#endif
+
+/* c1 * v.x + c2 * v.y + c3 * v.z + c4 * v.w */
+#define MN_MAT4_MUL_VEC(c1, c2, c3, c4, v) \
+    MN_FMAQ_LANEQ_F32(MN_FMAQ_LANEQ_F32(MN_FMAQ_LANEQ_F32(MN_MAT_MUL_LANE(c1, v, 0), c2, v, 1), c3, v, 2), c4, v, 3)
+
+mn_result_t mn_mulmat_4x4f_neon (mn_mat4f_t * dst, mn_mat4f_t * src1, mn_mat4f_t * src2, size_t count)
+{
+    const mn_float32_t * a = (const mn_float32_t *)src1;
+    const mn_float32_t * b = (const mn_float32_t *)src2;
+    mn_float32_t * d = (mn_float32_t *)dst;
+    MN_CHECK_Dst1SRC1SRC2(dst, src1, src2);
+
+    MN_PREFETCH_INIT;
+    for (size_t i = 0; i < count; i++, a += 16, b += 16, d += 16)
+    {
+        MN_PREFETCH_SRC_STEP(a, 64);
+        MN_PREFETCH_SRC_STEP(b, 64);
+        const float32x4_t a1 = vld1q_f32(a);
+        const float32x4_t a2 = vld1q_f32(a + 4);
+        const float32x4_t a3 = vld1q_f32(a + 8);
+        const float32x4_t a4 = vld1q_f32(a + 12);
+        const float32x4_t b1 = vld1q_f32(b);
+        const float32x4_t b2 = vld1q_f32(b + 4);
+        const float32x4_t b3 = vld1q_f32(b + 8);
+        const float32x4_t b4 = vld1q_f32(b + 12);
+        /* all loads happen before the stores, so dst may alias a source */
+        vst1q_f32(d,      MN_MAT4_MUL_VEC(a1, a2, a3, a4, b1));
+        vst1q_f32(d + 4,  MN_MAT4_MUL_VEC(a1, a2, a3, a4, b2));
+        vst1q_f32(d + 8,  MN_MAT4_MUL_VEC(a1, a2, a3, a4, b3));
+        vst1q_f32(d + 12, MN_MAT4_MUL_VEC(a1, a2, a3, a4, b4));
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_transform_vec4f_neon (mn_vec4f_t * dst, mn_vec4f_t * src, const mn_mat4f_t * mat, size_t count)
+{
+    const mn_float32_t * m = (const mn_float32_t *)mat;
+    const mn_float32_t * s = (const mn_float32_t *)src;
+    mn_float32_t * d = (mn_float32_t *)dst;
+    const float32x4_t c1 = vld1q_f32(m);
+    const float32x4_t c2 = vld1q_f32(m + 4);
+    const float32x4_t c3 = vld1q_f32(m + 8);
+    const float32x4_t c4 = vld1q_f32(m + 12);
+    size_t i = 0;
+    MN_CHECK_DstSRC;
+
+    MN_PREFETCH_INIT;
+    for (; i + 4 <= count; i += 4, s += 16, d += 16)
+    {
+        MN_PREFETCH_SRC_STEP(s, 64);
+        const float32x4_t v0 = vld1q_f32(s);
+        const float32x4_t v1 = vld1q_f32(s + 4);
+        const float32x4_t v2 = vld1q_f32(s + 8);
+        const float32x4_t v3 = vld1q_f32(s + 12);
+        vst1q_f32(d,      MN_MAT4_MUL_VEC(c1, c2, c3, c4, v0));
+        vst1q_f32(d + 4,  MN_MAT4_MUL_VEC(c1, c2, c3, c4, v1));
+        vst1q_f32(d + 8,  MN_MAT4_MUL_VEC(c1, c2, c3, c4, v2));
+        vst1q_f32(d + 12, MN_MAT4_MUL_VEC(c1, c2, c3, c4, v3));
+    }
+    for (; i < count; i++, s += 4, d += 4)
+    {
+        vst1q_f32(d, MN_MAT4_MUL_VEC(c1, c2, c3, c4, vld1q_f32(s)));
+    }
+    return MN_SUCCESS;
+}
+
+/* ===== add / sub ===== */
+
+#define MN_MAT_NEON_ELEMENTWISE(op, N) \
+mn_result_t mn_##op##mat_##N##x##N##f_neon (mn_mat##N##f_t * dst, mn_mat##N##f_t * src1, mn_mat##N##f_t * src2, size_t count) \
+{ \
+    return mn_##op##_float_neon((mn_float32_t *)dst, (mn_float32_t *)src1, (mn_float32_t *)src2, count * N * N); \
+}
+
+MN_MAT_NEON_ELEMENTWISE(add, 2)
+MN_MAT_NEON_ELEMENTWISE(add, 3)
+MN_MAT_NEON_ELEMENTWISE(add, 4)
+MN_MAT_NEON_ELEMENTWISE(sub, 2)
+MN_MAT_NEON_ELEMENTWISE(sub, 3)
+MN_MAT_NEON_ELEMENTWISE(sub, 4)
+
+/* ===== SoA helpers ===== */
+
+#define MN_MAT_MUL(a, b) vmulq_f32((a), (b))
+#define MN_MAT_ADD(a, b) vaddq_f32((a), (b))
+#define MN_MAT_SUB(a, b) vsubq_f32((a), (b))
+#define MN_MAT_NEG(a)    vnegq_f32(a)
+
+/* r0..r3 hold 4 floats of matrices 0..3; afterwards r_k holds float k of every matrix */
+#define MN_MAT_TRANSPOSE4(r0, r1, r2, r3) \
+    do { \
+        const float32x4x2_t t01_ = vtrnq_f32((r0), (r1)); \
+        const float32x4x2_t t23_ = vtrnq_f32((r2), (r3)); \
+        r0 = vcombine_f32(vget_low_f32(t01_.val[0]), vget_low_f32(t23_.val[0])); \
+        r1 = vcombine_f32(vget_low_f32(t01_.val[1]), vget_low_f32(t23_.val[1])); \
+        r2 = vcombine_f32(vget_high_f32(t01_.val[0]), vget_high_f32(t23_.val[0])); \
+        r3 = vcombine_f32(vget_high_f32(t01_.val[1]), vget_high_f32(t23_.val[1])); \
+    } while (0)
+
+/* Loads 4 consecutive NxN matrices from p into e[0 .. N*N-1] */
+static inline void mn_mat_load_soa (float32x4_t * e, const mn_float32_t * p, int nn)
+{
+    int k = 0;
+    for (; k + 4 <= nn; k += 4)
+    {
+        e[k]     = vld1q_f32(p + k);
+        e[k + 1] = vld1q_f32(p + nn + k);
+        e[k + 2] = vld1q_f32(p + 2 * nn + k);
+        e[k + 3] = vld1q_f32(p + 3 * nn + k);
+        MN_MAT_TRANSPOSE4(e[k], e[k + 1], e[k + 2], e[k + 3]);
+    }
+    if (k < nn)    /* 3x3: element 8 */
+    {
+        e[k] = vld1q_dup_f32(p + k);
+        e[k] = vld1q_lane_f32(p + nn + k, e[k], 1);
+        e[k] = vld1q_lane_f32(p + 2 * nn + k, e[k], 2);
+        e[k] = vld1q_lane_f32(p + 3 * nn + k, e[k], 3);
+    }
+}
+
+/* Stores e[0 .. N*N-1] as 4 consecutive NxN matrices at p (the inverse of mn_mat_load_soa) */
+static inline void mn_mat_store_soa (mn_float32_t * p, const float32x4_t * e, int nn)
+{
+    int k = 0;
+    for (; k + 4 <= nn; k += 4)
+    {
+        float32x4_t r0 = e[k], r1 = e[k + 1], r2 = e[k + 2], r3 = e[k + 3];
+        MN_MAT_TRANSPOSE4(r0, r1, r2, r3);
+        vst1q_f32(p + k, r0);
+        vst1q_f32(p + nn + k, r1);
+        vst1q_f32(p + 2 * nn + k, r2);
+        vst1q_f32(p + 3 * nn + k, r3);
+    }
+    if (k < nn)
+    {
+        vst1q_lane_f32(p + k, e[k], 0);
+        vst1q_lane_f32(p + nn + k, e[k], 1);
+        vst1q_lane_f32(p + 2 * nn + k, e[k], 2);
+        vst1q_lane_f32(p + 3 * nn + k, e[k], 3);
+    }
+}
+
+/*
+ * Runs BLOCK(d, s) on 4 matrices at a time; d and s point at mn_float32_t
+ * (d advances by DSTEP floats per block, s by 4 * N * N). The leftover goes
+ * through zero padded copies.
+ */
+#define MN_MAT_NEON_BLOCKS(N, DSTEP, BLOCK) \
+    do { \
+        const mn_float32_t * s_ = (const mn_float32_t *)src; \
+        mn_float32_t * d_ = (mn_float32_t *)dst; \
+        size_t i_ = 0; \
+        MN_PREFETCH_INIT; \
+        for (; i_ + 4 <= count; i_ += 4, s_ += 4 * N * N, d_ += 4 * (DSTEP)) \
+        { \
+            MN_PREFETCH_SRC_STEP(s_, 4 * N * N * sizeof(mn_float32_t)); \
+            BLOCK(d_, s_); \
+        } \
+        if (i_ < count) \
+        { \
+            mn_float32_t ts_[4 * N * N] = { 0 }; \
+            mn_float32_t td_[4 * (DSTEP)]; \
+            memcpy(ts_, s_, (count - i_) * N * N * sizeof(mn_float32_t)); \
+            BLOCK(td_, ts_); \
+            memcpy(d_, td_, (count - i_) * (DSTEP) * sizeof(mn_float32_t)); \
+        } \
+    } while (0)
+
+/* ===== transpose ===== */
+
+#define MN_MAT_TRANS_BLOCK(N) \
+static inline void mn_mat_trans##N##_block (mn_float32_t * d, const mn_float32_t * s) \
+{ \
+    float32x4_t a[N * N], b[N * N]; \
+    mn_mat_load_soa(a, s, N * N); \
+    for (int c = 0; c < N; c++) \
+    { \
+        for (int r = 0; r < N; r++) \
+        { \
+            b[c * N + r] = a[r * N + c]; \
+        } \
+    } \
+    mn_mat_store_soa(d, b, N * N); \
+} \
+mn_result_t mn_transmat_##N##x##N##f_neon (mn_mat##N##f_t * dst, mn_mat##N##f_t * src, size_t count) \
+{ \
+    MN_CHECK_DstSRC; \
+    MN_MAT_NEON_BLOCKS(N, N * N, mn_mat_trans##N##_block); \
+    return MN_SUCCESS; \
+}
+
+MN_MAT_TRANS_BLOCK(2)
+MN_MAT_TRANS_BLOCK(3)
+MN_MAT_TRANS_BLOCK(4)
+
+/* ===== determinant ===== */
+
+static inline void mn_mat_det2_block (mn_float32_t * d, const mn_float32_t * s)
+{
+    float32x4_t a[4];
+    mn_mat_load_soa(a, s, 4);
+    vst1q_f32(d, MN_MAT2_DET(a));
+}
+
+static inline void mn_mat_det3_block (mn_float32_t * d, const mn_float32_t * s)
+{
+    float32x4_t a[9], b[9], det;
+    mn_mat_load_soa(a, s, 9);
+    MN_MAT3_ADJ(a, b, det);
+    vst1q_f32(d, det);
+}
+
+static inline void mn_mat_det4_block (mn_float32_t * d, const mn_float32_t * s)
+{
+    float32x4_t a[16], sm[6], cm[6];
+    mn_mat_load_soa(a, s, 16);
+    MN_MAT4_MINORS(a, sm, cm);
+    vst1q_f32(d, MN_MAT4_DET_FROM_MINORS(sm, cm));
+}
+
+#define MN_MAT_NEON_DET(N) \
+mn_result_t mn_detmat_##N##x##N##f_neon (mn_float32_t * dst, mn_mat##N##f_t * src, size_t count) \
+{ \
+    assert(dst && src); \
+    MN_MAT_NEON_BLOCKS(N, 1, mn_mat_det##N##_block); \
+    return MN_SUCCESS; \
+}
+
+MN_MAT_NEON_DET(2)
+MN_MAT_NEON_DET(3)
+MN_MAT_NEON_DET(4)
+
+/* ===== inverse ===== */
+
+/* b holds the adjugate: scale by 1 / det, the identity where det == 0 */
+static inline void mn_mat_store_inverse (mn_float32_t * d, float32x4_t * b, float32x4_t det, int n)
+{
+    const uint32x4_t singular = vceqq_f32(det, vdupq_n_f32(0.0f));
+    const float32x4_t rdet = mn_recipq_f32(det);
+    for (int k = 0; k < n * n; k++)
+    {
+        b[k] = vbslq_f32(singular, vdupq_n_f32(k % (n + 1) == 0 ? 1.0f : 0.0f), vmulq_f32(b[k], rdet));
+    }
+    mn_mat_store_soa(d, b, n * n);
+}
+
+static inline void mn_mat_inv2_block (mn_float32_t * d, const mn_float32_t * s)
+{
+    float32x4_t a[4], b[4], det;
+    mn_mat_load_soa(a, s, 4);
+    MN_MAT2_ADJ(a, b, det);
+    mn_mat_store_inverse(d, b, det, 2);
+}
+
+static inline void mn_mat_inv3_block (mn_float32_t * d, const mn_float32_t * s)
+{
+    float32x4_t a[9], b[9], det;
+    mn_mat_load_soa(a, s, 9);
+    MN_MAT3_ADJ(a, b, det);
+    mn_mat_store_inverse(d, b, det, 3);
+}
+
+static inline void mn_mat_inv4_block (mn_float32_t * d, const mn_float32_t * s)
+{
+    float32x4_t a[16], b[16], sm[6], cm[6], det;
+    mn_mat_load_soa(a, s, 16);
+    MN_MAT4_MINORS(a, sm, cm);
+    det = MN_MAT4_DET_FROM_MINORS(sm, cm);
+    MN_MAT4_ADJ_FROM_MINORS(a, sm, cm, b);
+    mn_mat_store_inverse(d, b, det, 4);
+}
+
+#define MN_MAT_NEON_INV(N) \
+mn_result_t mn_invmat_##N##x##N##f_neon (mn_mat##N##f_t * dst, mn_mat##N##f_t * src, size_t count) \
+{ \
+    MN_CHECK_DstSRC; \
+    MN_MAT_NEON_BLOCKS(N, N * N, mn_mat_inv##N##_block); \
+    return MN_SUCCESS; \
+}
+
+MN_MAT_NEON_INV(2)
+MN_MAT_NEON_INV(3)
+MN_MAT_NEON_INV(4)
@@ -3,6 +3,7 @@
 #include "MN_math.h"
 #include <arm_neon.h>
 #include <assert.h>
+#include <string.h>
 
 /*
 Input Arguments:
@@ -19,11 +20,12 @@ Intrinsics used:
     int32 routines:
         vld1q_s32 - NEON intrinsic to load 4 int32 values from memory
         vst1q_s32 - NEON intrinsic to store 4 int32 values back to memory
+        vmull_s32 + vqmovn_s64 - exact products narrowed with saturation (mul_sat, mul_ovf)
 
 Supported routines: Int and Float 32-bit data types [1 to 4 Dimensional arrays]
 */
 
-mn_result_t mn_mul_float_neon(mn_float32_t * dst, mn_float32_t * src1, mn_float32_t * src2, uint32_t count)
+mn_result_t mn_mul_float_neon(mn_float32_t * dst, mn_float32_t * src1, mn_float32_t * src2, size_t count)
 {
     MN_MUL_DstSrc1Src2_DO_COUNT_TIMES_FLOAT_NEON(
         MN_MAINLOOP_FLOAT_NEON_MUL,      /* SIMD block for 4 elements */
@@ -31,7 +33,7 @@ mn_result_t mn_mul_float_neon(mn_float32_t * dst, mn_float32_t * src1, mn_float3
     );
 }
 
-mn_result_t mn_mul_int32_neon(mn_int32_t * dst, mn_int32_t * src1, mn_int32_t * src2, uint32_t count)
+mn_result_t mn_mul_int32_neon(mn_int32_t * dst, mn_int32_t * src1, mn_int32_t * src2, size_t count)
 {
     MN_MUL_DstSrc1Src2_DO_COUNT_TIMES_INT32_NEON(
         MN_MAINLOOP_INT32_NEON_MUL,      /* SIMD block for 4 elements */
@@ -39,7 +41,7 @@ mn_result_t mn_mul_int32_neon(mn_int32_t * dst, mn_int32_t * src1, mn_int32_t *
     );
 }
 
-mn_result_t mn_mul_vec2f_neon(mn_vec2f_t * dst, mn_vec2f_t * src1, mn_vec2f_t * src2, uint32_t count)
+mn_result_t mn_mul_vec2f_neon(mn_vec2f_t * dst, mn_vec2f_t * src1, mn_vec2f_t * src2, size_t count)
 {
     MN_MUL_DstSrc1Src2_DO_COUNT_TIMES_VEC2F_NEON(
         n_dst = vmulq_f32(n_src1, n_src2);,     /* SIMD main loop */
@@ -47,7 +49,7 @@ mn_result_t mn_mul_vec2f_neon(mn_vec2f_t * dst, mn_vec2f_t * src1, mn_vec2f_t *
     );
 }
 
-mn_result_t mn_mul_vec2i_neon(mn_vec2i_t * dst, mn_vec2i_t * src1, mn_vec2i_t * src2, uint32_t count)
+mn_result_t mn_mul_vec2i_neon(mn_vec2i_t * dst, mn_vec2i_t * src1, mn_vec2i_t * src2, size_t count)
 {
     MN_MUL_DstSrc1Src2_DO_COUNT_TIMES_VEC2I_NEON(
         n_dst = vmulq_s32(n_src1, n_src2);,     /* SIMD main loop */
@@ -55,7 +57,7 @@ mn_result_t mn_mul_vec2i_neon(mn_vec2i_t * dst, mn_vec2i_t * src1, mn_vec2i_t *
     );
 }
 
-mn_result_t mn_mul_vec3f_neon(mn_vec3f_t * dst, mn_vec3f_t * src1, mn_vec3f_t * src2, uint32_t count)
+mn_result_t mn_mul_vec3f_neon(mn_vec3f_t * dst, mn_vec3f_t * src1, mn_vec3f_t * src2, size_t count)
 {
     MN_MUL_DstSrc1Src2_DO_COUNT_TIMES_VEC3F_NEON(
         n_dst1 = vmulq_f32(n_src11, n_src21);   /* X components */
@@ -67,7 +69,7 @@ mn_result_t mn_mul_vec3f_neon(mn_vec3f_t * dst, mn_vec3f_t * src1, mn_vec3f_t *
     );
 }
 
-mn_result_t mn_mul_vec3i_neon(mn_vec3i_t * dst, mn_vec3i_t * src1, mn_vec3i_t * src2, uint32_t count)
+mn_result_t mn_mul_vec3i_neon(mn_vec3i_t * dst, mn_vec3i_t * src1, mn_vec3i_t * src2, size_t count)
 {
     MN_MUL_DstSrc1Src2_DO_COUNT_TIMES_VEC3I_NEON(
         n_dst1 = vmulq_s32(n_src11, n_src21);   /* X components */
@@ -79,16 +81,22 @@ mn_result_t mn_mul_vec3i_neon(mn_vec3i_t * dst, mn_vec3i_t * src1, mn_vec3i_t *
     );
 }
 
-mn_result_t mn_mul_vec4f_neon(mn_vec4f_t * dst, mn_vec4f_t * src1, mn_vec4f_t * src2, uint32_t count)
+mn_result_t mn_mul_vec4f_neon(mn_vec4f_t * dst, mn_vec4f_t * src1, mn_vec4f_t * src2, size_t count)
 {
     MN_MUL_DstSrc1Src2_DO_COUNT_TIMES_VEC4F_NEON(
         n_dst = vmulq_f32(n_src1, n_src2);      /* Each vec4f fits exactly in 128-bit register */
     );
 }
 
-mn_result_t mn_mul_vec4i_neon(mn_vec4i_t * dst, mn_vec4i_t * src1, mn_vec4i_t * src2, uint32_t count)
+mn_result_t mn_mul_vec4i_neon(mn_vec4i_t * dst, mn_vec4i_t * src1, mn_vec4i_t * src2, size_t count)
 {
     MN_MUL_DstSrc1Src2_DO_COUNT_TIMES_VEC4I_NEON(
         n_dst = vmulq_s32(n_src1, n_src2);      /* Each vec4i fits exactly in 128-bit register */
     );
 }
+
+/* Saturating int32 mul (MN_QMULQ_S32) */
+MN_INTN_NEON_BINARY(mul_sat, int32, mn_int32_t, int32x4_t, 4, s32, MN_QMULQ_S32)
+
+/* Overflow-checked int32 mul: wrapping result, returns MN_OVERFLOW if any lane overflowed */
+MN_INT32_NEON_OVF(mul, vmulq_s32, MN_INT32X4_MUL_OVF, MN_INT32_MUL_WRAP, MN_INT32_MUL_OVF)
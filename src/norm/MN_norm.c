@@ -0,0 +1,102 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <assert.h>
+#include <math.h>
+
+/*
+Function Input:
+    mean  - Destination of the mean (one per row for the rows routines)
+    var   - Destination of the population variance, sum((x - mean)^2) / count
+    dst   - Destination array
+    src   - Source array (rows * cols row-major for the rows routines)
+    gamma - Per-channel scale, count (cols) values, or NULL for 1
+    beta  - Per-channel offset, count (cols) values, or NULL for 0
+    eps   - Added to the variance before the square root
+    count - Count is an integer that stores number of elements
+
+    C Implementation of the statistics and layer normalization, the
+    reference for the NEON versions:
+        meanvar:   one pass of Welford's update in double
+                   mean += (x - mean) / n, m2 += (x - mean_old) * (x - mean)
+        layernorm: dst[i] = (src[i] - mean) / sqrtf(var + eps) * gamma[i] + beta[i]
+    count == 0 (cols == 0) returns MN_ERROR. dst may be the same array as src.
+*/
+
+static void mn_meanvar_c (mn_float32_t * mean, mn_float32_t * var, const mn_float32_t * src, size_t count)
+{
+    mn_float64_t m = 0.0, m2 = 0.0;
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        const mn_float64_t delta = (mn_float64_t)src[ itr ] - m;
+        m += delta / (mn_float64_t)(itr + 1);
+        m2 += delta * ((mn_float64_t)src[ itr ] - m);
+    }
+    *mean = (mn_float32_t)m;
+    *var = (mn_float32_t)(m2 / (mn_float64_t)count);
+}
+
+static void mn_layernorm_c (mn_float32_t * dst, const mn_float32_t * src, const mn_float32_t * gamma,
+                            const mn_float32_t * beta, mn_float32_t eps, size_t count)
+{
+    mn_float32_t mean, var;
+    mn_meanvar_c(&mean, &var, src, count);
+    const mn_float32_t rstd = 1.0f / sqrtf(var + eps);
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        const mn_float32_t z = (src[ itr ] - mean) * rstd;
+        dst[ itr ] = (gamma ? z * gamma[ itr ] : z) + (beta ? beta[ itr ] : 0.0f);
+    }
+}
+
+mn_result_t mn_meanvar_float_c (mn_float32_t * mean, mn_float32_t * var, mn_float32_t * src, size_t count)
+{
+    assert(mean && var && src);
+    if (count == 0)
+    {
+        return MN_ERROR;
+    }
+    mn_meanvar_c(mean, var, src, count);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_meanvar_rows_float_c (mn_float32_t * mean, mn_float32_t * var, mn_float32_t * src, size_t rows, size_t cols)
+{
+    assert(mean && var && src);
+    if (cols == 0)
+    {
+        return MN_ERROR;
+    }
+    for ( size_t r = 0; r < rows; r++ )
+    {
+        mn_meanvar_c(mean + r, var + r, src + r * cols, cols);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_layernorm_float_c (mn_float32_t * dst, mn_float32_t * src, mn_float32_t * gamma, mn_float32_t * beta,
+                                  mn_float32_t eps, size_t count)
+{
+    MN_ASSERT_DS;
+    if (count == 0)
+    {
+        return MN_ERROR;
+    }
+    mn_layernorm_c(dst, src, gamma, beta, eps, count);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_layernorm_rows_float_c (mn_float32_t * dst, mn_float32_t * src, mn_float32_t * gamma,
+                                       mn_float32_t * beta, mn_float32_t eps, size_t rows, size_t cols)
+{
+    assert(dst && src);
+    if (cols == 0)
+    {
+        return MN_ERROR;
+    }
+    for ( size_t r = 0; r < rows; r++ )
+    {
+        mn_layernorm_c(dst + r * cols, src + r * cols, gamma, beta, eps, cols);
+    }
+    return MN_SUCCESS;
+}
@@ -0,0 +1,195 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <arm_neon.h>
+#include <assert.h>
+#include <math.h>
+
+/*
+Input Arguments:
+    mean  - Destination of the mean (one per row for the rows routines)
+    var   - Destination of the population variance
+    dst   - Destination array
+    src   - Source array (rows * cols row-major for the rows routines)
+    gamma - Per-channel scale, or NULL for 1
+    beta  - Per-channel offset, or NULL for 0
+    eps   - Added to the variance before the square root
+    count - Count is an integer that stores number of elements
+
+Intrinsics used:
+    vsubq_f32 / vaddq_f32 - shift by the block's first value, sums
+    vfmaq_f32 / vmlaq_f32 - sums of squares, scale and offset of layernorm
+    vaddvq_f32 / vpadd_f32 - lane sums at the end of a block
+
+meanvar is a single pass over blocks of 256 values. Each block accumulates
+sum(x - k) and sum((x - k)^2) in four lanes times two accumulators, with k
+the first value of the block, so the sum of squares does not cancel when the
+mean is large against the spread. Blocks are merged with Chan's update in
+double precision:
+    n = na + nb, d = mean_b - mean_a
+    mean = mean_a + d * nb / n, m2 = m2_a + m2_b + d^2 * na * nb / n
+
+layernorm runs meanvar, then one pass writing
+    dst = (x - mean) * (rstd * gamma) + beta,  rstd = 1 / sqrtf(var + eps)
+so src is read twice and dst written once (against sum, sum of squares,
+subc and mulc as four passes). The rows routines repeat this per row.
+
+Supported routines: meanvar, layernorm [float, rows of a 2D float array]
+*/
+
+#define MN_NORM_BLOCK 256
+
+/* sum(x - k) and sum((x - k)^2) over n <= MN_NORM_BLOCK values, k = s[0] */
+static void mn_norm_block (const mn_float32_t * s, size_t n, mn_float32_t * s1, mn_float32_t * s2)
+{
+    const float32x4_t k = vdupq_n_f32(s[ 0 ]);
+    float32x4_t a0 = vdupq_n_f32(0.0f), a1 = a0, q0 = a0, q1 = a0;
+    size_t itr = 0;
+
+    MN_PREFETCH_INIT;
+    for ( ; itr + 8 <= n; itr += 8 )
+    {
+        MN_PREFETCH_SRC_STEP(s + itr, 32);
+        const float32x4_t d0 = vsubq_f32(vld1q_f32(s + itr), k);
+        const float32x4_t d1 = vsubq_f32(vld1q_f32(s + itr + 4), k);
+        a0 = vaddq_f32(a0, d0);
+        a1 = vaddq_f32(a1, d1);
+        q0 = MN_FMAQ_F32(q0, d0, d0);
+        q1 = MN_FMAQ_F32(q1, d1, d1);
+    }
+    if (itr < n)
+    {
+        /* pad with k, whose shifted value adds nothing */
+        mn_float32_t buf[ 8 ];
+        for ( size_t i = 0; i < 8; i++ ) buf[ i ] = itr + i < n ? s[ itr + i ] : s[ 0 ];
+        const float32x4_t d0 = vsubq_f32(vld1q_f32(buf), k);
+        const float32x4_t d1 = vsubq_f32(vld1q_f32(buf + 4), k);
+        a0 = vaddq_f32(a0, d0);
+        a1 = vaddq_f32(a1, d1);
+        q0 = MN_FMAQ_F32(q0, d0, d0);
+        q1 = MN_FMAQ_F32(q1, d1, d1);
+    }
+    *s1 = mn_hsumq_f32(vaddq_f32(a0, a1));
+    *s2 = mn_hsumq_f32(vaddq_f32(q0, q1));
+}
+
+static void mn_norm_meanvar (const mn_float32_t * src, size_t count, mn_float32_t * mean, mn_float32_t * var)
+{
+    mn_float64_t m = 0.0, m2 = 0.0;
+    size_t done = 0;
+
+    while (done < count)
+    {
+        const size_t nb = count - done < MN_NORM_BLOCK ? count - done : MN_NORM_BLOCK;
+        mn_float32_t s1, s2;
+        mn_norm_block(src + done, nb, &s1, &s2);
+
+        const mn_float64_t mb = (mn_float64_t)src[ done ] + (mn_float64_t)s1 / (mn_float64_t)nb;
+        const mn_float64_t m2b = fmax((mn_float64_t)s2 - (mn_float64_t)s1 * s1 / (mn_float64_t)nb, 0.0);
+        const mn_float64_t n = (mn_float64_t)(done + nb);
+        const mn_float64_t d = mb - m;
+        m += d * (mn_float64_t)nb / n;
+        m2 += m2b + d * d * (mn_float64_t)done * (mn_float64_t)nb / n;
+        done += nb;
+    }
+    *mean = (mn_float32_t)m;
+    *var = (mn_float32_t)(m2 / (mn_float64_t)count);
+}
+
+static inline float32x4_t mn_norm_affine (float32x4_t x, const mn_float32_t * gamma, const mn_float32_t * beta,
+                                          size_t i, float32x4_t vmean, float32x4_t vrstd)
+{
+    const float32x4_t scale = gamma ? vmulq_f32(vld1q_f32(gamma + i), vrstd) : vrstd;
+    const float32x4_t offset = beta ? vld1q_f32(beta + i) : vdupq_n_f32(0.0f);
+    return MN_FMAQ_F32(offset, vsubq_f32(x, vmean), scale);
+}
+
+static void mn_norm_layernorm (mn_float32_t * dst, const mn_float32_t * src, const mn_float32_t * gamma,
+                               const mn_float32_t * beta, mn_float32_t eps, size_t count)
+{
+    mn_float32_t mean, var;
+    size_t itr = 0;
+
+    mn_norm_meanvar(src, count, &mean, &var);
+    const float32x4_t vmean = vdupq_n_f32(mean);
+    const float32x4_t vrstd = vdupq_n_f32(1.0f / sqrtf(var + eps));
+
+    MN_PREFETCH_INIT;
+    for ( ; itr + 8 <= count; itr += 8 )
+    {
+        MN_PREFETCH_SRC_STEP(src + itr, 32);
+        const float32x4_t r0 = mn_norm_affine(vld1q_f32(src + itr), gamma, beta, itr, vmean, vrstd);
+        const float32x4_t r1 = mn_norm_affine(vld1q_f32(src + itr + 4), gamma, beta, itr + 4, vmean, vrstd);
+        vst1q_f32(dst + itr, r0);
+        vst1q_f32(dst + itr + 4, r1);
+    }
+    for ( ; itr + 4 <= count; itr += 4 )
+    {
+        vst1q_f32(dst + itr, mn_norm_affine(vld1q_f32(src + itr), gamma, beta, itr, vmean, vrstd));
+    }
+    if (itr < count)
+    {
+        mn_float32_t x[ 4 ] = { 0.0f }, g[ 4 ] = { 0.0f }, b[ 4 ] = { 0.0f };
+        for ( size_t i = 0; itr + i < count; i++ )
+        {
+            x[ i ] = src[ itr + i ];
+            g[ i ] = gamma ? gamma[ itr + i ] : 1.0f;
+            b[ i ] = beta ? beta[ itr + i ] : 0.0f;
+        }
+        vst1q_f32(x, mn_norm_affine(vld1q_f32(x), g, b, 0, vmean, vrstd));
+        for ( size_t i = 0; itr + i < count; i++ ) dst[ itr + i ] = x[ i ];
+    }
+}
+
+mn_result_t mn_meanvar_float_neon (mn_float32_t * mean, mn_float32_t * var, mn_float32_t * src, size_t count)
+{
+    assert(mean && var && src);
+    if (count == 0)
+    {
+        return MN_ERROR;
+    }
+    mn_norm_meanvar(src, count, mean, var);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_meanvar_rows_float_neon (mn_float32_t * mean, mn_float32_t * var, mn_float32_t * src, size_t rows,
+                                        size_t cols)
+{
+    assert(mean && var && src);
+    if (cols == 0)
+    {
+        return MN_ERROR;
+    }
+    for ( size_t r = 0; r < rows; r++ )
+    {
+        mn_norm_meanvar(src + r * cols, cols, mean + r, var + r);
+    }
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_layernorm_float_neon (mn_float32_t * dst, mn_float32_t * src, mn_float32_t * gamma, mn_float32_t * beta,
+                                     mn_float32_t eps, size_t count)
+{
+    MN_ASSERT_DS;
+    if (count == 0)
+    {
+        return MN_ERROR;
+    }
+    mn_norm_layernorm(dst, src, gamma, beta, eps, count);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_layernorm_rows_float_neon (mn_float32_t * dst, mn_float32_t * src, mn_float32_t * gamma,
+                                          mn_float32_t * beta, mn_float32_t eps, size_t rows, size_t cols)
+{
+    assert(dst && src);
+    if (cols == 0)
+    {
+        return MN_ERROR;
+    }
+    for ( size_t r = 0; r < rows; r++ )
+    {
+        mn_norm_layernorm(dst + r * cols, src + r * cols, gamma, beta, eps, cols);
+    }
+    return MN_SUCCESS;
+}
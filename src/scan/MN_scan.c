@@ -0,0 +1,71 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <assert.h>
+
+/*
+Function Input:
+    dst   - Destination array
+    src   - Source array
+    count - Count is an integer that stores number of elements
+
+    C Implementation of the prefix sums (scans), the reference for the NEON
+    versions:
+        inclusive: dst[i] = src[0] + src[1] + ... + src[i]
+        exclusive: dst[0] = 0, dst[i] = src[0] + ... + src[i - 1]
+    Vector types scan every component on its own (dst[i].x sums the .x of
+    src[0 .. i], and so on). int32 sums wrap modulo 2^32. dst may be the same
+    array as src.
+*/
+
+/* count elements of comps components each, one running sum per component */
+static void mn_scan_float_c (mn_float32_t * dst, const mn_float32_t * src, size_t count, size_t comps, int exclusive)
+{
+    mn_float32_t acc[ 4 ] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    for ( size_t itr = 0; itr < count * comps; itr += comps )
+    {
+        for ( size_t k = 0; k < comps; k++ )
+        {
+            const mn_float32_t x = src[ itr + k ];
+            dst[ itr + k ] = exclusive ? acc[ k ] : acc[ k ] + x;
+            acc[ k ] += x;
+        }
+    }
+}
+
+static void mn_scan_int32_c (mn_int32_t * dst, const mn_int32_t * src, size_t count, size_t comps, int exclusive)
+{
+    mn_uint32_t acc[ 4 ] = { 0, 0, 0, 0 };
+    for ( size_t itr = 0; itr < count * comps; itr += comps )
+    {
+        for ( size_t k = 0; k < comps; k++ )
+        {
+            const mn_uint32_t x = (mn_uint32_t)src[ itr + k ];
+            dst[ itr + k ] = (mn_int32_t)(exclusive ? acc[ k ] : acc[ k ] + x);
+            acc[ k ] += x;
+        }
+    }
+}
+
+#define MN_SCAN_C(NAME, TYPE, BASE, COMPS) \
+mn_result_t mn_scan_inclusive_##NAME##_c (TYPE * dst, TYPE * src, size_t count) \
+{ \
+    MN_ASSERT_DS; \
+    mn_scan_##BASE##_c((void *)dst, (const void *)src, count, COMPS, 0); \
+    return MN_SUCCESS; \
+} \
+mn_result_t mn_scan_exclusive_##NAME##_c (TYPE * dst, TYPE * src, size_t count) \
+{ \
+    MN_ASSERT_DS; \
+    mn_scan_##BASE##_c((void *)dst, (const void *)src, count, COMPS, 1); \
+    return MN_SUCCESS; \
+}
+
+MN_SCAN_C(float, mn_float32_t, float, 1)
+MN_SCAN_C(vec2f, mn_vec2f_t, float, 2)
+MN_SCAN_C(vec3f, mn_vec3f_t, float, 3)
+MN_SCAN_C(vec4f, mn_vec4f_t, float, 4)
+MN_SCAN_C(int32, mn_int32_t, int32, 1)
+MN_SCAN_C(vec2i, mn_vec2i_t, int32, 2)
+MN_SCAN_C(vec3i, mn_vec3i_t, int32, 3)
+MN_SCAN_C(vec4i, mn_vec4i_t, int32, 4)
@@ -0,0 +1,369 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include "../common/MN_thread.h"
+#include <arm_neon.h>
+#include <assert.h>
+#include <string.h>
+
+/*
+Input Arguments:
+    dst   - Destination array
+    src   - Source array
+    count - Count is an integer that stores number of elements
+
+Intrinsics used:
+    vextq_f32 / vextq_s32 - shift a block up by 1 or 2 lanes, filling with zeros
+    vaddq_f32 / vaddq_s32 - shift-and-add steps and the carried running total
+    vld3q / vst3q         - split vec3 into x, y and z vectors and back
+
+Each block of 4 lanes is scanned in registers by two shift-and-add steps
+    v = [a, b, c, d]
+    v += vextq(0, v, 3)   [a, a+b, b+c, c+d]
+    v += vextq(0, v, 2)   [a, a+b, a+b+c, a+b+c+d]
+then the running total of the earlier blocks (a vector holding it in every
+lane) is added, and the last lane becomes the running total of the next
+block. Two blocks are scanned side by side so only the carry add is on the
+serial chain. The exclusive scan stores vextq(carry, v, 3), the inclusive
+result shifted up by one lane with the carry in front.
+    vec2: one block holds 2 elements, a single 2-lane step scans it
+    vec3: vld3q gives 4 x, 4 y and 4 z, each scanned as above
+    vec4: one element per vector; 4 elements are pre-summed off the chain
+          and added to the carry
+The float sums are grouped differently from the serial C loop, so results
+can differ from mn_scan_*_c in the last bits. int32 results are exact (both
+wrap modulo 2^32).
+
+Threads (mn_set_threads): arrays of at least MN_SCAN_MIN_PER_THREAD
+elements per thread are split into equal chunks and scanned in two passes:
+    1. every chunk but the last is summed in parallel
+    2. a serial scan of the chunk sums gives the total entering each chunk,
+       then every chunk is scanned in parallel starting from it
+src is read twice and dst written once. The float totals are summed in yet
+another order, so threaded float results can differ in rounding from a
+single thread.
+
+Supported routines: inclusive and exclusive scans [float, int32, vec2f,
+vec3f, vec4f, vec2i, vec3i, vec4i]
+*/
+
+/* Below this many elements per thread, extra threads cost more than they save */
+#ifndef MN_SCAN_MIN_PER_THREAD
+#define MN_SCAN_MIN_PER_THREAD ((size_t)1 << 18)
+#endif
+
+/* running totals of up to 4 components, passed to the kernels as void * */
+typedef union
+{
+    mn_float32_t f[ 4 ];
+    mn_int32_t i[ 4 ];
+} mn_scan_carry_t;
+
+typedef void (*mn_scan_run_fn) (void * dst, const void * src, size_t count, void * carry, int exclusive);
+typedef void (*mn_scan_sum_fn) (const void * src, size_t count, void * total);
+
+typedef struct
+{
+    mn_scan_run_fn run;     /* scan starting from *carry, leaves the total in *carry */
+    mn_scan_sum_fn sum;     /* per component sums */
+    size_t size;            /* bytes per element */
+} mn_scan_kernel_t;
+
+/* inclusive scan of each group of COMPS lanes: two steps for 1, one for 2 */
+#define MN_SCAN_BLOCK(S, COMPS, v, zero) \
+    do { \
+        if ((COMPS) == 1) v = vaddq_##S(v, vextq_##S(zero, v, 3)); \
+        v = vaddq_##S(v, vextq_##S(zero, v, 2)); \
+    } while (0)
+
+/* the last COMPS lanes of v repeated across the vector */
+#define MN_SCAN_LAST(S, COMPS, v) \
+    ((COMPS) == 1 ? vdupq_n_##S(vgetq_lane_##S(v, 3)) : vcombine_##S(vget_high_##S(v), vget_high_##S(v)))
+
+/* scalars and vec2: the array is scanned as a flat run of count * COMPS values */
+#define MN_SCAN_FLAT(NAME, T, V, S, COMPS) \
+static void mn_scan_run_##NAME (void * dst, const void * src, size_t count, void * carry, int exclusive) \
+{ \
+    T * d = (T *)dst; \
+    const T * s = (const T *)src; \
+    T * c = (T *)carry; \
+    T buf[ 8 ]; \
+    const size_t n = count * (COMPS); \
+    const V zero = vdupq_n_##S(0); \
+    size_t itr = 0; \
+    for ( size_t i = 0; i < 4; i++ ) buf[ i ] = c[ i % (COMPS) ]; \
+    V vc = vld1q_##S(buf); \
+    MN_PREFETCH_INIT; \
+    for ( ; itr + 8 <= n; itr += 8 ) \
+    { \
+        V p0 = vld1q_##S(s + itr); \
+        V p1 = vld1q_##S(s + itr + 4); \
+        MN_PREFETCH_SRC_STEP(s + itr, 8 * sizeof(T)); \
+        MN_SCAN_BLOCK(S, COMPS, p0, zero); \
+        MN_SCAN_BLOCK(S, COMPS, p1, zero); \
+        p0 = vaddq_##S(p0, vc); \
+        const V vc0 = MN_SCAN_LAST(S, COMPS, p0); \
+        p1 = vaddq_##S(p1, vc0); \
+        vst1q_##S(d + itr, exclusive ? vextq_##S(vc, p0, 4 - (COMPS)) : p0); \
+        vst1q_##S(d + itr + 4, exclusive ? vextq_##S(vc0, p1, 4 - (COMPS)) : p1); \
+        vc = MN_SCAN_LAST(S, COMPS, p1); \
+    } \
+    for ( ; itr < n; itr += 4 ) \
+    { \
+        /* zero padding leaves the running total unchanged */ \
+        const size_t left = n - itr < 4 ? n - itr : 4; \
+        memset(buf, 0, sizeof(buf)); \
+        memcpy(buf, s + itr, left * sizeof(T)); \
+        V p = vld1q_##S(buf); \
+        MN_SCAN_BLOCK(S, COMPS, p, zero); \
+        p = vaddq_##S(p, vc); \
+        vst1q_##S(buf, exclusive ? vextq_##S(vc, p, 4 - (COMPS)) : p); \
+        memcpy(d + itr, buf, left * sizeof(T)); \
+        vc = MN_SCAN_LAST(S, COMPS, p); \
+    } \
+    vst1q_##S(buf, vc); \
+    for ( size_t k = 0; k < (COMPS); k++ ) c[ k ] = buf[ k ]; \
+} \
+static void mn_scan_sum_##NAME (const void * src, size_t count, void * total) \
+{ \
+    const T * s = (const T *)src; \
+    T * t = (T *)total; \
+    T buf[ 8 ] = { 0 }; \
+    const size_t n = count * (COMPS); \
+    V a0 = vdupq_n_##S(0), a1 = a0; \
+    size_t itr = 0; \
+    MN_PREFETCH_INIT; \
+    for ( ; itr + 8 <= n; itr += 8 ) \
+    { \
+        MN_PREFETCH_SRC_STEP(s + itr, 8 * sizeof(T)); \
+        a0 = vaddq_##S(a0, vld1q_##S(s + itr)); \
+        a1 = vaddq_##S(a1, vld1q_##S(s + itr + 4)); \
+    } \
+    memcpy(buf, s + itr, (n - itr) * sizeof(T)); \
+    a0 = vaddq_##S(a0, vld1q_##S(buf)); \
+    a1 = vaddq_##S(a1, vld1q_##S(buf + 4)); \
+    a0 = vaddq_##S(a0, a1); \
+    if ((COMPS) == 1) \
+    { \
+        t[ 0 ] = mn_hsumq_##S(a0); \
+    } \
+    else \
+    { \
+        vst1_##S(t, vadd_##S(vget_low_##S(a0), vget_high_##S(a0))); \
+    } \
+}
+
+/* vec3: x, y and z of 4 elements in three vectors */
+#define MN_SCAN_VEC3(NAME, T, V, X3, S) \
+static void mn_scan_run_##NAME (void * dst, const void * src, size_t count, void * carry, int exclusive) \
+{ \
+    T * d = (T *)dst; \
+    const T * s = (const T *)src; \
+    T * c = (T *)carry; \
+    const V zero = vdupq_n_##S(0); \
+    V vc[ 3 ] = { vdupq_n_##S(c[ 0 ]), vdupq_n_##S(c[ 1 ]), vdupq_n_##S(c[ 2 ]) }; \
+    T buf[ 12 ]; \
+    size_t itr = 0; \
+    MN_PREFETCH_INIT; \
+    for ( ; itr < count; itr += 4 ) \
+    { \
+        const size_t left = count - itr < 4 ? count - itr : 4; \
+        const T * in = s + itr * 3; \
+        X3 v; \
+        if (left < 4) \
+        { \
+            memset(buf, 0, sizeof(buf)); \
+            memcpy(buf, in, left * 3 * sizeof(T)); \
+            in = buf; \
+        } \
+        MN_PREFETCH_SRC_STEP(in, 12 * sizeof(T)); \
+        v = vld3q_##S(in); \
+        for ( size_t k = 0; k < 3; k++ ) \
+        { \
+            V p = v.val[ k ]; \
+            MN_SCAN_BLOCK(S, 1, p, zero); \
+            p = vaddq_##S(p, vc[ k ]); \
+            v.val[ k ] = exclusive ? vextq_##S(vc[ k ], p, 3) : p; \
+            vc[ k ] = MN_SCAN_LAST(S, 1, p); \
+        } \
+        if (left < 4) \
+        { \
+            vst3q_##S(buf, v); \
+            memcpy(d + itr * 3, buf, left * 3 * sizeof(T)); \
+        } \
+        else \
+        { \
+            vst3q_##S(d + itr * 3, v); \
+        } \
+    } \
+    for ( size_t k = 0; k < 3; k++ ) c[ k ] = vgetq_lane_##S(vc[ k ], 0); \
+} \
+static void mn_scan_sum_##NAME (const void * src, size_t count, void * total) \
+{ \
+    const T * s = (const T *)src; \
+    T * t = (T *)total; \
+    T buf[ 12 ] = { 0 }; \
+    V a[ 3 ] = { vdupq_n_##S(0), vdupq_n_##S(0), vdupq_n_##S(0) }; \
+    X3 v; \
+    size_t itr = 0; \
+    MN_PREFETCH_INIT; \
+    for ( ; itr + 4 <= count; itr += 4 ) \
+    { \
+        MN_PREFETCH_SRC_STEP(s + itr * 3, 12 * sizeof(T)); \
+        v = vld3q_##S(s + itr * 3); \
+        for ( size_t k = 0; k < 3; k++ ) a[ k ] = vaddq_##S(a[ k ], v.val[ k ]); \
+    } \
+    memcpy(buf, s + itr * 3, (count - itr) * 3 * sizeof(T)); \
+    v = vld3q_##S(buf); \
+    for ( size_t k = 0; k < 3; k++ ) t[ k ] = mn_hsumq_##S(vaddq_##S(a[ k ], v.val[ k ])); \
+}
+
+/* vec4: one element per vector, 4 elements pre-summed off the carry chain */
+#define MN_SCAN_VEC4(NAME, T, V, S) \
+static void mn_scan_run_##NAME (void * dst, const void * src, size_t count, void * carry, int exclusive) \
+{ \
+    T * d = (T *)dst; \
+    const T * s = (const T *)src; \
+    V vc = vld1q_##S((const T *)carry); \
+    size_t itr = 0; \
+    MN_PREFETCH_INIT; \
+    for ( ; itr + 4 <= count; itr += 4 ) \
+    { \
+        const V x0 = vld1q_##S(s + itr * 4); \
+        const V x1 = vld1q_##S(s + itr * 4 + 4); \
+        const V x2 = vld1q_##S(s + itr * 4 + 8); \
+        const V x3 = vld1q_##S(s + itr * 4 + 12); \
+        MN_PREFETCH_SRC_STEP(s + itr * 4, 16 * sizeof(T)); \
+        const V p1 = vaddq_##S(x0, x1); \
+        const V r0 = vaddq_##S(vc, x0); \
+        const V r1 = vaddq_##S(vc, p1); \
+        const V r2 = vaddq_##S(r1, x2); \
+        const V r3 = vaddq_##S(vc, vaddq_##S(p1, vaddq_##S(x2, x3))); \
+        vst1q_##S(d + itr * 4, exclusive ? vc : r0); \
+        vst1q_##S(d + itr * 4 + 4, exclusive ? r0 : r1); \
+        vst1q_##S(d + itr * 4 + 8, exclusive ? r1 : r2); \
+        vst1q_##S(d + itr * 4 + 12, exclusive ? r2 : r3); \
+        vc = r3; \
+    } \
+    for ( ; itr < count; itr++ ) \
+    { \
+        const V r = vaddq_##S(vc, vld1q_##S(s + itr * 4)); \
+        vst1q_##S(d + itr * 4, exclusive ? vc : r); \
+        vc = r; \
+    } \
+    vst1q_##S((T *)carry, vc); \
+} \
+static void mn_scan_sum_##NAME (const void * src, size_t count, void * total) \
+{ \
+    const T * s = (const T *)src; \
+    V a0 = vdupq_n_##S(0), a1 = a0; \
+    size_t itr = 0; \
+    MN_PREFETCH_INIT; \
+    for ( ; itr + 2 <= count; itr += 2 ) \
+    { \
+        MN_PREFETCH_SRC_STEP(s + itr * 4, 8 * sizeof(T)); \
+        a0 = vaddq_##S(a0, vld1q_##S(s + itr * 4)); \
+        a1 = vaddq_##S(a1, vld1q_##S(s + itr * 4 + 4)); \
+    } \
+    if (itr < count) a0 = vaddq_##S(a0, vld1q_##S(s + itr * 4)); \
+    vst1q_##S((T *)total, vaddq_##S(a0, a1)); \
+}
+
+MN_SCAN_FLAT(float, mn_float32_t, float32x4_t, f32, 1)
+MN_SCAN_FLAT(vec2f, mn_float32_t, float32x4_t, f32, 2)
+MN_SCAN_VEC3(vec3f, mn_float32_t, float32x4_t, float32x4x3_t, f32)
+MN_SCAN_VEC4(vec4f, mn_float32_t, float32x4_t, f32)
+MN_SCAN_FLAT(int32, mn_int32_t, int32x4_t, s32, 1)
+MN_SCAN_FLAT(vec2i, mn_int32_t, int32x4_t, s32, 2)
+MN_SCAN_VEC3(vec3i, mn_int32_t, int32x4_t, int32x4x3_t, s32)
+MN_SCAN_VEC4(vec4i, mn_int32_t, int32x4_t, s32)
+
+typedef struct
+{
+    const mn_scan_kernel_t * kernel;
+    char * dst;
+    const char * src;
+    size_t count;
+    int exclusive;
+    int pass;                   /* 0: chunk sum, 1: scan of the chunk */
+    mn_scan_carry_t carry;      /* the chunk sum after pass 0, the total entering the chunk for pass 1 */
+} mn_scan_task_t;
+
+static void mn_scan_task (void * arg)
+{
+    mn_scan_task_t * task = (mn_scan_task_t *)arg;
+    if (task->pass == 0)
+    {
+        task->kernel->sum(task->src, task->count, &task->carry);
+    }
+    else
+    {
+        task->kernel->run(task->dst, task->src, task->count, &task->carry, task->exclusive);
+    }
+}
+
+static mn_result_t mn_scan_neon (const mn_scan_kernel_t * kernel, void * dst, const void * src, size_t count,
+                                 int exclusive)
+{
+    mn_scan_task_t tasks[ MN_THREAD_MAX ];
+    mn_scan_carry_t running;
+    size_t threads = mn_thread_count();
+    size_t step;
+
+    memset(&running, 0, sizeof(running));
+    if (threads > count / MN_SCAN_MIN_PER_THREAD) threads = count / MN_SCAN_MIN_PER_THREAD;
+    if (threads <= 1)
+    {
+        kernel->run(dst, src, count, &running, exclusive);
+        return MN_SUCCESS;
+    }
+
+    /* equal chunks of whole 16-element groups */
+    step = ((count + threads - 1) / threads + 15) & ~(size_t)15;
+    threads = (count + step - 1) / step;
+    for ( size_t t = 0; t < threads; t++ )
+    {
+        tasks[ t ].kernel = kernel;
+        tasks[ t ].dst = (char *)dst + t * step * kernel->size;
+        tasks[ t ].src = (const char *)src + t * step * kernel->size;
+        tasks[ t ].count = count - t * step < step ? count - t * step : step;
+        tasks[ t ].exclusive = exclusive;
+        tasks[ t ].pass = 0;
+    }
+
+    /* the last chunk's sum is not needed */
+    if (mn_thread_run(mn_scan_task, tasks, sizeof(tasks[ 0 ]), threads - 1) != MN_SUCCESS)
+    {
+        return MN_ERROR;
+    }
+    for ( size_t t = 0; t < threads; t++ )
+    {
+        mn_scan_carry_t sum = tasks[ t ].carry;
+        tasks[ t ].carry = running;
+        tasks[ t ].pass = 1;
+        if (t + 1 < threads) kernel->run(&sum, &sum, 1, &running, 0);
+    }
+    return mn_thread_run(mn_scan_task, tasks, sizeof(tasks[ 0 ]), threads);
+}
+
+#define MN_SCAN_API(NAME, TYPE) \
+static const mn_scan_kernel_t mn_scan_kernel_##NAME = { mn_scan_run_##NAME, mn_scan_sum_##NAME, sizeof(TYPE) }; \
+mn_result_t mn_scan_inclusive_##NAME##_neon (TYPE * dst, TYPE * src, size_t count) \
+{ \
+    MN_ASSERT_DS; \
+    return mn_scan_neon(&mn_scan_kernel_##NAME, dst, src, count, 0); \
+} \
+mn_result_t mn_scan_exclusive_##NAME##_neon (TYPE * dst, TYPE * src, size_t count) \
+{ \
+    MN_ASSERT_DS; \
+    return mn_scan_neon(&mn_scan_kernel_##NAME, dst, src, count, 1); \
+}
+
+MN_SCAN_API(float, mn_float32_t)
+MN_SCAN_API(vec2f, mn_vec2f_t)
+MN_SCAN_API(vec3f, mn_vec3f_t)
+MN_SCAN_API(vec4f, mn_vec4f_t)
+MN_SCAN_API(int32, mn_int32_t)
+MN_SCAN_API(vec2i, mn_vec2i_t)
+MN_SCAN_API(vec3i, mn_vec3i_t)
+MN_SCAN_API(vec4i, mn_vec4i_t)
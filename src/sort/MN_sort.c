@@ -0,0 +1,157 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+Function Input:
+    dst        - Destination array, the count keys in ascending order
+    dst_values - Destination of the values, each moved with its key
+    src        - Source array of keys
+    src_values - Values paired with src, one per key
+    count      - Count is an integer that stores number of elements
+
+    C Implementation of the sorts, the reference for the NEON versions: a
+    stable bottom-up merge sort on a scratch copy of the keys. Floats are
+    ordered by their bits, -NaN < -inf < ... < -0 < +0 < ... < +inf < +NaN,
+    so every value has a place and NaNs end up at the ends. Equal keys keep
+    their input order here. dst may be the same array as src (and dst_values
+    as src_values). MN_ERROR when the scratch memory cannot be allocated.
+*/
+
+/* float bits to an int32 with the same order; its own inverse */
+static inline mn_int32_t mn_sort_key (mn_int32_t bits)
+{
+    return bits ^ (mn_int32_t)((0u - ((mn_uint32_t)bits >> 31)) >> 1);
+}
+
+/* sorts keys (and values when not NULL) of count elements, tmp* hold count scratch elements each */
+static void mn_sort_merge_c (mn_int32_t * keys, mn_uint32_t * values, mn_int32_t * tmp_keys, mn_uint32_t * tmp_values,
+                             size_t count)
+{
+    mn_int32_t * ka = keys;
+    mn_int32_t * kb = tmp_keys;
+    mn_uint32_t * va = values;
+    mn_uint32_t * vb = tmp_values;
+
+    for ( size_t width = 1; width < count; width *= 2 )
+    {
+        for ( size_t lo = 0; lo < count; lo += 2 * width )
+        {
+            const size_t mid = lo + width < count ? lo + width : count;
+            const size_t hi = mid + width < count ? mid + width : count;
+            size_t i = lo, j = mid, o = lo;
+
+            while (i < mid && j < hi)
+            {
+                /* ties take the left run first: stable */
+                const size_t s = ka[ j ] < ka[ i ] ? j++ : i++;
+                kb[ o ] = ka[ s ];
+                if (va) vb[ o ] = va[ s ];
+                o++;
+            }
+            for ( ; i < mid; i++, o++ )
+            {
+                kb[ o ] = ka[ i ];
+                if (va) vb[ o ] = va[ i ];
+            }
+            for ( ; j < hi; j++, o++ )
+            {
+                kb[ o ] = ka[ j ];
+                if (va) vb[ o ] = va[ j ];
+            }
+        }
+        {
+            mn_int32_t * kt = ka;
+            mn_uint32_t * vt = va;
+            ka = kb; kb = kt;
+            va = vb; vb = vt;
+        }
+    }
+    if (ka != keys)
+    {
+        memcpy(keys, ka, sizeof(mn_int32_t) * count);
+        if (values) memcpy(values, va, sizeof(mn_uint32_t) * count);
+    }
+}
+
+/* copies src in as int32 keys, sorts, copies back; is_float selects the float key order */
+static mn_result_t mn_sort_run_c (void * dst, mn_uint32_t * dst_values, const void * src,
+                                  const mn_uint32_t * src_values, size_t count, int is_float)
+{
+    const size_t per = src_values ? 4 : 2;
+    mn_int32_t * buf;
+    mn_int32_t * keys;
+    mn_uint32_t * values = NULL;
+
+    if (count == 0)
+    {
+        return MN_SUCCESS;
+    }
+    buf = (mn_int32_t *)malloc(sizeof(mn_int32_t) * count * per);
+    if (!buf)
+    {
+        return MN_ERROR;
+    }
+    keys = buf;
+    memcpy(keys, src, sizeof(mn_int32_t) * count);
+    if (src_values)
+    {
+        values = (mn_uint32_t *)(buf + 2 * count);
+        memcpy(values, src_values, sizeof(mn_uint32_t) * count);
+    }
+    if (is_float)
+    {
+        for ( size_t itr = 0; itr < count; itr++ )
+        {
+            keys[ itr ] = mn_sort_key(keys[ itr ]);
+        }
+    }
+
+    mn_sort_merge_c(keys, values, buf + count, values ? values + count : NULL, count);
+
+    if (is_float)
+    {
+        for ( size_t itr = 0; itr < count; itr++ )
+        {
+            keys[ itr ] = mn_sort_key(keys[ itr ]);
+        }
+    }
+    memcpy(dst, keys, sizeof(mn_int32_t) * count);
+    if (values)
+    {
+        memcpy(dst_values, values, sizeof(mn_uint32_t) * count);
+    }
+    free(buf);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_sort_float_c (mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    return mn_sort_run_c(dst, NULL, src, NULL, count, 1);
+}
+
+mn_result_t mn_sort_int32_c (mn_int32_t * dst, mn_int32_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    return mn_sort_run_c(dst, NULL, src, NULL, count, 0);
+}
+
+mn_result_t mn_sort_kv_float_c (mn_float32_t * dst, mn_uint32_t * dst_values, mn_float32_t * src,
+                                mn_uint32_t * src_values, size_t count)
+{
+    MN_ASSERT_DS;
+    assert(dst_values && src_values);
+    return mn_sort_run_c(dst, dst_values, src, src_values, count, 1);
+}
+
+mn_result_t mn_sort_kv_int32_c (mn_int32_t * dst, mn_uint32_t * dst_values, mn_int32_t * src,
+                                mn_uint32_t * src_values, size_t count)
+{
+    MN_ASSERT_DS;
+    assert(dst_values && src_values);
+    return mn_sort_run_c(dst, dst_values, src, src_values, count, 0);
+}
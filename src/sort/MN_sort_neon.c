@@ -0,0 +1,394 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <arm_neon.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+Input Arguments:
+    dst        - Destination array, the count keys in ascending order
+    dst_values - Destination of the values, each moved with its key
+    src        - Source array of keys
+    src_values - Values paired with src, one per key
+    count      - Count is an integer that stores number of elements
+
+Intrinsics used:
+    vminq_s32 / vmaxq_s32               - compare-exchange of 4 lane pairs (keys only)
+    vcgtq_s32 + vbslq_s32               - compare-exchange moving the values along
+    vtrnq_s32 / vuzpq_s32 / vzipq_s32   - transposes between network stages
+    vrev64q_s32 + vextq_s32             - reverse a sorted vector for a bitonic merge
+
+Sorting in two phases, both branch-free in the data:
+    1. Blocks of 16 keys (4 vectors) are sorted in registers: a 5 comparator
+       network sorts the 4 lanes of every column, a 4x4 transpose turns the
+       columns into 4 sorted vectors, and two rounds of bitonic merges join
+       them into 8 and then 16.
+    2. Bottom-up merge passes ping-pong between two buffers. Two sorted runs
+       are merged 4 keys at a time: the next vector comes from the run whose
+       next key is smaller, a bitonic merge of 4 + 4 keys with the carried
+       vector outputs the lowest 4 and carries the highest 4.
+
+Float keys are mapped to int32 keys with the same order (the magnitude bits
+of negative values flipped), so one integer kernel sorts both types and NaN
+has a fixed place: -NaN < -inf < ... < -0 < +0 < ... < +inf < +NaN. The
+keys are sorted in scratch memory padded to a multiple of 16 with INT32_MAX,
+so dst may be the same array as src. Unlike the C version the sort is not
+stable: the values of equal keys may come out in any order.
+
+Supported routines: ascending sorts of float / int32 keys, alone or with
+32-bit values (indices, ids) moved with them
+*/
+
+/* keys, and the values with them when the sort carries values */
+typedef struct
+{
+    int32x4_t k;
+    int32x4_t v;
+} mn_sort_vec_t;
+
+static inline mn_sort_vec_t mn_sort_load (const mn_int32_t * keys, const mn_int32_t * values, size_t i, int kv)
+{
+    mn_sort_vec_t r;
+    r.k = vld1q_s32(keys + i);
+    r.v = kv ? vld1q_s32(values + i) : r.k;
+    return r;
+}
+
+static inline void mn_sort_store (mn_int32_t * keys, mn_int32_t * values, size_t i, mn_sort_vec_t r, int kv)
+{
+    vst1q_s32(keys + i, r.k);
+    if (kv) vst1q_s32(values + i, r.v);
+}
+
+/* lane by lane: a gets the smaller key, b the larger; equal keys stay put */
+static inline void mn_sort_cmpx (mn_sort_vec_t * a, mn_sort_vec_t * b, int kv)
+{
+    if (kv)
+    {
+        const uint32x4_t swap = vcgtq_s32(a->k, b->k);
+        const int32x4_t lo_k = vbslq_s32(swap, b->k, a->k);
+        const int32x4_t lo_v = vbslq_s32(swap, b->v, a->v);
+        b->k = vbslq_s32(swap, a->k, b->k);
+        b->v = vbslq_s32(swap, a->v, b->v);
+        a->k = lo_k;
+        a->v = lo_v;
+    }
+    else
+    {
+        const int32x4_t lo = vminq_s32(a->k, b->k);
+        b->k = vmaxq_s32(a->k, b->k);
+        a->k = lo;
+    }
+}
+
+static inline int32x4_t mn_sort_rev_s32 (int32x4_t x)
+{
+    x = vrev64q_s32(x);
+    return vextq_s32(x, x, 2);
+}
+
+static inline void mn_sort_rev (mn_sort_vec_t * a, int kv)
+{
+    a->k = mn_sort_rev_s32(a->k);
+    if (kv) a->v = mn_sort_rev_s32(a->v);
+}
+
+/* sorts a and b, each a bitonic sequence of 4, with the distance 2 and 1 stages */
+static inline void mn_sort_clean (mn_sort_vec_t * a, mn_sort_vec_t * b, int kv)
+{
+    mn_sort_vec_t x, y;
+    int32x4x2_t t;
+
+    x.k = vcombine_s32(vget_low_s32(a->k), vget_low_s32(b->k));
+    y.k = vcombine_s32(vget_high_s32(a->k), vget_high_s32(b->k));
+    x.v = kv ? vcombine_s32(vget_low_s32(a->v), vget_low_s32(b->v)) : x.k;
+    y.v = kv ? vcombine_s32(vget_high_s32(a->v), vget_high_s32(b->v)) : y.k;
+    mn_sort_cmpx(&x, &y, kv);
+    a->k = vcombine_s32(vget_low_s32(x.k), vget_low_s32(y.k));
+    b->k = vcombine_s32(vget_high_s32(x.k), vget_high_s32(y.k));
+    if (kv)
+    {
+        a->v = vcombine_s32(vget_low_s32(x.v), vget_low_s32(y.v));
+        b->v = vcombine_s32(vget_high_s32(x.v), vget_high_s32(y.v));
+    }
+
+    t = vuzpq_s32(a->k, b->k);
+    x.k = t.val[ 0 ];
+    y.k = t.val[ 1 ];
+    if (kv)
+    {
+        t = vuzpq_s32(a->v, b->v);
+        x.v = t.val[ 0 ];
+        y.v = t.val[ 1 ];
+    }
+    mn_sort_cmpx(&x, &y, kv);
+    t = vzipq_s32(x.k, y.k);
+    a->k = t.val[ 0 ];
+    b->k = t.val[ 1 ];
+    if (kv)
+    {
+        t = vzipq_s32(x.v, y.v);
+        a->v = t.val[ 0 ];
+        b->v = t.val[ 1 ];
+    }
+}
+
+/* a and b sorted: a gets the lowest 4 of the 8, b the highest 4, both sorted */
+static inline void mn_sort_merge4 (mn_sort_vec_t * a, mn_sort_vec_t * b, int kv)
+{
+    mn_sort_rev(b, kv);
+    mn_sort_cmpx(a, b, kv);
+    mn_sort_clean(a, b, kv);
+}
+
+static inline void mn_sort_transpose (int32x4_t * r0, int32x4_t * r1, int32x4_t * r2, int32x4_t * r3)
+{
+    const int32x4x2_t t01 = vtrnq_s32(*r0, *r1);
+    const int32x4x2_t t23 = vtrnq_s32(*r2, *r3);
+    *r0 = vcombine_s32(vget_low_s32(t01.val[ 0 ]), vget_low_s32(t23.val[ 0 ]));
+    *r1 = vcombine_s32(vget_low_s32(t01.val[ 1 ]), vget_low_s32(t23.val[ 1 ]));
+    *r2 = vcombine_s32(vget_high_s32(t01.val[ 0 ]), vget_high_s32(t23.val[ 0 ]));
+    *r3 = vcombine_s32(vget_high_s32(t01.val[ 1 ]), vget_high_s32(t23.val[ 1 ]));
+}
+
+/* sorts keys[0 .. 15] (and values with them) in registers */
+static inline void mn_sort_block16 (mn_int32_t * keys, mn_int32_t * values, int kv)
+{
+    mn_sort_vec_t r0 = mn_sort_load(keys, values, 0, kv);
+    mn_sort_vec_t r1 = mn_sort_load(keys, values, 4, kv);
+    mn_sort_vec_t r2 = mn_sort_load(keys, values, 8, kv);
+    mn_sort_vec_t r3 = mn_sort_load(keys, values, 12, kv);
+
+    /* sort each column of 4 */
+    mn_sort_cmpx(&r0, &r1, kv);
+    mn_sort_cmpx(&r2, &r3, kv);
+    mn_sort_cmpx(&r0, &r2, kv);
+    mn_sort_cmpx(&r1, &r3, kv);
+    mn_sort_cmpx(&r1, &r2, kv);
+
+    /* columns to rows: 4 sorted vectors */
+    mn_sort_transpose(&r0.k, &r1.k, &r2.k, &r3.k);
+    if (kv) mn_sort_transpose(&r0.v, &r1.v, &r2.v, &r3.v);
+
+    /* 4 + 4 -> 8, twice */
+    mn_sort_merge4(&r0, &r1, kv);
+    mn_sort_merge4(&r2, &r3, kv);
+
+    /* 8 + 8 -> 16: r0 r1 against r2 r3 reversed, then distance 4, 2, 1 */
+    mn_sort_rev(&r2, kv);
+    mn_sort_rev(&r3, kv);
+    mn_sort_cmpx(&r0, &r3, kv);
+    mn_sort_cmpx(&r1, &r2, kv);
+    mn_sort_cmpx(&r0, &r1, kv);
+    mn_sort_cmpx(&r3, &r2, kv);
+    mn_sort_clean(&r0, &r1, kv);
+    mn_sort_clean(&r3, &r2, kv);
+
+    mn_sort_store(keys, values, 0, r0, kv);
+    mn_sort_store(keys, values, 4, r1, kv);
+    mn_sort_store(keys, values, 8, r3, kv);
+    mn_sort_store(keys, values, 12, r2, kv);
+}
+
+/* merges the sorted runs a[0 .. na - 1] and b[0 .. nb - 1] into out, na and nb multiples of 4 */
+static void mn_sort_merge_runs (const mn_int32_t * ka, const mn_int32_t * va, size_t na, const mn_int32_t * kb,
+                                const mn_int32_t * vb, size_t nb, mn_int32_t * ko, mn_int32_t * vo, int kv)
+{
+    mn_sort_vec_t lo = mn_sort_load(ka, va, 0, kv);
+    mn_sort_vec_t hi = mn_sort_load(kb, vb, 0, kv);
+    size_t ia = 4, ib = 4, o = 0;
+
+    mn_sort_merge4(&lo, &hi, kv);
+    mn_sort_store(ko, vo, o, lo, kv);
+    for ( o = 4; ia < na || ib < nb; o += 4 )
+    {
+        /* the next 4 keys come from the run with the smaller next key */
+        const int take_a = ib >= nb || (ia < na && ka[ ia ] <= kb[ ib ]);
+        const mn_int32_t * sk = take_a ? ka : kb;
+        const mn_int32_t * sv = take_a ? va : vb;
+        const size_t at = take_a ? ia : ib;
+
+        ia += take_a ? 4 : 0;
+        ib += take_a ? 0 : 4;
+        lo = mn_sort_load(sk, sv, at, kv);
+        mn_sort_merge4(&lo, &hi, kv);
+        mn_sort_store(ko, vo, o, lo, kv);
+    }
+    mn_sort_store(ko, vo, o, hi, kv);
+}
+
+/* float bits <-> int32 keys with the same order */
+static inline int32x4_t mn_sort_key_s32 (int32x4_t bits)
+{
+    const int32x4_t flip = vandq_s32(vshrq_n_s32(bits, 31), vdupq_n_s32(0x7fffffff));
+    return veorq_s32(bits, flip);
+}
+
+static inline mn_int32_t mn_sort_key (mn_int32_t bits)
+{
+    return bits ^ (mn_int32_t)((0u - ((mn_uint32_t)bits >> 31)) >> 1);
+}
+
+static mn_result_t mn_sort_run_neon (void * dst, mn_uint32_t * dst_values, const void * src,
+                                     const mn_uint32_t * src_values, size_t count, int is_float)
+{
+    const int kv = src_values != NULL;
+    const size_t padded = (count + 15) & ~(size_t)15;
+    mn_int32_t * buf;
+    mn_int32_t * k0, * k1, * v0 = NULL, * v1 = NULL;
+    size_t itr = 0, maxed = 0;
+
+    if (count == 0)
+    {
+        return MN_SUCCESS;
+    }
+    buf = (mn_int32_t *)malloc(sizeof(mn_int32_t) * padded * (kv ? 4 : 2));
+    if (!buf)
+    {
+        return MN_ERROR;
+    }
+    k0 = buf;
+    k1 = buf + padded;
+    if (kv)
+    {
+        v0 = buf + 2 * padded;
+        v1 = buf + 3 * padded;
+        memcpy(v0, src_values, sizeof(mn_int32_t) * count);
+        memset(v0 + count, 0, sizeof(mn_int32_t) * (padded - count));
+    }
+
+    /* keys in, padded with the largest key */
+    if (is_float)
+    {
+        const mn_float32_t * s = (const mn_float32_t *)src;
+        for ( ; itr + 4 <= count; itr += 4 )
+        {
+            vst1q_s32(k0 + itr, mn_sort_key_s32(vreinterpretq_s32_f32(vld1q_f32(s + itr))));
+        }
+        for ( ; itr < count; itr++ )
+        {
+            mn_int32_t bits;
+            memcpy(&bits, s + itr, sizeof(bits));
+            k0[ itr ] = mn_sort_key(bits);
+        }
+    }
+    else
+    {
+        memcpy(k0, src, sizeof(mn_int32_t) * count);
+    }
+    for ( itr = count; itr < padded; itr++ )
+    {
+        k0[ itr ] = INT32_MAX;
+    }
+    if (kv)
+    {
+        for ( itr = 0; itr < count; itr++ )
+        {
+            maxed += k0[ itr ] == INT32_MAX;
+        }
+    }
+
+    for ( itr = 0; itr < padded; itr += 16 )
+    {
+        mn_sort_block16(k0 + itr, kv ? v0 + itr : NULL, kv);
+    }
+
+    for ( size_t width = 16; width < padded; width *= 2 )
+    {
+        for ( size_t lo = 0; lo < padded; lo += 2 * width )
+        {
+            const size_t na = padded - lo < width ? padded - lo : width;
+            const size_t nb = padded - lo - na < width ? padded - lo - na : width;
+
+            if (nb == 0)
+            {
+                memcpy(k1 + lo, k0 + lo, sizeof(mn_int32_t) * na);
+                if (kv) memcpy(v1 + lo, v0 + lo, sizeof(mn_int32_t) * na);
+            }
+            else
+            {
+                mn_sort_merge_runs(k0 + lo, kv ? v0 + lo : NULL, na, k0 + lo + na, kv ? v0 + lo + na : NULL, nb,
+                                   k1 + lo, kv ? v1 + lo : NULL, kv);
+            }
+        }
+        {
+            mn_int32_t * t = k0;
+            k0 = k1; k1 = t;
+            t = v0; v0 = v1; v1 = t;
+        }
+    }
+
+    /*
+     * Keys equal to the padding key tie with the padding, which may have
+     * taken their place among the first count. Their values all belong in
+     * the last maxed slots, so they are copied there from src_values.
+     */
+    if (maxed)
+    {
+        size_t at = count - maxed;
+        for ( itr = 0; itr < count; itr++ )
+        {
+            mn_int32_t key;
+            memcpy(&key, (const mn_int32_t *)src + itr, sizeof(key));
+            if ((is_float ? mn_sort_key(key) : key) == INT32_MAX)
+            {
+                v0[ at++ ] = (mn_int32_t)src_values[ itr ];
+            }
+        }
+    }
+
+    /* keys out */
+    if (is_float)
+    {
+        mn_float32_t * d = (mn_float32_t *)dst;
+        for ( itr = 0; itr + 4 <= count; itr += 4 )
+        {
+            vst1q_f32(d + itr, vreinterpretq_f32_s32(mn_sort_key_s32(vld1q_s32(k0 + itr))));
+        }
+        for ( ; itr < count; itr++ )
+        {
+            const mn_int32_t bits = mn_sort_key(k0[ itr ]);
+            memcpy(d + itr, &bits, sizeof(bits));
+        }
+    }
+    else
+    {
+        memcpy(dst, k0, sizeof(mn_int32_t) * count);
+    }
+    if (kv)
+    {
+        memcpy(dst_values, v0, sizeof(mn_int32_t) * count);
+    }
+    free(buf);
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_sort_float_neon (mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    return mn_sort_run_neon(dst, NULL, src, NULL, count, 1);
+}
+
+mn_result_t mn_sort_int32_neon (mn_int32_t * dst, mn_int32_t * src, size_t count)
+{
+    MN_ASSERT_DS;
+    return mn_sort_run_neon(dst, NULL, src, NULL, count, 0);
+}
+
+mn_result_t mn_sort_kv_float_neon (mn_float32_t * dst, mn_uint32_t * dst_values, mn_float32_t * src,
+                                   mn_uint32_t * src_values, size_t count)
+{
+    MN_ASSERT_DS;
+    assert(dst_values && src_values);
+    return mn_sort_run_neon(dst, dst_values, src, src_values, count, 1);
+}
+
+mn_result_t mn_sort_kv_int32_neon (mn_int32_t * dst, mn_uint32_t * dst_values, mn_int32_t * src,
+                                   mn_uint32_t * src_values, size_t count)
+{
+    MN_ASSERT_DS;
+    assert(dst_values && src_values);
+    return mn_sort_run_neon(dst, dst_values, src, src_values, count, 0);
+}
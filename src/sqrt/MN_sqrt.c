@@ -0,0 +1,105 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <assert.h>
+#include <math.h>
+
+/*
+Function Input:
+    dst      - Destination array
+    src      - Source array
+    count    - Count is an integer that stores number of elements (vectors for vecNf)
+    accuracy - MN_ACCURACY_PRECISE, FAST, ULTRA or ESTIMATE
+
+    C Implementation of the square root family, the reference for the NEON
+    versions:
+        sqrt:  dst[i] = sqrtf(src[i])
+        rsqrt: dst[i] = 1.0f / sqrtf(src[i])
+        recip: dst[i] = 1.0f / src[i]
+    The vecNf routines work on each component. Every tier gives the libm
+    result, accuracy is only checked (MN_ERROR for an unknown value).
+    dst may be the same array as src.
+*/
+
+#define MN_SQRT_CHECK_ACCURACY(accuracy) \
+    do { \
+        if ((accuracy) < MN_ACCURACY_PRECISE || (accuracy) > MN_ACCURACY_ESTIMATE) \
+        { \
+            return MN_ERROR; \
+        } \
+    } while (0)
+
+/* the vecNf arrays are count * N packed floats */
+#define MN_SQRT_C(lanes, expr) \
+    MN_CHECK_DstSRC; \
+    MN_SQRT_CHECK_ACCURACY(accuracy); \
+    { \
+        mn_float32_t * d = (mn_float32_t *)dst; \
+        const mn_float32_t * s = (const mn_float32_t *)src; \
+        for ( size_t itr = 0; itr < count * (lanes); itr++ ) \
+        { \
+            const mn_float32_t x = s[ itr ]; \
+            d[ itr ] = (expr); \
+        } \
+    } \
+    return MN_OK;
+
+mn_result_t mn_sqrt_float_c (mn_float32_t * dst, mn_float32_t * src, size_t count, int accuracy)
+{
+    MN_SQRT_C(1, sqrtf(x))
+}
+
+mn_result_t mn_sqrt_vec2f_c (mn_vec2f_t * dst, mn_vec2f_t * src, size_t count, int accuracy)
+{
+    MN_SQRT_C(2, sqrtf(x))
+}
+
+mn_result_t mn_sqrt_vec3f_c (mn_vec3f_t * dst, mn_vec3f_t * src, size_t count, int accuracy)
+{
+    MN_SQRT_C(3, sqrtf(x))
+}
+
+mn_result_t mn_sqrt_vec4f_c (mn_vec4f_t * dst, mn_vec4f_t * src, size_t count, int accuracy)
+{
+    MN_SQRT_C(4, sqrtf(x))
+}
+
+mn_result_t mn_rsqrt_float_c (mn_float32_t * dst, mn_float32_t * src, size_t count, int accuracy)
+{
+    MN_SQRT_C(1, 1.0f / sqrtf(x))
+}
+
+mn_result_t mn_rsqrt_vec2f_c (mn_vec2f_t * dst, mn_vec2f_t * src, size_t count, int accuracy)
+{
+    MN_SQRT_C(2, 1.0f / sqrtf(x))
+}
+
+mn_result_t mn_rsqrt_vec3f_c (mn_vec3f_t * dst, mn_vec3f_t * src, size_t count, int accuracy)
+{
+    MN_SQRT_C(3, 1.0f / sqrtf(x))
+}
+
+mn_result_t mn_rsqrt_vec4f_c (mn_vec4f_t * dst, mn_vec4f_t * src, size_t count, int accuracy)
+{
+    MN_SQRT_C(4, 1.0f / sqrtf(x))
+}
+
+mn_result_t mn_recip_float_c (mn_float32_t * dst, mn_float32_t * src, size_t count, int accuracy)
+{
+    MN_SQRT_C(1, 1.0f / x)
+}
+
+mn_result_t mn_recip_vec2f_c (mn_vec2f_t * dst, mn_vec2f_t * src, size_t count, int accuracy)
+{
+    MN_SQRT_C(2, 1.0f / x)
+}
+
+mn_result_t mn_recip_vec3f_c (mn_vec3f_t * dst, mn_vec3f_t * src, size_t count, int accuracy)
+{
+    MN_SQRT_C(3, 1.0f / x)
+}
+
+mn_result_t mn_recip_vec4f_c (mn_vec4f_t * dst, mn_vec4f_t * src, size_t count, int accuracy)
+{
+    MN_SQRT_C(4, 1.0f / x)
+}
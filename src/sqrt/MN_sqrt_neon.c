@@ -0,0 +1,194 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <arm_neon.h>
+#include <assert.h>
+#include <math.h>
+
+/*
+Input Arguments:
+    dst      - Destination array
+    src      - Source array
+    count    - Count is an integer that stores number of elements (vectors for vecNf)
+    accuracy - MN_ACCURACY_PRECISE, FAST, ULTRA or ESTIMATE
+
+Intrinsics used:
+    vsqrtq_f32 / vdivq_f32     - precise tier (AArch64)
+    vrsqrteq_f32 / vrecpeq_f32 - 8-bit estimates of 1 / sqrt(x) and 1 / x
+    vrsqrtsq_f32               - Newton step for 1 / sqrt(x): e * (3 - x * e * e) / 2
+    vrecpsq_f32                - Newton step for 1 / x: e * (2 - x * e)
+
+The accuracy tier sets the number of Newton steps after the estimate:
+    MN_ACCURACY_PRECISE  - vsqrtq_f32 / vdivq_f32, the libm result (the C loop
+                           on 32-bit ARM, which has neither)
+    MN_ACCURACY_FAST     - two steps
+    MN_ACCURACY_ULTRA    - one step
+    MN_ACCURACY_ESTIMATE - none
+sqrt is x * rsqrt(x). The steps turn the exact estimates of 0 and +inf into
+NaN (0 * inf), so those lanes keep the estimate (rsqrt) or x (sqrt). The
+recip estimate is +-inf for |x| < 2^-128 (0 and the small subnormals); the
+steps would flip its sign there, so recip keeps every infinite estimate.
+
+The vecNf arrays are count * N packed floats and run through the float code,
+which maps the tier's vector function over the array (MN_MAP_F32_NEON). The
+spare lanes of the last partial vector hold 1.0f, so they never produce the
+inf / NaN edge cases above.
+
+Supported routines: sqrt, rsqrt, recip [float, vec2f, vec3f, vec4f]
+*/
+
+/* x is +-0 or +inf */
+static inline uint32x4_t mn_sqrt_edge (float32x4_t x)
+{
+    return vorrq_u32(vceqq_f32(x, vdupq_n_f32(0.0f)), vceqq_f32(x, vdupq_n_f32(INFINITY)));
+}
+
+/* the recip estimate of x is +-inf */
+static inline uint32x4_t mn_recip_edge (float32x4_t x)
+{
+    return vceqq_f32(vabsq_f32(vrecpeq_f32(x)), vdupq_n_f32(INFINITY));
+}
+
+static inline float32x4_t mn_rsqrt_nr (float32x4_t x, int steps)
+{
+    float32x4_t e = vrsqrteq_f32(x);
+    for ( int i = 0; i < steps; i++ )
+    {
+        e = vmulq_f32(e, vrsqrtsq_f32(vmulq_f32(x, e), e));
+    }
+    return e;
+}
+
+static inline float32x4_t mn_recip_nr (float32x4_t x, int steps)
+{
+    float32x4_t e = vrecpeq_f32(x);
+    for ( int i = 0; i < steps; i++ )
+    {
+        e = vmulq_f32(e, vrecpsq_f32(x, e));
+    }
+    return e;
+}
+
+static inline float32x4_t mn_sqrt_fast (float32x4_t x) { return vbslq_f32(mn_sqrt_edge(x), x, vmulq_f32(x, mn_rsqrt_nr(x, 2))); }
+static inline float32x4_t mn_sqrt_ultra (float32x4_t x) { return vbslq_f32(mn_sqrt_edge(x), x, vmulq_f32(x, mn_rsqrt_nr(x, 1))); }
+static inline float32x4_t mn_sqrt_estimate (float32x4_t x) { return vbslq_f32(mn_sqrt_edge(x), x, vmulq_f32(x, vrsqrteq_f32(x))); }
+static inline float32x4_t mn_rsqrt_fast (float32x4_t x) { return vbslq_f32(mn_sqrt_edge(x), vrsqrteq_f32(x), mn_rsqrt_nr(x, 2)); }
+static inline float32x4_t mn_rsqrt_ultra (float32x4_t x) { return vbslq_f32(mn_sqrt_edge(x), vrsqrteq_f32(x), mn_rsqrt_nr(x, 1)); }
+static inline float32x4_t mn_rsqrt_estimate (float32x4_t x) { return vrsqrteq_f32(x); }
+static inline float32x4_t mn_recip_fast (float32x4_t x) { return vbslq_f32(mn_recip_edge(x), vrecpeq_f32(x), mn_recip_nr(x, 2)); }
+static inline float32x4_t mn_recip_ultra (float32x4_t x) { return vbslq_f32(mn_recip_edge(x), vrecpeq_f32(x), mn_recip_nr(x, 1)); }
+static inline float32x4_t mn_recip_estimate (float32x4_t x) { return vrecpeq_f32(x); }
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+static inline float32x4_t mn_sqrt_precise (float32x4_t x) { return vsqrtq_f32(x); }
+static inline float32x4_t mn_rsqrt_precise (float32x4_t x) { return vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(x)); }
+static inline float32x4_t mn_recip_precise (float32x4_t x) { return vdivq_f32(vdupq_n_f32(1.0f), x); }
+#endif
+
+/* d[i] = VEC(s[i]) for n floats */
+#define MN_SQRT_NEON(VEC) MN_MAP_F32_NEON(d, s, n, VEC, 1.0f)
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define MN_SQRT_PRECISE_NEON(op, c_fn) MN_SQRT_NEON(mn_##op##_precise)
+#else
+#define MN_SQRT_PRECISE_NEON(op, c_fn) return c_fn(d, s, n, accuracy)
+#endif
+
+/* the tiers of one op over n floats */
+#define MN_SQRT_TIERS(op, c_fn) \
+    switch (accuracy) \
+    { \
+    case MN_ACCURACY_PRECISE:  MN_SQRT_PRECISE_NEON(op, c_fn); break; \
+    case MN_ACCURACY_FAST:     MN_SQRT_NEON(mn_##op##_fast); break; \
+    case MN_ACCURACY_ULTRA:    MN_SQRT_NEON(mn_##op##_ultra); break; \
+    case MN_ACCURACY_ESTIMATE: MN_SQRT_NEON(mn_##op##_estimate); break; \
+    default: return MN_ERROR; \
+    } \
+    return MN_OK;
+
+static mn_result_t mn_sqrt_run (mn_float32_t * d, mn_float32_t * s, size_t n, int accuracy)
+{
+    MN_SQRT_TIERS(sqrt, mn_sqrt_float_c)
+}
+
+static mn_result_t mn_rsqrt_run (mn_float32_t * d, mn_float32_t * s, size_t n, int accuracy)
+{
+    MN_SQRT_TIERS(rsqrt, mn_rsqrt_float_c)
+}
+
+static mn_result_t mn_recip_run (mn_float32_t * d, mn_float32_t * s, size_t n, int accuracy)
+{
+    MN_SQRT_TIERS(recip, mn_recip_float_c)
+}
+
+mn_result_t mn_sqrt_float_neon (mn_float32_t * dst, mn_float32_t * src, size_t count, int accuracy)
+{
+    MN_CHECK_DstSRC;
+    return mn_sqrt_run(dst, src, count, accuracy);
+}
+
+mn_result_t mn_sqrt_vec2f_neon (mn_vec2f_t * dst, mn_vec2f_t * src, size_t count, int accuracy)
+{
+    MN_CHECK_DstSRC;
+    return mn_sqrt_run((mn_float32_t *)dst, (mn_float32_t *)src, count * 2, accuracy);
+}
+
+mn_result_t mn_sqrt_vec3f_neon (mn_vec3f_t * dst, mn_vec3f_t * src, size_t count, int accuracy)
+{
+    MN_CHECK_DstSRC;
+    return mn_sqrt_run((mn_float32_t *)dst, (mn_float32_t *)src, count * 3, accuracy);
+}
+
+mn_result_t mn_sqrt_vec4f_neon (mn_vec4f_t * dst, mn_vec4f_t * src, size_t count, int accuracy)
+{
+    MN_CHECK_DstSRC;
+    return mn_sqrt_run((mn_float32_t *)dst, (mn_float32_t *)src, count * 4, accuracy);
+}
+
+mn_result_t mn_rsqrt_float_neon (mn_float32_t * dst, mn_float32_t * src, size_t count, int accuracy)
+{
+    MN_CHECK_DstSRC;
+    return mn_rsqrt_run(dst, src, count, accuracy);
+}
+
+mn_result_t mn_rsqrt_vec2f_neon (mn_vec2f_t * dst, mn_vec2f_t * src, size_t count, int accuracy)
+{
+    MN_CHECK_DstSRC;
+    return mn_rsqrt_run((mn_float32_t *)dst, (mn_float32_t *)src, count * 2, accuracy);
+}
+
+mn_result_t mn_rsqrt_vec3f_neon (mn_vec3f_t * dst, mn_vec3f_t * src, size_t count, int accuracy)
+{
+    MN_CHECK_DstSRC;
+    return mn_rsqrt_run((mn_float32_t *)dst, (mn_float32_t *)src, count * 3, accuracy);
+}
+
+mn_result_t mn_rsqrt_vec4f_neon (mn_vec4f_t * dst, mn_vec4f_t * src, size_t count, int accuracy)
+{
+    MN_CHECK_DstSRC;
+    return mn_rsqrt_run((mn_float32_t *)dst, (mn_float32_t *)src, count * 4, accuracy);
+}
+
+mn_result_t mn_recip_float_neon (mn_float32_t * dst, mn_float32_t * src, size_t count, int accuracy)
+{
+    MN_CHECK_DstSRC;
+    return mn_recip_run(dst, src, count, accuracy);
+}
+
+mn_result_t mn_recip_vec2f_neon (mn_vec2f_t * dst, mn_vec2f_t * src, size_t count, int accuracy)
+{
+    MN_CHECK_DstSRC;
+    return mn_recip_run((mn_float32_t *)dst, (mn_float32_t *)src, count * 2, accuracy);
+}
+
+mn_result_t mn_recip_vec3f_neon (mn_vec3f_t * dst, mn_vec3f_t * src, size_t count, int accuracy)
+{
+    MN_CHECK_DstSRC;
+    return mn_recip_run((mn_float32_t *)dst, (mn_float32_t *)src, count * 3, accuracy);
+}
+
+mn_result_t mn_recip_vec4f_neon (mn_vec4f_t * dst, mn_vec4f_t * src, size_t count, int accuracy)
+{
+    MN_CHECK_DstSRC;
+    return mn_recip_run((mn_float32_t *)dst, (mn_float32_t *)src, count * 4, accuracy);
+}
@@ -0,0 +1,594 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include "../common/MN_thread.h"
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*
+Streaming helpers: apply an elementwise op to arrays that do not fit in RAM
+(memory-mapped files) or to input that arrives in chunks.
+
+    mn_stream_apply  - Walks the arrays chunk by chunk. With `advise` the
+                       kernel gets MADV_SEQUENTIAL for the whole range and
+                       MADV_WILLNEED for the next chunk. With `io_thread` a
+                       helper thread faults in chunk i+1 (one read per page)
+                       while chunk i is computed, so page faults and NEON
+                       compute overlap. The helper never runs more than one
+                       chunk ahead and the compute loop does not enter a
+                       chunk before the helper is done with it (double
+                       buffering).
+    mn_stream_chunks - Double-buffered read -> compute -> write loop. With
+                       `io_thread` the read of the next chunk runs on a
+                       helper thread while the current chunk is computed.
+    mn_stream_map_file / mn_stream_unmap - mmap / MapViewOfFile wrappers.
+*/
+
+static size_t mn_stream_page_size (void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (size_t)info.dwPageSize;
+#else
+    long page = sysconf(_SC_PAGESIZE);
+    return page > 0 ? (size_t)page : 4096;
+#endif
+}
+
+/* Read-ahead hint for [addr, addr + bytes). Errors are ignored, it is only a hint. */
+static void mn_stream_advise (const void * addr, size_t bytes, int sequential)
+{
+    if (addr == NULL || bytes == 0)
+    {
+        return;
+    }
+#ifdef _WIN32
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+    if (!sequential)
+    {
+        WIN32_MEMORY_RANGE_ENTRY entry;
+        entry.VirtualAddress = (PVOID)addr;
+        entry.NumberOfBytes = bytes;
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &entry, 0);
+    }
+#endif
+#else
+    {
+        size_t page = mn_stream_page_size();
+        uintptr_t start = (uintptr_t)addr & ~(uintptr_t)(page - 1);
+        size_t len = (size_t)((uintptr_t)addr + bytes - start);
+#if defined(MADV_SEQUENTIAL) && defined(MADV_WILLNEED)
+        madvise((void *)start, len, sequential ? MADV_SEQUENTIAL : MADV_WILLNEED);
+#else
+        (void)start; (void)len; (void)sequential;
+#endif
+    }
+#endif
+}
+
+/* Faults in [addr, addr + bytes) by reading one byte per page. */
+static void mn_stream_touch (const void * addr, size_t bytes, size_t page)
+{
+    volatile const char * p = (volatile const char *)addr;
+    char sink = 0;
+    if (addr == NULL)
+    {
+        return;
+    }
+    for (size_t off = 0; off < bytes; off += page)
+    {
+        sink ^= p[off];
+    }
+    if (bytes != 0)
+    {
+        sink ^= p[bytes - 1];
+    }
+    (void)sink;
+}
+
+static void mn_stream_defaults (mn_stream_config_t * cfg, const mn_stream_config_t * config)
+{
+    if (config != NULL)
+    {
+        *cfg = *config;
+    }
+    else
+    {
+        cfg->chunk_bytes = 0;
+        cfg->advise = 1;
+        cfg->io_thread = 0;
+    }
+    if (cfg->chunk_bytes == 0)
+    {
+        cfg->chunk_bytes = MN_STREAM_DEFAULT_CHUNK;
+    }
+}
+
+/* ===== mn_stream_apply ===== */
+
+typedef struct
+{
+    char *       arrays[3];   /* dst, src1, src2 (NULL when unused) */
+    size_t       count;
+    size_t       chunk;       /* elements per chunk */
+    size_t       elem_size;
+    int          advise;
+    size_t       current;     /* chunk the compute loop is on */
+    size_t       ready;       /* last chunk faulted in by the helper */
+    int          stop;
+    mn_mutex_t   lock;
+    mn_cond_t    cond;
+} mn_stream_prefault_t;
+
+static void mn_stream_prefault_chunk (mn_stream_prefault_t * pf, size_t index, size_t page)
+{
+    size_t first = index * pf->chunk;
+    size_t n = pf->count - first < pf->chunk ? pf->count - first : pf->chunk;
+    for (int a = 0; a < 3; a++)
+    {
+        /* dst aliasing a source is only touched once */
+        if (pf->arrays[a] == NULL || (a == 0 && (pf->arrays[0] == pf->arrays[1] || pf->arrays[0] == pf->arrays[2])))
+        {
+            continue;
+        }
+        if (pf->advise)
+        {
+            mn_stream_advise(pf->arrays[a] + first * pf->elem_size, n * pf->elem_size, 0);
+        }
+        mn_stream_touch(pf->arrays[a] + first * pf->elem_size, n * pf->elem_size, page);
+    }
+}
+
+static void mn_stream_prefault_worker (void * arg)
+{
+    mn_stream_prefault_t * pf = (mn_stream_prefault_t *)arg;
+    size_t page = mn_stream_page_size();
+    size_t chunks = (pf->count + pf->chunk - 1) / pf->chunk;
+
+    for (size_t next = 1; next < chunks; next++)
+    {
+        mn_mutex_lock(&pf->lock);
+        while (!pf->stop && pf->current + 1 < next)
+        {
+            mn_cond_wait(&pf->cond, &pf->lock);
+        }
+        if (pf->stop)
+        {
+            mn_mutex_unlock(&pf->lock);
+            break;
+        }
+        mn_mutex_unlock(&pf->lock);
+
+        mn_stream_prefault_chunk(pf, next, page);
+
+        mn_mutex_lock(&pf->lock);
+        pf->ready = next;
+        mn_cond_broadcast(&pf->cond);
+        mn_mutex_unlock(&pf->lock);
+    }
+}
+
+mn_result_t mn_stream_apply (void * dst, void * src1, void * src2, size_t count, size_t elem_size,
+                             mn_stream_kernel_fn kernel, void * ctx, const mn_stream_config_t * config)
+{
+    mn_stream_config_t cfg;
+    mn_stream_prefault_t pf;
+    mn_thread_t worker;
+    int threaded = 0;
+    mn_result_t res = MN_SUCCESS;
+
+    if (dst == NULL || src1 == NULL || kernel == NULL || elem_size == 0)
+    {
+        return MN_ERROR;
+    }
+    mn_stream_defaults(&cfg, config);
+
+    pf.arrays[0] = (char *)dst;
+    pf.arrays[1] = (char *)src1;
+    pf.arrays[2] = (char *)src2;
+    pf.count = count;
+    pf.chunk = cfg.chunk_bytes / elem_size > 0 ? cfg.chunk_bytes / elem_size : 1;
+    pf.elem_size = elem_size;
+    pf.advise = cfg.advise;
+    pf.current = 0;
+    pf.ready = 0;
+    pf.stop = 0;
+
+    if (cfg.advise)
+    {
+        for (int a = 0; a < 3; a++)
+        {
+            mn_stream_advise(pf.arrays[a], count * elem_size, 1);
+        }
+    }
+
+    if (cfg.io_thread && count > pf.chunk)
+    {
+        mn_mutex_init(&pf.lock);
+        mn_cond_init(&pf.cond);
+        threaded = mn_thread_create(&worker, mn_stream_prefault_worker, &pf) == MN_SUCCESS;
+        if (!threaded)
+        {
+            mn_cond_destroy(&pf.cond);
+            mn_mutex_destroy(&pf.lock);
+        }
+    }
+
+    for (size_t first = 0, index = 0; first < count; first += pf.chunk, index++)
+    {
+        size_t n = count - first < pf.chunk ? count - first : pf.chunk;
+        size_t off = first * elem_size;
+
+        if (threaded)
+        {
+            /* wait until the helper is done with this chunk, then let it start on the next one */
+            mn_mutex_lock(&pf.lock);
+            while (pf.ready < index)
+            {
+                mn_cond_wait(&pf.cond, &pf.lock);
+            }
+            pf.current = index;
+            mn_cond_broadcast(&pf.cond);
+            mn_mutex_unlock(&pf.lock);
+        }
+        else if (cfg.advise && first + n < count)
+        {
+            size_t next_n = count - first - n < pf.chunk ? count - first - n : pf.chunk;
+            for (int a = 0; a < 3; a++)
+            {
+                if (pf.arrays[a] != NULL)
+                {
+                    mn_stream_advise(pf.arrays[a] + off + n * elem_size, next_n * elem_size, 0);
+                }
+            }
+        }
+
+        res = kernel(ctx, pf.arrays[0] + off, pf.arrays[1] + off,
+                     pf.arrays[2] != NULL ? pf.arrays[2] + off : NULL, n);
+        if (res != MN_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    if (threaded)
+    {
+        mn_mutex_lock(&pf.lock);
+        pf.stop = 1;
+        mn_cond_broadcast(&pf.cond);
+        mn_mutex_unlock(&pf.lock);
+        mn_thread_join(&worker);
+        mn_cond_destroy(&pf.cond);
+        mn_mutex_destroy(&pf.lock);
+    }
+    return res;
+}
+
+mn_result_t mn_stream_unary_kernel (void * ctx, void * dst, void * src1, void * src2, size_t count)
+{
+    (void)src2;
+    return (*(mn_stream_unary_fn *)ctx)(dst, src1, count);
+}
+
+mn_result_t mn_stream_binary_kernel (void * ctx, void * dst, void * src1, void * src2, size_t count)
+{
+    return (*(mn_stream_binary_fn *)ctx)(dst, src1, src2, count);
+}
+
+mn_result_t mn_stream_unary (void * dst, void * src, size_t count, size_t elem_size,
+                             mn_stream_unary_fn op, const mn_stream_config_t * config)
+{
+    if (op == NULL)
+    {
+        return MN_ERROR;
+    }
+    return mn_stream_apply(dst, src, NULL, count, elem_size, mn_stream_unary_kernel, &op, config);
+}
+
+mn_result_t mn_stream_binary (void * dst, void * src1, void * src2, size_t count, size_t elem_size,
+                              mn_stream_binary_fn op, const mn_stream_config_t * config)
+{
+    if (op == NULL || src2 == NULL)
+    {
+        return MN_ERROR;
+    }
+    return mn_stream_apply(dst, src1, src2, count, elem_size, mn_stream_binary_kernel, &op, config);
+}
+
+/* ===== mn_stream_chunks ===== */
+
+#define MN_STREAM_SLOT_EMPTY 0
+#define MN_STREAM_SLOT_FULL  1
+#define MN_STREAM_SLOT_END   2
+
+typedef struct
+{
+    mn_stream_read_fn read;
+    void *            read_ctx;
+    char *            buf[2][2];  /* [slot][source] */
+    size_t            filled[2];
+    int               state[2];
+    size_t            chunk;
+    int               stop;
+    mn_mutex_t        lock;
+    mn_cond_t         cond;
+} mn_stream_reader_t;
+
+static void mn_stream_reader_worker (void * arg)
+{
+    mn_stream_reader_t * rd = (mn_stream_reader_t *)arg;
+
+    for (int slot = 0; ; slot ^= 1)
+    {
+        size_t n;
+
+        mn_mutex_lock(&rd->lock);
+        while (!rd->stop && rd->state[slot] != MN_STREAM_SLOT_EMPTY)
+        {
+            mn_cond_wait(&rd->cond, &rd->lock);
+        }
+        if (rd->stop)
+        {
+            mn_mutex_unlock(&rd->lock);
+            return;
+        }
+        mn_mutex_unlock(&rd->lock);
+
+        n = rd->read(rd->read_ctx, rd->buf[slot][0], rd->buf[slot][1], rd->chunk);
+
+        mn_mutex_lock(&rd->lock);
+        rd->filled[slot] = n;
+        rd->state[slot] = n != 0 ? MN_STREAM_SLOT_FULL : MN_STREAM_SLOT_END;
+        mn_cond_broadcast(&rd->cond);
+        mn_mutex_unlock(&rd->lock);
+        if (n == 0)
+        {
+            return;
+        }
+    }
+}
+
+mn_result_t mn_stream_chunks (mn_stream_read_fn read, void * read_ctx,
+                              mn_stream_write_fn write, void * write_ctx,
+                              size_t elem_size, int sources,
+                              mn_stream_kernel_fn kernel, void * ctx,
+                              const mn_stream_config_t * config)
+{
+    mn_stream_config_t cfg;
+    mn_stream_reader_t rd;
+    mn_thread_t worker;
+    char * storage;
+    size_t chunk_bytes;
+    int threaded = 0;
+    mn_result_t res = MN_SUCCESS;
+
+    if (read == NULL || write == NULL || kernel == NULL || elem_size == 0 || sources < 1 || sources > 2)
+    {
+        return MN_ERROR;
+    }
+    mn_stream_defaults(&cfg, config);
+
+    rd.chunk = cfg.chunk_bytes / elem_size > 0 ? cfg.chunk_bytes / elem_size : 1;
+    chunk_bytes = rd.chunk * elem_size;
+    storage = (char *)malloc(chunk_bytes * 2 * (size_t)sources);
+    if (storage == NULL)
+    {
+        return MN_ERROR;
+    }
+    for (int slot = 0; slot < 2; slot++)
+    {
+        rd.buf[slot][0] = storage + (size_t)(slot * sources) * chunk_bytes;
+        rd.buf[slot][1] = sources == 2 ? rd.buf[slot][0] + chunk_bytes : NULL;
+        rd.filled[slot] = 0;
+        rd.state[slot] = MN_STREAM_SLOT_EMPTY;
+    }
+    rd.read = read;
+    rd.read_ctx = read_ctx;
+    rd.stop = 0;
+
+    if (cfg.io_thread)
+    {
+        mn_mutex_init(&rd.lock);
+        mn_cond_init(&rd.cond);
+        threaded = mn_thread_create(&worker, mn_stream_reader_worker, &rd) == MN_SUCCESS;
+        if (!threaded)
+        {
+            mn_cond_destroy(&rd.cond);
+            mn_mutex_destroy(&rd.lock);
+        }
+    }
+
+    for (int slot = 0; ; slot ^= 1)
+    {
+        size_t n;
+
+        if (threaded)
+        {
+            mn_mutex_lock(&rd.lock);
+            while (rd.state[slot] == MN_STREAM_SLOT_EMPTY)
+            {
+                mn_cond_wait(&rd.cond, &rd.lock);
+            }
+            n = rd.state[slot] == MN_STREAM_SLOT_FULL ? rd.filled[slot] : 0;
+            mn_mutex_unlock(&rd.lock);
+        }
+        else
+        {
+            slot = 0;
+            n = read(read_ctx, rd.buf[0][0], rd.buf[0][1], rd.chunk);
+        }
+        if (n == 0)
+        {
+            break;
+        }
+
+        /* the op runs in place on the first source buffer */
+        res = kernel(ctx, rd.buf[slot][0], rd.buf[slot][0], rd.buf[slot][1], n);
+        if (res == MN_SUCCESS)
+        {
+            res = write(write_ctx, rd.buf[slot][0], n);
+        }
+        if (res != MN_SUCCESS)
+        {
+            break;
+        }
+
+        if (threaded)
+        {
+            mn_mutex_lock(&rd.lock);
+            rd.state[slot] = MN_STREAM_SLOT_EMPTY;
+            mn_cond_broadcast(&rd.cond);
+            mn_mutex_unlock(&rd.lock);
+        }
+    }
+
+    if (threaded)
+    {
+        mn_mutex_lock(&rd.lock);
+        rd.stop = 1;
+        mn_cond_broadcast(&rd.cond);
+        mn_mutex_unlock(&rd.lock);
+        mn_thread_join(&worker);
+        mn_cond_destroy(&rd.cond);
+        mn_mutex_destroy(&rd.lock);
+    }
+    free(storage);
+    return res;
+}
+
+/* ===== mn_stream_map_file ===== */
+
+mn_result_t mn_stream_map_file (mn_stream_map_t * map, const char * path, size_t size, int writable)
+{
+    if (map == NULL || path == NULL)
+    {
+        return MN_ERROR;
+    }
+    map->data = NULL;
+    map->size = 0;
+    map->file = -1;
+    map->mapping = 0;
+
+#ifdef _WIN32
+    {
+        HANDLE file, mapping;
+        LARGE_INTEGER file_size;
+        void * data;
+
+        file = CreateFileA(path, writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ,
+                           FILE_SHARE_READ, NULL, writable ? OPEN_ALWAYS : OPEN_EXISTING,
+                           FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return MN_ERROR;
+        }
+        if (writable && size > 0)
+        {
+            DWORD unused;
+            file_size.QuadPart = (LONGLONG)size;
+            /* mark sparse so the untouched parts take no disk space */
+            DeviceIoControl(file, FSCTL_SET_SPARSE, NULL, 0, NULL, 0, &unused, NULL);
+            if (!SetFilePointerEx(file, file_size, NULL, FILE_BEGIN) || !SetEndOfFile(file))
+            {
+                CloseHandle(file);
+                return MN_ERROR;
+            }
+        }
+        else if (!GetFileSizeEx(file, &file_size) || (size = (size_t)file_size.QuadPart) == 0)
+        {
+            CloseHandle(file);
+            return MN_ERROR;
+        }
+
+        mapping = CreateFileMappingA(file, NULL, writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, NULL);
+        if (mapping == NULL)
+        {
+            CloseHandle(file);
+            return MN_ERROR;
+        }
+        data = MapViewOfFile(mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size);
+        if (data == NULL)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return MN_ERROR;
+        }
+        map->data = data;
+        map->size = size;
+        map->file = (intptr_t)file;
+        map->mapping = (intptr_t)mapping;
+    }
+#else
+    {
+        int fd = open(path, writable ? (O_RDWR | O_CREAT) : O_RDONLY, 0644);
+        struct stat st;
+        void * data;
+
+        if (fd < 0)
+        {
+            return MN_ERROR;
+        }
+        if (writable && size > 0)
+        {
+            /* ftruncate leaves a hole, the file stays sparse until written */
+            if (ftruncate(fd, (off_t)size) != 0)
+            {
+                close(fd);
+                return MN_ERROR;
+            }
+        }
+        else if (fstat(fd, &st) != 0 || (size = (size_t)st.st_size) == 0)
+        {
+            close(fd);
+            return MN_ERROR;
+        }
+
+        data = mmap(NULL, size, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            close(fd);
+            return MN_ERROR;
+        }
+        map->data = data;
+        map->size = size;
+        map->file = fd;
+    }
+#endif
+    return MN_SUCCESS;
+}
+
+mn_result_t mn_stream_unmap (mn_stream_map_t * map)
+{
+    mn_result_t res = MN_SUCCESS;
+
+    if (map == NULL || map->data == NULL)
+    {
+        return MN_ERROR;
+    }
+#ifdef _WIN32
+    if (!UnmapViewOfFile(map->data))
+    {
+        res = MN_ERROR;
+    }
+    CloseHandle((HANDLE)map->mapping);
+    CloseHandle((HANDLE)map->file);
+#else
+    if (munmap(map->data, map->size) != 0)
+    {
+        res = MN_ERROR;
+    }
+    close((int)map->file);
+#endif
+    map->data = NULL;
+    map->size = 0;
+    return res;
+}
@@ -3,8 +3,9 @@
 #include "MN_math.h"
 #include <arm_neon.h>
 #include <assert.h>
+#include <string.h>
 
-mn_result_t mn_subc_float_neon (mn_float32_t * dst, mn_float32_t * src, const mn_float32_t cst, mn_uint32_t count)
+mn_result_t mn_subc_float_neon (mn_float32_t * dst, mn_float32_t * src, const mn_float32_t cst, size_t count)
 {
     MN_SUBC_DstSrcCst_DO_COUNT_TIMES_FLOAT_NEON
     (
@@ -14,7 +15,7 @@ mn_result_t mn_subc_float_neon (mn_float32_t * dst, mn_float32_t * src, const mn
     );
 }
 
-mn_result_t mn_subc_vec2f_neon (mn_vec2f_t * dst, mn_vec2f_t * src, const mn_vec2f_t * cst, mn_uint32_t count)
+mn_result_t mn_subc_vec2f_neon (mn_vec2f_t * dst, mn_vec2f_t * src, const mn_vec2f_t * cst, size_t count)
 {
     MN_SUBC_DstSrcCst_DO_COUNT_TIMES_VEC2F_NEON
     (
@@ -24,7 +25,7 @@ mn_result_t mn_subc_vec2f_neon (mn_vec2f_t * dst, mn_vec2f_t * src, const mn_vec
     );
 }
 
-mn_result_t mn_subc_vec3f_neon (mn_vec3f_t * dst, mn_vec3f_t * src, const mn_vec3f_t * cst, mn_uint32_t count)
+mn_result_t mn_subc_vec3f_neon (mn_vec3f_t * dst, mn_vec3f_t * src, const mn_vec3f_t * cst, size_t count)
 {
     MN_SUBC_DstSrcCst_DO_COUNT_TIMES_VEC3F_NEON
     (
@@ -38,7 +39,7 @@ mn_result_t mn_subc_vec3f_neon (mn_vec3f_t * dst, mn_vec3f_t * src, const mn_vec
     );
 }
 
-mn_result_t mn_subc_vec4f_neon (mn_vec4f_t * dst, mn_vec4f_t * src, const mn_vec4f_t * cst, mn_uint32_t count)
+mn_result_t mn_subc_vec4f_neon (mn_vec4f_t * dst, mn_vec4f_t * src, const mn_vec4f_t * cst, size_t count)
 {
     MN_SUBC_DstSrcCst_DO_COUNT_TIMES_VEC4F_NEON
     (
@@ -46,7 +47,7 @@ mn_result_t mn_subc_vec4f_neon (mn_vec4f_t * dst, mn_vec4f_t * src, const mn_vec
     );
 }
 
-mn_result_t mn_subc_int32_neon (mn_int32_t * dst, mn_int32_t * src, const mn_int32_t cst, mn_uint32_t count)
+mn_result_t mn_subc_int32_neon (mn_int32_t * dst, mn_int32_t * src, const mn_int32_t cst, size_t count)
 {
     MN_SUBC_DstSrcCst_DO_COUNT_TIMES_INT32_NEON
     (
@@ -56,7 +57,7 @@ mn_result_t mn_subc_int32_neon (mn_int32_t * dst, mn_int32_t * src, const mn_int
     );
 }
 
-mn_result_t mn_subc_vec2i_neon (mn_vec2i_t * dst, mn_vec2i_t * src, const mn_vec2i_t * cst, mn_uint32_t count)
+mn_result_t mn_subc_vec2i_neon (mn_vec2i_t * dst, mn_vec2i_t * src, const mn_vec2i_t * cst, size_t count)
 {
     MN_SUBC_DstSrcCst_DO_COUNT_TIMES_VEC2I_NEON
     (
@@ -66,7 +67,7 @@ mn_result_t mn_subc_vec2i_neon (mn_vec2i_t * dst, mn_vec2i_t * src, const mn_vec
     );
 }
 
-mn_result_t mn_subc_vec3i_neon (mn_vec3i_t * dst, mn_vec3i_t * src, const mn_vec3i_t * cst, mn_uint32_t count)
+mn_result_t mn_subc_vec3i_neon (mn_vec3i_t * dst, mn_vec3i_t * src, const mn_vec3i_t * cst, size_t count)
 {
     MN_SUBC_DstSrcCst_DO_COUNT_TIMES_VEC3I_NEON
     (
@@ -80,10 +81,13 @@ mn_result_t mn_subc_vec3i_neon (mn_vec3i_t * dst, mn_vec3i_t * src, const mn_vec
     );
 }
 
-mn_result_t mn_subc_vec4i_neon (mn_vec4i_t * dst, mn_vec4i_t * src, const mn_vec4i_t * cst, mn_uint32_t count)
+mn_result_t mn_subc_vec4i_neon (mn_vec4i_t * dst, mn_vec4i_t * src, const mn_vec4i_t * cst, size_t count)
 {
     MN_SUBC_DstSrcCst_DO_COUNT_TIMES_VEC4I_NEON
     (
         n_dst = vsubq_s32 (n_src , n_cst);
     );
 }
+
+/* Saturating int32 subc (vqsubq_s32) */
+MN_INTN_NEON_CONST(subc_sat, int32, mn_int32_t, int32x4_t, 4, s32, vqsubq_s32)
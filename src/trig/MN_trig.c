@@ -0,0 +1,72 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include <assert.h>
+#include <math.h>
+
+/*
+Function Input:
+    dst      - Destination array (sin / cos / tan / atan2)
+    dst_sin  - Sines (sincos)
+    dst_cos  - Cosines (sincos)
+    src      - Arguments in radians
+    src1     - y (atan2)
+    src2     - x (atan2)
+    count    - Count is an integer that stores number of elements
+
+    C Implementation of the trigonometric routines with the libm float
+    functions, the reference for the NEON versions:
+        sin:    dst[i] = sinf(src[i])
+        cos:    dst[i] = cosf(src[i])
+        sincos: dst_sin[i] = sinf(src[i]), dst_cos[i] = cosf(src[i])
+        tan:    dst[i] = tanf(src[i])
+        atan2:  dst[i] = atan2f(src1[i], src2[i])
+    dst may be the same array as a source; dst_sin and dst_cos must differ.
+*/
+
+#define MN_TRIG_UNARY_C(fn) \
+    MN_CHECK_DstSRC; \
+    for ( size_t itr = 0; itr < count; itr++ ) \
+    { \
+        dst[ itr ] = fn(src[ itr ]); \
+    } \
+    return MN_OK;
+
+mn_result_t mn_sin_float_c (mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    MN_TRIG_UNARY_C(sinf)
+}
+
+mn_result_t mn_cos_float_c (mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    MN_TRIG_UNARY_C(cosf)
+}
+
+mn_result_t mn_tan_float_c (mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    MN_TRIG_UNARY_C(tanf)
+}
+
+mn_result_t mn_sincos_float_c (mn_float32_t * dst_sin, mn_float32_t * dst_cos, mn_float32_t * src, size_t count)
+{
+    MN_CHECK_Dst1SRC1SRC2(dst_sin, dst_cos, src);
+    MN_CHECK_Dst1SRC1SRC2(dst_cos, src, src);
+    assert(dst_sin != dst_cos || count == 0);
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        const mn_float32_t x = src[ itr ];
+        dst_sin[ itr ] = sinf(x);
+        dst_cos[ itr ] = cosf(x);
+    }
+    return MN_OK;
+}
+
+mn_result_t mn_atan2_float_c (mn_float32_t * dst, mn_float32_t * src1, mn_float32_t * src2, size_t count)
+{
+    MN_CHECK_Dst1SRC1SRC2(dst, src1, src2);
+    for ( size_t itr = 0; itr < count; itr++ )
+    {
+        dst[ itr ] = atan2f(src1[ itr ], src2[ itr ]);
+    }
+    return MN_OK;
+}
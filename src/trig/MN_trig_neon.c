@@ -0,0 +1,359 @@
+#include "MN_dtype.h"
+#include "MN_macro.h"
+#include "MN_math.h"
+#include "../common/MN_explog_neon.h"
+#include <arm_neon.h>
+#include <assert.h>
+#include <math.h>
+
+/*
+Input Arguments:
+    dst      - Destination array (sin / cos / tan / atan2)
+    dst_sin  - Sines (sincos)
+    dst_cos  - Cosines (sincos)
+    src      - Arguments in radians
+    src1     - y (atan2)
+    src2     - x (atan2)
+    count    - Count is an integer that stores number of elements
+
+Intrinsics used:
+    vfmaq_f32 / vfmsq_f32 - Cody-Waite reduction and the polynomials
+                            (vmlaq_f32 / vmlsq_f32 on 32-bit ARM without FMA)
+    vbslq_f32       - pick the sin or cos polynomial per quadrant, atan2 octants
+    veorq_u32       - sign of the quadrant / of y
+    vdivq_f32       - tan and atan2 quotients (vrecpeq_f32 + two vrecpsq_f32
+                      steps on 32-bit ARM)
+
+sin / cos / sincos / tan: x = n pi/2 + r with n = round(x * 2/pi) and pi/2
+split in three (Cody-Waite), so |r| <= pi/4. With FMA the split is the float
+rounding of pi/2 and its two remainders; without FMA it has short leading
+parts (8 and 11 bits) so that n * P1 and n * P2 are exact. The low two bits
+of n choose between the sin and cos polynomials and the sign:
+    sin(r) = r + r^3 * S(r^2)           cos(r) = 1 - r^2 / 2 + r^4 * C(r^2)
+    tan(r) = r + r^3 * T(r^2), -1 / tan(r) for odd n
+Lanes with |x| > MN_TRIG_RANGE (where the three-part reduction runs out of
+bits), inf and NaN are recomputed with sinf / cosf / tanf.
+
+atan2: with a = min(|x|, |y|), b = max(|x|, |y|), t = a / b is in [0, 1];
+above tan(pi/8) it is replaced by (a - b) / (a + b) and pi/4 is added, so the
+polynomial atan(t) = t + t^3 * A(t^2) runs on |t| <= tan(pi/8). The octant
+then gives m pi/4 + s * atan(t) with m in 0 .. 4, s = +-1 and pi/4 in two
+parts, and the sign of y is copied last. Lanes where b is below 2^-126 (both inputs
+zero or subnormal) or at or above 2^126 (a + b could overflow), inf and NaN
+go to atan2f.
+
+Supported routines: sin, cos, sincos, tan, atan2
+*/
+
+#if defined(MN_NEON_FMA)
+#define MN_TRIG_PIO2_1 1.57079637050628662e+00f  /* float(pi/2) */
+#define MN_TRIG_PIO2_2 -4.37113882867379300e-08f
+#define MN_TRIG_PIO2_3 -1.71512451000588187e-15f
+#define MN_TRIG_RANGE  0x1p17f
+#else
+#define MN_TRIG_PIO2_1 1.5703125f                /* 8 significant bits */
+#define MN_TRIG_PIO2_2 4.837512969970703125e-4f  /* 11 */
+#define MN_TRIG_PIO2_3 7.54953362047672272e-08f  /* 11 */
+#define MN_TRIG_PIO2_4 2.56334406825708960e-12f
+#define MN_TRIG_RANGE  0x1p13f
+#endif
+
+#define MN_TRIG_2_PI     0.636619772367581343f
+#define MN_TRIG_TAN_PI_8 0.414213562373095049f
+#define MN_TRIG_PI_4_HI  7.85398244857788086e-01f  /* 22 significant bits, m * PI_4_HI is exact for m <= 4 */
+#define MN_TRIG_PI_4_LO  -8.14603424714732682e-08f
+
+/* sin(r) = r + r^3 * S(r^2) */
+static const mn_float32_t mn_trig_c_sin[ 3 ] = {
+    -1.6666654611e-1f, 8.3321608736e-3f, -1.9515295891e-4f };
+/* cos(r) = 1 - r^2 / 2 + r^4 * C(r^2) */
+static const mn_float32_t mn_trig_c_cos[ 3 ] = {
+    4.166664568298827e-2f, -1.388731625493765e-3f, 2.443315711809948e-5f };
+/* tan(r) = r + r^3 * T(r^2) */
+static const mn_float32_t mn_trig_c_tan[ 6 ] = {
+    3.33331568548e-1f, 1.33387994085e-1f, 5.34112807005e-2f, 2.44301354525e-2f, 3.11992232697e-3f,
+    9.38540185543e-3f };
+/* atan(t) = t + t^3 * A(t^2) */
+static const mn_float32_t mn_trig_c_atan[ 4 ] = {
+    -3.33329491539e-1f, 1.99777106478e-1f, -1.38776856032e-1f, 8.05374449538e-2f };
+
+/* x = n pi/2 + r; returns r, *q = n (only the low bits are used) */
+static inline float32x4_t mn_trig_reduce (float32x4_t x, uint32x4_t * q)
+{
+    const float32x4_t shift = vdupq_n_f32(MN_EXPLOG_SHIFT);
+    const float32x4_t z = MN_FMAQ_F32(shift, x, vdupq_n_f32(MN_TRIG_2_PI));
+    const float32x4_t n = vsubq_f32(z, shift);
+    float32x4_t r = MN_FMSQ_F32(x, n, vdupq_n_f32(MN_TRIG_PIO2_1));
+    r = MN_FMSQ_F32(r, n, vdupq_n_f32(MN_TRIG_PIO2_2));
+    r = MN_FMSQ_F32(r, n, vdupq_n_f32(MN_TRIG_PIO2_3));
+#if !defined(MN_NEON_FMA)
+    r = MN_FMSQ_F32(r, n, vdupq_n_f32(MN_TRIG_PIO2_4));
+#endif
+    *q = vreinterpretq_u32_f32(z);
+    return r;
+}
+
+/* sin / tan of +-0 is +-0 (the reduction and r + r^3 * S can turn -0 into +0) */
+static inline float32x4_t mn_trig_keep_zero (float32x4_t res, float32x4_t x)
+{
+    return vbslq_f32(vceqq_f32(x, vdupq_n_f32(0.0f)), x, res);
+}
+
+static inline float32x4_t mn_trig_sin_r (float32x4_t r, float32x4_t z)
+{
+    return MN_FMAQ_F32(r, vmulq_f32(r, z), mn_explog_poly(z, mn_trig_c_sin, 3));
+}
+
+static inline float32x4_t mn_trig_cos_r (float32x4_t z)
+{
+    const float32x4_t c = MN_FMAQ_F32(vdupq_n_f32(-0.5f), z, mn_explog_poly(z, mn_trig_c_cos, 3));
+    return MN_FMAQ_F32(vdupq_n_f32(1.0f), z, c);
+}
+
+/* quadrant q: bit 0 swaps sin and cos, bit 1 negates */
+static inline void mn_trig_sincos (float32x4_t x, float32x4_t * s, float32x4_t * c)
+{
+    uint32x4_t q;
+    const float32x4_t r = mn_trig_reduce(x, &q);
+    const float32x4_t z = vmulq_f32(r, r);
+    const float32x4_t ps = mn_trig_sin_r(r, z);
+    const float32x4_t pc = mn_trig_cos_r(z);
+    const uint32x4_t swap = vtstq_u32(q, vdupq_n_u32(1));
+    const uint32x4_t sign_s = vshlq_n_u32(vandq_u32(q, vdupq_n_u32(2)), 30);
+    const uint32x4_t sign_c = vshlq_n_u32(vandq_u32(vaddq_u32(q, vdupq_n_u32(1)), vdupq_n_u32(2)), 30);
+    *s = mn_trig_keep_zero(vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, pc, ps)), sign_s)), x);
+    *c = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, ps, pc)), sign_c));
+}
+
+static inline float32x4_t mn_trig_sin (float32x4_t x)
+{
+    float32x4_t s, c;
+    mn_trig_sincos(x, &s, &c);
+    return s;
+}
+
+static inline float32x4_t mn_trig_cos (float32x4_t x)
+{
+    float32x4_t s, c;
+    mn_trig_sincos(x, &s, &c);
+    return c;
+}
+
+static inline float32x4_t mn_trig_tan (float32x4_t x)
+{
+    uint32x4_t q;
+    const float32x4_t r = mn_trig_reduce(x, &q);
+    const float32x4_t z = vmulq_f32(r, r);
+    const float32x4_t t = MN_FMAQ_F32(r, vmulq_f32(r, z), mn_explog_poly(z, mn_trig_c_tan, 6));
+    const float32x4_t cot = mn_divq_f32(vdupq_n_f32(-1.0f), t);
+    return mn_trig_keep_zero(vbslq_f32(vtstq_u32(q, vdupq_n_u32(1)), cot, t), x);
+}
+
+/* |x| > MN_TRIG_RANGE, inf or NaN */
+static inline uint32x4_t mn_trig_special (float32x4_t x)
+{
+    const uint32x4_t u = vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x7fffffff));
+    return vcgtq_u32(u, vreinterpretq_u32_f32(vdupq_n_f32(MN_TRIG_RANGE)));
+}
+
+static inline float32x4_t mn_trig_atan2 (float32x4_t y, float32x4_t x)
+{
+    const float32x4_t ay = vabsq_f32(y);
+    const float32x4_t ax = vabsq_f32(x);
+    const uint32x4_t swap = vcgtq_f32(ay, ax);
+    const float32x4_t a = vminq_f32(ax, ay);
+    const float32x4_t b = vmaxq_f32(ax, ay);
+    const uint32x4_t big = vcgtq_f32(a, vmulq_f32(b, vdupq_n_f32(MN_TRIG_TAN_PI_8)));
+    const float32x4_t t = mn_divq_f32(vbslq_f32(big, vsubq_f32(a, b), a), vbslq_f32(big, vaddq_f32(a, b), b));
+    const float32x4_t z = vmulq_f32(t, t);
+    const float32x4_t p = MN_FMAQ_F32(t, vmulq_f32(t, z), mn_explog_poly(z, mn_trig_c_atan, 4));
+
+    /* result = m pi/4 + s * p: m = 1 for the reduced t, then 2 - m and -s when |y| > |x|, 4 - m and -s when x < 0 */
+    const float32x4_t neg = vdupq_n_f32(-0.0f);
+    const uint32x4_t xneg = vcltq_s32(vreinterpretq_s32_f32(x), vdupq_n_s32(0));
+    float32x4_t m = vreinterpretq_f32_u32(vandq_u32(big, vreinterpretq_u32_f32(vdupq_n_f32(1.0f))));
+    m = vbslq_f32(swap, vsubq_f32(vdupq_n_f32(2.0f), m), m);
+    m = vbslq_f32(xneg, vsubq_f32(vdupq_n_f32(4.0f), m), m);
+    const uint32x4_t s = vandq_u32(veorq_u32(swap, xneg), vreinterpretq_u32_f32(neg));
+    const float32x4_t sp = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(p), s));
+    const float32x4_t r = MN_FMAQ_F32(MN_FMAQ_F32(sp, m, vdupq_n_f32(MN_TRIG_PI_4_HI)), m,
+                                        vdupq_n_f32(MN_TRIG_PI_4_LO));
+    const uint32x4_t ysign = vandq_u32(vreinterpretq_u32_f32(y), vreinterpretq_u32_f32(neg));
+    return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(r), ysign));
+}
+
+/* max(|x|, |y|) below 2^-126 (both zero, or a reciprocal that overflows), at or above 2^126, inf or NaN */
+static inline uint32x4_t mn_trig_atan2_special (float32x4_t y, float32x4_t x)
+{
+    const uint32x4_t ax = vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x7fffffff));
+    const uint32x4_t ay = vandq_u32(vreinterpretq_u32_f32(y), vdupq_n_u32(0x7fffffff));
+    const uint32x4_t b = vmaxq_u32(ax, ay);
+    return vcgeq_u32(vsubq_u32(b, vdupq_n_u32(0x00800000)), vdupq_n_u32(0x7e000000));
+}
+
+/* Redo the flagged lanes of dst[0 .. 3] with the libm function (x kept in registers for in-place calls) */
+static inline void mn_trig_fix_unary (mn_float32_t * dst, float32x4_t x, uint32x4_t mask, float (*fn)(float))
+{
+    mn_float32_t v[ 4 ];
+    mn_uint32_t m[ 4 ];
+    vst1q_f32(v, x);
+    vst1q_u32(m, mask);
+    for ( int i = 0; i < 4; i++ )
+    {
+        if (m[ i ]) dst[ i ] = fn(v[ i ]);
+    }
+}
+
+/* dst[i] = VEC(src[i]), lanes flagged by mn_trig_special from SCALAR */
+#define MN_TRIG_UNARY_NEON(VEC, SCALAR) \
+    do { \
+        size_t itr = 0; \
+        for ( ; itr + 16 <= count; itr += 16 ) \
+        { \
+            const float32x4_t x0 = vld1q_f32(src + itr); \
+            const float32x4_t x1 = vld1q_f32(src + itr + 4); \
+            const float32x4_t x2 = vld1q_f32(src + itr + 8); \
+            const float32x4_t x3 = vld1q_f32(src + itr + 12); \
+            const uint32x4_t s0 = mn_trig_special(x0); \
+            const uint32x4_t s1 = mn_trig_special(x1); \
+            const uint32x4_t s2 = mn_trig_special(x2); \
+            const uint32x4_t s3 = mn_trig_special(x3); \
+            const float32x4_t r0 = VEC(x0); \
+            const float32x4_t r1 = VEC(x1); \
+            const float32x4_t r2 = VEC(x2); \
+            const float32x4_t r3 = VEC(x3); \
+            vst1q_f32(dst + itr, r0); \
+            vst1q_f32(dst + itr + 4, r1); \
+            vst1q_f32(dst + itr + 8, r2); \
+            vst1q_f32(dst + itr + 12, r3); \
+            if (mn_explog_any(vorrq_u32(vorrq_u32(s0, s1), vorrq_u32(s2, s3)))) \
+            { \
+                mn_trig_fix_unary(dst + itr, x0, s0, SCALAR); \
+                mn_trig_fix_unary(dst + itr + 4, x1, s1, SCALAR); \
+                mn_trig_fix_unary(dst + itr + 8, x2, s2, SCALAR); \
+                mn_trig_fix_unary(dst + itr + 12, x3, s3, SCALAR); \
+            } \
+        } \
+        for ( ; itr < count; itr += 4 ) \
+        { \
+            mn_float32_t in[ 4 ] = { 0.0f, 0.0f, 0.0f, 0.0f }, out[ 4 ]; \
+            const size_t n = count - itr < 4 ? count - itr : 4; \
+            for ( size_t i = 0; i < n; i++ ) in[ i ] = src[ itr + i ]; \
+            const float32x4_t x = vld1q_f32(in); \
+            vst1q_f32(out, VEC(x)); \
+            mn_trig_fix_unary(out, x, mn_trig_special(x), SCALAR); \
+            for ( size_t i = 0; i < n; i++ ) dst[ itr + i ] = out[ i ]; \
+        } \
+    } while (0)
+
+mn_result_t mn_sin_float_neon (mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    MN_CHECK_DstSRC;
+    MN_TRIG_UNARY_NEON(mn_trig_sin, sinf);
+    return MN_OK;
+}
+
+mn_result_t mn_cos_float_neon (mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    MN_CHECK_DstSRC;
+    MN_TRIG_UNARY_NEON(mn_trig_cos, cosf);
+    return MN_OK;
+}
+
+mn_result_t mn_tan_float_neon (mn_float32_t * dst, mn_float32_t * src, size_t count)
+{
+    MN_CHECK_DstSRC;
+    MN_TRIG_UNARY_NEON(mn_trig_tan, tanf);
+    return MN_OK;
+}
+
+static inline void mn_trig_sincos4 (mn_float32_t * ds, mn_float32_t * dc, float32x4_t x)
+{
+    float32x4_t s, c;
+    const uint32x4_t sp = mn_trig_special(x);
+    mn_trig_sincos(x, &s, &c);
+    vst1q_f32(ds, s);
+    vst1q_f32(dc, c);
+    if (mn_explog_any(sp))
+    {
+        mn_trig_fix_unary(ds, x, sp, sinf);
+        mn_trig_fix_unary(dc, x, sp, cosf);
+    }
+}
+
+mn_result_t mn_sincos_float_neon (mn_float32_t * dst_sin, mn_float32_t * dst_cos, mn_float32_t * src, size_t count)
+{
+    MN_CHECK_Dst1SRC1SRC2(dst_sin, dst_cos, src);
+    MN_CHECK_Dst1SRC1SRC2(dst_cos, src, src);
+    assert(dst_sin != dst_cos || count == 0);
+    size_t itr = 0;
+    for ( ; itr + 8 <= count; itr += 8 )
+    {
+        const float32x4_t x0 = vld1q_f32(src + itr);
+        const float32x4_t x1 = vld1q_f32(src + itr + 4);
+        mn_trig_sincos4(dst_sin + itr, dst_cos + itr, x0);
+        mn_trig_sincos4(dst_sin + itr + 4, dst_cos + itr + 4, x1);
+    }
+    for ( ; itr < count; itr += 4 )
+    {
+        mn_float32_t in[ 4 ] = { 0.0f, 0.0f, 0.0f, 0.0f }, s[ 4 ], c[ 4 ];
+        const size_t n = count - itr < 4 ? count - itr : 4;
+        for ( size_t i = 0; i < n; i++ ) in[ i ] = src[ itr + i ];
+        mn_trig_sincos4(s, c, vld1q_f32(in));
+        for ( size_t i = 0; i < n; i++ )
+        {
+            dst_sin[ itr + i ] = s[ i ];
+            dst_cos[ itr + i ] = c[ i ];
+        }
+    }
+    return MN_OK;
+}
+
+static inline void mn_trig_atan2_fix (mn_float32_t * dst, float32x4_t y, float32x4_t x, uint32x4_t mask)
+{
+    mn_float32_t a[ 4 ], b[ 4 ];
+    mn_uint32_t m[ 4 ];
+    vst1q_f32(a, y);
+    vst1q_f32(b, x);
+    vst1q_u32(m, mask);
+    for ( int i = 0; i < 4; i++ )
+    {
+        if (m[ i ]) dst[ i ] = atan2f(a[ i ], b[ i ]);
+    }
+}
+
+mn_result_t mn_atan2_float_neon (mn_float32_t * dst, mn_float32_t * src1, mn_float32_t * src2, size_t count)
+{
+    MN_CHECK_Dst1SRC1SRC2(dst, src1, src2);
+    size_t itr = 0;
+    for ( ; itr + 8 <= count; itr += 8 )
+    {
+        const float32x4_t y0 = vld1q_f32(src1 + itr);
+        const float32x4_t y1 = vld1q_f32(src1 + itr + 4);
+        const float32x4_t x0 = vld1q_f32(src2 + itr);
+        const float32x4_t x1 = vld1q_f32(src2 + itr + 4);
+        const uint32x4_t s0 = mn_trig_atan2_special(y0, x0);
+        const uint32x4_t s1 = mn_trig_atan2_special(y1, x1);
+        const float32x4_t r0 = mn_trig_atan2(y0, x0);
+        const float32x4_t r1 = mn_trig_atan2(y1, x1);
+        vst1q_f32(dst + itr, r0);
+        vst1q_f32(dst + itr + 4, r1);
+        if (mn_explog_any(vorrq_u32(s0, s1)))
+        {
+            mn_trig_atan2_fix(dst + itr, y0, x0, s0);
+            mn_trig_atan2_fix(dst + itr + 4, y1, x1, s1);
+        }
+    }
+    for ( ; itr < count; itr += 4 )
+    {
+        mn_float32_t a[ 4 ] = { 0.0f, 0.0f, 0.0f, 0.0f }, b[ 4 ] = { 1.0f, 1.0f, 1.0f, 1.0f }, out[ 4 ];
+        const size_t n = count - itr < 4 ? count - itr : 4;
+        for ( size_t i = 0; i < n; i++ ) { a[ i ] = src1[ itr + i ]; b[ i ] = src2[ itr + i ]; }
+        const float32x4_t y = vld1q_f32(a);
+        const float32x4_t x = vld1q_f32(b);
+        vst1q_f32(out, mn_trig_atan2(y, x));
+        mn_trig_atan2_fix(out, y, x, mn_trig_atan2_special(y, x));
+        for ( size_t i = 0; i < n; i++ ) dst[ itr + i ] = out[ i ];
+    }
+    return MN_OK;
+}
@@ -0,0 +1,54 @@
+#ifndef MN_TEST_H
+#define MN_TEST_H
+
+#include <math.h>
+#include <stdint.h>
+#include "../includes/MN_dtype.h"
+
+/*
+    Helpers shared by the test programs:
+      - a seeded linear congruential generator, so every run (and every
+        platform) sees the same pseudo-random inputs; each test calls
+        mn_test_seed once before filling its arrays
+      - the error of a float result in units of the last place, for the
+        accuracy tiers of the math kernels
+*/
+
+static uint32_t mn_test_rng_state = 1u;
+
+static inline void mn_test_seed(uint32_t seed)
+{
+    mn_test_rng_state = seed;
+}
+
+/* 24 random bits */
+static inline uint32_t mn_test_bits(void)
+{
+    mn_test_rng_state = mn_test_rng_state * 1103515245u + 12345u;
+    return mn_test_rng_state >> 8;
+}
+
+/* a float in [lo, hi) */
+static inline mn_float32_t mn_test_uniform(mn_float32_t lo, mn_float32_t hi)
+{
+    return lo + (hi - lo) * ((mn_float32_t)mn_test_bits() / 16777216.0f);
+}
+
+/* any int32, from the high halves of two steps */
+static inline mn_int32_t mn_test_int32(void)
+{
+    const uint32_t hi = mn_test_bits() >> 8;
+    return (mn_int32_t)((hi << 16) | (mn_test_bits() >> 8));
+}
+
+/* error of got in units of the last place of the float nearest to ref */
+static inline double mn_test_ulp_error(mn_float32_t got, double ref)
+{
+    const float rf = (float)ref;
+    if (isnan(ref)) return isnan(got) ? 0.0 : 1e30;
+    if (isinf(rf)) return got == rf ? 0.0 : 1e30;
+    const double ulp = rf == 0.0f ? ldexp(1.0, -149) : fmax(ldexp(1.0, ilogbf(rf) - 23), ldexp(1.0, -149));
+    return fabs((double)got - ref) / ulp;
+}
+
+#endif // MN_TEST_H
@@ -0,0 +1,300 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    relu / leaky_relu / sigmoid / tanh / gelu / softmax tests:
+      1. The C versions give the libm formulas.
+      2. NEON relu / leaky_relu give the C values; sigmoid / tanh / gelu stay
+         within the documented ULP bounds of a double precision reference
+         (gelu for x < 0 in units of 1 + |2u|).
+      3. Special values (+-0, inf, NaN, FLT_MAX, large negative) match the C versions.
+      4. softmax against a double precision reference, with inputs around
+         +-1000 (no overflow), a single element and all equal elements.
+      5. float16: NEON within one half ulp of the C versions.
+      6. Counts 0 .. 40 and in-place calls give the same values as one long call.
+*/
+
+#define N 4099
+#define ALPHA 0.01f
+#define TINY 7.52316385e-37   /* 2^-120 */
+
+typedef mn_result_t (*unary_fn)(mn_float32_t *, mn_float32_t *, size_t);
+typedef mn_result_t (*half_fn)(mn_float16_t *, mn_float16_t *, size_t);
+
+/* error of got in units of the last place of the float nearest to ref */
+static int same(mn_float32_t a, mn_float32_t b)
+{
+    return (isnan(a) && isnan(b)) || memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+static double ref_sigmoid(double x) { return 1.0 / (1.0 + exp(-x)); }
+static double ref_tanh(double x) { return tanh(x); }
+/* 0.5 x (1 + tanh(u)) = x / (1 + e^-2u), which keeps its precision for negative x */
+static double ref_gelu(double x) { return x / (1.0 + exp(-1.5957691216057308 * (x + 0.044715 * x * x * x))); }
+static float libm_sigmoid(float x) { return 1.0f / (1.0f + expf(-x)); }
+static float libm_gelu(float x) { return x / (1.0f + expf(-x * (1.59576912160573f + 0.0713548162726f * x * x))); }
+static mn_result_t leaky_c(mn_float32_t *d, mn_float32_t *s, size_t n) { return mn_leaky_relu_float_c(d, s, ALPHA, n); }
+static mn_result_t leaky_neon(mn_float32_t *d, mn_float32_t *s, size_t n) { return mn_leaky_relu_float_neon(d, s, ALPHA, n); }
+static mn_result_t leaky16_c(mn_float16_t *d, mn_float16_t *s, size_t n) { return mn_leaky_relu_float16_c(d, s, ALPHA, n); }
+static mn_result_t leaky16_neon(mn_float16_t *d, mn_float16_t *s, size_t n) { return mn_leaky_relu_float16_neon(d, s, ALPHA, n); }
+
+typedef struct
+{
+    const char *name;
+    unary_fn c, neon;
+    half_fn c16, neon16;
+    float (*libm)(float);
+    double (*ref)(double);   /* NULL: NEON must give the C values */
+    double ulp;
+} case_t;
+
+static const case_t cases[] = {
+    { "relu", mn_relu_float_c, mn_relu_float_neon, mn_relu_float16_c, mn_relu_float16_neon, NULL, NULL, 0.0 },
+    { "leaky_relu", leaky_c, leaky_neon, leaky16_c, leaky16_neon, NULL, NULL, 0.0 },
+    { "sigmoid", mn_sigmoid_float_c, mn_sigmoid_float_neon, mn_sigmoid_float16_c, mn_sigmoid_float16_neon,
+      libm_sigmoid, ref_sigmoid, 4.0 },
+    { "tanh", mn_tanh_float_c, mn_tanh_float_neon, mn_tanh_float16_c, mn_tanh_float16_neon, tanhf, ref_tanh, 2.0 },
+    { "gelu", mn_gelu_float_c, mn_gelu_float_neon, mn_gelu_float16_c, mn_gelu_float16_neon, libm_gelu, ref_gelu, 4.0 },
+};
+
+static mn_float32_t libm_value(const case_t *cs, mn_float32_t x)
+{
+    if (cs->libm) return cs->libm(x);
+    if (cs->c == leaky_c) return x > 0.0f ? x : ALPHA * x;
+    return (x > 0.0f || isnan(x)) ? x : 0.0f;
+}
+
+/* error in ULP, for gelu(x < 0) in units of 1 + |2u| */
+static double scaled_error(const case_t *cs, mn_float32_t got, mn_float32_t x)
+{
+    const double ref = cs->ref(x);
+    if (fabs(ref) < TINY) {
+        /* results below 2^-120 may flush to zero (1 / (1 + e) on 32-bit ARM) */
+        return fabsf(got) < TINY && !(got != 0.0f && (got < 0.0f) != (ref < 0.0)) ? 0.0 : 1e30;
+    }
+    if (cs->ref == ref_gelu && x < 0.0f) {
+        /* rounding 2u in float moves e^-2u by |2u| ULP */
+        return mn_test_ulp_error(got, ref) / (1.0 + fabs(1.5957691216057308 * (x + 0.044715 * x * x * x)));
+    }
+    return mn_test_ulp_error(got, ref);
+}
+
+static void fill(mn_float32_t *x)
+{
+    for (size_t i = 0; i < N; i++) {
+        switch (i % 3) {
+        case 0: x[i] = mn_test_uniform(-1.0f, 1.0f); break;
+        case 1: x[i] = mn_test_uniform(-5.0f, 5.0f); break;
+        default: x[i] = mn_test_uniform(-20.0f, 20.0f); break;
+        }
+    }
+}
+
+static int check_values(const case_t *cs)
+{
+    static mn_float32_t x[N], yc[N], yn[N], y2[N];
+    double worst = 0.0;
+    size_t at = 0;
+    int fail = 0;
+
+    fill(x);
+    fail |= cs->c(yc, x, N) != MN_SUCCESS;
+    fail |= cs->neon(yn, x, N) != MN_SUCCESS;
+    for (size_t i = 0; i < N; i++) {
+        if (!same(yc[i], libm_value(cs, x[i]))) {
+            printf("%s_c differs from libm at %a\n", cs->name, x[i]);
+            return 1;
+        }
+        if (!cs->ref) {
+            if (!same(yn[i], yc[i])) {
+                printf("%s failed at %a: NEON=%a, C=%a\n", cs->name, x[i], yn[i], yc[i]);
+                return 1;
+            }
+            continue;
+        }
+        const double err = scaled_error(cs, yn[i], x[i]);
+        if (err > worst) { worst = err; at = i; }
+    }
+    if (worst > cs->ulp) {
+        printf("%s failed at %a: NEON=%a, Reference=%a (%g ULP)\n", cs->name, x[at], yn[at], cs->ref(x[at]), worst);
+        fail = 1;
+    }
+
+    /* short counts and in place give the same values as the long call */
+    for (size_t count = 0; count <= 40; count++) {
+        memcpy(y2, x + 7, count * sizeof(mn_float32_t));
+        cs->neon(y2, y2, count);
+        if (count && memcmp(y2, yn + 7, count * sizeof(mn_float32_t)) != 0) {
+            printf("%s count=%zu in-place differs from the long call\n", cs->name, count);
+            fail = 1;
+            break;
+        }
+    }
+    return fail;
+}
+
+static int check_special(const case_t *cs)
+{
+    const mn_float32_t sp[] = {
+        0.0f, -0.0f, INFINITY, -INFINITY, NAN, 1e-40f, -1e-40f, 3.4028235e38f, -3.4028235e38f,
+        1e-7f, -1e-7f, 0.5624999f, 0.5625f, -0.5625f, 9.0f, 44.0f, -44.0f, 88.0f, -88.0f, 89.0f, -89.0f, -104.0f,
+        -9.5f, -10.5f, 1e13f, -1e13f,
+    };
+    const size_t n = sizeof(sp) / sizeof(sp[0]);
+    mn_float32_t x[32], y[32];
+    int fail = 0;
+
+    memcpy(x, sp, sizeof(sp));
+    cs->neon(y, x, n);
+    for (size_t i = 0; i < n; i++) {
+        const mn_float32_t want = libm_value(cs, x[i]);
+        int ok;
+        if (!cs->ref || isnan(want) || isinf(want)) {
+            ok = same(y[i], want);
+        } else {
+            ok = scaled_error(cs, y[i], x[i]) <= cs->ulp;
+        }
+        if (!ok) {
+            printf("%s special %a: NEON=%a, C=%a\n", cs->name, x[i], y[i], want);
+            fail = 1;
+        }
+    }
+    return fail;
+}
+
+static int check_half(const case_t *cs)
+{
+    static mn_float16_t x[N], yc[N], yn[N], y2[N];
+    int fail = 0;
+
+    for (size_t i = 0; i < N; i++) {
+        x[i] = mn_f32_to_f16(i % 2 ? mn_test_uniform(-8.0f, 8.0f) : mn_test_uniform(-1.0f, 1.0f));
+    }
+    x[0] = 0x7c00u;   /* +inf */
+    x[1] = 0xfc00u;   /* -inf */
+    x[2] = 0x7e00u;   /* NaN */
+    x[3] = 0x8000u;   /* -0 */
+    x[4] = 0x0001u;   /* smallest subnormal */
+    fail |= cs->c16(yc, x, N) != MN_SUCCESS;
+    fail |= cs->neon16(yn, x, N) != MN_SUCCESS;
+    for (size_t i = 0; i < N; i++) {
+        const mn_float32_t fc = mn_f16_to_f32(yc[i]), fn = mn_f16_to_f32(yn[i]);
+        const int ok = isnan(fc) ? isnan(fn) : abs((int)yc[i] - (int)yn[i]) <= (cs->ref ? 1 : 0);
+        if (!ok) {
+            printf("%s float16 failed at %a: NEON=%a, C=%a\n", cs->name, mn_f16_to_f32(x[i]), fn, fc);
+            return 1;
+        }
+    }
+    for (size_t count = 0; count <= 40; count++) {
+        memcpy(y2, x + 5, count * sizeof(mn_float16_t));
+        cs->neon16(y2, y2, count);
+        if (count && memcmp(y2, yn + 5, count * sizeof(mn_float16_t)) != 0) {
+            printf("%s float16 count=%zu in-place differs from the long call\n", cs->name, count);
+            fail = 1;
+            break;
+        }
+    }
+    return fail;
+}
+
+/* relative error of each value against a double precision softmax */
+static double softmax_error(const mn_float32_t *y, const mn_float32_t *x, size_t n)
+{
+    double max = -INFINITY, sum = 0.0, worst = 0.0;
+    for (size_t i = 0; i < n; i++) max = fmax(max, x[i]);
+    for (size_t i = 0; i < n; i++) sum += exp((double)x[i] - max);
+    for (size_t i = 0; i < n; i++) {
+        const double ref = exp((double)x[i] - max) / sum;
+        /* values deep in the subnormals only keep their absolute precision */
+        worst = fmax(worst, fabs(y[i] - ref) / fmax(ref, 1e-36));
+    }
+    return worst;
+}
+
+static int check_softmax(void)
+{
+    static mn_float32_t x[N], yc[N], yn[N], y2[N];
+    int fail = 0;
+
+    for (int round = 0; round < 3; round++) {
+        /* wide logits, logits around +1000 and around -1000 */
+        const mn_float32_t offset = round == 0 ? 0.0f : round == 1 ? 1000.0f : -1000.0f;
+        for (size_t i = 0; i < N; i++) x[i] = offset + mn_test_uniform(-30.0f, 30.0f);
+        fail |= mn_softmax_float_c(yc, x, N) != MN_SUCCESS;
+        fail |= mn_softmax_float_neon(yn, x, N) != MN_SUCCESS;
+        const double ec = softmax_error(yc, x, N), en = softmax_error(yn, x, N);
+        if (ec > 2e-5 || en > 2e-5) {
+            printf("softmax offset %g: relative error C=%g, NEON=%g\n", offset, ec, en);
+            fail = 1;
+        }
+    }
+    for (size_t count = 1; count <= 40; count++) {
+        memcpy(y2, x + 3, count * sizeof(mn_float32_t));
+        mn_softmax_float_neon(yn, x + 3, count);
+        mn_softmax_float_neon(y2, y2, count);
+        if (memcmp(y2, yn, count * sizeof(mn_float32_t)) != 0 || softmax_error(yn, x + 3, count) > 2e-6) {
+            printf("softmax count=%zu failed\n", count);
+            fail = 1;
+            break;
+        }
+    }
+    fail |= mn_softmax_float_neon(yn, x, 0) != MN_SUCCESS;
+
+    /* one element is 1, equal elements share the mass evenly, -inf gets 0 */
+    x[0] = -3.0f;
+    mn_softmax_float_neon(yn, x, 1);
+    fail |= yn[0] != 1.0f;
+    for (size_t i = 0; i < 37; i++) x[i] = 2.5f;
+    x[5] = -INFINITY;
+    mn_softmax_float_neon(yn, x, 37);
+    for (size_t i = 0; i < 37; i++) fail |= i == 5 ? yn[i] != 0.0f : fabsf(yn[i] * 36.0f - 1.0f) > 1e-6f;
+    x[9] = NAN;
+    mn_softmax_float_neon(yn, x, 37);
+    fail |= !isnan(yn[0]);
+    if (fail) printf("softmax special values failed\n");
+    return fail;
+}
+
+static int check_softmax_half(void)
+{
+    static mn_float16_t x[N], yc[N], yn[N];
+    int fail = 0;
+
+    for (size_t i = 0; i < N; i++) x[i] = mn_f32_to_f16(mn_test_uniform(-12.0f, 12.0f));
+    for (size_t count = 0; count <= N; count += count < 40 ? 1 : 1000) {
+        fail |= mn_softmax_float16_c(yc, x, count) != MN_SUCCESS;
+        fail |= mn_softmax_float16_neon(yn, x, count) != MN_SUCCESS;
+        for (size_t i = 0; i < count; i++) {
+            if (abs((int)yc[i] - (int)yn[i]) > 1) {
+                printf("softmax float16 count=%zu failed at %zu: NEON=%a, C=%a\n", count, i,
+                       mn_f16_to_f32(yn[i]), mn_f16_to_f32(yc[i]));
+                return 1;
+            }
+        }
+    }
+    return fail;
+}
+
+int main(void)
+{
+    int fail = 0;
+
+    mn_test_seed(17u);
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        fail |= check_values(&cases[i]);
+        fail |= check_special(&cases[i]);
+        fail |= check_half(&cases[i]);
+    }
+    fail |= check_softmax();
+    fail |= check_softmax_half();
+
+    if (fail) return 1;
+    printf("All relu / leaky_relu / sigmoid / tanh / gelu / softmax tests passed\n");
+    return 0;
+}
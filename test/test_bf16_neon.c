@@ -0,0 +1,176 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    bfloat16 tests:
+      1. Scalar conversions: round trip of every bfloat16 and known rounding cases.
+      2. NEON vs C for add/sub/mul/addc/mulc on random finite values and fma
+         on values where every result is exact.
+      3. sum/dot on small integers, where any summation order gives the same float32.
+      4. sum/dot on random values: NEON keeps 8 partial sums and C adds in sequence,
+         so they only have to agree within the rounding error of the two orders.
+    The count is not a multiple of 8 so the leftover path runs too.
+*/
+
+#define COUNT 151
+
+static mn_bfloat16_t random_bf16(void)
+{
+    mn_bfloat16_t h = (mn_bfloat16_t)mn_test_bits();
+    if (((h >> 7) & 0xff) == 0xff) {
+        h &= (mn_bfloat16_t)~0x4000u;   /* keep it finite */
+    }
+    return h;
+}
+
+static mn_bfloat16_t bits_to_bf16(uint32_t bits)
+{
+    mn_float32_t f;
+    memcpy(&f, &bits, sizeof(f));
+    return mn_f32_to_bf16(f);
+}
+
+static int check(const char* name, const mn_bfloat16_t* got, const mn_bfloat16_t* ref, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        if (got[i] != ref[i]) {
+            printf("%s failed at %zu: NEON=0x%04x, Reference=0x%04x\n", name, i, got[i], ref[i]);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* |got - ref| within n * FLT_EPSILON * abs_sum, abs_sum the sum of the magnitudes of the terms */
+static int check_close(const char* name, mn_float32_t got, mn_float32_t ref, double abs_sum, size_t n)
+{
+    if (fabs((double)got - (double)ref) > (double)n * FLT_EPSILON * abs_sum) {
+        printf("%s failed: NEON=%.6f, Reference=%.6f\n", name, got, ref);
+        return 1;
+    }
+    return 0;
+}
+
+static int test_conversions(void)
+{
+    struct { uint32_t f; mn_bfloat16_t h; } cases[] = {
+        { 0x3f800000u, 0x3f80 },            /* 1.0 */
+        { 0xc0000000u, 0xc000 },            /* -2.0 */
+        { 0x3f808000u, 0x3f80 },            /* tie, rounds to even */
+        { 0x3f818000u, 0x3f82 },            /* tie, rounds up to even */
+        { 0x3f808001u, 0x3f81 },            /* just above the tie */
+        { 0x7f7fffffu, 0x7f80 },            /* FLT_MAX rounds to inf */
+        { 0x7f800000u, 0x7f80 },            /* inf */
+        { 0x7f800001u, 0x7fc0 },            /* signalling NaN comes back quiet */
+        { 0xffc12345u, 0xffc1 },            /* quiet NaN keeps sign and payload */
+        { 0x00008000u, 0x0000 },            /* subnormal tie to zero */
+        { 0x80000000u, 0x8000 },            /* -0.0 */
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        mn_bfloat16_t h = bits_to_bf16(cases[i].f);
+        if (h != cases[i].h) {
+            printf("mn_f32_to_bf16(0x%08x) = 0x%04x, expected 0x%04x\n", cases[i].f, h, cases[i].h);
+            return 1;
+        }
+    }
+
+    for (uint32_t bits = 0; bits <= 0xffff; bits++) {
+        mn_bfloat16_t h = (mn_bfloat16_t)bits;
+        mn_bfloat16_t back = mn_f32_to_bf16(mn_bf16_to_f32(h));
+        int is_nan = ((h >> 7) & 0xff) == 0xff && (h & 0x7f) != 0;
+        if (is_nan ? back != (h | 0x40) : back != h) {
+            printf("Round trip failed for 0x%04x (got 0x%04x)\n", h, back);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(void)
+{
+    int failed = 0;
+    mn_bfloat16_t a[COUNT], b[COUNT], ref[COUNT], dst[COUNT];
+    mn_bfloat16_t ea[COUNT], eb[COUNT], ec[COUNT];
+    mn_bfloat16_t ra[COUNT], rb[COUNT];
+    double abs_sum = 0.0, abs_dot = 0.0;
+    mn_bfloat16_t k = mn_f32_to_bf16(-1.75f);
+    mn_float32_t sum_c, sum_neon;
+
+    mn_test_seed(2024u);
+    failed |= test_conversions();
+
+    for (size_t i = 0; i < COUNT; i++) {
+        a[i] = random_bf16();
+        b[i] = random_bf16();
+        /* small integers: products and sums are exact in bfloat16 and float32 */
+        ea[i] = mn_f32_to_bf16((float)((int)(i % 13) - 6));
+        eb[i] = mn_f32_to_bf16((float)((int)(i % 7) - 3));
+        ec[i] = mn_f32_to_bf16((float)((int)(i % 11) - 5));
+    }
+
+#define RUN2(op) \
+    mn_##op##_bfloat16_c(ref, a, b, COUNT); \
+    mn_##op##_bfloat16_neon(dst, a, b, COUNT); \
+    failed |= check(#op "_bfloat16", dst, ref, COUNT);
+#define RUNC(op) \
+    mn_##op##_bfloat16_c(ref, a, k, COUNT); \
+    mn_##op##_bfloat16_neon(dst, a, k, COUNT); \
+    failed |= check(#op "_bfloat16", dst, ref, COUNT);
+
+    RUN2(add) RUN2(sub) RUN2(mul)
+    RUNC(addc) RUNC(mulc)
+
+    mn_fma_bfloat16_c(ref, ea, eb, ec, COUNT);
+    mn_fma_bfloat16_neon(dst, ea, eb, ec, COUNT);
+    failed |= check("fma_bfloat16", dst, ref, COUNT);
+
+    // ==== Reductions ====
+    mn_sum_bfloat16_c(&sum_c, ea, COUNT);
+    mn_sum_bfloat16_neon(&sum_neon, ea, COUNT);
+    if (sum_c != sum_neon) {
+        printf("sum_bfloat16 failed: NEON=%.6f, Reference=%.6f\n", sum_neon, sum_c);
+        failed = 1;
+    }
+
+    for (size_t n = 0; n <= 17; n++) {
+        mn_dot_bfloat16_c(&sum_c, ea, eb, n);
+        mn_dot_bfloat16_neon(&sum_neon, ea, eb, n);
+        if (sum_c != sum_neon) {
+            printf("dot_bfloat16 failed for count %zu: NEON=%.6f, Reference=%.6f\n", n, sum_neon, sum_c);
+            failed = 1;
+            break;
+        }
+    }
+    mn_dot_bfloat16_c(&sum_c, ea, ec, COUNT);
+    mn_dot_bfloat16_neon(&sum_neon, ea, ec, COUNT);
+    if (sum_c != sum_neon) {
+        printf("dot_bfloat16 failed: NEON=%.6f, Reference=%.6f\n", sum_neon, sum_c);
+        failed = 1;
+    }
+
+    for (size_t i = 0; i < COUNT; i++) {
+        ra[i] = mn_f32_to_bf16(mn_test_uniform(-100.0f, 100.0f));
+        rb[i] = mn_f32_to_bf16(mn_test_uniform(-100.0f, 100.0f));
+        abs_sum += fabs(mn_bf16_to_f32(ra[i]));
+        abs_dot += fabs((double)mn_bf16_to_f32(ra[i]) * mn_bf16_to_f32(rb[i]));
+    }
+    mn_sum_bfloat16_c(&sum_c, ra, COUNT);
+    mn_sum_bfloat16_neon(&sum_neon, ra, COUNT);
+    failed |= check_close("sum_bfloat16 random", sum_neon, sum_c, abs_sum, COUNT);
+    mn_dot_bfloat16_c(&sum_c, ra, rb, COUNT);
+    mn_dot_bfloat16_neon(&sum_neon, ra, rb, COUNT);
+    failed |= check_close("dot_bfloat16 random", sum_neon, sum_c, abs_dot, COUNT);
+
+    if (!failed) {
+        printf("All bfloat16 tests passed!\n");
+    }
+    return failed;
+}
@@ -0,0 +1,192 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    compact tests:
+      1. compact / compactc for float and int32, every MN_CMP_* predicate,
+         C and NEON, against a reference loop for counts 0 .. 40 and 1003:
+         same kept count and the same values in order.
+      2. Float data holds NaN (kept by NE only) and values equal to the
+         constant; the constant is chosen so about 10% and 50% are kept.
+      3. Nothing past dst[count - 1] is written.
+      4. In place with dst == src1 and with dst == src2.
+      5. An unknown predicate returns MN_ERROR.
+*/
+
+#define N 1003
+#define GUARD 8
+
+typedef mn_result_t (*compact_f_fn)(mn_float32_t *, size_t *, mn_float32_t *, mn_float32_t *, size_t, int);
+typedef mn_result_t (*compactc_f_fn)(mn_float32_t *, size_t *, mn_float32_t *, mn_float32_t, size_t, int);
+typedef mn_result_t (*compact_i_fn)(mn_int32_t *, size_t *, mn_int32_t *, mn_int32_t *, size_t, int);
+typedef mn_result_t (*compactc_i_fn)(mn_int32_t *, size_t *, mn_int32_t *, mn_int32_t, size_t, int);
+
+static const compact_f_fn compact_f[2] = { mn_compact_float_c, mn_compact_float_neon };
+static const compactc_f_fn compactc_f[2] = { mn_compactc_float_c, mn_compactc_float_neon };
+static const compact_i_fn compact_i[2] = { mn_compact_int32_c, mn_compact_int32_neon };
+static const compactc_i_fn compactc_i[2] = { mn_compactc_int32_c, mn_compactc_int32_neon };
+static const char *impl_names[2] = { "c", "neon" };
+
+static int test_float(mn_float32_t x, mn_float32_t y, int cmp)
+{
+    switch (cmp) {
+    case MN_CMP_EQ: return x == y;
+    case MN_CMP_NE: return x != y;
+    case MN_CMP_LT: return x < y;
+    case MN_CMP_LE: return x <= y;
+    case MN_CMP_GT: return x > y;
+    default: return x >= y;
+    }
+}
+
+static int test_int(mn_int32_t x, mn_int32_t y, int cmp)
+{
+    switch (cmp) {
+    case MN_CMP_EQ: return x == y;
+    case MN_CMP_NE: return x != y;
+    case MN_CMP_LT: return x < y;
+    case MN_CMP_LE: return x <= y;
+    case MN_CMP_GT: return x > y;
+    default: return x >= y;
+    }
+}
+
+/* bitwise comparison so kept NaN values compare equal */
+static int same(const char *name, const void *got, size_t kept, const void *want, size_t n, size_t size,
+                size_t count, int cmp)
+{
+    if (kept != n || memcmp(got, want, n * size) != 0) {
+        printf("%s cmp=%d n=%zu failed: kept %zu, reference %zu\n", name, cmp, count, kept, n);
+        return 1;
+    }
+    return 0;
+}
+
+static int check_float(void)
+{
+    static mn_float32_t x[N], y[N], want[N], d[N + GUARD], d2[N];
+    const mn_float32_t csts[2] = { 0.8f, 0.0f };    /* keeps about 10% / 50% with GT */
+    char name[64];
+    int fail = 0;
+
+    for (size_t i = 0; i < N; i++) {
+        x[i] = (i % 37 == 5) ? NAN : (i % 11 == 3) ? 0.0f : mn_test_uniform(-1.0f, 1.0f);
+        y[i] = (i % 13 == 2) ? x[i] : mn_test_uniform(-1.0f, 1.0f);
+    }
+    for (int k = 0; k < 2; k++) {
+        for (int cmp = MN_CMP_EQ; cmp <= MN_CMP_GE; cmp++) {
+            for (size_t c = 0; c < 2; c++) {
+                for (size_t n = 0; n <= 41 && !fail; n++) {
+                    const size_t count = n <= 40 ? n : N;
+                    size_t kept, m = 0;
+
+                    /* against a constant */
+                    for (size_t i = 0; i < count; i++) {
+                        if (test_float(x[i], csts[c], cmp)) want[m++] = x[i];
+                    }
+                    for (size_t i = 0; i < N + GUARD; i++) d[i] = -7.0f;
+                    snprintf(name, sizeof(name), "compactc_float_%s", impl_names[k]);
+                    fail |= compactc_f[k](d, &kept, x, csts[c], count, cmp) != MN_SUCCESS;
+                    fail |= same(name, d, kept, want, m, sizeof(mn_float32_t), count, cmp);
+                    for (size_t i = count; i < N + GUARD; i++) fail |= d[i] != -7.0f;
+                    memcpy(d2, x, count * sizeof(mn_float32_t));
+                    compactc_f[k](d2, &kept, d2, csts[c], count, cmp);
+                    fail |= same("in place", d2, kept, want, m, sizeof(mn_float32_t), count, cmp);
+
+                    /* against a second array */
+                    m = 0;
+                    for (size_t i = 0; i < count; i++) {
+                        if (test_float(x[i], y[i], cmp)) want[m++] = x[i];
+                    }
+                    for (size_t i = 0; i < N + GUARD; i++) d[i] = -7.0f;
+                    snprintf(name, sizeof(name), "compact_float_%s", impl_names[k]);
+                    fail |= compact_f[k](d, &kept, x, y, count, cmp) != MN_SUCCESS;
+                    fail |= same(name, d, kept, want, m, sizeof(mn_float32_t), count, cmp);
+                    for (size_t i = count; i < N + GUARD; i++) fail |= d[i] != -7.0f;
+                    memcpy(d2, x, count * sizeof(mn_float32_t));
+                    compact_f[k](d2, &kept, d2, y, count, cmp);
+                    fail |= same("in place src1", d2, kept, want, m, sizeof(mn_float32_t), count, cmp);
+                    memcpy(d2, y, count * sizeof(mn_float32_t));
+                    compact_f[k](d2, &kept, x, d2, count, cmp);
+                    fail |= same("in place src2", d2, kept, want, m, sizeof(mn_float32_t), count, cmp);
+                    if (fail) printf("%s cmp=%d n=%zu failed\n", name, cmp, count);
+                }
+            }
+        }
+        fail |= compact_f[k](d, &(size_t){ 0 }, x, y, N, 6) != MN_ERROR;
+        fail |= compactc_f[k](d, &(size_t){ 0 }, x, 0.0f, N, -1) != MN_ERROR;
+    }
+    return fail;
+}
+
+static int check_int(void)
+{
+    static mn_int32_t x[N], y[N], want[N], d[N + GUARD], d2[N];
+    const mn_int32_t csts[2] = { 900, 0 };
+    char name[64];
+    int fail = 0;
+
+    for (size_t i = 0; i < N; i++) {
+        x[i] = (mn_int32_t)mn_test_uniform(-1000.0f, 1000.0f);
+        y[i] = (i % 13 == 2) ? x[i] : (mn_int32_t)mn_test_uniform(-1000.0f, 1000.0f);
+    }
+    x[0] = -2147483647 - 1;
+    x[1] = 2147483647;
+    x[2] = 0;
+    for (int k = 0; k < 2; k++) {
+        for (int cmp = MN_CMP_EQ; cmp <= MN_CMP_GE; cmp++) {
+            for (size_t c = 0; c < 2; c++) {
+                for (size_t n = 0; n <= 41 && !fail; n++) {
+                    const size_t count = n <= 40 ? n : N;
+                    size_t kept, m = 0;
+
+                    for (size_t i = 0; i < count; i++) {
+                        if (test_int(x[i], csts[c], cmp)) want[m++] = x[i];
+                    }
+                    for (size_t i = 0; i < N + GUARD; i++) d[i] = -7;
+                    snprintf(name, sizeof(name), "compactc_int32_%s", impl_names[k]);
+                    fail |= compactc_i[k](d, &kept, x, csts[c], count, cmp) != MN_SUCCESS;
+                    fail |= same(name, d, kept, want, m, sizeof(mn_int32_t), count, cmp);
+                    for (size_t i = count; i < N + GUARD; i++) fail |= d[i] != -7;
+                    memcpy(d2, x, count * sizeof(mn_int32_t));
+                    compactc_i[k](d2, &kept, d2, csts[c], count, cmp);
+                    fail |= same("in place", d2, kept, want, m, sizeof(mn_int32_t), count, cmp);
+
+                    m = 0;
+                    for (size_t i = 0; i < count; i++) {
+                        if (test_int(x[i], y[i], cmp)) want[m++] = x[i];
+                    }
+                    snprintf(name, sizeof(name), "compact_int32_%s", impl_names[k]);
+                    fail |= compact_i[k](d, &kept, x, y, count, cmp) != MN_SUCCESS;
+                    fail |= same(name, d, kept, want, m, sizeof(mn_int32_t), count, cmp);
+                    memcpy(d2, y, count * sizeof(mn_int32_t));
+                    compact_i[k](d2, &kept, x, d2, count, cmp);
+                    fail |= same("in place src2", d2, kept, want, m, sizeof(mn_int32_t), count, cmp);
+                    if (fail) printf("%s cmp=%d n=%zu failed\n", name, cmp, count);
+                }
+            }
+        }
+        fail |= compact_i[k](d, &(size_t){ 0 }, x, y, N, 6) != MN_ERROR;
+        fail |= compactc_i[k](d, &(size_t){ 0 }, x, 0, N, -1) != MN_ERROR;
+    }
+    return fail;
+}
+
+int main(void)
+{
+    int fail = 0;
+
+    mn_test_seed(31u);
+    fail |= check_float();
+    fail |= check_int();
+
+    if (fail) return 1;
+    printf("All compact tests passed\n");
+    return 0;
+}
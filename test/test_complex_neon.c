@@ -0,0 +1,137 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    Complex tests:
+      1. Known products ((1 + 2i) * (3 + 4i) = -5 + 10i, ...) through both versions.
+      2. NEON against C for counts around the 8 / 4 number blocks and a long
+         array, within a relative tolerance (NEON may fuse the cross terms).
+      3. In-place: dst == src1 (cmul, cconjmul), dst == src (cmulc, cabs, cmag2).
+*/
+
+#define MAX_COUNT 1003
+
+/* re / im of a product are differences of terms up to 200 in size */
+static int close_enough(mn_float32_t got, mn_float32_t ref)
+{
+    return fabsf(got - ref) <= 4e-6f * (fabsf(ref) + 200.0f);
+}
+
+static int check_known(void)
+{
+    mn_complexf_t a[1] = { { 1.0f, 2.0f } }, b[1] = { { 3.0f, 4.0f } }, d[1];
+    const mn_complexf_t c = { 0.0f, 1.0f };
+    mn_float32_t f[1];
+    int fail = 0;
+
+    for (int neon = 0; neon < 2; neon++) {
+        (neon ? mn_cmul_complexf_neon : mn_cmul_complexf_c)(d, a, b, 1);
+        fail |= d[0].re != -5.0f || d[0].im != 10.0f;
+        (neon ? mn_cconjmul_complexf_neon : mn_cconjmul_complexf_c)(d, a, b, 1);
+        fail |= d[0].re != 11.0f || d[0].im != 2.0f;
+        (neon ? mn_cmulc_complexf_neon : mn_cmulc_complexf_c)(d, a, &c, 1);
+        fail |= d[0].re != -2.0f || d[0].im != 1.0f;
+        (neon ? mn_cabs_complexf_neon : mn_cabs_complexf_c)(f, b, 1);
+        fail |= f[0] != 5.0f;
+        (neon ? mn_cmag2_complexf_neon : mn_cmag2_complexf_c)(f, b, 1);
+        fail |= f[0] != 25.0f;
+    }
+    if (fail) printf("complex known values failed\n");
+    return fail;
+}
+
+static int compare_complex(const char *name, size_t count, const mn_complexf_t *got, const mn_complexf_t *ref)
+{
+    for (size_t i = 0; i < count; i++) {
+        if (!close_enough(got[i].re, ref[i].re) || !close_enough(got[i].im, ref[i].im)) {
+            printf("%s count=%zu failed at %zu: NEON=(%f, %f), Reference=(%f, %f)\n",
+                   name, count, i, got[i].re, got[i].im, ref[i].re, ref[i].im);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int compare_float(const char *name, size_t count, const mn_float32_t *got, const mn_float32_t *ref)
+{
+    for (size_t i = 0; i < count; i++) {
+        if (!close_enough(got[i], ref[i])) {
+            printf("%s count=%zu failed at %zu: NEON=%f, Reference=%f\n", name, count, i, got[i], ref[i]);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int check_count(size_t count)
+{
+    static mn_complexf_t a[MAX_COUNT], b[MAX_COUNT], dn[MAX_COUNT], dc[MAX_COUNT], tmp[MAX_COUNT];
+    static mn_float32_t fn[MAX_COUNT], fc[MAX_COUNT];
+    const mn_complexf_t c = { mn_test_uniform(-10.0f, 10.0f), mn_test_uniform(-10.0f, 10.0f) };
+    int fail = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        a[i].re = mn_test_uniform(-10.0f, 10.0f); a[i].im = mn_test_uniform(-10.0f, 10.0f);
+        b[i].re = mn_test_uniform(-10.0f, 10.0f); b[i].im = mn_test_uniform(-10.0f, 10.0f);
+    }
+    /* a zero keeps the cabs zero lane honest */
+    if (count > 3) a[3].re = a[3].im = 0.0f;
+
+    mn_cmul_complexf_c(dc, a, b, count);
+    mn_cmul_complexf_neon(dn, a, b, count);
+    fail |= compare_complex("cmul", count, dn, dc);
+    memcpy(tmp, a, sizeof(a[0]) * count);
+    mn_cmul_complexf_neon(tmp, tmp, b, count);
+    fail |= compare_complex("cmul in-place", count, tmp, dc);
+
+    mn_cconjmul_complexf_c(dc, a, b, count);
+    mn_cconjmul_complexf_neon(dn, a, b, count);
+    fail |= compare_complex("cconjmul", count, dn, dc);
+    memcpy(tmp, a, sizeof(a[0]) * count);
+    mn_cconjmul_complexf_neon(tmp, tmp, b, count);
+    fail |= compare_complex("cconjmul in-place", count, tmp, dc);
+
+    mn_cmulc_complexf_c(dc, a, &c, count);
+    mn_cmulc_complexf_neon(dn, a, &c, count);
+    fail |= compare_complex("cmulc", count, dn, dc);
+    memcpy(tmp, a, sizeof(a[0]) * count);
+    mn_cmulc_complexf_neon(tmp, tmp, &c, count);
+    fail |= compare_complex("cmulc in-place", count, tmp, dc);
+
+    mn_cabs_complexf_c(fc, a, count);
+    mn_cabs_complexf_neon(fn, a, count);
+    fail |= compare_float("cabs", count, fn, fc);
+    memcpy(tmp, a, sizeof(a[0]) * count);
+    mn_cabs_complexf_neon((mn_float32_t *)tmp, tmp, count);
+    fail |= compare_float("cabs in-place", count, (mn_float32_t *)tmp, fc);
+
+    mn_cmag2_complexf_c(fc, a, count);
+    mn_cmag2_complexf_neon(fn, a, count);
+    fail |= compare_float("cmag2", count, fn, fc);
+
+    return fail;
+}
+
+int main(void)
+{
+    int fail = 0;
+
+    mn_test_seed(11u);
+    if (sizeof(mn_complexf_t) != sizeof(mn_vec2f_t)) {
+        printf("mn_complexf_t does not match the mn_vec2f_t layout\n");
+        return 1;
+    }
+    fail |= check_known();
+    for (size_t count = 0; count <= 20; count++) fail |= check_count(count);
+    fail |= check_count(MAX_COUNT);
+
+    if (fail) return 1;
+    printf("All complex tests passed\n");
+    return 0;
+}
@@ -0,0 +1,244 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    Type conversion tests:
+      1. Known values: rounding modes, saturation, NaN, scale/offset.
+      2. NEON vs C, bit exact, for every pair of types, every rounding mode,
+         with and without scale/offset, on a length with leftover elements.
+      3. float64 pairs: int32 values above 2^24 and the float64 mantissa
+         survive the scaling, out of range values saturate, NaN gives 0.
+*/
+
+#define COUNT 75
+
+static int failures = 0;
+
+#define EXPECT(name, got, want) \
+    do { \
+        if ((got) != (want)) { \
+            printf("%s failed: got %d, expected %d\n", name, (int)(got), (int)(want)); \
+            failures++; \
+        } \
+    } while (0)
+
+static void test_known(void)
+{
+    mn_float32_t src[8] = { 2.5f, -2.5f, 1.7f, -1.2f, 300.0f, -300.0f, 0.0f, 0.0f };
+    mn_int8_t d8[8];
+    mn_uint8_t du8[8];
+    mn_cvt_config_t cfg = { 1.0f, 0.0f, MN_ROUND_NEAREST };
+    const int modes[4] = { MN_ROUND_NEAREST, MN_ROUND_ZERO, MN_ROUND_DOWN, MN_ROUND_UP };
+    const mn_int8_t want[4][6] = {
+        { 2, -2, 2, -1, 127, -128 },
+        { 2, -2, 1, -1, 127, -128 },
+        { 2, -3, 1, -2, 127, -128 },
+        { 3, -2, 2, -1, 127, -128 },
+    };
+    src[6] = 0.0f / 0.0f;
+
+    for (int m = 0; m < 4; m++) {
+        cfg.round = modes[m];
+        mn_cvt_float_int8_neon(d8, src, &cfg, 7);
+        for (int i = 0; i < 6; i++) EXPECT("float->int8 rounding", d8[i], want[m][i]);
+        EXPECT("float->int8 NaN", d8[6], 0);
+    }
+
+    mn_cvt_float_uint8_neon(du8, src, NULL, 6);
+    EXPECT("float->uint8 saturate high", du8[4], 255);
+    EXPECT("float->uint8 saturate low", du8[5], 0);
+
+    /* Q15 int16 -> float -> int16 round trip */
+    mn_int16_t q[3] = { 16384, -32768, 32767 }, q2[3];
+    mn_float32_t f[3];
+    mn_cvt_config_t to_f = { 1.0f / 32768.0f, 0.0f, MN_ROUND_NEAREST };
+    mn_cvt_config_t to_q = { 32768.0f, 0.0f, MN_ROUND_NEAREST };
+    mn_cvt_int16_float_neon(f, q, &to_f, 3);
+    if (f[0] != 0.5f || f[1] != -1.0f) {
+        printf("int16->float Q15 scale failed: %f %f\n", f[0], f[1]);
+        failures++;
+    }
+    mn_cvt_float_int16_neon(q2, f, &to_q, 3);
+    for (int i = 0; i < 3; i++) EXPECT("float->int16 Q15 round trip", q2[i], q[i]);
+
+    /* uint8 pixels -> float in [-1, 1) with a fused scale and offset */
+    mn_uint8_t px[2] = { 0, 128 };
+    mn_cvt_config_t norm = { 1.0f / 128.0f, -1.0f, MN_ROUND_NEAREST };
+    mn_cvt_uint8_float_neon(f, px, &norm, 2);
+    if (f[0] != -1.0f || f[1] != 0.0f) {
+        printf("uint8->float scale/offset failed: %f %f\n", f[0], f[1]);
+        failures++;
+    }
+
+    /* int32 -> float16 -> int32 */
+    mn_int32_t iv[2] = { 1000, -70000 }, iv2[2];
+    mn_float16_t h[2];
+    mn_cvt_int32_float16_neon(h, iv, NULL, 2);
+    mn_cvt_float16_int32_neon(iv2, h, NULL, 2);
+    EXPECT("int32->float16->int32", iv2[0], 1000);
+    if (iv2[1] != -2147483647 - 1) {
+        /* -70000 overflows float16 to -inf, which saturates */
+        printf("int32->float16 overflow failed: %d\n", iv2[1]);
+        failures++;
+    }
+}
+
+static void test_known_float64(void)
+{
+    mn_int32_t iv[5] = { 16777217, -2147483647 - 1, 2147483647, 3, -5 }, iv2[5];
+    mn_float64_t d[5];
+    mn_float64_t dv[5] = { 2.5, 3e9, -3e9, 0.1, 0.0 };
+    mn_float32_t f[5];
+    mn_cvt_config_t half = { 0.5f, 0.0f, MN_ROUND_NEAREST };
+    dv[4] = 0.0 / 0.0;
+
+    for (int k = 0; k < 2; k++) {
+        (k ? mn_cvt_int32_float64_neon : mn_cvt_int32_float64_c)(d, iv, NULL, 5);
+        (k ? mn_cvt_float64_int32_neon : mn_cvt_float64_int32_c)(iv2, d, NULL, 5);
+        for (int i = 0; i < 5; i++) EXPECT("int32->float64->int32", iv2[i], iv[i]);
+
+        /* 16777217 * 0.5 is not a float32 value; rounding in float64 gives 8388608.5 -> 8388608 */
+        (k ? mn_cvt_int32_float64_neon : mn_cvt_int32_float64_c)(d, iv, &half, 1);
+        if (d[0] != 8388608.5) {
+            printf("int32->float64 scale lost precision: %f\n", d[0]);
+            failures++;
+        }
+
+        (k ? mn_cvt_float64_int32_neon : mn_cvt_float64_int32_c)(iv2, dv, NULL, 5);
+        EXPECT("float64->int32 half to even", iv2[0], 2);
+        EXPECT("float64->int32 saturate high", iv2[1], 2147483647);
+        EXPECT("float64->int32 saturate low", iv2[2], -2147483647 - 1);
+        EXPECT("float64->int32 NaN", iv2[4], 0);
+
+        (k ? mn_cvt_float64_float_neon : mn_cvt_float64_float_c)(f, dv, NULL, 4);
+        if (f[3] != 0.1f || f[1] != 3e9f) {
+            printf("float64->float rounding failed: %a %a\n", f[3], f[1]);
+            failures++;
+        }
+    }
+}
+
+/* source values: fsrc converted to the source type (float sources use fsrc as is) */
+#define FILL_float(s)        memcpy(s, fsrc, sizeof fsrc)
+#define FILL_OTHER(s, from)  mn_cvt_float_##from##_c(s, fsrc, NULL, COUNT)
+/* float64: fractions below the float32 precision, values past the int32 range and NaN */
+#define FILL_float64(s) \
+    do { \
+        for (int i = 0; i < COUNT; i++) s[i] = (mn_float64_t)fsrc[i] + (i % 7) * 0x1p-30; \
+        s[5] = 3e9; \
+        s[6] = -3e9; \
+        s[7] = 0.0 / 0.0; \
+    } while (0)
+
+#define CHECK_PAIR(from, FT, to, TT, FILL) \
+    do { \
+        FT s[COUNT]; \
+        TT dn[COUNT], dc[COUNT]; \
+        FILL; \
+        for (int c = 0; c < 5; c++) { \
+            const mn_cvt_config_t * cp = c == 4 ? NULL : &cfgs[c]; \
+            memset(dn, 0xa5, sizeof dn); \
+            memset(dc, 0x5a, sizeof dc); \
+            mn_cvt_##from##_##to##_neon(dn, s, cp, COUNT); \
+            mn_cvt_##from##_##to##_c(dc, s, cp, COUNT); \
+            if (memcmp(dn, dc, sizeof dn) != 0) { \
+                printf("mn_cvt_" #from "_" #to " NEON/C mismatch (config %d)\n", c); \
+                failures++; \
+            } \
+        } \
+    } while (0)
+
+static void test_pairs(void)
+{
+    mn_float32_t fsrc[COUNT];
+    const mn_cvt_config_t cfgs[4] = {
+        { 1.0f, 0.0f, MN_ROUND_NEAREST },
+        { 0.37f, 12.5f, MN_ROUND_ZERO },
+        { 3.0f, -0.5f, MN_ROUND_DOWN },
+        { -0.01f, 0.25f, MN_ROUND_UP },
+    };
+    for (int i = 0; i < COUNT; i++) fsrc[i] = mn_test_uniform(-80000.0f, 80000.0f);
+    fsrc[3] = 0.5f;
+    fsrc[4] = -1.5f;
+    fsrc[9] = -0.0f;
+
+    CHECK_PAIR(int8, mn_int8_t, uint8, mn_uint8_t, FILL_OTHER(s, int8));
+    CHECK_PAIR(int8, mn_int8_t, int16, mn_int16_t, FILL_OTHER(s, int8));
+    CHECK_PAIR(int8, mn_int8_t, uint16, mn_uint16_t, FILL_OTHER(s, int8));
+    CHECK_PAIR(int8, mn_int8_t, int32, mn_int32_t, FILL_OTHER(s, int8));
+    CHECK_PAIR(int8, mn_int8_t, float, mn_float32_t, FILL_OTHER(s, int8));
+    CHECK_PAIR(int8, mn_int8_t, float16, mn_float16_t, FILL_OTHER(s, int8));
+    CHECK_PAIR(int8, mn_int8_t, bfloat16, mn_bfloat16_t, FILL_OTHER(s, int8));
+    CHECK_PAIR(uint8, mn_uint8_t, int8, mn_int8_t, FILL_OTHER(s, uint8));
+    CHECK_PAIR(uint8, mn_uint8_t, int16, mn_int16_t, FILL_OTHER(s, uint8));
+    CHECK_PAIR(uint8, mn_uint8_t, uint16, mn_uint16_t, FILL_OTHER(s, uint8));
+    CHECK_PAIR(uint8, mn_uint8_t, int32, mn_int32_t, FILL_OTHER(s, uint8));
+    CHECK_PAIR(uint8, mn_uint8_t, float, mn_float32_t, FILL_OTHER(s, uint8));
+    CHECK_PAIR(uint8, mn_uint8_t, float16, mn_float16_t, FILL_OTHER(s, uint8));
+    CHECK_PAIR(uint8, mn_uint8_t, bfloat16, mn_bfloat16_t, FILL_OTHER(s, uint8));
+    CHECK_PAIR(int16, mn_int16_t, int8, mn_int8_t, FILL_OTHER(s, int16));
+    CHECK_PAIR(int16, mn_int16_t, uint8, mn_uint8_t, FILL_OTHER(s, int16));
+    CHECK_PAIR(int16, mn_int16_t, uint16, mn_uint16_t, FILL_OTHER(s, int16));
+    CHECK_PAIR(int16, mn_int16_t, int32, mn_int32_t, FILL_OTHER(s, int16));
+    CHECK_PAIR(int16, mn_int16_t, float, mn_float32_t, FILL_OTHER(s, int16));
+    CHECK_PAIR(int16, mn_int16_t, float16, mn_float16_t, FILL_OTHER(s, int16));
+    CHECK_PAIR(int16, mn_int16_t, bfloat16, mn_bfloat16_t, FILL_OTHER(s, int16));
+    CHECK_PAIR(uint16, mn_uint16_t, int8, mn_int8_t, FILL_OTHER(s, uint16));
+    CHECK_PAIR(uint16, mn_uint16_t, uint8, mn_uint8_t, FILL_OTHER(s, uint16));
+    CHECK_PAIR(uint16, mn_uint16_t, int16, mn_int16_t, FILL_OTHER(s, uint16));
+    CHECK_PAIR(uint16, mn_uint16_t, int32, mn_int32_t, FILL_OTHER(s, uint16));
+    CHECK_PAIR(uint16, mn_uint16_t, float, mn_float32_t, FILL_OTHER(s, uint16));
+    CHECK_PAIR(uint16, mn_uint16_t, float16, mn_float16_t, FILL_OTHER(s, uint16));
+    CHECK_PAIR(uint16, mn_uint16_t, bfloat16, mn_bfloat16_t, FILL_OTHER(s, uint16));
+    CHECK_PAIR(int32, mn_int32_t, int8, mn_int8_t, FILL_OTHER(s, int32));
+    CHECK_PAIR(int32, mn_int32_t, uint8, mn_uint8_t, FILL_OTHER(s, int32));
+    CHECK_PAIR(int32, mn_int32_t, int16, mn_int16_t, FILL_OTHER(s, int32));
+    CHECK_PAIR(int32, mn_int32_t, uint16, mn_uint16_t, FILL_OTHER(s, int32));
+    CHECK_PAIR(int32, mn_int32_t, float, mn_float32_t, FILL_OTHER(s, int32));
+    CHECK_PAIR(int32, mn_int32_t, float16, mn_float16_t, FILL_OTHER(s, int32));
+    CHECK_PAIR(int32, mn_int32_t, bfloat16, mn_bfloat16_t, FILL_OTHER(s, int32));
+    CHECK_PAIR(float, mn_float32_t, int8, mn_int8_t, FILL_float(s));
+    CHECK_PAIR(float, mn_float32_t, uint8, mn_uint8_t, FILL_float(s));
+    CHECK_PAIR(float, mn_float32_t, int16, mn_int16_t, FILL_float(s));
+    CHECK_PAIR(float, mn_float32_t, uint16, mn_uint16_t, FILL_float(s));
+    CHECK_PAIR(float, mn_float32_t, int32, mn_int32_t, FILL_float(s));
+    CHECK_PAIR(float, mn_float32_t, float16, mn_float16_t, FILL_float(s));
+    CHECK_PAIR(float, mn_float32_t, bfloat16, mn_bfloat16_t, FILL_float(s));
+    CHECK_PAIR(float16, mn_float16_t, int8, mn_int8_t, FILL_OTHER(s, float16));
+    CHECK_PAIR(float16, mn_float16_t, uint8, mn_uint8_t, FILL_OTHER(s, float16));
+    CHECK_PAIR(float16, mn_float16_t, int16, mn_int16_t, FILL_OTHER(s, float16));
+    CHECK_PAIR(float16, mn_float16_t, uint16, mn_uint16_t, FILL_OTHER(s, float16));
+    CHECK_PAIR(float16, mn_float16_t, int32, mn_int32_t, FILL_OTHER(s, float16));
+    CHECK_PAIR(float16, mn_float16_t, float, mn_float32_t, FILL_OTHER(s, float16));
+    CHECK_PAIR(float16, mn_float16_t, bfloat16, mn_bfloat16_t, FILL_OTHER(s, float16));
+    CHECK_PAIR(bfloat16, mn_bfloat16_t, int8, mn_int8_t, FILL_OTHER(s, bfloat16));
+    CHECK_PAIR(bfloat16, mn_bfloat16_t, uint8, mn_uint8_t, FILL_OTHER(s, bfloat16));
+    CHECK_PAIR(bfloat16, mn_bfloat16_t, int16, mn_int16_t, FILL_OTHER(s, bfloat16));
+    CHECK_PAIR(bfloat16, mn_bfloat16_t, uint16, mn_uint16_t, FILL_OTHER(s, bfloat16));
+    CHECK_PAIR(bfloat16, mn_bfloat16_t, int32, mn_int32_t, FILL_OTHER(s, bfloat16));
+    CHECK_PAIR(bfloat16, mn_bfloat16_t, float, mn_float32_t, FILL_OTHER(s, bfloat16));
+    CHECK_PAIR(bfloat16, mn_bfloat16_t, float16, mn_float16_t, FILL_OTHER(s, bfloat16));
+    CHECK_PAIR(int32, mn_int32_t, float64, mn_float64_t, FILL_OTHER(s, int32));
+    CHECK_PAIR(float, mn_float32_t, float64, mn_float64_t, FILL_float(s));
+    CHECK_PAIR(float64, mn_float64_t, int32, mn_int32_t, FILL_float64(s));
+    CHECK_PAIR(float64, mn_float64_t, float, mn_float32_t, FILL_float64(s));
+}
+
+int main(void)
+{
+    mn_test_seed(777u);
+    test_known();
+    test_known_float64();
+    test_pairs();
+    if (failures) {
+        printf("%d conversion test(s) failed\n", failures);
+        return 1;
+    }
+    printf("All conversion tests passed\n");
+    return 0;
+}
@@ -0,0 +1,234 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    exp / exp2 / log / log2 / pow tests:
+      1. The C versions give the libm results.
+      2. NEON against a double precision reference over sweeps and random
+         inputs, within the documented bound of each accuracy tier.
+      3. Special values (0, negative, subnormal, inf, NaN, overflow and
+         underflow) match libm.
+      4. Counts 0 .. 40 and in-place calls give the same values as one long call.
+      5. Unknown accuracy values return MN_ERROR.
+*/
+
+#define N 4099
+
+typedef mn_result_t (*unary_fn)(mn_float32_t *, mn_float32_t *, size_t, int);
+typedef mn_result_t (*binary_fn)(mn_float32_t *, mn_float32_t *, mn_float32_t *, size_t, int);
+
+static const char *tier_name[3] = { "precise", "fast", "ultra" };
+
+/* error of got in units of the last place of the float nearest to ref */
+static double rel_error(mn_float32_t got, double ref)
+{
+    if (isnan(ref)) return isnan(got) ? 0.0 : 1e30;
+    if (isinf((float)ref) || (float)ref == 0.0f) return got == (float)ref ? 0.0 : 1e30;
+    /* results in the subnormal range only keep their absolute precision */
+    return fabs((double)got - ref) / fmax(fabs(ref), 1e-37);
+}
+
+static double ref_exp(double x) { return exp(x); }
+static double ref_exp2(double x) { return exp2(x); }
+static double ref_log(double x) { return log(x); }
+static double ref_log2(double x) { return log2(x); }
+
+typedef struct
+{
+    const char *name;
+    unary_fn c, neon;
+    float (*libm)(float);
+    double (*ref)(double);
+    mn_float32_t lo, hi;
+    double ulp[2];   /* precise, fast */
+} unary_case_t;
+
+static const unary_case_t unary_cases[] = {
+    { "exp",  mn_exp_float_c,  mn_exp_float_neon,  expf,  ref_exp,  -110.0f, 95.0f,  { 1.5, 3.0 } },
+    { "exp2", mn_exp2_float_c, mn_exp2_float_neon, exp2f, ref_exp2, -160.0f, 135.0f, { 1.5, 3.0 } },
+    { "log",  mn_log_float_c,  mn_log_float_neon,  logf,  ref_log,  1e-30f,  1e30f,  { 1.5, 4.5 } },
+    { "log2", mn_log2_float_c, mn_log2_float_neon, log2f, ref_log2, 1e-30f,  1e30f,  { 2.0, 4.5 } },
+};
+
+static void fill_unary(const unary_case_t *uc, mn_float32_t *x)
+{
+    for (size_t i = 0; i < N; i++) {
+        if (uc->lo > 0.0f) {
+            /* log: spread over the exponents, then a dense sweep around 1 */
+            x[i] = i < N / 2 ? expf(mn_test_uniform(logf(uc->lo), logf(uc->hi))) : mn_test_uniform(0.5f, 2.0f);
+        } else {
+            x[i] = i < N / 2 ? mn_test_uniform(uc->lo, uc->hi) : mn_test_uniform(-1.0f, 1.0f);
+        }
+    }
+}
+
+static int check_unary(const unary_case_t *uc)
+{
+    static mn_float32_t x[N], yc[N], yn[N], y2[N];
+    int fail = 0;
+
+    fill_unary(uc, x);
+    for (int tier = 0; tier < 3; tier++) {
+        double worst = 0.0;
+        size_t at = 0;
+        fail |= uc->c(yc, x, N, tier) != MN_SUCCESS;
+        fail |= uc->neon(yn, x, N, tier) != MN_SUCCESS;
+        for (size_t i = 0; i < N; i++) {
+            if (memcmp(&yc[i], &(mn_float32_t){ uc->libm(x[i]) }, sizeof(mn_float32_t)) != 0) {
+                printf("%s_c differs from libm at %g\n", uc->name, x[i]);
+                return 1;
+            }
+            const double ref = uc->ref(x[i]);
+            const double err = tier < 2 ? mn_test_ulp_error(yn[i], ref) : rel_error(yn[i], ref);
+            if (err > worst) { worst = err; at = i; }
+        }
+        if (worst > (tier < 2 ? uc->ulp[tier] : 1e-3)) {
+            printf("%s %s failed at %a: NEON=%a, Reference=%a (error %g)\n", uc->name, tier_name[tier],
+                   x[at], yn[at], uc->ref(x[at]), worst);
+            fail = 1;
+        }
+
+        /* short counts and in place give the same values as the long call */
+        for (size_t count = 0; count <= 40; count++) {
+            memcpy(y2, x + 7, count * sizeof(mn_float32_t));
+            uc->neon(y2, y2, count, tier);
+            if (count && memcmp(y2, yn + 7, count * sizeof(mn_float32_t)) != 0) {
+                printf("%s %s count=%zu in-place differs from the long call\n", uc->name, tier_name[tier], count);
+                fail = 1;
+                break;
+            }
+        }
+    }
+    fail |= uc->neon(yn, x, 4, 3) != MN_ERROR;
+    fail |= uc->c(yn, x, 4, -1) != MN_ERROR;
+    return fail;
+}
+
+static int check_unary_special(const unary_case_t *uc)
+{
+    const mn_float32_t sp[] = {
+        0.0f, -0.0f, 1.0f, -1.0f, INFINITY, -INFINITY, NAN, 1e-40f, 1.17549435e-38f, 3.4e38f,
+        88.72283f, 88.7229f, -87.3365f, -103.9f, -104.0f, -150.0f, 128.0f, -149.0f, 127.99999f, 1e-7f, -1e-7f,
+        0.999999f, 1.0000001f, 4.0f / 3.0f,
+    };
+    const size_t n = sizeof(sp) / sizeof(sp[0]);
+    mn_float32_t x[32], y[32];
+    int fail = 0;
+
+    memcpy(x, sp, sizeof(sp));
+    for (int tier = 0; tier < 3; tier++) {
+        uc->neon(y, x, n, tier);
+        for (size_t i = 0; i < n; i++) {
+            const mn_float32_t want = uc->libm(x[i]);
+            int ok;
+            if (isnan(want) || isinf(want) || want == 0.0f) {
+                ok = isnan(want) ? isnan(y[i]) : y[i] == want;
+            } else {
+                const double ref = uc->ref(x[i]);
+                ok = tier < 2 ? mn_test_ulp_error(y[i], ref) <= uc->ulp[tier] : rel_error(y[i], ref) <= 1e-3;
+                /* results deep in the subnormals keep only a few bits */
+                ok |= fabsf(want) < 1e-37f && fabs(y[i] - ref) <= 1e-3 * 1.17549435e-38;
+            }
+            if (!ok) {
+                printf("%s %s special %a: NEON=%a, libm=%a\n", uc->name, tier_name[tier], x[i], y[i], want);
+                fail = 1;
+            }
+        }
+    }
+    return fail;
+}
+
+static int check_pow(void)
+{
+    static mn_float32_t x[N], e[N], yc[N], yn[N], y2[N];
+    int fail = 0;
+
+    for (size_t i = 0; i < N; i++) {
+        x[i] = i % 2 ? mn_test_uniform(0.0f, 4.0f) : expf(mn_test_uniform(-20.0f, 20.0f));
+        e[i] = i % 3 ? mn_test_uniform(-4.0f, 4.0f) : mn_test_uniform(-30.0f, 30.0f);
+    }
+    for (int tier = 0; tier < 3; tier++) {
+        double worst = 0.0;
+        size_t at = 0;
+        fail |= mn_pow_float_c(yc, x, e, N, tier) != MN_SUCCESS;
+        fail |= mn_pow_float_neon(yn, x, e, N, tier) != MN_SUCCESS;
+        for (size_t i = 0; i < N; i++) {
+            const double ref = pow((double)x[i], (double)e[i]);
+            /* the float tiers lose accuracy in y * log2(x) in proportion to its size */
+            const double t = fabs((double)e[i] * log2((double)x[i]));
+            double err;
+            if (yc[i] != powf(x[i], e[i])) {
+                printf("pow_c differs from libm at %a ^ %a\n", x[i], e[i]);
+                return 1;
+            }
+            /* error over the tier's bound, above 1 fails */
+            if (tier == 0) err = mn_test_ulp_error(yn[i], ref);
+            else if (tier == 1) err = mn_test_ulp_error(yn[i], ref) / (4.0 + 2.0 * t);
+            else err = rel_error(yn[i], ref) / (1e-3 + 4e-4 * t);
+            if (err > 1.0 && err > worst) { worst = err; at = i; }
+        }
+        if (worst > 0.0) {
+            printf("pow %s failed at %a ^ %a: NEON=%a, Reference=%a\n", tier_name[tier], x[at], e[at], yn[at],
+                   pow((double)x[at], (double)e[at]));
+            fail = 1;
+        }
+        for (size_t count = 0; count <= 40; count++) {
+            memcpy(y2, e + 5, count * sizeof(mn_float32_t));
+            mn_pow_float_neon(y2, x + 5, y2, count, tier);
+            if (count && memcmp(y2, yn + 5, count * sizeof(mn_float32_t)) != 0) {
+                printf("pow %s count=%zu in-place differs from the long call\n", tier_name[tier], count);
+                fail = 1;
+                break;
+            }
+        }
+    }
+    fail |= mn_pow_float_neon(yn, x, e, 4, 7) != MN_ERROR;
+    return fail;
+}
+
+static int check_pow_special(void)
+{
+    const mn_float32_t sx[] = { -2.0f, -2.0f, 0.0f, -0.0f, 0.0f, 1.0f, NAN, 2.0f, INFINITY, -INFINITY, 0.5f, 2.0f, 1e-40f, 2.0f, 3.0f, -8.0f };
+    const mn_float32_t sy[] = { 3.0f, 0.5f, -1.0f, -3.0f, 2.0f, NAN, 0.0f, INFINITY, -0.5f, 3.0f, -INFINITY, 200.0f, 0.5f, -200.0f, 0.0f, 1.0f / 3.0f };
+    const size_t n = sizeof(sx) / sizeof(sx[0]);
+    mn_float32_t y[16];
+    int fail = 0;
+
+    for (int tier = 0; tier < 3; tier++) {
+        mn_pow_float_neon(y, (mn_float32_t *)sx, (mn_float32_t *)sy, n, tier);
+        for (size_t i = 0; i < n; i++) {
+            const mn_float32_t want = powf(sx[i], sy[i]);
+            const int ok = isnan(want) ? isnan(y[i])
+                         : (isinf(want) || want == 0.0f) ? y[i] == want
+                         : rel_error(y[i], pow((double)sx[i], (double)sy[i])) <= (tier == 2 ? 2e-3 : 1e-6);
+            if (!ok) {
+                printf("pow %s special %a ^ %a: NEON=%a, libm=%a\n", tier_name[tier], sx[i], sy[i], y[i], want);
+                fail = 1;
+            }
+        }
+    }
+    return fail;
+}
+
+int main(void)
+{
+    int fail = 0;
+
+    mn_test_seed(3u);
+    for (size_t i = 0; i < sizeof(unary_cases) / sizeof(unary_cases[0]); i++) {
+        fail |= check_unary(&unary_cases[i]);
+        fail |= check_unary_special(&unary_cases[i]);
+    }
+    fail |= check_pow();
+    fail |= check_pow_special();
+
+    if (fail) return 1;
+    printf("All exp / log / pow tests passed\n");
+    return 0;
+}
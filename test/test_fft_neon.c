@@ -0,0 +1,181 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    FFT tests:
+      1. Complex forward (C and NEON) against a double precision DFT for
+         power-of-two and mixed 2 / 3 / 5 lengths, then inverse back to the input.
+      2. Batches of 3 transforms, out of place and in place.
+      3. Real forward against the double DFT (n / 2 + 1 values) and the
+         real inverse back to the samples.
+      4. Unsupported lengths and plan / call mismatches return MN_ERROR.
+*/
+
+#define BATCH 3
+
+static void dft_reference(double *re, double *im, const mn_complexf_t *x, size_t n)
+{
+    for (size_t k = 0; k < n; k++) {
+        double sr = 0.0, si = 0.0;
+        for (size_t j = 0; j < n; j++) {
+            const double a = -2.0 * 3.14159265358979323846 * (double)((j * k) % n) / (double)n;
+            sr += x[j].re * cos(a) - x[j].im * sin(a);
+            si += x[j].re * sin(a) + x[j].im * cos(a);
+        }
+        re[k] = sr;
+        im[k] = si;
+    }
+}
+
+/* float error grows with log2(n) stages, each over ~sqrt(n) sized values */
+static double tolerance(size_t n)
+{
+    return 2e-6 * sqrt((double)n) * (log2((double)n) + 1.0);
+}
+
+static int check_close(const char *what, size_t n, size_t i, double got_re, double got_im, double re, double im, double tol)
+{
+    if (fabs(got_re - re) > tol || fabs(got_im - im) > tol) {
+        printf("%s n=%zu failed at %zu: got (%f, %f), Reference=(%f, %f)\n", what, n, i, got_re, got_im, re, im);
+        return 1;
+    }
+    return 0;
+}
+
+static int test_complex(size_t n)
+{
+    mn_complexf_t *x = (mn_complexf_t *)malloc(sizeof(mn_complexf_t) * n * BATCH);
+    mn_complexf_t *y = (mn_complexf_t *)malloc(sizeof(mn_complexf_t) * n * BATCH);
+    mn_complexf_t *z = (mn_complexf_t *)malloc(sizeof(mn_complexf_t) * n * BATCH);
+    double *re = (double *)malloc(sizeof(double) * n * BATCH);
+    double *im = (double *)malloc(sizeof(double) * n * BATCH);
+    const double tol = tolerance(n);
+    mn_fft_plan_t plan;
+    int fail = 0;
+
+    if (!x || !y || !z || !re || !im || mn_fft_plan_complex(&plan, n) != MN_SUCCESS) {
+        printf("fft setup n=%zu failed\n", n);
+        exit(1);
+    }
+    for (size_t i = 0; i < n * BATCH; i++) { x[i].re = mn_test_uniform(-1.0f, 1.0f); x[i].im = mn_test_uniform(-1.0f, 1.0f); }
+    for (size_t b = 0; b < BATCH; b++) dft_reference(re + b * n, im + b * n, x + b * n, n);
+
+    for (int neon = 0; neon < 2 && !fail; neon++) {
+        const char *name = neon ? "fft NEON" : "fft C";
+        mn_result_t ok = neon ? mn_fft_forward_neon(&plan, y, x, BATCH) : mn_fft_forward_c(&plan, y, x, BATCH);
+        for (size_t i = 0; i < n * BATCH && !fail; i++)
+            fail |= check_close(name, n, i, y[i].re, y[i].im, re[i], im[i], tol);
+
+        /* in place, then back with the inverse (also in place) */
+        memcpy(z, x, sizeof(mn_complexf_t) * n * BATCH);
+        ok |= neon ? mn_fft_forward_neon(&plan, z, z, BATCH) : mn_fft_forward_c(&plan, z, z, BATCH);
+        for (size_t i = 0; i < n * BATCH && !fail; i++)
+            fail |= check_close(name, n, i, z[i].re, z[i].im, re[i], im[i], tol);
+        ok |= neon ? mn_fft_inverse_neon(&plan, z, z, BATCH) : mn_fft_inverse_c(&plan, z, z, BATCH);
+        for (size_t i = 0; i < n * BATCH && !fail; i++)
+            fail |= check_close(neon ? "ifft NEON" : "ifft C", n, i, z[i].re, z[i].im, x[i].re, x[i].im, tol / sqrt((double)n));
+        ok |= neon ? mn_fft_inverse_neon(&plan, z, y, BATCH) : mn_fft_inverse_c(&plan, z, y, BATCH);
+        for (size_t i = 0; i < n * BATCH && !fail; i++)
+            fail |= check_close(neon ? "ifft NEON" : "ifft C", n, i, z[i].re, z[i].im, x[i].re, x[i].im, tol / sqrt((double)n));
+        if (ok != MN_SUCCESS) {
+            printf("%s n=%zu returned an error\n", name, n);
+            fail = 1;
+        }
+    }
+
+    mn_fft_plan_free(&plan);
+    free(x); free(y); free(z); free(re); free(im);
+    return fail;
+}
+
+static int test_real(size_t n)
+{
+    const size_t h = n / 2 + 1;
+    mn_float32_t *x = (mn_float32_t *)malloc(sizeof(mn_float32_t) * n * BATCH);
+    mn_float32_t *xb = (mn_float32_t *)malloc(sizeof(mn_float32_t) * n * BATCH);
+    mn_complexf_t *xc = (mn_complexf_t *)malloc(sizeof(mn_complexf_t) * n);
+    mn_complexf_t *y = (mn_complexf_t *)malloc(sizeof(mn_complexf_t) * h * BATCH);
+    double *re = (double *)malloc(sizeof(double) * n * BATCH);
+    double *im = (double *)malloc(sizeof(double) * n * BATCH);
+    const double tol = tolerance(n);
+    mn_fft_plan_t plan;
+    int fail = 0;
+
+    if (!x || !xb || !xc || !y || !re || !im || mn_fft_plan_real(&plan, n) != MN_SUCCESS) {
+        printf("rfft setup n=%zu failed\n", n);
+        exit(1);
+    }
+    for (size_t i = 0; i < n * BATCH; i++) x[i] = mn_test_uniform(-1.0f, 1.0f);
+    for (size_t b = 0; b < BATCH; b++) {
+        for (size_t i = 0; i < n; i++) { xc[i].re = x[b * n + i]; xc[i].im = 0.0f; }
+        dft_reference(re + b * n, im + b * n, xc, n);
+    }
+
+    for (int neon = 0; neon < 2 && !fail; neon++) {
+        mn_result_t ok = neon ? mn_rfft_forward_neon(&plan, y, x, BATCH) : mn_rfft_forward_c(&plan, y, x, BATCH);
+        for (size_t b = 0; b < BATCH && !fail; b++)
+            for (size_t k = 0; k < h && !fail; k++)
+                fail |= check_close(neon ? "rfft NEON" : "rfft C", n, k, y[b * h + k].re, y[b * h + k].im,
+                                    re[b * n + k], im[b * n + k], tol);
+        ok |= neon ? mn_rfft_inverse_neon(&plan, xb, y, BATCH) : mn_rfft_inverse_c(&plan, xb, y, BATCH);
+        for (size_t i = 0; i < n * BATCH && !fail; i++)
+            fail |= check_close(neon ? "irfft NEON" : "irfft C", n, i, xb[i], 0.0, x[i], 0.0, tol / sqrt((double)n));
+        if (ok != MN_SUCCESS) {
+            printf("rfft n=%zu returned an error\n", n);
+            fail = 1;
+        }
+    }
+
+    mn_fft_plan_free(&plan);
+    free(x); free(xb); free(xc); free(y); free(re); free(im);
+    return fail;
+}
+
+static int test_errors(void)
+{
+    mn_fft_plan_t plan;
+    mn_complexf_t c[8];
+    mn_float32_t f[8] = { 0 };
+    int fail = 0;
+
+    fail |= mn_fft_plan_complex(&plan, 7) != MN_ERROR;
+    fail |= mn_fft_plan_complex(&plan, 0) != MN_ERROR;
+    fail |= mn_fft_plan_real(&plan, 6 * 7) != MN_ERROR;
+    fail |= mn_fft_plan_real(&plan, 9) != MN_ERROR;
+    mn_fft_plan_free(&plan);
+
+    if (mn_fft_plan_real(&plan, 8) != MN_SUCCESS) return 1;
+    fail |= mn_fft_forward_neon(&plan, c, c, 1) != MN_ERROR;
+    mn_fft_plan_free(&plan);
+    if (mn_fft_plan_complex(&plan, 8) != MN_SUCCESS) return 1;
+    fail |= mn_rfft_forward_c(&plan, c, f, 1) != MN_ERROR;
+    mn_fft_plan_free(&plan);
+
+    if (fail) printf("fft error cases failed\n");
+    return fail;
+}
+
+int main(void)
+{
+    static const size_t complex_n[] = {
+        1, 2, 3, 4, 5, 6, 8, 9, 12, 15, 16, 20, 25, 30, 32, 48, 60, 64, 80, 96, 100,
+        128, 240, 256, 512, 1000, 1024, 1536, 2048,
+    };
+    static const size_t real_n[] = { 2, 4, 6, 8, 10, 16, 24, 32, 40, 64, 120, 256, 1024, 2000 };
+    int fail = 0;
+
+    mn_test_seed(5u);
+    for (size_t i = 0; i < sizeof(complex_n) / sizeof(complex_n[0]); i++) fail |= test_complex(complex_n[i]);
+    for (size_t i = 0; i < sizeof(real_n) / sizeof(real_n[0]); i++) fail |= test_real(real_n[i]);
+    fail |= test_errors();
+
+    if (fail) return 1;
+    printf("All fft tests passed\n");
+    return 0;
+}
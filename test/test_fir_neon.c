@@ -0,0 +1,187 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    FIR / conv1d tests:
+      1. conv1d NEON against C for tap counts around the 4-tap and
+         16 / 8 output blocks (int16 bit exact, float within a tolerance).
+      2. Streaming: a signal fed to mn_fir_* in uneven chunks gives the same
+         output as one valid-mode convolution over the zero-padded signal.
+      3. Decimation by 2, 3 and 5 keeps outputs D - 1, 2D - 1, ... of the
+         full-rate filter, also across chunks.
+      4. int16 saturation and the MN_ERROR cases.
+*/
+
+#define MAX_LEN 1600
+#define MAX_TAPS 40
+
+static int close_enough(mn_float32_t got, mn_float32_t ref, size_t taps)
+{
+    return fabsf(got - ref) <= 1e-6f * (mn_float32_t)(taps + 4);
+}
+
+static int test_conv1d(void)
+{
+    static const size_t taps_list[] = { 1, 2, 3, 4, 5, 7, 8, 9, 16, 17, 31, 40 };
+    static mn_float32_t xf[MAX_LEN], hf[MAX_TAPS], yf_c[MAX_LEN], yf_n[MAX_LEN];
+    static mn_int16_t xi[MAX_LEN], hi[MAX_TAPS], yi_c[MAX_LEN], yi_n[MAX_LEN];
+    int fail = 0;
+
+    for (size_t t = 0; t < sizeof(taps_list) / sizeof(taps_list[0]); t++) {
+        const size_t taps = taps_list[t];
+        for (size_t count = taps; count < taps + 40; count += 3) {
+            for (size_t i = 0; i < count; i++) { xf[i] = mn_test_uniform(-1.0f, 1.0f); xi[i] = (mn_int16_t)mn_test_bits(); }
+            for (size_t k = 0; k < taps; k++) { hf[k] = mn_test_uniform(-1.0f, 1.0f); hi[k] = (mn_int16_t)((mn_int16_t)mn_test_bits() / 4); }
+            const size_t n = count - taps + 1;
+
+            mn_conv1d_float_c(yf_c, xf, count, hf, taps);
+            mn_conv1d_float_neon(yf_n, xf, count, hf, taps);
+            mn_conv1d_int16_c(yi_c, xi, count, hi, taps);
+            mn_conv1d_int16_neon(yi_n, xi, count, hi, taps);
+            for (size_t i = 0; i < n; i++) {
+                if (!close_enough(yf_n[i], yf_c[i], taps)) {
+                    printf("conv1d float taps=%zu count=%zu failed at %zu: NEON=%f, Reference=%f\n",
+                           taps, count, i, yf_n[i], yf_c[i]);
+                    fail = 1;
+                    break;
+                }
+                if (yi_n[i] != yi_c[i]) {
+                    printf("conv1d int16 taps=%zu count=%zu failed at %zu: NEON=%d, Reference=%d\n",
+                           taps, count, i, yi_n[i], yi_c[i]);
+                    fail = 1;
+                    break;
+                }
+            }
+        }
+    }
+    return fail;
+}
+
+/* Full-rate reference: zero history, then valid-mode convolution */
+static void reference_float(mn_float32_t *y, const mn_float32_t *x, size_t len, const mn_float32_t *h, size_t taps)
+{
+    static mn_float32_t padded[MAX_TAPS + MAX_LEN];
+    memset(padded, 0, sizeof(padded));
+    memcpy(padded + taps - 1, x, len * sizeof(*x));
+    mn_conv1d_float_c(y, padded, len + taps - 1, h, taps);
+}
+
+static void reference_int16(mn_int16_t *y, const mn_int16_t *x, size_t len, const mn_int16_t *h, size_t taps)
+{
+    static mn_int16_t padded[MAX_TAPS + MAX_LEN];
+    memset(padded, 0, sizeof(padded));
+    memcpy(padded + taps - 1, x, len * sizeof(*x));
+    mn_conv1d_int16_c(y, padded, len + taps - 1, h, taps);
+}
+
+static int test_stream(size_t taps, size_t dec, int use_neon)
+{
+    /* chunk sizes in units of dec: smaller and larger than the delay line */
+    static const size_t chunks[] = { 1, 2, 5, 0, 17, 3, 64, 1, 9, 200 };
+    static mn_float32_t xf[MAX_LEN], hf[MAX_TAPS], yf[MAX_LEN], rf[MAX_LEN];
+    static mn_int16_t xi[MAX_LEN], hi[MAX_TAPS], yi[MAX_LEN], ri[MAX_LEN];
+    mn_fir_float_t ff;
+    mn_fir_int16_t fi;
+    size_t len = 0, out = 0;
+    int fail = 0;
+
+    for (size_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) len += chunks[c] * dec;
+    for (size_t i = 0; i < len; i++) { xf[i] = mn_test_uniform(-1.0f, 1.0f); xi[i] = (mn_int16_t)mn_test_bits(); }
+    for (size_t k = 0; k < taps; k++) { hf[k] = mn_test_uniform(-1.0f, 1.0f); hi[k] = (mn_int16_t)((mn_int16_t)mn_test_bits() / 4); }
+    reference_float(rf, xf, len, hf, taps);
+    reference_int16(ri, xi, len, hi, taps);
+
+    if (mn_fir_init_float(&ff, hf, taps, dec) != MN_SUCCESS || mn_fir_init_int16(&fi, hi, taps, dec) != MN_SUCCESS) {
+        printf("fir init taps=%zu dec=%zu failed\n", taps, dec);
+        return 1;
+    }
+    for (size_t c = 0, pos = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) {
+        const size_t n = chunks[c] * dec;
+        mn_result_t rf_ok = use_neon ? mn_fir_float_neon(&ff, yf + out, xf + pos, n) : mn_fir_float_c(&ff, yf + out, xf + pos, n);
+        mn_result_t ri_ok = use_neon ? mn_fir_int16_neon(&fi, yi + out, xi + pos, n) : mn_fir_int16_c(&fi, yi + out, xi + pos, n);
+        if (rf_ok != MN_SUCCESS || ri_ok != MN_SUCCESS) {
+            printf("fir taps=%zu dec=%zu returned an error\n", taps, dec);
+            fail = 1;
+        }
+        pos += n;
+        out += chunks[c];
+    }
+    for (size_t m = 0; m < out && !fail; m++) {
+        const size_t n = m * dec + dec - 1;
+        if (!close_enough(yf[m], rf[n], taps)) {
+            printf("fir float %s taps=%zu dec=%zu failed at %zu: got %f, Reference=%f\n",
+                   use_neon ? "NEON" : "C", taps, dec, m, yf[m], rf[n]);
+            fail = 1;
+        }
+        if (yi[m] != ri[n]) {
+            printf("fir int16 %s taps=%zu dec=%zu failed at %zu: got %d, Reference=%d\n",
+                   use_neon ? "NEON" : "C", taps, dec, m, yi[m], ri[n]);
+            fail = 1;
+        }
+    }
+    mn_fir_free_float(&ff);
+    mn_fir_free_int16(&fi);
+    return fail;
+}
+
+static int test_saturation_and_errors(void)
+{
+    static const mn_int16_t h[3] = { 32767, 32767, 32767 };
+    mn_int16_t x[20], y[20];
+    mn_fir_int16_t fi;
+    mn_fir_float_t ff;
+    mn_float32_t hf = 1.0f, xf[4] = { 0 }, yf[4];
+    int fail = 0;
+
+    /* 3 * 32767 * +-32767 / 2^15 is out of range: outputs 0-7 clamp high, 10-17 low */
+    for (int i = 0; i < 20; i++) x[i] = i < 10 ? INT16_MAX : INT16_MIN;
+    mn_conv1d_int16_neon(y, x, 20, h, 3);
+    for (int i = 0; i < 18; i++) {
+        if ((i < 8 && y[i] != INT16_MAX) || (i >= 10 && y[i] != INT16_MIN)) {
+            printf("int16 saturation failed at %d: %d\n", i, y[i]);
+            fail = 1;
+        }
+    }
+
+    if (mn_fir_init_float(&ff, &hf, 0, 1) != MN_ERROR || mn_fir_init_float(&ff, &hf, 1, 0) != MN_ERROR) {
+        printf("fir init accepted zero taps / decimation\n");
+        fail = 1;
+    }
+    if (mn_conv1d_float_neon(yf, xf, 4, &hf, 0) != MN_ERROR || mn_conv1d_int16_c(y, x, 4, h, 0) != MN_ERROR) {
+        printf("conv1d accepted zero taps\n");
+        fail = 1;
+    }
+    if (mn_fir_init_int16(&fi, h, 3, 4) != MN_SUCCESS || mn_fir_int16_neon(&fi, y, x, 6) != MN_ERROR) {
+        printf("fir accepted a count that is not a multiple of the decimation\n");
+        fail = 1;
+    }
+    mn_fir_free_int16(&fi);
+    return fail;
+}
+
+int main(void)
+{
+    static const size_t taps_list[] = { 1, 2, 4, 5, 12, 33, 40 };
+    static const size_t dec_list[] = { 1, 2, 3, 5 };
+    int fail = 0;
+
+    mn_test_seed(7u);
+    fail |= test_conv1d();
+    for (size_t t = 0; t < sizeof(taps_list) / sizeof(taps_list[0]); t++) {
+        for (size_t d = 0; d < sizeof(dec_list) / sizeof(dec_list[0]); d++) {
+            fail |= test_stream(taps_list[t], dec_list[d], 0);
+            fail |= test_stream(taps_list[t], dec_list[d], 1);
+        }
+    }
+    fail |= test_saturation_and_errors();
+
+    if (fail) return 1;
+    printf("All fir tests passed\n");
+    return 0;
+}
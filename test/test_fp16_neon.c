@@ -0,0 +1,139 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    float16 tests:
+      1. Scalar conversions: round trip of every half and known rounding cases.
+      2. NEON vs C for add/sub/mul/addc/mulc/abs on random finite halves and
+         fma on values where every result is exact, for float16 and vec2h-vec4h.
+    The count is not a multiple of 8 so the leftover path runs too.
+*/
+
+#define COUNT 37
+#define HALVES (COUNT * 4)
+
+static mn_float16_t random_half(void)
+{
+    mn_float16_t h = (mn_float16_t)mn_test_bits();
+    if (((h >> 10) & 0x1f) == 0x1f) {
+        h &= (mn_float16_t)~0x4000u;   /* keep it finite */
+    }
+    return h;
+}
+
+static int check(const char* name, const mn_float16_t* got, const mn_float16_t* ref, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        if (got[i] != ref[i]) {
+            printf("%s failed at %zu: NEON=0x%04x, Reference=0x%04x\n", name, i, got[i], ref[i]);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int test_conversions(void)
+{
+    struct { float f; mn_float16_t h; } cases[] = {
+        { 1.0f, 0x3c00 }, { -2.0f, 0xc000 }, { 65504.0f, 0x7bff },
+        { 65519.0f, 0x7bff }, { 65520.0f, 0x7c00 },             /* overflow threshold */
+        { 1.0f + 1.0f / 2048.0f, 0x3c00 },                      /* tie, rounds to even */
+        { 1.0f + 3.0f / 2048.0f, 0x3c02 },                      /* tie, rounds up to even */
+        { 5.9604644775390625e-8f, 0x0001 },                     /* 2^-24, smallest subnormal */
+        { 2.98023223876953125e-8f, 0x0000 },                    /* 2^-25, tie to zero */
+        { 2.9802326e-8f, 0x0001 },                              /* just above 2^-25 */
+        { 6.103515625e-5f, 0x0400 },                            /* 2^-14, smallest normal */
+        { -0.0f, 0x8000 },
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        mn_float16_t h = mn_f32_to_f16(cases[i].f);
+        if (h != cases[i].h) {
+            printf("mn_f32_to_f16(%.10g) = 0x%04x, expected 0x%04x\n", cases[i].f, h, cases[i].h);
+            return 1;
+        }
+    }
+
+    for (uint32_t bits = 0; bits <= 0xffff; bits++) {
+        mn_float16_t h = (mn_float16_t)bits;
+        mn_float32_t f = mn_f16_to_f32(h);
+        mn_float16_t back = mn_f32_to_f16(f);
+        int is_nan = ((h >> 10) & 0x1f) == 0x1f && (h & 0x3ff) != 0;
+        if (is_nan ? (f == f || ((back >> 10) & 0x1f) != 0x1f || (back & 0x3ff) == 0) : back != h) {
+            printf("Round trip failed for 0x%04x (got 0x%04x)\n", h, back);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(void)
+{
+    int failed = 0;
+    mn_float16_t a[HALVES], b[HALVES], c[HALVES], ref[HALVES], dst[HALVES];
+    mn_float16_t ea[HALVES], eb[HALVES], ec[HALVES];
+    mn_float16_t k = mn_f32_to_f16(-1.75f);
+    mn_vec2h_t k2 = { mn_f32_to_f16(0.5f), mn_f32_to_f16(-3.0f) };
+    mn_vec3h_t k3 = { mn_f32_to_f16(1.25f), mn_f32_to_f16(2.0f), mn_f32_to_f16(-0.75f) };
+    mn_vec4h_t k4 = { mn_f32_to_f16(4.0f), mn_f32_to_f16(-1.0f), mn_f32_to_f16(0.125f), mn_f32_to_f16(10.0f) };
+
+    mn_test_seed(12345u);
+    failed |= test_conversions();
+
+    for (size_t i = 0; i < HALVES; i++) {
+        a[i] = random_half();
+        b[i] = random_half();
+        c[i] = random_half();
+        /* small multiples of 1/4: products and sums are exact in half */
+        ea[i] = mn_f32_to_f16((float)((int)(i % 13) - 6) * 0.25f);
+        eb[i] = mn_f32_to_f16((float)((int)(i % 7) - 3) * 0.5f);
+        ec[i] = mn_f32_to_f16((float)((int)(i % 11) - 5));
+    }
+
+#define RUN2(op, T, n) \
+    mn_##op##_##T##_c((void*)ref, (void*)a, (void*)b, COUNT); \
+    mn_##op##_##T##_neon((void*)dst, (void*)a, (void*)b, COUNT); \
+    failed |= check(#op "_" #T, dst, ref, (size_t)COUNT * (n));
+#define RUNC(op, T, n, cst) \
+    mn_##op##_##T##_c((void*)ref, (void*)a, cst, COUNT); \
+    mn_##op##_##T##_neon((void*)dst, (void*)a, cst, COUNT); \
+    failed |= check(#op "_" #T, dst, ref, (size_t)COUNT * (n));
+#define RUN1(op, T, n) \
+    mn_##op##_##T##_c((void*)ref, (void*)a, COUNT); \
+    mn_##op##_##T##_neon((void*)dst, (void*)a, COUNT); \
+    failed |= check(#op "_" #T, dst, ref, (size_t)COUNT * (n));
+#define RUNFMA(T, n) \
+    mn_fma_##T##_c((void*)ref, (void*)ea, (void*)eb, (void*)ec, COUNT); \
+    mn_fma_##T##_neon((void*)dst, (void*)ea, (void*)eb, (void*)ec, COUNT); \
+    failed |= check("fma_" #T, dst, ref, (size_t)COUNT * (n));
+
+    RUN2(add, float16, 1) RUN2(add, vec2h, 2) RUN2(add, vec3h, 3) RUN2(add, vec4h, 4)
+    RUN2(sub, float16, 1) RUN2(sub, vec2h, 2) RUN2(sub, vec3h, 3) RUN2(sub, vec4h, 4)
+    RUN2(mul, float16, 1) RUN2(mul, vec2h, 2) RUN2(mul, vec3h, 3) RUN2(mul, vec4h, 4)
+    RUNC(addc, float16, 1, k) RUNC(addc, vec2h, 2, &k2) RUNC(addc, vec3h, 3, &k3) RUNC(addc, vec4h, 4, &k4)
+    RUNC(mulc, float16, 1, k) RUNC(mulc, vec2h, 2, &k2) RUNC(mulc, vec3h, 3, &k3) RUNC(mulc, vec4h, 4, &k4)
+    RUN1(abs, float16, 1) RUN1(abs, vec2h, 2) RUN1(abs, vec3h, 3) RUN1(abs, vec4h, 4)
+    RUNFMA(float16, 1) RUNFMA(vec2h, 2) RUNFMA(vec3h, 3) RUNFMA(vec4h, 4)
+
+    // ==== Spot check against float32 math ====
+    mn_fma_float16_neon(dst, ea, eb, ec, COUNT);
+    for (size_t i = 0; i < COUNT; i++) {
+        float expected = mn_f16_to_f32(ea[i]) * mn_f16_to_f32(eb[i]) + mn_f16_to_f32(ec[i]);
+        if (mn_f16_to_f32(dst[i]) != expected) {
+            printf("fma_float16 value failed at %zu: %.4f vs %.4f\n", i, mn_f16_to_f32(dst[i]), expected);
+            failed = 1;
+            break;
+        }
+    }
+
+    (void)c;
+    if (!failed) {
+        printf("All float16 tests passed!\n");
+    }
+    return failed;
+}
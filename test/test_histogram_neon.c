@@ -0,0 +1,192 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <limits.h>
+#include <float.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    histogram tests:
+      1. uint8 (C and NEON) against a reference loop for counts 0 .. 40 and
+         4099, on random bytes and on long runs of one value.
+      2. int32 bincount for several bin counts (including more than the
+         sub-histogram limit), with negative and too large values skipped.
+      3. float histogram: C and NEON give identical counts, the edges lo / hi,
+         the last value below hi, NaN and infinities, and the total equals the
+         number of values in [lo, hi).
+      4. bins == 0, lo >= hi and NaN edges return MN_ERROR.
+      5. With 4 threads, huge arrays give the single thread counts.
+*/
+
+#define N 4099
+#define HUGE_N ((size_t)1000003)
+
+static int check_uint8(void)
+{
+    static mn_uint8_t x[N];
+    mn_uint32_t ref[256], hc[256], hn[256];
+    int fail = 0;
+
+    for (int round = 0; round < 2 && !fail; round++) {
+        for (size_t i = 0; i < N; i++) x[i] = round ? (mn_uint8_t)(i / 500 * 31) : (mn_uint8_t)mn_test_bits();
+        for (size_t n = 0; n <= 41 && !fail; n++) {
+            const size_t count = n <= 40 ? n : N;
+            memset(ref, 0, sizeof(ref));
+            for (size_t i = 0; i < count; i++) ref[x[i]]++;
+            memset(hc, 0xff, sizeof(hc));
+            memset(hn, 0xff, sizeof(hn));
+            fail |= mn_histogram_uint8_c(hc, x, count) != MN_SUCCESS;
+            fail |= mn_histogram_uint8_neon(hn, x, count) != MN_SUCCESS;
+            if (fail || memcmp(ref, hc, sizeof(ref)) != 0 || memcmp(ref, hn, sizeof(ref)) != 0) {
+                printf("histogram_uint8 round %d n=%zu failed\n", round, count);
+                fail = 1;
+            }
+        }
+    }
+    return fail;
+}
+
+static int check_int32(void)
+{
+    static mn_int32_t x[N];
+    static mn_uint32_t ref[5000], hc[5000], hn[5000];
+    const size_t bins_list[] = { 1, 7, 256, 5000 };
+    int fail = 0;
+
+    for (size_t b = 0; b < sizeof(bins_list) / sizeof(bins_list[0]) && !fail; b++) {
+        const size_t bins = bins_list[b];
+        for (size_t i = 0; i < N; i++) x[i] = (mn_int32_t)(mn_test_bits() % (bins + 20)) - 10;
+        x[0] = INT_MIN;
+        x[1] = INT_MAX;
+        x[2] = (mn_int32_t)bins;
+        x[3] = 0;
+        for (size_t n = 0; n <= 41 && !fail; n++) {
+            const size_t count = n <= 40 ? n : N;
+            memset(ref, 0, bins * sizeof(mn_uint32_t));
+            for (size_t i = 0; i < count; i++) {
+                if (x[i] >= 0 && (size_t)x[i] < bins) ref[x[i]]++;
+            }
+            fail |= mn_histogram_int32_c(hc, bins, x, count) != MN_SUCCESS;
+            fail |= mn_histogram_int32_neon(hn, bins, x, count) != MN_SUCCESS;
+            if (fail || memcmp(ref, hc, bins * sizeof(mn_uint32_t)) != 0 ||
+                memcmp(ref, hn, bins * sizeof(mn_uint32_t)) != 0) {
+                printf("histogram_int32 bins=%zu n=%zu failed\n", bins, count);
+                fail = 1;
+            }
+        }
+    }
+    fail |= mn_histogram_int32_c(hc, 0, x, N) != MN_ERROR;
+    fail |= mn_histogram_int32_neon(hn, 0, x, N) != MN_ERROR;
+    return fail;
+}
+
+static int check_float(void)
+{
+    static mn_float32_t x[N];
+    static mn_uint32_t hc[5000], hn[5000];
+    const size_t bins_list[] = { 1, 10, 1000, 5000 };
+    const mn_float32_t lo = -3.5f, hi = 12.25f;
+    int fail = 0;
+
+    for (size_t b = 0; b < sizeof(bins_list) / sizeof(bins_list[0]) && !fail; b++) {
+        const size_t bins = bins_list[b];
+        for (size_t i = 0; i < N; i++) x[i] = mn_test_uniform(lo - 1.0f, hi + 1.0f);
+        x[0] = lo;
+        x[1] = hi;
+        x[2] = nextafterf(hi, lo);
+        x[3] = NAN;
+        x[4] = INFINITY;
+        x[5] = -INFINITY;
+        x[6] = nextafterf(lo, hi);
+        for (size_t n = 0; n <= 41 && !fail; n++) {
+            const size_t count = n <= 40 ? n : N;
+            size_t inside = 0, total = 0;
+            for (size_t i = 0; i < count; i++) inside += x[i] >= lo && x[i] < hi;
+            fail |= mn_histogram_float_c(hc, bins, x, lo, hi, count) != MN_SUCCESS;
+            fail |= mn_histogram_float_neon(hn, bins, x, lo, hi, count) != MN_SUCCESS;
+            for (size_t i = 0; i < bins; i++) total += hn[i];
+            if (fail || total != inside || memcmp(hc, hn, bins * sizeof(mn_uint32_t)) != 0) {
+                printf("histogram_float bins=%zu n=%zu failed: %zu counted, %zu in range\n", bins, count, total,
+                       inside);
+                fail = 1;
+            }
+        }
+        /* the first and last bins hold lo and the value just below hi */
+        mn_histogram_float_neon(hn, bins, x, lo, hi, 3);
+        fail |= hn[0] == 0 || hn[bins - 1] == 0;
+    }
+
+    fail |= mn_histogram_float_c(hc, 0, x, lo, hi, N) != MN_ERROR;
+    fail |= mn_histogram_float_neon(hn, 0, x, lo, hi, N) != MN_ERROR;
+    fail |= mn_histogram_float_c(hc, 10, x, hi, lo, N) != MN_ERROR;
+    fail |= mn_histogram_float_neon(hn, 10, x, hi, lo, N) != MN_ERROR;
+    fail |= mn_histogram_float_neon(hn, 10, x, NAN, hi, N) != MN_ERROR;
+    fail |= mn_histogram_float_neon(hn, 10, x, -FLT_MAX, FLT_MAX, N) != MN_ERROR;
+    if (fail) printf("histogram_float edges / errors failed\n");
+    return fail;
+}
+
+static int check_threads(void)
+{
+    mn_uint8_t *xb = (mn_uint8_t *)malloc(HUGE_N);
+    mn_int32_t *xi = (mn_int32_t *)malloc(HUGE_N * sizeof(mn_int32_t));
+    mn_float32_t *xf = (mn_float32_t *)malloc(HUGE_N * sizeof(mn_float32_t));
+    static mn_uint32_t h1[1000], h4[1000];
+    int fail = 0;
+
+    if (!xb || !xi || !xf) {
+        printf("out of memory\n");
+        return 1;
+    }
+    for (size_t i = 0; i < HUGE_N; i++) {
+        xb[i] = (mn_uint8_t)mn_test_bits();
+        xi[i] = (mn_int32_t)(mn_test_bits() % 1100) - 50;
+        xf[i] = mn_test_uniform(-1.0f, 2.0f);
+    }
+
+    mn_set_threads(1);
+    mn_histogram_uint8_neon(h1, xb, HUGE_N);
+    mn_set_threads(4);
+    fail |= mn_histogram_uint8_neon(h4, xb, HUGE_N) != MN_SUCCESS;
+    fail |= memcmp(h1, h4, 256 * sizeof(mn_uint32_t)) != 0;
+
+    mn_set_threads(1);
+    mn_histogram_int32_neon(h1, 1000, xi, HUGE_N);
+    mn_set_threads(4);
+    fail |= mn_histogram_int32_neon(h4, 1000, xi, HUGE_N) != MN_SUCCESS;
+    fail |= memcmp(h1, h4, sizeof(h1)) != 0;
+
+    mn_set_threads(1);
+    mn_histogram_float_neon(h1, 1000, xf, 0.0f, 1.0f, HUGE_N);
+    mn_set_threads(4);
+    fail |= mn_histogram_float_neon(h4, 1000, xf, 0.0f, 1.0f, HUGE_N) != MN_SUCCESS;
+    fail |= memcmp(h1, h4, sizeof(h1)) != 0;
+
+    fail |= mn_get_threads() != 4;
+    mn_set_threads(1);
+    if (fail) printf("threaded histograms differ from one thread\n");
+
+    free(xb);
+    free(xi);
+    free(xf);
+    return fail;
+}
+
+int main(void)
+{
+    int fail = 0;
+
+    mn_test_seed(29u);
+    fail |= check_uint8();
+    fail |= check_int32();
+    fail |= check_float();
+    fail |= check_threads();
+
+    if (fail) return 1;
+    printf("All histogram tests passed\n");
+    return 0;
+}
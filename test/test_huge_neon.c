@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+
+/*
+    Runs one call over more than 2^32 float elements.
+
+    The array is a 16 GiB+ window of virtual memory backed by a small sparse
+    file: the same CHUNK_BYTES region (A) of the file is mapped over and over,
+    and the final chunk maps a second region (B), so every element at index
+    2^32 or above lives in B only. mn_abs_float_neon runs in place over the
+    whole window (abs is idempotent, so the repeated views of A are fine).
+
+    A 32-bit count would wrap to the small remainder and leave B untouched,
+    so the test checks that B holds |x| up to the end of the call and the
+    original values after it.
+
+    Needs mmap with MAP_FIXED, so it only runs on 64-bit POSIX systems.
+    Exit code 77 marks the test as skipped when the mapping is not possible.
+*/
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+
+#define CHUNK_BYTES ((size_t)16 << 20)
+#define CHUNK_ELEMS (CHUNK_BYTES / sizeof(float))
+#define TAIL_ELEMS  1027   /* elements past 2^32, not a multiple of 4 */
+
+static float value_a(size_t i) { return -(float)(i % 97 + 1); }
+static float value_b(size_t i) { return -(float)(i % 89 + 1) - 0.5f; }
+
+int main(void)
+{
+    const size_t count = ((size_t)1 << 32) + TAIL_ELEMS;
+    const size_t chunks_a = (((size_t)1 << 32) * sizeof(float)) / CHUNK_BYTES;
+    const size_t window = (chunks_a + 1) * CHUNK_BYTES;
+    FILE* backing;
+    int fd;
+    char* base;
+    float* file_view;
+    int status = 1;
+
+    if (sizeof(size_t) < 8)
+    {
+        printf("Skipped: needs a 64-bit address space\n");
+        return 77;
+    }
+
+    // ==== Sparse backing file: region A then region B ====
+    backing = tmpfile();
+    if (!backing)
+    {
+        printf("Skipped: tmpfile failed\n");
+        return 77;
+    }
+    fd = fileno(backing);
+    if (ftruncate(fd, (off_t)(2 * CHUNK_BYTES)) != 0)
+    {
+        printf("Skipped: ftruncate failed\n");
+        fclose(backing);
+        return 77;
+    }
+
+    file_view = (float*)mmap(NULL, 2 * CHUNK_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (file_view == MAP_FAILED)
+    {
+        printf("Skipped: mmap of backing file failed\n");
+        fclose(backing);
+        return 77;
+    }
+    for (size_t i = 0; i < CHUNK_ELEMS; i++)
+    {
+        file_view[i] = value_a(i);
+        file_view[CHUNK_ELEMS + i] = value_b(i);
+    }
+
+    // ==== Reserve the window and map the file regions into it ====
+    base = (char*)mmap(NULL, window, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (base == MAP_FAILED)
+    {
+        printf("Skipped: could not reserve %zu bytes of address space\n", window);
+        munmap(file_view, 2 * CHUNK_BYTES);
+        fclose(backing);
+        return 77;
+    }
+    for (size_t c = 0; c <= chunks_a; c++)
+    {
+        off_t offset = (c < chunks_a) ? 0 : (off_t)CHUNK_BYTES;
+        if (mmap(base + c * CHUNK_BYTES, CHUNK_BYTES, PROT_READ | PROT_WRITE,
+                 MAP_SHARED | MAP_FIXED, fd, offset) == MAP_FAILED)
+        {
+            printf("Skipped: mapping chunk %zu failed\n", c);
+            status = 77;
+            goto cleanup;
+        }
+    }
+
+    printf("Running mn_abs_float_neon in place over %zu elements...\n", count);
+    mn_abs_float_neon((float*)base, (float*)base, count);
+
+    // ==== Verify through the direct file view ====
+    for (size_t i = 0; i < CHUNK_ELEMS; i++)
+    {
+        if (file_view[i] != -value_a(i))
+        {
+            printf("Region A failed at %zu: got %.2f, expected %.2f\n", i, file_view[i], -value_a(i));
+            goto cleanup;
+        }
+    }
+    for (size_t i = 0; i < CHUNK_ELEMS; i++)
+    {
+        float expected = (i < TAIL_ELEMS) ? -value_b(i) : value_b(i);
+        if (file_view[CHUNK_ELEMS + i] != expected)
+        {
+            printf("Region B failed at element %zu past 2^32: got %.2f, expected %.2f\n",
+                   i, file_view[CHUNK_ELEMS + i], expected);
+            goto cleanup;
+        }
+    }
+
+    printf("Huge array test passed!\n");
+    status = 0;
+
+cleanup:
+    munmap(base, window);
+    munmap(file_view, 2 * CHUNK_BYTES);
+    fclose(backing);
+    return status;
+}
+
+#else
+
+int main(void)
+{
+    printf("Skipped: huge array test needs POSIX mmap\n");
+    return 77;
+}
+
+#endif
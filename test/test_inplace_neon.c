@@ -0,0 +1,139 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+
+/*
+    In-place tests: every operator is called with dst equal to one of its
+    sources and the result is compared with an out-of-place C reference.
+    The count is odd so the leftover loops also run in place.
+*/
+
+#define COUNT 19
+
+static int check_float(const char* name, const float* got, const float* ref, int n)
+{
+    for (int i = 0; i < n; i++) {
+        if (got[i] != ref[i]) {
+            printf("%s failed at %d: in-place=%.6f, Reference=%.6f\n", name, i, got[i], ref[i]);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int check_int(const char* name, const int* got, const int* ref, int n)
+{
+    for (int i = 0; i < n; i++) {
+        if (got[i] != ref[i]) {
+            printf("%s failed at %d: in-place=%d, Reference=%d\n", name, i, got[i], ref[i]);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(void)
+{
+    int failed = 0;
+
+    float a_f[COUNT * 4], b_f[COUNT * 4], ref_f[COUNT * 4], buf_f[COUNT * 4];
+    int a_i[COUNT * 4], b_i[COUNT * 4], ref_i[COUNT * 4], buf_i[COUNT * 4];
+    const int n4 = COUNT * 4;
+    const int n3 = COUNT * 3;
+
+    mn_vec3f_t c3f = { 1.5f, -2.0f, 0.25f };
+    mn_vec4i_t c4i = { 3, -4, 5, -6 };
+
+    for (int i = 0; i < n4; i++) {
+        a_f[i] = (float)(i + 1) * ((i % 2) ? -0.75f : 0.5f);
+        b_f[i] = (float)(n4 - i) * 0.125f + 1.0f;
+        a_i[i] = (i + 1) * ((i % 3) ? -7 : 5);
+        b_i[i] = (n4 - i) * 2 + 1;
+    }
+
+    // ==== float, dst == src1 and dst == src2 ====
+    mn_add_float_c(ref_f, a_f, b_f, COUNT);
+    memcpy(buf_f, a_f, sizeof(a_f));
+    mn_add_float_neon(buf_f, buf_f, b_f, COUNT);
+    failed |= check_float("add_float_neon (dst == src1)", buf_f, ref_f, COUNT);
+    memcpy(buf_f, b_f, sizeof(b_f));
+    mn_add_float_neon(buf_f, a_f, buf_f, COUNT);
+    failed |= check_float("add_float_neon (dst == src2)", buf_f, ref_f, COUNT);
+    memcpy(buf_f, a_f, sizeof(a_f));
+    mn_add_float_c(buf_f, buf_f, b_f, COUNT);
+    failed |= check_float("add_float_c (dst == src1)", buf_f, ref_f, COUNT);
+
+    mn_sub_float_c(ref_f, a_f, b_f, COUNT);
+    memcpy(buf_f, a_f, sizeof(a_f));
+    mn_sub_float_neon(buf_f, buf_f, b_f, COUNT);
+    failed |= check_float("sub_float_neon (dst == src1)", buf_f, ref_f, COUNT);
+    memcpy(buf_f, b_f, sizeof(b_f));
+    mn_sub_float_c(buf_f, a_f, buf_f, COUNT);
+    failed |= check_float("sub_float_c (dst == src2)", buf_f, ref_f, COUNT);
+
+    mn_mul_float_c(ref_f, a_f, a_f, COUNT);
+    memcpy(buf_f, a_f, sizeof(a_f));
+    mn_mul_float_neon(buf_f, buf_f, buf_f, COUNT);
+    failed |= check_float("mul_float_neon (dst == src1 == src2)", buf_f, ref_f, COUNT);
+
+    mn_mulc_float_c(ref_f, a_f, -3.0f, COUNT);
+    memcpy(buf_f, a_f, sizeof(a_f));
+    mn_mulc_float_neon(buf_f, buf_f, -3.0f, COUNT);
+    failed |= check_float("mulc_float_neon", buf_f, ref_f, COUNT);
+    memcpy(buf_f, a_f, sizeof(a_f));
+    mn_mulc_float_c(buf_f, buf_f, -3.0f, COUNT);
+    failed |= check_float("mulc_float_c", buf_f, ref_f, COUNT);
+
+    mn_abs_float_c(ref_f, a_f, COUNT);
+    memcpy(buf_f, a_f, sizeof(a_f));
+    mn_abs_float_neon(buf_f, buf_f, COUNT);
+    failed |= check_float("abs_float_neon", buf_f, ref_f, COUNT);
+
+    // ==== vec3f (leftover loop uses 3-element lanes) ====
+    mn_add_vec3f_c((mn_vec3f_t*)ref_f, (mn_vec3f_t*)a_f, (mn_vec3f_t*)b_f, COUNT);
+    memcpy(buf_f, a_f, sizeof(a_f));
+    mn_add_vec3f_neon((mn_vec3f_t*)buf_f, (mn_vec3f_t*)buf_f, (mn_vec3f_t*)b_f, COUNT);
+    failed |= check_float("add_vec3f_neon (dst == src1)", buf_f, ref_f, n3);
+
+    mn_mul_vec3f_c((mn_vec3f_t*)ref_f, (mn_vec3f_t*)a_f, (mn_vec3f_t*)b_f, COUNT);
+    memcpy(buf_f, b_f, sizeof(b_f));
+    mn_mul_vec3f_neon((mn_vec3f_t*)buf_f, (mn_vec3f_t*)a_f, (mn_vec3f_t*)buf_f, COUNT);
+    failed |= check_float("mul_vec3f_neon (dst == src2)", buf_f, ref_f, n3);
+
+    mn_addc_vec3f_c((mn_vec3f_t*)ref_f, (mn_vec3f_t*)a_f, &c3f, COUNT);
+    memcpy(buf_f, a_f, sizeof(a_f));
+    mn_addc_vec3f_neon((mn_vec3f_t*)buf_f, (mn_vec3f_t*)buf_f, &c3f, COUNT);
+    failed |= check_float("addc_vec3f_neon", buf_f, ref_f, n3);
+
+    // ==== int32 and vec4i ====
+    mn_sub_int32_c(ref_i, a_i, b_i, COUNT);
+    memcpy(buf_i, a_i, sizeof(a_i));
+    mn_sub_int32_neon(buf_i, buf_i, b_i, COUNT);
+    failed |= check_int("sub_int32_neon (dst == src1)", buf_i, ref_i, COUNT);
+
+    mn_mul_int32_c(ref_i, a_i, b_i, COUNT);
+    memcpy(buf_i, b_i, sizeof(b_i));
+    mn_mul_int32_neon(buf_i, a_i, buf_i, COUNT);
+    failed |= check_int("mul_int32_neon (dst == src2)", buf_i, ref_i, COUNT);
+
+    mn_subc_vec4i_c((mn_vec4i_t*)ref_i, (mn_vec4i_t*)a_i, &c4i, COUNT);
+    memcpy(buf_i, a_i, sizeof(a_i));
+    mn_subc_vec4i_neon((mn_vec4i_t*)buf_i, (mn_vec4i_t*)buf_i, &c4i, COUNT);
+    failed |= check_int("subc_vec4i_neon", buf_i, ref_i, n4);
+    memcpy(buf_i, a_i, sizeof(a_i));
+    mn_subc_vec4i_c((mn_vec4i_t*)buf_i, (mn_vec4i_t*)buf_i, &c4i, COUNT);
+    failed |= check_int("subc_vec4i_c", buf_i, ref_i, n4);
+
+    mn_abs_vec4i_c((mn_vec4i_t*)ref_i, (mn_vec4i_t*)a_i, COUNT);
+    memcpy(buf_i, a_i, sizeof(a_i));
+    mn_abs_vec4i_neon((mn_vec4i_t*)buf_i, (mn_vec4i_t*)buf_i, COUNT);
+    failed |= check_int("abs_vec4i_neon", buf_i, ref_i, n4);
+
+    if (!failed) {
+        printf("All in-place tests passed!\n");
+    }
+    return failed;
+}
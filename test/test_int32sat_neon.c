@@ -0,0 +1,117 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    int32 saturating and overflow-checked tests:
+      1. NEON vs C for add/sub/mul/addc/subc/mulc _sat on random full range values.
+      2. _ovf: results equal the wrapping routines, MN_SUCCESS without overflow
+         and MN_OVERFLOW when a single element overflows, both inside the
+         vector loop and in the leftover elements, including products whose
+         wrapped value equals the saturated one (101 * 63786643).
+*/
+
+#define COUNT 67
+
+static int check(const char* name, const mn_int32_t* got, const mn_int32_t* ref, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        if (got[i] != ref[i]) {
+            printf("%s failed at %zu: NEON=%d, Reference=%d\n", name, i, got[i], ref[i]);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+typedef mn_result_t (*binary_fn)(mn_int32_t*, mn_int32_t*, mn_int32_t*, size_t);
+
+static int check_ovf(const char* name, binary_fn ovf, binary_fn wrap, mn_int32_t* a, mn_int32_t* b, mn_int32_t big, mn_int32_t big_other)
+{
+    mn_int32_t dst[COUNT], ref[COUNT];
+    size_t positions[] = { 0, 5, COUNT - 1 };   /* vector loop, vector loop, leftover */
+
+    if (ovf(dst, a, b, COUNT) != MN_SUCCESS) {
+        printf("%s reported overflow on small values\n", name);
+        return 1;
+    }
+    wrap(ref, a, b, COUNT);
+    if (check(name, dst, ref, COUNT)) return 1;
+
+    for (size_t p = 0; p < sizeof(positions) / sizeof(positions[0]); p++) {
+        mn_int32_t sa = a[positions[p]], sb = b[positions[p]];
+        a[positions[p]] = big;
+        b[positions[p]] = big_other;
+        mn_result_t res = ovf(dst, a, b, COUNT);
+        wrap(ref, a, b, COUNT);
+        a[positions[p]] = sa;
+        b[positions[p]] = sb;
+        if (res != MN_OVERFLOW) {
+            printf("%s missed overflow at %zu\n", name, positions[p]);
+            return 1;
+        }
+        if (check(name, dst, ref, COUNT)) return 1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    mn_test_seed(4242u);
+    int failed = 0;
+    mn_int32_t a[COUNT], b[COUNT], ref[COUNT], dst[COUNT];
+    mn_int32_t sa[COUNT], sb[COUNT];
+    mn_int32_t k = mn_test_int32();
+
+    for (size_t i = 0; i < COUNT; i++) {
+        a[i] = mn_test_int32();
+        b[i] = (i % 3 == 0) ? (mn_int32_t)(i * 1000) - 30000 : mn_test_int32();
+        sa[i] = (mn_int32_t)i * 37 - 1000;
+        sb[i] = 500 - (mn_int32_t)i * 11;
+    }
+
+#define RUN2(op) \
+    mn_##op##_int32_c(ref, a, b, COUNT); \
+    mn_##op##_int32_neon(dst, a, b, COUNT); \
+    failed |= check(#op "_int32", dst, ref, COUNT);
+#define RUNC(op) \
+    mn_##op##_int32_c(ref, a, k, COUNT); \
+    mn_##op##_int32_neon(dst, a, k, COUNT); \
+    failed |= check(#op "_int32", dst, ref, COUNT);
+
+    RUN2(add_sat) RUN2(sub_sat) RUN2(mul_sat)
+    RUNC(addc_sat) RUNC(subc_sat) RUNC(mulc_sat)
+
+    // ==== Known saturation values ====
+    {
+        mn_int32_t x[2] = { INT32_MAX, INT32_MIN }, y[2] = { 1, 2 }, r[2];
+        mn_add_sat_int32_neon(r, x, y, 2);
+        if (r[0] != INT32_MAX || r[1] != INT32_MIN + 2) { printf("add_sat_int32 values wrong\n"); failed = 1; }
+        mn_sub_sat_int32_neon(r, x, y, 2);
+        if (r[0] != INT32_MAX - 1 || r[1] != INT32_MIN) { printf("sub_sat_int32 values wrong\n"); failed = 1; }
+        mn_mul_sat_int32_neon(r, x, y, 2);
+        if (r[0] != INT32_MAX || r[1] != INT32_MIN) { printf("mul_sat_int32 values wrong\n"); failed = 1; }
+    }
+
+    // ==== Overflow flag ====
+    failed |= check_ovf("add_ovf_int32_neon", mn_add_ovf_int32_neon, mn_add_int32_neon, sa, sb, INT32_MAX, 1);
+    failed |= check_ovf("add_ovf_int32_c", mn_add_ovf_int32_c, mn_add_int32_neon, sa, sb, INT32_MAX, 1);
+    failed |= check_ovf("sub_ovf_int32_neon", mn_sub_ovf_int32_neon, mn_sub_int32_neon, sa, sb, INT32_MIN, 1);
+    failed |= check_ovf("sub_ovf_int32_c", mn_sub_ovf_int32_c, mn_sub_int32_neon, sa, sb, INT32_MIN, 1);
+    failed |= check_ovf("mul_ovf_int32_neon", mn_mul_ovf_int32_neon, mn_mul_int32_neon, sa, sb, 65536, 65536);
+    failed |= check_ovf("mul_ovf_int32_c", mn_mul_ovf_int32_c, mn_mul_int32_neon, sa, sb, 65536, 65536);
+    /* products whose wrapped value equals the saturated one: INT32_MAX and INT32_MIN */
+    failed |= check_ovf("mul_ovf_int32_neon", mn_mul_ovf_int32_neon, mn_mul_int32_neon, sa, sb, 101, 63786643);
+    failed |= check_ovf("mul_ovf_int32_c", mn_mul_ovf_int32_c, mn_mul_int32_neon, sa, sb, 101, 63786643);
+    failed |= check_ovf("mul_ovf_int32_neon", mn_mul_ovf_int32_neon, mn_mul_int32_neon, sa, sb, -65536, 98304);
+    failed |= check_ovf("mul_ovf_int32_c", mn_mul_ovf_int32_c, mn_mul_int32_neon, sa, sb, -65536, 98304);
+
+    if (!failed) {
+        printf("All int32 saturating / overflow tests passed!\n");
+    }
+    return failed;
+}
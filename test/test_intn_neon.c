@@ -0,0 +1,98 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    int8 / uint8 / int16 / uint16 tests:
+      1. NEON vs C for every wrapping and saturating routine on random values
+         over the full range of the type, so overflow happens in many lanes.
+      2. Spot checks of the saturation and Q15 results against known values.
+    The count is not a multiple of 16 so the leftover path runs too.
+*/
+
+#define COUNT 67
+
+#define CHECK(name, T, got, ref) \
+    for (size_t i = 0; i < COUNT; i++) { \
+        if ((got)[i] != (ref)[i]) { \
+            printf("%s failed at %zu: NEON=%d, Reference=%d\n", name, i, (int)(got)[i], (int)(ref)[i]); \
+            failed = 1; \
+            break; \
+        } \
+    }
+
+#define RUN2(op, tname, T) \
+    mn_##op##_##tname##_c(ref, a, b, COUNT); \
+    mn_##op##_##tname##_neon(dst, a, b, COUNT); \
+    CHECK(#op "_" #tname, T, dst, ref)
+
+#define RUNC(op, tname, T) \
+    mn_##op##_##tname##_c(ref, a, b[3], COUNT); \
+    mn_##op##_##tname##_neon(dst, a, b[3], COUNT); \
+    CHECK(#op "_" #tname, T, dst, ref)
+
+#define RUN1(op, tname, T) \
+    mn_##op##_##tname##_c(ref, a, COUNT); \
+    mn_##op##_##tname##_neon(dst, a, COUNT); \
+    CHECK(#op "_" #tname, T, dst, ref)
+
+#define TEST_FAMILY(tname, T) do { \
+        T a[COUNT], b[COUNT], ref[COUNT], dst[COUNT]; \
+        for (size_t i = 0; i < COUNT; i++) { \
+            a[i] = (T)mn_test_bits(); \
+            b[i] = (T)mn_test_bits(); \
+        } \
+        RUN2(add, tname, T) RUN2(sub, tname, T) RUN2(mul, tname, T) \
+        RUNC(addc, tname, T) RUNC(subc, tname, T) RUNC(mulc, tname, T) \
+        RUN2(add_sat, tname, T) RUN2(sub_sat, tname, T) RUN2(mul_sat, tname, T) \
+        RUNC(addc_sat, tname, T) RUNC(subc_sat, tname, T) RUNC(mulc_sat, tname, T) \
+        EXTRA_##tname \
+    } while (0)
+
+#define EXTRA_int8   RUN1(abs, int8, mn_int8_t) RUN1(abs_sat, int8, mn_int8_t)
+#define EXTRA_int16  RUN1(abs, int16, mn_int16_t) RUN1(abs_sat, int16, mn_int16_t) \
+                     RUN2(mul_q15, int16, mn_int16_t) RUNC(mulc_q15, int16, mn_int16_t)
+#define EXTRA_uint8
+#define EXTRA_uint16
+
+int main(void)
+{
+    int failed = 0;
+
+    mn_test_seed(777u);
+    TEST_FAMILY(int8, mn_int8_t);
+    TEST_FAMILY(uint8, mn_uint8_t);
+    TEST_FAMILY(int16, mn_int16_t);
+    TEST_FAMILY(uint16, mn_uint16_t);
+
+    // ==== Known values ====
+    {
+        mn_int8_t a8[3] = { 100, -100, -128 }, b8[3] = { 100, 100, 1 }, r8[3];
+        mn_uint8_t ua[2] = { 200, 10 }, ub[2] = { 100, 20 }, ur[2];
+        mn_int16_t q1[3] = { 16384, INT16_MIN, -16384 }, q2[3] = { 16384, INT16_MIN, 16384 }, qr[3];
+
+        mn_add_sat_int8_neon(r8, a8, b8, 3);
+        if (r8[0] != 127 || r8[1] != 0 || r8[2] != -127) { printf("add_sat_int8 values wrong\n"); failed = 1; }
+        mn_add_int8_neon(r8, a8, b8, 3);
+        if (r8[0] != -56) { printf("add_int8 did not wrap\n"); failed = 1; }
+        mn_abs_sat_int8_neon(r8, a8, 3);
+        if (r8[2] != 127) { printf("abs_sat_int8 of -128 should be 127\n"); failed = 1; }
+        mn_abs_int8_neon(r8, a8, 3);
+        if (r8[2] != -128) { printf("abs_int8 of -128 should wrap to -128\n"); failed = 1; }
+        mn_sub_sat_uint8_neon(ur, ub, ua, 2);
+        if (ur[0] != 0 || ur[1] != 10) { printf("sub_sat_uint8 values wrong\n"); failed = 1; }
+        mn_mul_sat_uint8_neon(ur, ua, ub, 2);
+        if (ur[0] != 255 || ur[1] != 200) { printf("mul_sat_uint8 values wrong\n"); failed = 1; }
+        mn_mul_q15_int16_neon(qr, q1, q2, 3);
+        if (qr[0] != 8192 || qr[1] != INT16_MAX || qr[2] != -8192) { printf("mul_q15_int16 values wrong\n"); failed = 1; }
+    }
+
+    if (!failed) {
+        printf("All int8 / int16 tests passed!\n");
+    }
+    return failed;
+}
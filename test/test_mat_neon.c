@@ -0,0 +1,201 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    Matrix tests:
+      1. Known values: identity and a translation matrix.
+      2. NEON vs C on random matrices / vectors (fused multiply-add in NEON,
+         so a relative tolerance is used), with a leftover for transform.
+      3. In-place: dst == src1 / src2 / src.
+      4. add/sub/trans (bit exact), det and inv (tolerance) NEON vs C for
+         2x2, 3x3 and 4x4, singular matrices, A * inverse(A) == I.
+*/
+
+#define COUNT 67
+#define REL_TOLERANCE 1e-5f
+
+static int close_enough(const mn_float32_t* got, const mn_float32_t* ref, size_t n, const char* name)
+{
+    for (size_t i = 0; i < n; i++) {
+        if (fabsf(got[i] - ref[i]) > REL_TOLERANCE * (1.0f + fabsf(ref[i]))) {
+            printf("%s failed at %zu: NEON=%f, Reference=%f\n", name, i, got[i], ref[i]);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void fill(mn_float32_t* p, size_t n)
+{
+    for (size_t i = 0; i < n; i++) p[i] = mn_test_uniform(-2.0f, 2.0f);
+}
+
+/* Diagonally dominant matrices keep the inverses well conditioned */
+static void fill_invertible(mn_float32_t* p, size_t count, int n)
+{
+    fill(p, count * n * n);
+    for (size_t m = 0; m < count; m++) {
+        for (int k = 0; k < n; k++) p[m * n * n + k * (n + 1)] += 8.0f;
+    }
+}
+
+#define CHECK_SIZE(N) \
+    do { \
+        mn_mat##N##f_t* x = (mn_mat##N##f_t*)malloc(sizeof(mn_mat##N##f_t) * COUNT); \
+        mn_mat##N##f_t* y = (mn_mat##N##f_t*)malloc(sizeof(mn_mat##N##f_t) * COUNT); \
+        mn_mat##N##f_t* rn = (mn_mat##N##f_t*)malloc(sizeof(mn_mat##N##f_t) * COUNT); \
+        mn_mat##N##f_t* rc = (mn_mat##N##f_t*)malloc(sizeof(mn_mat##N##f_t) * COUNT); \
+        mn_float32_t detn[COUNT], detc[COUNT]; \
+        const size_t nf = (size_t)N * N * COUNT; \
+        fill_invertible((mn_float32_t*)x, COUNT, N); \
+        fill((mn_float32_t*)y, nf); \
+        mn_addmat_##N##x##N##f_neon(rn, x, y, COUNT); \
+        mn_addmat_##N##x##N##f_c(rc, x, y, COUNT); \
+        if (memcmp(rn, rc, sizeof(mn_mat##N##f_t) * COUNT)) { printf("addmat_" #N " failed\n"); fail = 1; } \
+        mn_submat_##N##x##N##f_neon(rn, x, y, COUNT); \
+        mn_submat_##N##x##N##f_c(rc, x, y, COUNT); \
+        if (memcmp(rn, rc, sizeof(mn_mat##N##f_t) * COUNT)) { printf("submat_" #N " failed\n"); fail = 1; } \
+        for (size_t n = 0; n < 4; n++) { /* every leftover length */ \
+            mn_transmat_##N##x##N##f_neon(rn, y, COUNT - n); \
+            mn_transmat_##N##x##N##f_c(rc, y, COUNT - n); \
+            if (memcmp(rn, rc, sizeof(mn_mat##N##f_t) * (COUNT - n))) { printf("transmat_" #N " failed\n"); fail = 1; } \
+            mn_detmat_##N##x##N##f_neon(detn, x, COUNT - n); \
+            mn_detmat_##N##x##N##f_c(detc, x, COUNT - n); \
+            fail |= !close_enough(detn, detc, COUNT - n, "detmat_" #N); \
+            mn_invmat_##N##x##N##f_neon(rn, x, COUNT - n); \
+            mn_invmat_##N##x##N##f_c(rc, x, COUNT - n); \
+            fail |= !close_enough((mn_float32_t*)rn, (mn_float32_t*)rc, (size_t)N * N * (COUNT - n), "invmat_" #N); \
+        } \
+        /* transposing twice, inverting in place */ \
+        memcpy(rn, y, sizeof(mn_mat##N##f_t) * COUNT); \
+        mn_transmat_##N##x##N##f_neon(rn, rn, COUNT); \
+        mn_transmat_##N##x##N##f_neon(rn, rn, COUNT); \
+        if (memcmp(rn, y, sizeof(mn_mat##N##f_t) * COUNT)) { printf("transmat_" #N " in-place failed\n"); fail = 1; } \
+        memcpy(rn, x, sizeof(mn_mat##N##f_t) * COUNT); \
+        mn_invmat_##N##x##N##f_neon(rn, rn, COUNT); \
+        mn_invmat_##N##x##N##f_c(rc, x, COUNT); \
+        fail |= !close_enough((mn_float32_t*)rn, (mn_float32_t*)rc, nf, "invmat_" #N " in-place"); \
+        /* singular (all zero and rank deficient) matrices give the identity */ \
+        memset(&x[1], 0, sizeof(mn_mat##N##f_t)); \
+        memcpy((mn_float32_t*)&x[COUNT - 1] + N, (mn_float32_t*)&x[COUNT - 1], N * sizeof(mn_float32_t)); \
+        mn_invmat_##N##x##N##f_neon(rn, x, COUNT); \
+        mn_detmat_##N##x##N##f_neon(detn, x, COUNT); \
+        for (int k = 0; k < N * N; k++) { \
+            mn_float32_t want = (k % (N + 1) == 0) ? 1.0f : 0.0f; \
+            if (((mn_float32_t*)&rn[1])[k] != want || ((mn_float32_t*)&rn[COUNT - 1])[k] != want) { \
+                printf("invmat_" #N " singular failed\n"); \
+                fail = 1; \
+                break; \
+            } \
+        } \
+        if (detn[1] != 0.0f || detn[COUNT - 1] != 0.0f) { printf("detmat_" #N " singular failed\n"); fail = 1; } \
+        free(x); free(y); free(rn); free(rc); \
+    } while (0)
+
+int main(void)
+{
+    int fail = 0;
+    mn_mat4f_t* a = (mn_mat4f_t*)malloc(sizeof(mn_mat4f_t) * COUNT);
+    mn_mat4f_t* b = (mn_mat4f_t*)malloc(sizeof(mn_mat4f_t) * COUNT);
+    mn_mat4f_t* dn = (mn_mat4f_t*)malloc(sizeof(mn_mat4f_t) * COUNT);
+    mn_mat4f_t* dc = (mn_mat4f_t*)malloc(sizeof(mn_mat4f_t) * COUNT);
+    mn_vec4f_t* v = (mn_vec4f_t*)malloc(sizeof(mn_vec4f_t) * COUNT);
+    mn_vec4f_t* vn = (mn_vec4f_t*)malloc(sizeof(mn_vec4f_t) * COUNT);
+    mn_vec4f_t* vc = (mn_vec4f_t*)malloc(sizeof(mn_vec4f_t) * COUNT);
+    if (!a || !b || !dn || !dc || !v || !vn || !vc) {
+        fprintf(stderr, "malloc failed!\n");
+        return 1;
+    }
+    mn_test_seed(2024u);
+
+    /* ==== known values ==== */
+    mn_mat4f_t ident = { { 1, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 0, 1, 0 }, { 0, 0, 0, 1 } };
+    mn_mat4f_t trans = { { 1, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 0, 1, 0 }, { 10, 20, 30, 1 } };
+    mn_vec4f_t p = { 1, 2, 3, 1 }, q;
+    mn_transform_vec4f_neon(&q, &p, &trans, 1);
+    if (q.x != 11 || q.y != 22 || q.z != 33 || q.w != 1) {
+        printf("transform_vec4f translation failed: %f %f %f %f\n", q.x, q.y, q.z, q.w);
+        fail = 1;
+    }
+    fill((mn_float32_t*)a, 16);
+    mn_mulmat_4x4f_neon(dn, a, &ident, 1);
+    if (memcmp(dn, a, sizeof(mn_mat4f_t)) != 0) {
+        printf("mulmat_4x4f A * I != A\n");
+        fail = 1;
+    }
+    /* translation * translation adds the offsets (row 1 . column 4 = 10 + 10) */
+    mn_mulmat_4x4f_neon(dn, &trans, &trans, 1);
+    if (dn->c4.x != 20 || dn->c4.y != 40 || dn->c4.z != 60 || dn->c4.w != 1 || dn->c1.x != 1) {
+        printf("mulmat_4x4f translation failed\n");
+        fail = 1;
+    }
+
+    /* ==== NEON vs C ==== */
+    fill((mn_float32_t*)a, 16 * COUNT);
+    fill((mn_float32_t*)b, 16 * COUNT);
+    fill((mn_float32_t*)v, 4 * COUNT);
+
+    mn_mulmat_4x4f_neon(dn, a, b, COUNT);
+    mn_mulmat_4x4f_c(dc, a, b, COUNT);
+    fail |= !close_enough((mn_float32_t*)dn, (mn_float32_t*)dc, 16 * COUNT, "mulmat_4x4f");
+
+    for (size_t n = 0; n <= 6; n++) {   /* vector loop and every leftover length */
+        memset(vn, 0, sizeof(mn_vec4f_t) * COUNT);
+        mn_transform_vec4f_neon(vn, v, &a[1], COUNT - n);
+        mn_transform_vec4f_c(vc, v, &a[1], COUNT - n);
+        fail |= !close_enough((mn_float32_t*)vn, (mn_float32_t*)vc, 4 * (COUNT - n), "transform_vec4f");
+        if (vn[COUNT - 1].x != 0.0f && n > 0) {
+            printf("transform_vec4f wrote past count\n");
+            fail = 1;
+        }
+    }
+
+    /* ==== in-place ==== */
+    memcpy(dn, a, sizeof(mn_mat4f_t) * COUNT);
+    mn_mulmat_4x4f_neon(dn, dn, b, COUNT);
+    mn_mulmat_4x4f_c(dc, a, b, COUNT);
+    fail |= !close_enough((mn_float32_t*)dn, (mn_float32_t*)dc, 16 * COUNT, "mulmat_4x4f in-place src1");
+    memcpy(dn, b, sizeof(mn_mat4f_t) * COUNT);
+    mn_mulmat_4x4f_neon(dn, a, dn, COUNT);
+    fail |= !close_enough((mn_float32_t*)dn, (mn_float32_t*)dc, 16 * COUNT, "mulmat_4x4f in-place src2");
+    memcpy(dc, b, sizeof(mn_mat4f_t) * COUNT);
+    mn_mulmat_4x4f_c(dc, a, dc, COUNT);
+    fail |= !close_enough((mn_float32_t*)dn, (mn_float32_t*)dc, 16 * COUNT, "mulmat_4x4f_c in-place src2");
+
+    memcpy(vn, v, sizeof(mn_vec4f_t) * COUNT);
+    mn_transform_vec4f_neon(vn, vn, &b[2], COUNT);
+    mn_transform_vec4f_c(vc, v, &b[2], COUNT);
+    fail |= !close_enough((mn_float32_t*)vn, (mn_float32_t*)vc, 4 * COUNT, "transform_vec4f in-place");
+
+    /* ==== add/sub/trans/det/inv ==== */
+    CHECK_SIZE(2);
+    CHECK_SIZE(3);
+    CHECK_SIZE(4);
+
+    /* A * inverse(A) == I */
+    fill_invertible((mn_float32_t*)a, COUNT, 4);
+    mn_invmat_4x4f_neon(b, a, COUNT);
+    mn_mulmat_4x4f_neon(dn, a, b, COUNT);
+    for (size_t m = 0; m < COUNT; m++) {
+        for (int k = 0; k < 16; k++) {
+            mn_float32_t want = (k % 5 == 0) ? 1.0f : 0.0f;
+            if (fabsf(((mn_float32_t*)&dn[m])[k] - want) > 1e-5f) {
+                printf("A * invmat_4x4f(A) != I at %zu\n", m);
+                fail = 1;
+                m = COUNT;
+                break;
+            }
+        }
+    }
+
+    free(a); free(b); free(dn); free(dc); free(v); free(vn); free(vc);
+    if (fail) return 1;
+    printf("All matrix tests passed\n");
+    return 0;
+}
@@ -0,0 +1,194 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    meanvar / layernorm tests:
+      1. meanvar (C and NEON) against a double precision two-pass reference
+         for counts 1 .. 40 and across the 256-value blocks, on data centred
+         at 0 and at 1e4 with spread 1 (where sum of squares would cancel).
+      2. A constant array has variance 0 and its value as mean.
+      3. layernorm against a double precision reference with and without
+         gamma / beta, in place and out of place.
+      4. The rows routines give the same values as one call per row.
+      5. count == 0 returns MN_ERROR.
+*/
+
+#define N 4099
+#define EPS 1e-5f
+
+typedef mn_result_t (*layernorm_fn)(mn_float32_t *, mn_float32_t *, mn_float32_t *, mn_float32_t *, mn_float32_t,
+                                    size_t);
+
+static void ref_meanvar(const mn_float32_t *x, size_t n, double *mean, double *var)
+{
+    double s = 0.0, q = 0.0;
+    for (size_t i = 0; i < n; i++) s += x[i];
+    *mean = s / (double)n;
+    for (size_t i = 0; i < n; i++) q += (x[i] - *mean) * (x[i] - *mean);
+    *var = q / (double)n;
+}
+
+/* relative errors of the mean (against mean and spread) and of the variance */
+static int meanvar_ok(const char *name, const mn_float32_t *x, size_t n, mn_float32_t mean, mn_float32_t var,
+                      double tol)
+{
+    double rm, rv;
+    ref_meanvar(x, n, &rm, &rv);
+    const double em = fabs(mean - rm) / (fabs(rm) + sqrt(rv) + 1e-30);
+    const double ev = rv == 0.0 ? fabs(var) : fabs(var - rv) / rv;
+    if (em > tol || ev > tol) {
+        printf("%s n=%zu: mean=%.9g (%.9g), var=%.9g (%.9g)\n", name, n, mean, rm, var, rv);
+        return 1;
+    }
+    return 0;
+}
+
+static int check_meanvar(void)
+{
+    static mn_float32_t x[N];
+    const size_t counts[] = { 255, 256, 257, 512, 1000, N };
+    mn_float32_t mean, var;
+    int fail = 0;
+
+    for (int round = 0; round < 2; round++) {
+        const mn_float32_t centre = round ? 1e4f : 0.0f;
+        for (size_t i = 0; i < N; i++) x[i] = centre + mn_test_uniform(-1.0f, 1.0f);
+        for (size_t n = 1; n <= 40 + sizeof(counts) / sizeof(counts[0]); n++) {
+            const size_t count = n <= 40 ? n : counts[n - 41];
+            fail |= mn_meanvar_float_neon(&mean, &var, x, count) != MN_SUCCESS;
+            fail |= meanvar_ok("meanvar_neon", x, count, mean, var, 1e-6);
+            fail |= mn_meanvar_float_c(&mean, &var, x, count) != MN_SUCCESS;
+            fail |= meanvar_ok("meanvar_c", x, count, mean, var, 1e-6);
+            if (fail) return 1;
+        }
+    }
+
+    for (size_t i = 0; i < N; i++) x[i] = 3.25f;
+    mn_meanvar_float_neon(&mean, &var, x, N);
+    fail |= mean != 3.25f || var != 0.0f;
+    fail |= mn_meanvar_float_neon(&mean, &var, x, 0) != MN_ERROR;
+    fail |= mn_meanvar_float_c(&mean, &var, x, 0) != MN_ERROR;
+    if (fail) printf("meanvar constant / empty input failed\n");
+    return fail;
+}
+
+static int check_layernorm_one(const char *name, layernorm_fn fn, const mn_float32_t *x, const mn_float32_t *gamma,
+                               const mn_float32_t *beta, size_t n)
+{
+    static mn_float32_t y[N], y2[N];
+    double rm, rv;
+    int fail = 0;
+
+    ref_meanvar(x, n, &rm, &rv);
+    fail |= fn(y, (mn_float32_t *)x, (mn_float32_t *)gamma, (mn_float32_t *)beta, EPS, n) != MN_SUCCESS;
+    const double rstd = 1.0 / sqrt(rv + EPS);
+    for (size_t i = 0; i < n; i++) {
+        const double g = gamma ? gamma[i] : 1.0, b = beta ? beta[i] : 0.0;
+        const double z = (x[i] - rm) * rstd;
+        const double ref = z * g + b;
+        if (fabs(y[i] - ref) > 2e-6 * (fabs(z * g) + fabs(b) + 1.0)) {
+            printf("%s n=%zu gamma=%d beta=%d failed at %zu: %.9g, reference %.9g\n", name, n, gamma != NULL,
+                   beta != NULL, i, y[i], ref);
+            return 1;
+        }
+    }
+    memcpy(y2, x, n * sizeof(mn_float32_t));
+    fn(y2, y2, (mn_float32_t *)gamma, (mn_float32_t *)beta, EPS, n);
+    if (memcmp(y, y2, n * sizeof(mn_float32_t)) != 0) {
+        printf("%s n=%zu in-place differs\n", name, n);
+        fail = 1;
+    }
+    return fail;
+}
+
+static int check_layernorm(void)
+{
+    static mn_float32_t x[N], gamma[N], beta[N];
+    static const layernorm_fn fns[2] = { mn_layernorm_float_c, mn_layernorm_float_neon };
+    static const char *names[2] = { "layernorm_c", "layernorm_neon" };
+    int fail = 0;
+
+    for (size_t i = 0; i < N; i++) {
+        x[i] = 5.0f + mn_test_uniform(-3.0f, 3.0f);
+        gamma[i] = mn_test_uniform(0.5f, 2.0f);
+        beta[i] = mn_test_uniform(-1.0f, 1.0f);
+    }
+    for (int k = 0; k < 2; k++) {
+        for (size_t n = 1; n <= 40 && !fail; n++) {
+            fail |= check_layernorm_one(names[k], fns[k], x, gamma, beta, n);
+            fail |= check_layernorm_one(names[k], fns[k], x, NULL, NULL, n);
+        }
+        fail |= check_layernorm_one(names[k], fns[k], x, gamma, beta, N);
+        fail |= check_layernorm_one(names[k], fns[k], x, gamma, NULL, N);
+        fail |= check_layernorm_one(names[k], fns[k], x, NULL, beta, N);
+        fail |= fns[k](x, x, gamma, beta, EPS, 0) != MN_ERROR;
+    }
+    return fail;
+}
+
+static int check_rows(void)
+{
+    enum { ROWS = 7, COLS = 301 };
+    static mn_float32_t x[ROWS * COLS], gamma[COLS], beta[COLS], y[ROWS * COLS], y1[COLS];
+    mn_float32_t mean[ROWS], var[ROWS], m1, v1;
+    int fail = 0;
+
+    for (size_t i = 0; i < ROWS * COLS; i++) x[i] = (mn_float32_t)(i / COLS) * 10.0f + mn_test_uniform(-1.0f, 1.0f);
+    for (size_t i = 0; i < COLS; i++) {
+        gamma[i] = mn_test_uniform(0.5f, 2.0f);
+        beta[i] = mn_test_uniform(-1.0f, 1.0f);
+    }
+
+    fail |= mn_meanvar_rows_float_neon(mean, var, x, ROWS, COLS) != MN_SUCCESS;
+    for (size_t r = 0; r < ROWS; r++) {
+        mn_meanvar_float_neon(&m1, &v1, x + r * COLS, COLS);
+        fail |= m1 != mean[r] || v1 != var[r];
+    }
+    fail |= mn_meanvar_rows_float_c(mean, var, x, ROWS, COLS) != MN_SUCCESS;
+    for (size_t r = 0; r < ROWS; r++) {
+        mn_meanvar_float_c(&m1, &v1, x + r * COLS, COLS);
+        fail |= m1 != mean[r] || v1 != var[r];
+    }
+
+    fail |= mn_layernorm_rows_float_neon(y, x, gamma, beta, EPS, ROWS, COLS) != MN_SUCCESS;
+    for (size_t r = 0; r < ROWS; r++) {
+        mn_layernorm_float_neon(y1, x + r * COLS, gamma, beta, EPS, COLS);
+        fail |= memcmp(y1, y + r * COLS, sizeof(y1)) != 0;
+    }
+    fail |= mn_layernorm_rows_float_c(y, x, gamma, beta, EPS, ROWS, COLS) != MN_SUCCESS;
+    for (size_t r = 0; r < ROWS; r++) {
+        mn_layernorm_float_c(y1, x + r * COLS, gamma, beta, EPS, COLS);
+        fail |= memcmp(y1, y + r * COLS, sizeof(y1)) != 0;
+    }
+    /* in place over the whole array */
+    memcpy(y, x, sizeof(x));
+    mn_layernorm_rows_float_neon(y, y, NULL, NULL, EPS, ROWS, COLS);
+    for (size_t r = 0; r < ROWS; r++) {
+        mn_layernorm_float_neon(y1, x + r * COLS, NULL, NULL, EPS, COLS);
+        fail |= memcmp(y1, y + r * COLS, sizeof(y1)) != 0;
+    }
+    fail |= mn_meanvar_rows_float_neon(mean, var, x, ROWS, 0) != MN_ERROR;
+    fail |= mn_layernorm_rows_float_neon(y, x, gamma, beta, EPS, ROWS, 0) != MN_ERROR;
+    if (fail) printf("rows routines differ from one call per row\n");
+    return fail;
+}
+
+int main(void)
+{
+    int fail = 0;
+
+    mn_test_seed(19u);
+    fail |= check_meanvar();
+    fail |= check_layernorm();
+    fail |= check_rows();
+
+    if (fail) return 1;
+    printf("All meanvar / layernorm tests passed\n");
+    return 0;
+}
@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+
+/*
+    Runs a few NEON kernels with software prefetch enabled and checks that the
+    results still match the C implementation. The count is not a multiple of 4
+    so the prefetch also runs alongside the leftover loops.
+*/
+
+int main(void)
+{
+    int count = 1027;
+    int status = 1;
+    size_t distances[] = { 0, 64, 256, 1024 };
+
+    float* src1_f = (float*)malloc(sizeof(float) * count);
+    float* src2_f = (float*)malloc(sizeof(float) * count);
+    float* dst_f  = (float*)malloc(sizeof(float) * count);
+    float* ref_f  = (float*)malloc(sizeof(float) * count);
+
+    int* src1_i = (int*)malloc(sizeof(int) * count);
+    int* src2_i = (int*)malloc(sizeof(int) * count);
+    int* dst_i  = (int*)malloc(sizeof(int) * count);
+    int* ref_i  = (int*)malloc(sizeof(int) * count);
+
+    mn_vec4f_t* src_v4f = (mn_vec4f_t*)malloc(sizeof(mn_vec4f_t) * count);
+    mn_vec4f_t* dst_v4f = (mn_vec4f_t*)malloc(sizeof(mn_vec4f_t) * count);
+    mn_vec4f_t* ref_v4f = (mn_vec4f_t*)malloc(sizeof(mn_vec4f_t) * count);
+
+    if (!src1_f || !src2_f || !dst_f || !ref_f ||
+        !src1_i || !src2_i || !dst_i || !ref_i ||
+        !src_v4f || !dst_v4f || !ref_v4f)
+    {
+        fprintf(stderr, "malloc failed!\n");
+        return 1;
+    }
+
+    // ==== Fill inputs ====
+    for (int i = 0; i < count; i++)
+    {
+        src1_f[i] = (float)(i + 1) * 0.25f;
+        src2_f[i] = (float)(count - i) * -0.5f;
+        src1_i[i] = (i + 1) * 3;
+        src2_i[i] = -(i + 7);
+
+        src_v4f[i].x = (float)(i + 1);
+        src_v4f[i].y = (float)(i + 1) * -1.1f;
+        src_v4f[i].z = (float)(i + 1) * 1.2f;
+        src_v4f[i].w = (float)(i + 1) * -1.3f;
+    }
+
+    if (mn_get_prefetch_distance() != MN_PREFETCH_DISTANCE)
+    {
+        printf("Initial prefetch distance %zu does not match MN_PREFETCH_DISTANCE\n", mn_get_prefetch_distance());
+        goto cleanup;
+    }
+
+    for (size_t d = 0; d < sizeof(distances) / sizeof(distances[0]); d++)
+    {
+        mn_set_prefetch_distance(distances[d]);
+        if (mn_get_prefetch_distance() != distances[d])
+        {
+            printf("mn_set_prefetch_distance(%zu) was not applied\n", distances[d]);
+            goto cleanup;
+        }
+        printf("Testing with prefetch distance %zu bytes...\n", distances[d]);
+
+        mn_add_float_c(ref_f, src1_f, src2_f, count);
+        mn_add_float_neon(dst_f, src1_f, src2_f, count);
+        for (int i = 0; i < count; i++) {
+            if (dst_f[i] != ref_f[i]) {
+                printf("Float add failed at %d: NEON=%.6f, Reference=%.6f\n", i, dst_f[i], ref_f[i]);
+                goto cleanup;
+            }
+        }
+
+        mn_add_int32_c(ref_i, src1_i, src2_i, count);
+        mn_add_int32_neon(dst_i, src1_i, src2_i, count);
+        for (int i = 0; i < count; i++) {
+            if (dst_i[i] != ref_i[i]) {
+                printf("Int32 add failed at %d: NEON=%d, Reference=%d\n", i, dst_i[i], ref_i[i]);
+                goto cleanup;
+            }
+        }
+
+        mn_mulc_float_c(ref_f, src2_f, 1.5f, count);
+        mn_mulc_float_neon(dst_f, src2_f, 1.5f, count);
+        for (int i = 0; i < count; i++) {
+            if (dst_f[i] != ref_f[i]) {
+                printf("Float mulc failed at %d: NEON=%.6f, Reference=%.6f\n", i, dst_f[i], ref_f[i]);
+                goto cleanup;
+            }
+        }
+
+        mn_abs_vec4f_c(ref_v4f, src_v4f, count);
+        mn_abs_vec4f_neon(dst_v4f, src_v4f, count);
+        for (int i = 0; i < count; i++) {
+            if (dst_v4f[i].x != ref_v4f[i].x || dst_v4f[i].y != ref_v4f[i].y ||
+                dst_v4f[i].z != ref_v4f[i].z || dst_v4f[i].w != ref_v4f[i].w) {
+                printf("Vec4f abs failed at %d\n", i);
+                goto cleanup;
+            }
+        }
+    }
+
+    printf("All prefetch tests passed!\n");
+    status = 0;
+
+cleanup:
+    mn_set_prefetch_distance(MN_PREFETCH_DISTANCE);
+    free(src1_f); free(src2_f); free(dst_f); free(ref_f);
+    free(src1_i); free(src2_i); free(dst_i); free(ref_i);
+    free(src_v4f); free(dst_v4f); free(ref_v4f);
+
+    return status;
+}
@@ -0,0 +1,237 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    scan tests:
+      1. int32 / vec2i / vec3i / vec4i inclusive and exclusive scans (C and
+         NEON) equal a reference loop exactly, for counts 0 .. 40 and 1001,
+         with values large enough to wrap.
+      2. float / vec2f / vec3f / vec4f scans against a double reference,
+         within (n + 8) * FLT_EPSILON * sum(|x|) of each prefix.
+      3. The NEON exclusive scan is the inclusive scan shifted by one element,
+         and in-place scans give the same result as out of place.
+      4. With 4 threads, int scans of huge arrays equal the single thread
+         result and float scans stay within the bound of test 2.
+*/
+
+#define N 1001
+#define HUGE_N ((size_t)1200007)
+
+typedef mn_result_t (*scan_i_fn)(mn_int32_t *, mn_int32_t *, size_t);
+typedef mn_result_t (*scan_f_fn)(mn_float32_t *, mn_float32_t *, size_t);
+
+/* flat wrappers so every type goes through one table */
+#define WRAP(NAME, TYPE, BASE) \
+    static mn_result_t inc_##NAME##_c(BASE *d, BASE *s, size_t n) { return mn_scan_inclusive_##NAME##_c((TYPE *)d, (TYPE *)s, n); } \
+    static mn_result_t exc_##NAME##_c(BASE *d, BASE *s, size_t n) { return mn_scan_exclusive_##NAME##_c((TYPE *)d, (TYPE *)s, n); } \
+    static mn_result_t inc_##NAME##_neon(BASE *d, BASE *s, size_t n) { return mn_scan_inclusive_##NAME##_neon((TYPE *)d, (TYPE *)s, n); } \
+    static mn_result_t exc_##NAME##_neon(BASE *d, BASE *s, size_t n) { return mn_scan_exclusive_##NAME##_neon((TYPE *)d, (TYPE *)s, n); }
+
+WRAP(int32, mn_int32_t, mn_int32_t)
+WRAP(vec2i, mn_vec2i_t, mn_int32_t)
+WRAP(vec3i, mn_vec3i_t, mn_int32_t)
+WRAP(vec4i, mn_vec4i_t, mn_int32_t)
+WRAP(float, mn_float32_t, mn_float32_t)
+WRAP(vec2f, mn_vec2f_t, mn_float32_t)
+WRAP(vec3f, mn_vec3f_t, mn_float32_t)
+WRAP(vec4f, mn_vec4f_t, mn_float32_t)
+
+typedef struct
+{
+    const char *name;
+    size_t comps;
+    scan_i_fn fn[4];    /* inclusive C, exclusive C, inclusive NEON, exclusive NEON */
+} int_case_t;
+
+typedef struct
+{
+    const char *name;
+    size_t comps;
+    scan_f_fn fn[4];
+} float_case_t;
+
+static const int_case_t int_cases[] = {
+    { "int32", 1, { inc_int32_c, exc_int32_c, inc_int32_neon, exc_int32_neon } },
+    { "vec2i", 2, { inc_vec2i_c, exc_vec2i_c, inc_vec2i_neon, exc_vec2i_neon } },
+    { "vec3i", 3, { inc_vec3i_c, exc_vec3i_c, inc_vec3i_neon, exc_vec3i_neon } },
+    { "vec4i", 4, { inc_vec4i_c, exc_vec4i_c, inc_vec4i_neon, exc_vec4i_neon } },
+};
+
+static const float_case_t float_cases[] = {
+    { "float", 1, { inc_float_c, exc_float_c, inc_float_neon, exc_float_neon } },
+    { "vec2f", 2, { inc_vec2f_c, exc_vec2f_c, inc_vec2f_neon, exc_vec2f_neon } },
+    { "vec3f", 3, { inc_vec3f_c, exc_vec3f_c, inc_vec3f_neon, exc_vec3f_neon } },
+    { "vec4f", 4, { inc_vec4f_c, exc_vec4f_c, inc_vec4f_neon, exc_vec4f_neon } },
+};
+
+static const char *fn_names[4] = { "inclusive_c", "exclusive_c", "inclusive_neon", "exclusive_neon" };
+
+static int check_int(const int_case_t *c, const mn_int32_t *x, mn_int32_t *y, mn_int32_t *y2, size_t n)
+{
+    int fail = 0;
+    for (int f = 0; f < 4; f++) {
+        const int exclusive = f & 1;
+        fail |= c->fn[f](y, (mn_int32_t *)x, n) != MN_SUCCESS;
+        for (size_t k = 0; k < c->comps; k++) {
+            uint32_t acc = 0;
+            for (size_t i = 0; i < n; i++) {
+                const uint32_t v = (uint32_t)x[i * c->comps + k];
+                const mn_int32_t ref = (mn_int32_t)(exclusive ? acc : acc + v);
+                acc += v;
+                if (y[i * c->comps + k] != ref) {
+                    printf("%s %s n=%zu failed at %zu.%zu: %d, reference %d\n", c->name, fn_names[f], n, i, k,
+                           y[i * c->comps + k], ref);
+                    return 1;
+                }
+            }
+        }
+        memcpy(y2, x, n * c->comps * sizeof(mn_int32_t));
+        c->fn[f](y2, y2, n);
+        if (memcmp(y, y2, n * c->comps * sizeof(mn_int32_t)) != 0) {
+            printf("%s %s n=%zu in-place differs\n", c->name, fn_names[f], n);
+            fail = 1;
+        }
+    }
+    return fail;
+}
+
+/* err <= (n + 8) * FLT_EPSILON * sum(|x|) for every prefix; returns 1 on failure */
+static int float_ok(const char *name, const char *fn, const mn_float32_t *x, const mn_float32_t *y, size_t n,
+                    size_t comps, int exclusive)
+{
+    for (size_t k = 0; k < comps; k++) {
+        double acc = 0.0, mag = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            const double v = x[i * comps + k];
+            const double ref = exclusive ? acc : acc + v;
+            const double bound = (double)(i + 8) * FLT_EPSILON * (exclusive ? mag : mag + fabs(v));
+            acc += v;
+            mag += fabs(v);
+            if (fabs(y[i * comps + k] - ref) > bound) {
+                printf("%s %s n=%zu failed at %zu.%zu: %.9g, reference %.9g\n", name, fn, n, i, k,
+                       y[i * comps + k], ref);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int check_float(const float_case_t *c, const mn_float32_t *x, mn_float32_t *y, mn_float32_t *y2, size_t n)
+{
+    const size_t len = n * c->comps;
+    int fail = 0;
+    for (int f = 0; f < 4; f++) {
+        fail |= c->fn[f](y, (mn_float32_t *)x, n) != MN_SUCCESS;
+        fail |= float_ok(c->name, fn_names[f], x, y, n, c->comps, f & 1);
+        memcpy(y2, x, len * sizeof(mn_float32_t));
+        c->fn[f](y2, y2, n);
+        if (memcmp(y, y2, len * sizeof(mn_float32_t)) != 0) {
+            printf("%s %s n=%zu in-place differs\n", c->name, fn_names[f], n);
+            fail = 1;
+        }
+    }
+    /* NEON exclusive = inclusive shifted by one element */
+    c->fn[2](y, (mn_float32_t *)x, n);
+    c->fn[3](y2, (mn_float32_t *)x, n);
+    for (size_t i = 0; i < len; i++) {
+        const mn_float32_t want = i < c->comps ? 0.0f : y[i - c->comps];
+        if (y2[i] != want) {
+            printf("%s n=%zu exclusive is not the shifted inclusive scan at %zu\n", c->name, n, i);
+            return 1;
+        }
+    }
+    return fail;
+}
+
+static int check_small(void)
+{
+    static mn_int32_t xi[N * 4], yi[N * 4], yi2[N * 4];
+    static mn_float32_t xf[N * 4], yf[N * 4], yf2[N * 4];
+    int fail = 0;
+
+    for (size_t i = 0; i < N * 4; i++) {
+        xi[i] = mn_test_int32();
+        xf[i] = mn_test_uniform(-100.0f, 100.0f);
+    }
+    for (size_t t = 0; t < 4 && !fail; t++) {
+        for (size_t n = 0; n <= 41 && !fail; n++) {
+            const size_t count = n <= 40 ? n : N;
+            fail |= check_int(&int_cases[t], xi, yi, yi2, count);
+            fail |= check_float(&float_cases[t], xf, yf, yf2, count);
+        }
+    }
+    return fail;
+}
+
+static int check_threads(void)
+{
+    mn_int32_t *xi = (mn_int32_t *)malloc(HUGE_N * 3 * sizeof(mn_int32_t));
+    mn_int32_t *yi = (mn_int32_t *)malloc(HUGE_N * 3 * sizeof(mn_int32_t));
+    mn_int32_t *yi2 = (mn_int32_t *)malloc(HUGE_N * 3 * sizeof(mn_int32_t));
+    mn_float32_t *xf = (mn_float32_t *)malloc(HUGE_N * sizeof(mn_float32_t));
+    mn_float32_t *yf = (mn_float32_t *)malloc(HUGE_N * sizeof(mn_float32_t));
+    int fail = 0;
+
+    if (!xi || !yi || !yi2 || !xf || !yf) {
+        printf("out of memory\n");
+        return 1;
+    }
+    for (size_t i = 0; i < HUGE_N * 3; i++) xi[i] = mn_test_int32();
+    for (size_t i = 0; i < HUGE_N; i++) xf[i] = mn_test_uniform(0.0f, 1.0f);
+
+    for (int exclusive = 0; exclusive < 2; exclusive++) {
+        const scan_i_fn fi = int_cases[0].fn[2 + exclusive];
+        const scan_i_fn fv = int_cases[2].fn[2 + exclusive];
+        const scan_f_fn ff = float_cases[0].fn[2 + exclusive];
+
+        mn_set_threads(1);
+        fi(yi, xi, HUGE_N);
+        mn_set_threads(4);
+        fail |= fi(yi2, xi, HUGE_N) != MN_SUCCESS;
+        fail |= memcmp(yi, yi2, HUGE_N * sizeof(mn_int32_t)) != 0;
+        memcpy(yi2, xi, HUGE_N * sizeof(mn_int32_t));
+        fi(yi2, yi2, HUGE_N);
+        fail |= memcmp(yi, yi2, HUGE_N * sizeof(mn_int32_t)) != 0;
+
+        mn_set_threads(1);
+        fv(yi, xi, HUGE_N);
+        mn_set_threads(4);
+        fail |= fv(yi2, xi, HUGE_N) != MN_SUCCESS;
+        fail |= memcmp(yi, yi2, HUGE_N * 3 * sizeof(mn_int32_t)) != 0;
+        if (fail) printf("threaded int scan (exclusive=%d) differs from one thread\n", exclusive);
+
+        fail |= ff(yf, xf, HUGE_N) != MN_SUCCESS;
+        fail |= float_ok("float", exclusive ? "exclusive threaded" : "inclusive threaded", xf, yf, HUGE_N, 1,
+                         exclusive);
+    }
+    fail |= mn_get_threads() != 4;
+    mn_set_threads(1);
+
+    free(xi);
+    free(yi);
+    free(yi2);
+    free(xf);
+    free(yf);
+    return fail;
+}
+
+int main(void)
+{
+    int fail = 0;
+
+    mn_test_seed(23u);
+    fail |= check_small();
+    fail |= check_threads();
+
+    if (fail) return 1;
+    printf("All scan tests passed\n");
+    return 0;
+}
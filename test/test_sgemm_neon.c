@@ -0,0 +1,91 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    SGEMM tests, mn_sgemm_neon against mn_sgemm_c:
+      1. Shapes below, at and across the 8x12 tile and the cache blocks,
+         with padded leading dimensions.
+      2. alpha / beta, including beta == 0 over a C full of NaN.
+      3. K == 0 and alpha == 0 (C = beta * C).
+      4. Multi-threaded runs split over rows and over columns.
+*/
+
+static int run_case(size_t M, size_t N, size_t K, size_t pad, mn_float32_t alpha, mn_float32_t beta, int nan_c)
+{
+    const size_t lda = M + pad, ldb = K + pad, ldc = M + pad;
+    mn_float32_t* A = (mn_float32_t*)malloc(sizeof(mn_float32_t) * (lda * K + 1));
+    mn_float32_t* B = (mn_float32_t*)malloc(sizeof(mn_float32_t) * (ldb * N + 1));
+    mn_float32_t* Cn = (mn_float32_t*)malloc(sizeof(mn_float32_t) * (ldc * N + 1));
+    mn_float32_t* Cc = (mn_float32_t*)malloc(sizeof(mn_float32_t) * (ldc * N + 1));
+    int fail = 0;
+    if (!A || !B || !Cn || !Cc) {
+        fprintf(stderr, "malloc failed!\n");
+        exit(1);
+    }
+    for (size_t i = 0; i < lda * K; i++) A[i] = mn_test_uniform(-1.0f, 1.0f);
+    for (size_t i = 0; i < ldb * N; i++) B[i] = mn_test_uniform(-1.0f, 1.0f);
+    for (size_t i = 0; i < ldc * N; i++) Cn[i] = Cc[i] = nan_c ? NAN : mn_test_uniform(-1.0f, 1.0f);
+
+    if (mn_sgemm_neon(M, N, K, A, lda, B, ldb, Cn, ldc, alpha, beta) != MN_SUCCESS ||
+        mn_sgemm_c(M, N, K, A, lda, B, ldb, Cc, ldc, alpha, beta) != MN_SUCCESS) {
+        printf("sgemm %zux%zux%zu returned an error\n", M, N, K);
+        fail = 1;
+    }
+    /* rounding differs with the summation order: allow a K proportional error */
+    const mn_float32_t tol = 1e-6f * (mn_float32_t)(K + 4) * (fabsf(alpha) + fabsf(beta) + 1.0f);
+    for (size_t j = 0; j < N && !fail; j++) {
+        for (size_t i = 0; i < ldc; i++) {
+            mn_float32_t got = Cn[i + j * ldc], ref = Cc[i + j * ldc];
+            /* rows in the padding must stay untouched (both NaN or equal) */
+            int bad = i < M ? !(fabsf(got - ref) <= tol) : memcmp(&got, &ref, sizeof(got)) != 0;
+            if (bad) {
+                printf("sgemm M=%zu N=%zu K=%zu pad=%zu alpha=%g beta=%g failed at (%zu, %zu): NEON=%f, Reference=%f\n",
+                       M, N, K, pad, alpha, beta, i, j, got, ref);
+                fail = 1;
+                break;
+            }
+        }
+    }
+    free(A); free(B); free(Cn); free(Cc);
+    return fail;
+}
+
+int main(void)
+{
+    static const size_t shapes[][3] = {
+        { 1, 1, 1 }, { 8, 12, 1 }, { 7, 11, 5 }, { 9, 13, 17 }, { 16, 24, 32 },
+        { 33, 50, 70 }, { 130, 40, 260 }, { 40, 390, 300 }, { 129, 385, 257 },
+    };
+    int fail = 0;
+
+    mn_test_seed(99u);
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        const size_t M = shapes[s][0], N = shapes[s][1], K = shapes[s][2];
+        fail |= run_case(M, N, K, 0, 1.0f, 0.0f, 1);
+        fail |= run_case(M, N, K, 3, -0.5f, 2.0f, 0);
+        fail |= run_case(M, N, K, 1, 1.5f, 1.0f, 0);
+    }
+
+    /* K == 0 and alpha == 0 only scale C */
+    fail |= run_case(20, 30, 0, 2, 1.0f, 0.5f, 0);
+    fail |= run_case(20, 30, 10, 2, 0.0f, -1.0f, 0);
+    fail |= run_case(20, 30, 10, 0, 0.0f, 0.0f, 1);
+
+    /* threads: split over rows (M > N) and over columns */
+    mn_set_threads(4);
+    fail |= run_case(300, 100, 200, 1, 1.0f, 0.25f, 0);
+    fail |= run_case(100, 301, 200, 0, 2.0f, 0.0f, 1);
+    mn_set_threads(0);
+    fail |= run_case(257, 255, 129, 0, 1.0f, 1.0f, 0);
+    mn_set_threads(1);
+
+    if (fail) return 1;
+    printf("All sgemm tests passed\n");
+    return 0;
+}
@@ -0,0 +1,207 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    sort tests:
+      1. sort float / int32, C and NEON, against qsort for counts 0 .. 40,
+         1003 and 4099: the same keys bit for bit.
+      2. Float data holds duplicates, -0 / +0, +-inf and NaNs of both signs,
+         ordered -NaN < -inf < ... < -0 < +0 < ... < +inf < +NaN.
+      3. Int data holds INT32_MIN / INT32_MAX and many duplicates.
+      4. kv forms: the keys as above and every value still paired with its
+         key (values are the source indices, so they must be a permutation);
+         the C version keeps equal keys in input order.
+      5. Keys equal to the largest key (INT32_MAX, the NaN 0x7fffffff) keep
+         their values.
+      6. In place with dst == src and dst_values == src_values; nothing past
+         dst[count - 1] is written.
+*/
+
+#define N 4099
+#define GUARD 8
+
+typedef mn_result_t (*sort_f_fn)(mn_float32_t *, mn_float32_t *, size_t);
+typedef mn_result_t (*sort_i_fn)(mn_int32_t *, mn_int32_t *, size_t);
+typedef mn_result_t (*sort_kv_f_fn)(mn_float32_t *, mn_uint32_t *, mn_float32_t *, mn_uint32_t *, size_t);
+typedef mn_result_t (*sort_kv_i_fn)(mn_int32_t *, mn_uint32_t *, mn_int32_t *, mn_uint32_t *, size_t);
+
+static const sort_f_fn sort_f[2] = { mn_sort_float_c, mn_sort_float_neon };
+static const sort_i_fn sort_i[2] = { mn_sort_int32_c, mn_sort_int32_neon };
+static const sort_kv_f_fn sort_kv_f[2] = { mn_sort_kv_float_c, mn_sort_kv_float_neon };
+static const sort_kv_i_fn sort_kv_i[2] = { mn_sort_kv_int32_c, mn_sort_kv_int32_neon };
+static const char *impl_names[2] = { "c", "neon" };
+
+static const size_t counts[] = { 1003, 4099 };
+
+/* the float order of the sorts, on the bits */
+static int32_t float_key(mn_float32_t x)
+{
+    int32_t b;
+    memcpy(&b, &x, sizeof(b));
+    return b < 0 ? b ^ 0x7fffffff : b;
+}
+
+static int cmp_float(const void *a, const void *b)
+{
+    const int32_t x = float_key(*(const mn_float32_t *)a), y = float_key(*(const mn_float32_t *)b);
+    return (x > y) - (x < y);
+}
+
+static int cmp_int(const void *a, const void *b)
+{
+    const mn_int32_t x = *(const mn_int32_t *)a, y = *(const mn_int32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static mn_float32_t from_bits(uint32_t b)
+{
+    mn_float32_t x;
+    memcpy(&x, &b, sizeof(x));
+    return x;
+}
+
+static size_t count_of(size_t n)
+{
+    return n <= 40 ? n : counts[n - 41];
+}
+
+/* values hold source indices: a permutation, each pointing at its key, in order for stable sorts */
+static int check_values(const char *name, const void *keys, const void *src, const mn_uint32_t *values, size_t count,
+                        int stable)
+{
+    static unsigned char seen[N];
+    memset(seen, 0, sizeof(seen));
+    for (size_t i = 0; i < count; i++) {
+        const mn_uint32_t v = values[i];
+        if (v >= count || seen[v] || memcmp((const int32_t *)keys + i, (const int32_t *)src + v, 4) != 0 ||
+            (stable && i > 0 && memcmp((const int32_t *)keys + i - 1, (const int32_t *)keys + i, 4) == 0 &&
+             values[i - 1] > v)) {
+            printf("%s n=%zu failed: value %u at %zu\n", name, count, v, i);
+            return 1;
+        }
+        seen[v] = 1;
+    }
+    return 0;
+}
+
+static int check_float(void)
+{
+    static mn_float32_t x[N], want[N], d[N + GUARD], d2[N];
+    static mn_uint32_t idx[N], dv[N + GUARD], dv2[N];
+    char name[64];
+    int fail = 0;
+
+    for (size_t i = 0; i < N; i++) {
+        switch (i % 23) {
+        case 3: x[i] = NAN; break;
+        case 5: x[i] = -NAN; break;
+        case 7: x[i] = INFINITY; break;
+        case 11: x[i] = -INFINITY; break;
+        case 13: x[i] = (i & 32) ? -0.0f : 0.0f; break;
+        case 17: x[i] = from_bits(0x7fffffffu); break;           /* the largest key */
+        default: x[i] = (mn_float32_t)((int)(mn_test_bits() % 2001) - 1000) * 0.25f; break;  /* duplicates */
+        }
+        idx[i] = (mn_uint32_t)i;
+    }
+    for (int k = 0; k < 2; k++) {
+        for (size_t n = 0; n <= 42 && !fail; n++) {
+            const size_t count = count_of(n);
+
+            memcpy(want, x, count * sizeof(mn_float32_t));
+            qsort(want, count, sizeof(mn_float32_t), cmp_float);
+
+            for (size_t i = 0; i < N + GUARD; i++) d[i] = -7.0f;
+            snprintf(name, sizeof(name), "sort_float_%s", impl_names[k]);
+            fail |= sort_f[k](d, x, count) != MN_SUCCESS;
+            fail |= memcmp(d, want, count * sizeof(mn_float32_t)) != 0;
+            for (size_t i = count; i < N + GUARD; i++) fail |= d[i] != -7.0f;
+            memcpy(d2, x, count * sizeof(mn_float32_t));
+            sort_f[k](d2, d2, count);
+            fail |= memcmp(d2, want, count * sizeof(mn_float32_t)) != 0;
+            if (fail) printf("%s n=%zu failed\n", name, count);
+
+            for (size_t i = 0; i < N + GUARD; i++) dv[i] = 0xdeadu;
+            snprintf(name, sizeof(name), "sort_kv_float_%s", impl_names[k]);
+            fail |= sort_kv_f[k](d, dv, x, idx, count) != MN_SUCCESS;
+            fail |= memcmp(d, want, count * sizeof(mn_float32_t)) != 0;
+            fail |= check_values(name, d, x, dv, count, k == 0);
+            for (size_t i = count; i < N + GUARD; i++) fail |= dv[i] != 0xdeadu;
+            memcpy(d2, x, count * sizeof(mn_float32_t));
+            memcpy(dv2, idx, count * sizeof(mn_uint32_t));
+            sort_kv_f[k](d2, dv2, d2, dv2, count);
+            fail |= memcmp(d2, want, count * sizeof(mn_float32_t)) != 0;
+            fail |= check_values("in place", d2, x, dv2, count, k == 0);
+            if (fail) printf("%s n=%zu failed\n", name, count);
+        }
+    }
+    return fail;
+}
+
+static int check_int(void)
+{
+    static mn_int32_t x[N], want[N], d[N + GUARD], d2[N];
+    static mn_uint32_t idx[N], dv[N + GUARD], dv2[N];
+    char name[64];
+    int fail = 0;
+
+    for (size_t i = 0; i < N; i++) {
+        switch (i % 19) {
+        case 2: x[i] = -2147483647 - 1; break;
+        case 9: x[i] = 2147483647; break;
+        case 4: case 14: x[i] = (mn_int32_t)(mn_test_bits() % 8); break;      /* duplicates */
+        default: x[i] = (mn_int32_t)(mn_test_bits() << 8) ^ (mn_int32_t)mn_test_bits(); break;
+        }
+        idx[i] = (mn_uint32_t)i;
+    }
+    for (int k = 0; k < 2; k++) {
+        for (size_t n = 0; n <= 42 && !fail; n++) {
+            const size_t count = count_of(n);
+
+            memcpy(want, x, count * sizeof(mn_int32_t));
+            qsort(want, count, sizeof(mn_int32_t), cmp_int);
+
+            for (size_t i = 0; i < N + GUARD; i++) d[i] = -7;
+            snprintf(name, sizeof(name), "sort_int32_%s", impl_names[k]);
+            fail |= sort_i[k](d, x, count) != MN_SUCCESS;
+            fail |= memcmp(d, want, count * sizeof(mn_int32_t)) != 0;
+            for (size_t i = count; i < N + GUARD; i++) fail |= d[i] != -7;
+            memcpy(d2, x, count * sizeof(mn_int32_t));
+            sort_i[k](d2, d2, count);
+            fail |= memcmp(d2, want, count * sizeof(mn_int32_t)) != 0;
+            if (fail) printf("%s n=%zu failed\n", name, count);
+
+            for (size_t i = 0; i < N + GUARD; i++) dv[i] = 0xdeadu;
+            snprintf(name, sizeof(name), "sort_kv_int32_%s", impl_names[k]);
+            fail |= sort_kv_i[k](d, dv, x, idx, count) != MN_SUCCESS;
+            fail |= memcmp(d, want, count * sizeof(mn_int32_t)) != 0;
+            fail |= check_values(name, d, x, dv, count, k == 0);
+            for (size_t i = count; i < N + GUARD; i++) fail |= dv[i] != 0xdeadu;
+            memcpy(d2, x, count * sizeof(mn_int32_t));
+            memcpy(dv2, idx, count * sizeof(mn_uint32_t));
+            sort_kv_i[k](d2, dv2, d2, dv2, count);
+            fail |= memcmp(d2, want, count * sizeof(mn_int32_t)) != 0;
+            fail |= check_values("in place", d2, x, dv2, count, k == 0);
+            if (fail) printf("%s n=%zu failed\n", name, count);
+        }
+    }
+    return fail;
+}
+
+int main(void)
+{
+    int fail = 0;
+
+    mn_test_seed(37u);
+    fail |= check_float();
+    fail |= check_int();
+
+    if (fail) return 1;
+    printf("All sort tests passed\n");
+    return 0;
+}
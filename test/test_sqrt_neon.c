@@ -0,0 +1,166 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    sqrt / rsqrt / recip tests:
+      1. The C versions give the libm results in every tier.
+      2. NEON against a double precision reference: the precise tier equals
+         the C version, the other tiers stay within their documented bounds.
+      3. +-0, +-inf, negative values and NaN give the IEEE results in every tier,
+         and recip of subnormals gives +-inf with the sign of x.
+      4. The vec2f / vec3f / vec4f routines match the float routine on the same
+         floats, for counts 0 .. 13 and in place.
+      5. Unknown accuracy values return MN_ERROR.
+*/
+
+#define N 4099
+#define TIERS 4
+
+typedef mn_result_t (*float_fn)(mn_float32_t *, mn_float32_t *, size_t, int);
+
+static const char *tier_name[TIERS] = { "precise", "fast", "ultra", "estimate" };
+
+static double ref_sqrt(double x) { return sqrt(x); }
+static double ref_rsqrt(double x) { return 1.0 / sqrt(x); }
+static double ref_recip(double x) { return 1.0 / x; }
+static float libm_sqrt(float x) { return sqrtf(x); }
+static float libm_rsqrt(float x) { return 1.0f / sqrtf(x); }
+static float libm_recip(float x) { return 1.0f / x; }
+
+typedef struct
+{
+    const char *name;
+    float_fn c, neon;
+    mn_result_t (*neon2)(mn_vec2f_t *, mn_vec2f_t *, size_t, int);
+    mn_result_t (*neon3)(mn_vec3f_t *, mn_vec3f_t *, size_t, int);
+    mn_result_t (*neon4)(mn_vec4f_t *, mn_vec4f_t *, size_t, int);
+    float (*libm)(float);
+    double (*ref)(double);
+} case_t;
+
+static const case_t cases[] = {
+    { "sqrt", mn_sqrt_float_c, mn_sqrt_float_neon,
+      mn_sqrt_vec2f_neon, mn_sqrt_vec3f_neon, mn_sqrt_vec4f_neon, libm_sqrt, ref_sqrt },
+    { "rsqrt", mn_rsqrt_float_c, mn_rsqrt_float_neon,
+      mn_rsqrt_vec2f_neon, mn_rsqrt_vec3f_neon, mn_rsqrt_vec4f_neon, libm_rsqrt, ref_rsqrt },
+    { "recip", mn_recip_float_c, mn_recip_float_neon,
+      mn_recip_vec2f_neon, mn_recip_vec3f_neon, mn_recip_vec4f_neon, libm_recip, ref_recip },
+};
+
+/* within the bound of the tier (error in ULP for fast, relative below) */
+static int within(int tier, mn_float32_t got, double ref)
+{
+    switch (tier) {
+    case MN_ACCURACY_FAST:  return mn_test_ulp_error(got, ref) <= 3.0;
+    case MN_ACCURACY_ULTRA: return fabs(got - ref) <= 2e-5 * fabs(ref);
+    default:                return fabs(got - ref) <= 4e-3 * fabs(ref);
+    }
+}
+
+static int check_values(const case_t *cs)
+{
+    static mn_float32_t x[N], yc[N], yn[N];
+    int fail = 0;
+
+    for (size_t i = 0; i < N; i++) {
+        /* spread over the exponents (recip: below 2^126, whose result is normal), then [0.25, 4] */
+        x[i] = i % 2 ? expf(mn_test_uniform(-87.0f, 87.0f)) : mn_test_uniform(0.25f, 4.0f);
+        if (cs->ref == ref_recip && i % 3 == 0) x[i] = -x[i];
+    }
+    for (int tier = 0; tier < TIERS; tier++) {
+        fail |= cs->c(yc, x, N, tier) != MN_SUCCESS;
+        fail |= cs->neon(yn, x, N, tier) != MN_SUCCESS;
+        for (size_t i = 0; i < N; i++) {
+            if (yc[i] != cs->libm(x[i])) {
+                printf("%s_c %s differs from libm at %a\n", cs->name, tier_name[tier], x[i]);
+                return 1;
+            }
+            const int ok = tier == MN_ACCURACY_PRECISE ? yn[i] == yc[i] : within(tier, yn[i], cs->ref(x[i]));
+            if (!ok) {
+                printf("%s %s failed at %a: NEON=%a, Reference=%a\n", cs->name, tier_name[tier], x[i], yn[i],
+                       cs->ref(x[i]));
+                fail = 1;
+                break;
+            }
+        }
+    }
+    fail |= cs->neon(yn, x, 4, 4) != MN_ERROR;
+    fail |= cs->c(yn, x, 4, -1) != MN_ERROR;
+    return fail;
+}
+
+static int check_special(const case_t *cs)
+{
+    const mn_float32_t sp[] = { 0.0f, -0.0f, INFINITY, -INFINITY, NAN, -1.0f, -1e-30f, 1.0f, 4.0f };
+    /* recip: the estimate of these is infinite (|x| < 2^-128) */
+    const mn_float32_t sub[] = { 1e-39f, -1e-39f, 1e-45f, -1e-45f };
+    const size_t n = sizeof(sp) / sizeof(sp[0]) + (cs->ref == ref_recip ? sizeof(sub) / sizeof(sub[0]) : 0);
+    mn_float32_t x[16], y[16];
+    int fail = 0;
+
+    memcpy(x, sp, sizeof(sp));
+    memcpy(x + sizeof(sp) / sizeof(sp[0]), sub, sizeof(sub));
+    for (int tier = 0; tier < TIERS; tier++) {
+        cs->neon(y, x, n, tier);
+        for (size_t i = 0; i < n; i++) {
+            const mn_float32_t want = cs->libm(x[i]);
+            const int ok = isnan(want) ? isnan(y[i])
+                         : (want == 0.0f || isinf(want)) ? memcmp(&y[i], &want, sizeof(want)) == 0
+                         : tier == MN_ACCURACY_PRECISE ? y[i] == want : within(tier, y[i], cs->ref(x[i]));
+            if (!ok) {
+                printf("%s %s special %a: NEON=%a, libm=%a\n", cs->name, tier_name[tier], x[i], y[i], want);
+                fail = 1;
+            }
+        }
+    }
+    return fail;
+}
+
+static int check_vec(const case_t *cs)
+{
+    mn_float32_t x[4 * 13], want[4 * 13], got[4 * 13];
+    int fail = 0;
+
+    for (size_t i = 0; i < 4 * 13; i++) x[i] = mn_test_uniform(0.01f, 100.0f);
+    for (int tier = 0; tier < TIERS; tier++) {
+        for (int lanes = 2; lanes <= 4; lanes++) {
+            for (size_t count = 0; count <= 13; count++) {
+                cs->neon(want, x, count * lanes, tier);
+                memcpy(got, x, sizeof(x));
+                mn_result_t r;
+                if (lanes == 2) r = cs->neon2((mn_vec2f_t *)got, (mn_vec2f_t *)got, count, tier);
+                else if (lanes == 3) r = cs->neon3((mn_vec3f_t *)got, (mn_vec3f_t *)got, count, tier);
+                else r = cs->neon4((mn_vec4f_t *)got, (mn_vec4f_t *)got, count, tier);
+                fail |= r != MN_SUCCESS;
+                if (memcmp(got, want, count * lanes * sizeof(mn_float32_t)) != 0) {
+                    printf("%s vec%df %s count=%zu differs from the float routine\n", cs->name, lanes,
+                           tier_name[tier], count);
+                    return 1;
+                }
+            }
+        }
+    }
+    return fail;
+}
+
+int main(void)
+{
+    int fail = 0;
+
+    mn_test_seed(13u);
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        fail |= check_values(&cases[i]);
+        fail |= check_special(&cases[i]);
+        fail |= check_vec(&cases[i]);
+    }
+
+    if (fail) return 1;
+    printf("All sqrt / rsqrt / recip tests passed\n");
+    return 0;
+}
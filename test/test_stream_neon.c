@@ -0,0 +1,162 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+
+/*
+    Streaming tests:
+      1. mn_stream_binary over plain arrays with a small chunk, with and
+         without the I/O thread.
+      2. mn_stream_map_file: write a float column through a writable map,
+         map it read-only again and stream mn_abs_float_neon over it.
+      3. mn_stream_chunks with an in-memory reader/writer and a constant op.
+    The count is not a multiple of the chunk or of 4.
+*/
+
+#define COUNT 10007
+#define MAP_PATH "mn_stream_test.bin"
+
+typedef struct
+{
+    const float* src1;
+    const float* src2;
+    float*       out;
+    size_t       count;
+    size_t       pos;
+    size_t       written;
+} mem_stream_t;
+
+static size_t mem_read(void* ctx, void* src1, void* src2, size_t max_count)
+{
+    mem_stream_t* m = (mem_stream_t*)ctx;
+    size_t n = m->count - m->pos < max_count ? m->count - m->pos : max_count;
+    memcpy(src1, m->src1 + m->pos, n * sizeof(float));
+    if (src2 != NULL) {
+        memcpy(src2, m->src2 + m->pos, n * sizeof(float));
+    }
+    m->pos += n;
+    return n;
+}
+
+static mn_result_t mem_write(void* ctx, const void* dst, size_t count)
+{
+    mem_stream_t* m = (mem_stream_t*)ctx;
+    memcpy(m->out + m->written, dst, count * sizeof(float));
+    m->written += count;
+    return MN_SUCCESS;
+}
+
+MN_STREAM_DEFINE_UNARY(mn_abs_float_neon, mn_float32_t)
+MN_STREAM_DEFINE_BINARY(mn_add_float_neon, mn_float32_t)
+MN_STREAM_DEFINE_BINARY(mn_sub_float_neon, mn_float32_t)
+
+static mn_result_t mulc_kernel(void* ctx, void* dst, void* src1, void* src2, size_t count)
+{
+    (void)src2;
+    return mn_mulc_float_neon((float*)dst, (float*)src1, *(const float*)ctx, count);
+}
+
+static int compare(const char* name, const float* got, const float* ref, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        if (got[i] != ref[i]) {
+            printf("%s failed at %zu: stream=%.6f, Reference=%.6f\n", name, i, got[i], ref[i]);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(void)
+{
+    int failed = 0;
+    float* src1 = (float*)malloc(sizeof(float) * COUNT);
+    float* src2 = (float*)malloc(sizeof(float) * COUNT);
+    float* dst  = (float*)malloc(sizeof(float) * COUNT);
+    float* ref  = (float*)malloc(sizeof(float) * COUNT);
+    mn_stream_config_t cfg;
+    mn_stream_map_t map;
+
+    if (!src1 || !src2 || !dst || !ref) {
+        fprintf(stderr, "malloc failed!\n");
+        return 1;
+    }
+
+    for (size_t i = 0; i < COUNT; i++) {
+        src1[i] = (float)i * ((i % 2) ? -0.5f : 0.25f);
+        src2[i] = (float)(COUNT - i) * 0.125f;
+    }
+
+    // ==== 1. Arrays, chunked ====
+    mn_add_float_c(ref, src1, src2, COUNT);
+    for (int io = 0; io < 2; io++) {
+        cfg.chunk_bytes = 4096;
+        cfg.advise = 1;
+        cfg.io_thread = io;
+        memset(dst, 0, sizeof(float) * COUNT);
+        if (mn_stream_binary(dst, src1, src2, COUNT, sizeof(float), MN_STREAM_BINARY(mn_add_float_neon), &cfg) != MN_SUCCESS) {
+            printf("mn_stream_binary returned an error (io_thread=%d)\n", io);
+            failed = 1;
+        }
+        failed |= compare(io ? "stream_binary (io thread)" : "stream_binary", dst, ref, COUNT);
+    }
+
+    // ==== 2. Memory-mapped file ====
+    if (mn_stream_map_file(&map, MAP_PATH, sizeof(float) * COUNT, 1) != MN_SUCCESS) {
+        printf("mn_stream_map_file (write) failed\n");
+        failed = 1;
+    } else {
+        memcpy(map.data, src1, sizeof(float) * COUNT);
+        mn_stream_unmap(&map);
+
+        if (mn_stream_map_file(&map, MAP_PATH, 0, 0) != MN_SUCCESS || map.size != sizeof(float) * COUNT) {
+            printf("mn_stream_map_file (read) failed\n");
+            failed = 1;
+        } else {
+            mn_abs_float_c(ref, src1, COUNT);
+            cfg.chunk_bytes = 8192;
+            cfg.advise = 1;
+            cfg.io_thread = 1;
+            mn_stream_unary(dst, map.data, COUNT, sizeof(float), MN_STREAM_UNARY(mn_abs_float_neon), &cfg);
+            failed |= compare("stream_unary (mapped file)", dst, ref, COUNT);
+            mn_stream_unmap(&map);
+        }
+        remove(MAP_PATH);
+    }
+
+    // ==== 3. Chunked input ====
+    {
+        float k = -1.5f;
+        mn_mulc_float_c(ref, src1, k, COUNT);
+        for (int io = 0; io < 2; io++) {
+            mem_stream_t m = { src1, NULL, dst, COUNT, 0, 0 };
+            cfg.chunk_bytes = 1000;
+            cfg.advise = 0;
+            cfg.io_thread = io;
+            memset(dst, 0, sizeof(float) * COUNT);
+            mn_stream_chunks(mem_read, &m, mem_write, &m, sizeof(float), 1, mulc_kernel, &k, &cfg);
+            if (m.written != COUNT) {
+                printf("stream_chunks wrote %zu of %d elements\n", m.written, COUNT);
+                failed = 1;
+            }
+            failed |= compare(io ? "stream_chunks (io thread)" : "stream_chunks", dst, ref, COUNT);
+        }
+
+        mn_sub_float_c(ref, src1, src2, COUNT);
+        {
+            mn_stream_binary_fn op = MN_STREAM_BINARY(mn_sub_float_neon);
+            mem_stream_t m = { src1, src2, dst, COUNT, 0, 0 };
+            cfg.io_thread = 1;
+            mn_stream_chunks(mem_read, &m, mem_write, &m, sizeof(float), 2, mn_stream_binary_kernel, &op, &cfg);
+            failed |= compare("stream_chunks (two sources)", dst, ref, COUNT);
+        }
+    }
+
+    if (!failed) {
+        printf("All stream tests passed!\n");
+    }
+    free(src1); free(src2); free(dst); free(ref);
+    return failed;
+}
@@ -0,0 +1,219 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../includes/MN_dtype.h"
+#include "../includes/MN_macro.h"
+#include "../includes/MN_math.h"
+#include "MN_test.h"
+
+/*
+    sin / cos / sincos / tan / atan2 tests:
+      1. The C versions give the libm results.
+      2. NEON against a double precision reference on small, medium, near
+         multiples of pi/2 and huge (libm path) arguments, within the
+         documented ULP bounds; atan2 over every octant and ratios from 2^-30
+         to 2^30.
+      3. sincos gives the same values as sin and cos.
+      4. Special values (+-0, inf, NaN, subnormal, FLT_MAX) match libm.
+      5. Counts 0 .. 40 and in-place calls give the same values as one long call.
+*/
+
+#define N 4099
+
+typedef mn_result_t (*unary_fn)(mn_float32_t *, mn_float32_t *, size_t);
+
+/* error of got in units of the last place of the float nearest to ref */
+typedef struct
+{
+    const char *name;
+    unary_fn c, neon;
+    float (*libm)(float);
+    double (*ref)(double);
+    double ulp;
+} unary_case_t;
+
+static const unary_case_t unary_cases[] = {
+    { "sin", mn_sin_float_c, mn_sin_float_neon, sinf, sin, 2.5 },
+    { "cos", mn_cos_float_c, mn_cos_float_neon, cosf, cos, 2.5 },
+    { "tan", mn_tan_float_c, mn_tan_float_neon, tanf, tan, 3.5 },
+};
+
+static void fill_angles(mn_float32_t *x)
+{
+    for (size_t i = 0; i < N; i++) {
+        switch (i % 4) {
+        case 0: x[i] = mn_test_uniform(-4.0f, 4.0f); break;
+        case 1: x[i] = mn_test_uniform(-2e5f, 2e5f); break;
+        /* next to a multiple of pi/2, where the reduction cancels most bits */
+        case 2: x[i] = (mn_float32_t)((double)(int)mn_test_uniform(-8e4f, 8e4f) * 1.57079632679489662); break;
+        default: x[i] = i % 8 == 3 ? mn_test_uniform(-1e30f, 1e30f) : mn_test_uniform(-1e-3f, 1e-3f); break;
+        }
+    }
+}
+
+static int check_unary(const unary_case_t *uc)
+{
+    static mn_float32_t x[N], yc[N], yn[N], y2[N];
+    double worst = 0.0;
+    size_t at = 0;
+    int fail = 0;
+
+    fill_angles(x);
+    fail |= uc->c(yc, x, N) != MN_SUCCESS;
+    fail |= uc->neon(yn, x, N) != MN_SUCCESS;
+    for (size_t i = 0; i < N; i++) {
+        if (memcmp(&yc[i], &(mn_float32_t){ uc->libm(x[i]) }, sizeof(mn_float32_t)) != 0) {
+            printf("%s_c differs from libm at %g\n", uc->name, x[i]);
+            return 1;
+        }
+        const double err = mn_test_ulp_error(yn[i], uc->ref(x[i]));
+        if (err > worst) { worst = err; at = i; }
+    }
+    if (worst > uc->ulp) {
+        printf("%s failed at %a: NEON=%a, Reference=%a (%g ULP)\n", uc->name, x[at], yn[at], uc->ref(x[at]), worst);
+        fail = 1;
+    }
+
+    /* short counts and in place give the same values as the long call */
+    for (size_t count = 0; count <= 40; count++) {
+        memcpy(y2, x + 7, count * sizeof(mn_float32_t));
+        uc->neon(y2, y2, count);
+        if (count && memcmp(y2, yn + 7, count * sizeof(mn_float32_t)) != 0) {
+            printf("%s count=%zu in-place differs from the long call\n", uc->name, count);
+            fail = 1;
+            break;
+        }
+    }
+    return fail;
+}
+
+static int check_sincos(void)
+{
+    static mn_float32_t x[N], s[N], c[N], s1[N], c1[N];
+    int fail = 0;
+
+    fill_angles(x);
+    mn_sin_float_neon(s1, x, N);
+    mn_cos_float_neon(c1, x, N);
+    fail |= mn_sincos_float_neon(s, c, x, N) != MN_SUCCESS;
+    fail |= memcmp(s, s1, sizeof(s)) != 0 || memcmp(c, c1, sizeof(c)) != 0;
+    mn_sincos_float_c(s, c, x, N);
+    for (size_t i = 0; i < N; i++) {
+        fail |= s[i] != sinf(x[i]) || c[i] != cosf(x[i]);
+    }
+    for (size_t count = 0; count <= 40 && !fail; count++) {
+        memcpy(s, x + 3, count * sizeof(mn_float32_t));
+        mn_sincos_float_neon(s, c, s, count);
+        fail |= memcmp(s, s1 + 3, count * sizeof(mn_float32_t)) != 0;
+        fail |= memcmp(c, c1 + 3, count * sizeof(mn_float32_t)) != 0;
+    }
+    if (fail) printf("sincos differs from sin / cos\n");
+    return fail;
+}
+
+static int check_atan2(void)
+{
+    static mn_float32_t y[N], x[N], rc[N], rn[N], r2[N];
+    double worst = 0.0;
+    size_t at = 0;
+    int fail = 0;
+
+    for (size_t i = 0; i < N; i++) {
+        const int scale = (int)(i % 61) - 30;
+        y[i] = ldexpf(mn_test_uniform(-1.0f, 1.0f), i % 2 ? scale : 0);
+        x[i] = ldexpf(mn_test_uniform(-1.0f, 1.0f), i % 2 ? 0 : scale);
+    }
+    fail |= mn_atan2_float_c(rc, y, x, N) != MN_SUCCESS;
+    fail |= mn_atan2_float_neon(rn, y, x, N) != MN_SUCCESS;
+    for (size_t i = 0; i < N; i++) {
+        if (rc[i] != atan2f(y[i], x[i])) {
+            printf("atan2_c differs from libm at %a, %a\n", y[i], x[i]);
+            return 1;
+        }
+        const double err = mn_test_ulp_error(rn[i], atan2((double)y[i], (double)x[i]));
+        if (err > worst) { worst = err; at = i; }
+    }
+    if (worst > 3.0) {
+        printf("atan2 failed at %a, %a: NEON=%a, Reference=%a (%g ULP)\n", y[at], x[at], rn[at],
+               atan2((double)y[at], (double)x[at]), worst);
+        fail = 1;
+    }
+    for (size_t count = 0; count <= 40; count++) {
+        memcpy(r2, x + 5, count * sizeof(mn_float32_t));
+        mn_atan2_float_neon(r2, y + 5, r2, count);
+        if (count && memcmp(r2, rn + 5, count * sizeof(mn_float32_t)) != 0) {
+            printf("atan2 count=%zu in-place differs from the long call\n", count);
+            fail = 1;
+            break;
+        }
+    }
+    return fail;
+}
+
+static int check_special(void)
+{
+    const mn_float32_t sp[] = {
+        0.0f, -0.0f, INFINITY, -INFINITY, NAN, 1e-40f, -1e-40f, 3.4028235e38f, -3.4028235e38f,
+        8192.0f, -8192.0f, 8193.0f, 131072.0f, 131073.0f, 1e10f, 1.5707964f, -1.5707964f, 3.1415927f,
+    };
+    const size_t n = sizeof(sp) / sizeof(sp[0]);
+    mn_float32_t x[32], y[32], s[32], c[32];
+    int fail = 0;
+
+    memcpy(x, sp, sizeof(sp));
+    for (size_t k = 0; k < sizeof(unary_cases) / sizeof(unary_cases[0]); k++) {
+        const unary_case_t *uc = &unary_cases[k];
+        uc->neon(y, x, n);
+        for (size_t i = 0; i < n; i++) {
+            const mn_float32_t want = uc->libm(x[i]);
+            const int ok = isnan(want) ? isnan(y[i])
+                         : want == 0.0f ? memcmp(&y[i], &want, sizeof(want)) == 0
+                         : mn_test_ulp_error(y[i], uc->ref(x[i])) <= uc->ulp;
+            if (!ok) {
+                printf("%s special %a: NEON=%a, libm=%a\n", uc->name, x[i], y[i], want);
+                fail = 1;
+            }
+        }
+    }
+    mn_sincos_float_neon(s, c, x, n);
+    mn_sin_float_neon(y, x, n);
+    fail |= memcmp(s, y, n * sizeof(mn_float32_t)) != 0;
+    mn_cos_float_neon(y, x, n);
+    fail |= memcmp(c, y, n * sizeof(mn_float32_t)) != 0;
+
+    /* every pair of the values below, signed zeros and infinities included */
+    const mn_float32_t av[] = { 0.0f, -0.0f, 1.0f, -1.0f, 1e-40f, -3e-39f, 2.5f, 1e38f, -1e38f, INFINITY, -INFINITY, NAN };
+    const size_t na = sizeof(av) / sizeof(av[0]);
+    mn_float32_t ay[144], ax[144], r[144];
+    for (size_t i = 0; i < na; i++) {
+        for (size_t j = 0; j < na; j++) { ay[i * na + j] = av[i]; ax[i * na + j] = av[j]; }
+    }
+    mn_atan2_float_neon(r, ay, ax, na * na);
+    for (size_t i = 0; i < na * na; i++) {
+        const mn_float32_t want = atan2f(ay[i], ax[i]);
+        const int ok = isnan(want) ? isnan(r[i])
+                     : want == 0.0f ? memcmp(&r[i], &want, sizeof(want)) == 0
+                     : mn_test_ulp_error(r[i], atan2((double)ay[i], (double)ax[i])) <= 3.0;
+        if (!ok) {
+            printf("atan2 special %a, %a: NEON=%a, libm=%a\n", ay[i], ax[i], r[i], want);
+            fail = 1;
+        }
+    }
+    return fail;
+}
+
+int main(void)
+{
+    int fail = 0;
+
+    mn_test_seed(11u);
+    for (size_t i = 0; i < sizeof(unary_cases) / sizeof(unary_cases[0]); i++) fail |= check_unary(&unary_cases[i]);
+    fail |= check_sincos();
+    fail |= check_atan2();
+    fail |= check_special();
+
+    if (fail) return 1;
+    printf("All sin / cos / tan / atan2 tests passed\n");
+    return 0;
+}